@@ -0,0 +1,64 @@
+// bench_edit.h
+//
+// What the diff benches share: a second revision of a file made in memory
+// out of known edits, each replacing a byte range of the original, and the
+// check that a diff lists exactly the changes those edits should give.
+//
+//   std::vector<nvtools::Edit> edits{{at, at + old.size(), "new"}};
+//   std::string edited = nvtools::apply_edits(source, edits);
+//   ok = nvtools::same_lines(want, got);    // prints both when they differ
+
+#ifndef NVTOOLS_BENCH_EDIT_H
+#define NVTOOLS_BENCH_EDIT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace nvtools {
+
+struct Edit {
+    size_t begin;
+    size_t end;
+    std::string text;
+};
+
+// Where text, a view into source, starts in it.
+inline size_t offset_in(std::string_view source, std::string_view text)
+{
+    return size_t(text.data() - source.data());
+}
+
+// source with the edits made; they may come in any order, but must not
+// overlap.
+inline std::string apply_edits(std::string_view source, std::vector<Edit> edits)
+{
+    std::sort(edits.begin(), edits.end(), [](const Edit& a, const Edit& b) { return a.begin < b.begin; });
+    std::string out;
+    size_t at = 0;
+    for (const Edit& e : edits) {
+        out.append(source.substr(at, e.begin - at));
+        out += e.text;
+        at = e.end;
+    }
+    out.append(source.substr(at));
+    return out;
+}
+
+// Whether got is want, line for line; prints the two side by side if not.
+inline bool same_lines(const std::vector<std::string>& want, const std::vector<std::string>& got)
+{
+    if (got == want)
+        return true;
+    for (size_t i = 0; i < std::max(got.size(), want.size()); ++i)
+        std::fprintf(stderr, "want %-60s got %s\n", i < want.size() ? want[i].c_str() : "",
+                     i < got.size() ? got[i].c_str() : "");
+    return false;
+}
+
+} // namespace nvtools
+
+#endif // NVTOOLS_BENCH_EDIT_H
@@ -0,0 +1,111 @@
+// bench_nvapi_avail.cpp
+//
+// Times reach() over many build profiles, each pinning a random set of the
+// config symbols the dump tests, and fails if a profile takes longer than
+// the budget on average:
+//
+//   bench_nvapi_avail nvapi.snap [budget us, default 5] [profiles, default 20000]
+//
+// The first few hundred answers are checked against every way of pinning
+// the symbols a profile leaves open: maybe has to be the union of those
+// answers and always their intersection.
+
+#include "nvapi_avail.h"
+#include "nvapi_snapshot.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    if (argc < 2 || argc > 4) {
+        std::fprintf(stderr, "usage: bench_nvapi_avail <snapshot> [budget us] [profiles]\n");
+        return 2;
+    }
+    double budget = argc > 2 ? std::atof(argv[2]) : 5.0;
+    int profiles = argc > 3 ? std::atoi(argv[3]) : 20000;
+    if (profiles < 1)
+        profiles = 1;
+
+    nvapi::Snapshot snap;
+    std::string why;
+    if (!snap.open(argv[1], &why)) {
+        std::fprintf(stderr, "error: %s: %s\n", argv[1], why.c_str());
+        return 1;
+    }
+    std::vector<nvapi::Section> sections;
+    for (size_t i = 0; i < snap.size(); ++i)
+        sections.push_back(snap.section(i));
+    nvapi::AvailabilityIndex idx = nvapi::AvailabilityIndex::build(sections);
+    const std::vector<std::string>& symbols = idx.symbols();
+    if (symbols.size() > 16) {
+        std::fprintf(stderr, "error: %zu config symbols, too many to check exhaustively\n", symbols.size());
+        return 1;
+    }
+
+    // Each symbol on, off or open: two bits per symbol of a random word.
+    unsigned seed = 12345;
+    auto rnd = [&] { return seed = seed * 1103515245u + 12345u, seed >> 8; };
+    auto profile_of = [&](uint32_t on, uint32_t off) {
+        nvapi::Profile p;
+        for (size_t s = 0; s < symbols.size(); ++s)
+            if ((on | off) & (1u << s))
+                p.set(symbols[s], (on >> s) & 1);
+        return p;
+    };
+
+    size_t wrong = 0, checked = 0;
+    nvapi::Reachability r, exact;
+    for (int n = 0; n < 300; ++n) {
+        uint32_t on = rnd() & ((1u << symbols.size()) - 1);
+        uint32_t off = rnd() & ~on & ((1u << symbols.size()) - 1);
+        if (n == 0)
+            on = off = 0;
+        idx.reach(profile_of(on, off), r);
+        uint32_t open = ~(on | off) & ((1u << symbols.size()) - 1);
+        std::vector<bool> any(sections.size(), false), all(sections.size(), true);
+        // Every subset of the open symbols switched on.
+        for (uint32_t sub = open;; sub = (sub - 1) & open) {
+            idx.reach(profile_of(on | sub, off | (open & ~sub)), exact);
+            for (size_t i = 0; i < sections.size(); ++i) {
+                any[i] = any[i] || exact.maybe.test(i);
+                all[i] = all[i] && exact.always.test(i);
+            }
+            if (sub == 0)
+                break;
+        }
+        for (size_t i = 0; i < sections.size(); ++i)
+            wrong += r.maybe.test(i) != any[i] || r.always.test(i) != all[i];
+        ++checked;
+    }
+    if (wrong) {
+        std::fprintf(stderr, "error: %zu settings answered differently from pinning every symbol\n", wrong);
+        return 1;
+    }
+
+    std::vector<nvapi::Profile> batch;
+    for (int n = 0; n < profiles; ++n) {
+        uint32_t on = rnd() & ((1u << symbols.size()) - 1);
+        batch.push_back(profile_of(on, rnd() & ~on & ((1u << symbols.size()) - 1)));
+    }
+    using Clock = std::chrono::steady_clock;
+    auto t0 = Clock::now();
+    size_t reachable = 0;
+    for (const nvapi::Profile& p : batch) {
+        idx.reach(p, r);
+        reachable += r.maybe.words()[0] & 1;
+    }
+    double us = std::chrono::duration<double, std::micro>(Clock::now() - t0).count() / profiles;
+    std::printf("%zu settings, %zu config symbols, %zu distinct clauses (%zu not parsed)\n", sections.size(),
+                symbols.size(), idx.predicate_count(), idx.unparsed_count());
+    std::printf("%zu profiles checked exhaustively, %d timed: %.2f us per profile, budget %.1f us (%zu)\n", checked,
+                profiles, us, budget, reachable);
+    if (us > budget) {
+        std::fprintf(stderr, "error: over budget\n");
+        return 1;
+    }
+    return 0;
+}
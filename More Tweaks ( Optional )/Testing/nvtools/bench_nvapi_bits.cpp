@@ -0,0 +1,121 @@
+// bench_nvapi_bits.cpp
+//
+// Builds a BitfieldPlan for every bitfield setting in a snapshot, then
+// decodes values made of each key's own symbols plus some stray bits, and
+// fails if it manages fewer than the budget per second:
+//
+//   bench_nvapi_bits nvapi.snap [budget, millions of decodes/s, default 5] [values, default 2000000]
+//
+// Every value is also encoded back from its decoded names, and any that
+// does not come back the same is an error.
+
+#include "nvapi_bits.h"
+#include "nvapi_snapshot.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    if (argc < 2 || argc > 4) {
+        std::fprintf(stderr, "usage: bench_nvapi_bits <snapshot> [budget M/s] [values]\n");
+        return 2;
+    }
+    double budget = argc > 2 ? std::atof(argv[2]) : 5.0;
+    long count = argc > 3 ? std::atol(argv[3]) : 2000000;
+    if (count < 1)
+        count = 1;
+
+    nvapi::Snapshot snap;
+    std::string why;
+    if (!snap.open(argv[1], &why)) {
+        std::fprintf(stderr, "error: %s: %s\n", argv[1], why.c_str());
+        return 1;
+    }
+
+    using Clock = std::chrono::steady_clock;
+    auto t0 = Clock::now();
+    std::vector<nvapi::BitfieldPlan> plans;
+    std::vector<std::vector<uint32_t>> symbol_values;
+    nvapi::SectionRecord r;
+    for (size_t i = 0; i < snap.size(); ++i) {
+        nvapi::Section s = snap.section(i);
+        if (!s.bitfields)
+            continue;
+        snap.read(i, r);
+        plans.push_back(nvapi::BitfieldPlan::build(r));
+        std::vector<uint32_t> values;
+        for (uint32_t k = 0; k < s.symbol_count; ++k)
+            if (auto v = snap.number(s, k); v && *v <= 0xffffffffu)
+                values.push_back(uint32_t(*v));
+        symbol_values.push_back(values);
+    }
+    double build_ms = std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+    if (plans.empty()) {
+        std::fprintf(stderr, "error: %s has no bitfield settings\n", argv[1]);
+        return 1;
+    }
+
+    // A few of each key's symbols OR-ed together, and now and then a stray bit.
+    std::mt19937 rng(12345);
+    std::vector<uint32_t> key(static_cast<size_t>(count)), value(static_cast<size_t>(count));
+    for (long i = 0; i < count; ++i) {
+        key[i] = uint32_t(rng() % plans.size());
+        const std::vector<uint32_t>& sv = symbol_values[key[i]];
+        uint32_t v = 0;
+        for (int n = int(rng() % 4); n > 0 && !sv.empty(); --n)
+            v |= sv[rng() % sv.size()];
+        if (rng() % 8 == 0)
+            v |= 1u << (rng() % 32);
+        value[i] = v;
+    }
+
+    nvapi::BitDecode d;
+    uint64_t parts = 0;
+    t0 = Clock::now();
+    for (long i = 0; i < count; ++i) {
+        plans[key[i]].decode(value[i], d);
+        parts += d.count;
+    }
+    double secs = std::chrono::duration<double>(Clock::now() - t0).count();
+    double rate = double(count) / secs / 1e6;
+
+    long bad = 0;
+    std::vector<std::string> text;
+    std::vector<std::string_view> names;
+    for (long i = 0; i < count && i < 200000; ++i) {
+        const nvapi::BitfieldPlan& p = plans[key[i]];
+        p.decode(value[i], d);
+        text.clear();
+        names.clear();
+        for (uint32_t k = 0; k < d.count; ++k)
+            text.push_back(d.parts[k].field_value ? std::string(d.parts[k].name) + "=" + std::to_string(*d.parts[k].field_value)
+                                                  : std::string(d.parts[k].name));
+        for (const std::string& t : text)
+            names.push_back(t);
+        std::optional<uint32_t> back = p.encode(names, &why);
+        uint32_t want = value[i] & p.mask() & ~d.unnamed;
+        if (!back || *back != want) {
+            if (bad++ < 5)
+                std::fprintf(stderr, "mismatch: %.*s 0x%08x -> %s -> %s\n", int(p.key().size()), p.key().data(),
+                             value[i], nvapi::format_bits(d).c_str(), back ? std::to_string(*back).c_str() : why.c_str());
+        }
+    }
+
+    std::printf("%zu bitfield keys, plans built in %.3f ms\n", plans.size(), build_ms);
+    std::printf("%ld values, %.2f parts each, %.1f M decodes/s, budget %.1f M/s\n", count,
+                double(parts) / double(count), rate, budget);
+    if (bad) {
+        std::fprintf(stderr, "error: %ld values did not encode back\n", bad);
+        return 1;
+    }
+    if (rate < budget) {
+        std::fprintf(stderr, "error: under budget\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,181 @@
+// bench_nvapi_bulk.cpp
+//
+// Generates application profiles for many executables from a handful of
+// shared blocks, streams them to a temporary file, and fails if that takes
+// longer than the budget:
+//
+//   bench_nvapi_bulk [budget ms, default 1000] [profiles, default 10000]
+//
+// The same manifest cut to a quarter of the profiles is run first. Memory
+// has to stay flat: both runs have to end with the same blocks in the pool
+// and hold no more than one profile's bytes before a write. The file is
+// read back and every profile checked for its name, executables and the
+// settings its blocks give it.
+
+#include "nvapi_bulk.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+constexpr int kBlocks = 4;
+constexpr int kLists = 12;
+
+// Block b has 12 settings, IDs overlapping with the next block's, so
+// layering replaces some.
+std::vector<nvapi::BlockSetting> block(int b)
+{
+    std::vector<nvapi::BlockSetting> s;
+    for (uint32_t i = 0; i < 12; ++i) {
+        uint32_t id = 0x10000000 + uint32_t(b) * 8 + i;
+        s.push_back({id, i % 3 ? "" : "Setting " + std::to_string(id), std::to_string(b * 100 + int(i)), "Dword"});
+    }
+    return s;
+}
+
+// The blocks column of profile p, and what it layers to. The last list
+// repeats a block, which has to intern to the same block as the block
+// alone.
+std::string list_of(long p)
+{
+    int l = int(p % kLists);
+    if (l == kLists - 1)
+        return "b0+b0";
+    std::string s = "b" + std::to_string(l % kBlocks);
+    if (l >= kBlocks)
+        s += "+b" + std::to_string((l + 1) % kBlocks);
+    if (l >= 2 * kBlocks)
+        s += "+b" + std::to_string((l + 2) % kBlocks);
+    return s;
+}
+
+std::vector<std::pair<uint32_t, std::string>> expected(const std::string& list)
+{
+    std::vector<std::pair<uint32_t, std::string>> out;
+    for (size_t at = 0; at < list.size();) {
+        size_t plus = list.find('+', at);
+        int b = std::atoi(list.c_str() + at + 1);
+        for (const nvapi::BlockSetting& s : block(b)) {
+            bool replaced = false;
+            for (auto& e : out)
+                if (e.first == s.id) {
+                    e.second = s.value;
+                    replaced = true;
+                }
+            if (!replaced)
+                out.push_back({s.id, s.value});
+        }
+        at = plus == std::string::npos ? list.size() : plus + 1;
+    }
+    std::sort(out.begin(), out.end());
+    return out;
+}
+
+std::string manifest(long profiles)
+{
+    std::string m = "# bench\n";
+    for (long p = 0; p < profiles; ++p) {
+        std::string n = std::to_string(p);
+        m += "profile\tGame " + n + (p % 5 ? "" : " & Friends") + "\t" + list_of(p) + "\tgame" + n + ".exe";
+        if (p % 3 == 0)
+            m += "\tlauncher" + n + ".exe";
+        m += '\n';
+    }
+    return m;
+}
+
+bool generate(const std::string& text, std::string& out, nvapi::BulkStats& st, double& ms)
+{
+    nvapi::BulkGenerator gen{nvapi::NipFormat()};
+    for (int b = 0; b < kBlocks; ++b)
+        gen.add_block("b" + std::to_string(b), block(b));
+    FILE* f = std::tmpfile();
+    if (!f)
+        return false;
+    std::string why;
+    auto t0 = std::chrono::steady_clock::now();
+    bool ok = gen.run(text, "", f, &st, &why);
+    ok = std::fflush(f) == 0 && ok;
+    ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    if (!ok) {
+        std::fprintf(stderr, "error: %s\n", why.c_str());
+        std::fclose(f);
+        return false;
+    }
+    out.resize(size_t(st.bytes));
+    std::rewind(f);
+    ok = std::fread(&out[0], 1, out.size(), f) == out.size();
+    std::fclose(f);
+    return ok;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc > 3) {
+        std::fprintf(stderr, "usage: bench_nvapi_bulk [budget ms] [profiles]\n");
+        return 2;
+    }
+    double budget = argc > 1 ? std::atof(argv[1]) : 1000.0;
+    long profiles = argc > 2 ? std::atol(argv[2]) : 10000;
+    if (profiles < 4 * kLists)
+        profiles = 4 * kLists;
+
+    std::string file, small_file;
+    nvapi::BulkStats st, small;
+    double ms, small_ms;
+    if (!generate(manifest(profiles / 4), small_file, small, small_ms)
+        || !generate(manifest(profiles), file, st, ms)) {
+        std::fprintf(stderr, "error: generating failed\n");
+        return 1;
+    }
+
+    nvapi::NipFile nip;
+    std::string why;
+    if (!nvapi::read_nip(file, nip, &why)) {
+        std::fprintf(stderr, "error: the output is not a .nip file: %s\n", why.c_str());
+        return 1;
+    }
+    size_t wrong = nip.profile_count() != size_t(profiles);
+    std::vector<std::vector<std::pair<uint32_t, std::string>>> want(kLists);
+    for (int l = 0; l < kLists; ++l)
+        want[size_t(l)] = expected(list_of(l));
+    for (uint32_t p = 0; p < nip.profile_count() && !wrong; ++p) {
+        std::string n = std::to_string(p);
+        wrong += nip.profile_name[p] != "Game " + n + (p % 5 ? "" : " &amp; Friends");
+        wrong += nip.exe_begin[p + 1] - nip.exe_begin[p] != (p % 3 ? 1u : 2u)
+            || nip.exes[nip.exe_begin[p]] != "game" + n + ".exe";
+        const auto& w = want[p % kLists];
+        uint32_t first = nip.setting_begin[p];
+        wrong += nip.setting_begin[p + 1] - first != w.size();
+        for (size_t i = 0; i < w.size() && !wrong; ++i)
+            wrong += nip.setting_id[first + i] != w[i].first || nip.setting_value[first + i] != w[i].second;
+    }
+
+    std::printf("%zu profiles, %zu executables, %zu settings from %zu blocks (%zu block lists), %.1f MB\n",
+                st.profiles, st.exes, st.settings, st.blocks, st.block_lists, double(st.bytes) / 1e6);
+    std::printf("generate %.1f ms (budget %.0f ms), a quarter of it %.1f ms; largest write %zu bytes, %zu for a"
+                " quarter\n",
+                ms, budget, small_ms, st.buffer_peak, small.buffer_peak);
+    if (wrong) {
+        std::fprintf(stderr, "error: a profile came back wrong\n");
+        return 1;
+    }
+    // b0+b0 is b0, so one list fewer than there are lists.
+    if (st.blocks != small.blocks || st.blocks != size_t(kLists - 1) || st.buffer_peak > 2 * small.buffer_peak) {
+        std::fprintf(stderr, "error: memory grew with the profile count\n");
+        return 1;
+    }
+    if (ms > budget) {
+        std::fprintf(stderr, "error: over budget\n");
+        return 1;
+    }
+    return 0;
+}
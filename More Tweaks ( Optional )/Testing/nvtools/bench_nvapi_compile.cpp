@@ -0,0 +1,225 @@
+// bench_nvapi_compile.cpp
+//
+// Writes a checklist with a line for every setting the join index has an ID
+// for, compiles it and checks each setting came out with the value its line
+// was written for. Fails if the best compile is over budget:
+//
+//   bench_nvapi_compile nvapi.join nvapi.snap ../../nvidiaProfileInspector/Reference.xml
+//                       [budget ms, default 2] [runs, default 20]
+//
+// A setting with value names is written by one of them, in turn as it is,
+// with a note, after its hex number and with the number in () after it. A
+// setting without is written as a decimal with a fraction of zeros, the way
+// the checklists write "0.00". Then a few lines that have to be problems: an
+// unknown name, a setting with no ID, "N/A", a fraction, and a setting given
+// a second, different value.
+
+#include "mapped_file.h"
+#include "nvapi_compile.h"
+#include "nvapi_value.h"
+#include "text_util.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace {
+
+using nvtools::iequals;
+using nvtools::trim;
+
+std::string hex(uint32_t v)
+{
+    char buf[16];
+    std::snprintf(buf, sizeof buf, "0x%08X", v);
+    return buf;
+}
+
+std::string dword_text(uint32_t v)
+{
+    std::string out;
+    nvapi::format_nip(nvapi::Value::dword(v), out);
+    return out;
+}
+
+// A value name the compiler has to take as written: no entity, no note or
+// colon, nothing that reads as a number.
+bool plain_name(std::string_view name)
+{
+    return !name.empty() && name.find_first_of("&:()[]") == std::string_view::npos
+        && !(name[0] >= '0' && name[0] <= '9') && name[0] != '+' && name[0] != '-';
+}
+
+struct Expected {
+    std::string value;
+    uint32_t line;
+};
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 4 || argc > 6) {
+        std::fprintf(stderr, "usage: bench_nvapi_compile <join index> <snapshot> <names.xml> [budget ms] [runs]\n");
+        return 2;
+    }
+    double budget = argc > 4 ? std::atof(argv[4]) : 2.0;
+    int runs = argc > 5 ? std::atoi(argv[5]) : 20;
+    if (runs < 1)
+        runs = 1;
+
+    nvapi::JoinIndex idx;
+    nvapi::Snapshot snap;
+    nvtools::MappedFile names_file;
+    nvapi::CustomNames names;
+    std::string why;
+    if (!idx.open(argv[1], &why) || !snap.open(argv[2], &why)) {
+        std::fprintf(stderr, "error: %s\n", why.c_str());
+        return 1;
+    }
+    if (snap.size() != idx.dump_size()) {
+        std::fprintf(stderr, "error: %s was built against another dump than %s\n", argv[1], argv[2]);
+        return 1;
+    }
+    if (!names_file.open(argv[3]) || !nvapi::read_custom_names(names_file.view(), names, &why)) {
+        std::fprintf(stderr, "error: %s: %s\n", argv[3], why.empty() ? "cannot read" : why.c_str());
+        return 1;
+    }
+    nvapi::ChecklistCompiler compiler(idx, &snap);
+    compiler.add_names(names);
+
+    // The first setting to name an ID's values is the one the compiler uses.
+    std::map<uint32_t, const nvapi::CustomSetting*> named;
+    for (const nvapi::CustomSetting& s : names.settings)
+        if (s.value_count)
+            named.emplace(s.id, &s);
+
+    std::string text = "Bench\n-----\n";
+    uint32_t line = 2;
+    std::map<uint32_t, Expected> want;
+    std::vector<std::string> no_names;      // resolvable as a number, and no value names
+    std::string no_id;
+    size_t written = 0;
+    nvapi::SectionRecord rec;
+    for (uint32_t e = 0; e < idx.size(); ++e) {
+        nvapi::JoinEntry j = idx.entry(e);
+        if (j.name.find(": ") != std::string_view::npos || j.name.find(" - 0x") != std::string_view::npos
+            || trim(j.name) != j.name || idx.by_name(j.name) != e)
+            continue;
+        if (!j.has_id) {
+            if (no_id.empty())
+                no_id = std::string(j.name);
+            continue;
+        }
+        if (want.count(j.id))
+            continue;
+        bool dword = j.section == nvapi::kNoSection;
+        if (!dword) {
+            snap.read(j.section, rec);
+            dword = rec.section.type == nvapi::ValueType::Dword && !rec.section.names_only;
+        }
+
+        auto n = named.find(j.id);
+        if (n == named.end()) {
+            if (!dword)
+                continue;
+            uint32_t v = uint32_t(written % 100);
+            text += std::string(j.name) + ": " + std::to_string(v) + ".00\n";
+            want[j.id] = {dword_text(v), ++line};
+            no_names.push_back(std::string(j.name));
+            ++written;
+            continue;
+        }
+        const nvapi::CustomSetting& s = *n->second;
+        const nvapi::CustomValue& cv = names.values[s.value_begin + uint32_t(written % s.value_count)];
+        std::string_view name = trim(cv.name);
+        if (!plain_name(name))
+            continue;
+        // A name that a value before it has too gives that value.
+        uint32_t v = 0;
+        for (uint32_t i = s.value_begin; i < s.value_begin + s.value_count; ++i)
+            if (iequals(trim(names.values[i].name), name)) {
+                v = uint32_t(std::strtoul(std::string(trim(names.values[i].hex)).c_str(), nullptr, 16));
+                break;
+            }
+        int form = dword ? int(written % 4) : int(written % 2);
+        std::string value = form == 0 ? std::string(name)
+            : form == 1               ? std::string(name) + " (bench note)"
+            : form == 2               ? hex(v) + " " + std::string(name)
+                                      : std::string(name) + " (" + hex(v) + ")";
+        text += std::string(j.name) + ": " + value + "\n";
+        want[j.id] = {dword_text(v), ++line};
+        ++written;
+    }
+    if (no_names.size() < 3) {
+        std::fprintf(stderr, "error: the index has too few settings to check\n");
+        return 1;
+    }
+    // The problems, with the line each has to be reported on.
+    std::vector<std::pair<nvapi::CompileProblem, uint32_t>> problems;
+    text += "Bench Setting No Driver Has: On\n";
+    problems.push_back({nvapi::CompileProblem::UnknownSetting, ++line});
+    if (!no_id.empty()) {
+        text += no_id + ": 1\n";
+        problems.push_back({nvapi::CompileProblem::NoId, ++line});
+    }
+    text += no_names[0] + ": N/A\n";
+    problems.push_back({nvapi::CompileProblem::UnknownValue, ++line});
+    text += no_names[1] + ": 0.50\n";
+    problems.push_back({nvapi::CompileProblem::UnknownValue, ++line});
+    text += no_names[2] + ": 123456.00\n";
+    problems.push_back({nvapi::CompileProblem::Duplicate, ++line});
+
+    nvapi::Checklist list;
+    if (!nvapi::read_checklist(text, list, &why)) {
+        std::fprintf(stderr, "error: the checklist does not read: %s\n", why.c_str());
+        return 1;
+    }
+    using Clock = std::chrono::steady_clock;
+    std::vector<double> times;
+    nvapi::CompiledProfile p;
+    for (int r = 0; r < runs; ++r) {
+        auto t0 = Clock::now();
+        compiler.compile(list, p);
+        times.push_back(std::chrono::duration<double, std::milli>(Clock::now() - t0).count());
+    }
+    std::sort(times.begin(), times.end());
+    double best = times.front();
+
+    size_t wrong = p.settings.size() != want.size() || p.problems.size() != problems.size();
+    for (const nvapi::CompiledSetting& s : p.settings) {
+        auto w = want.find(s.id);
+        if (w == want.end() || s.value != w->second.value || std::string_view(s.type) != "Dword"
+            || s.line != w->second.line) {
+            std::fprintf(stderr, "error: line %u: 0x%08x is %s %s, not Dword %s\n", s.line, s.id, s.type,
+                         s.value.c_str(), w == want.end() ? "(none)" : w->second.value.c_str());
+            ++wrong;
+        }
+    }
+    for (size_t i = 0; i < p.problems.size() && i < problems.size(); ++i) {
+        const nvapi::CompileIssue& got = p.problems[i];
+        if (got.problem != problems[i].first || got.line != problems[i].second) {
+            std::fprintf(stderr, "error: line %u: %s: %.*s: %.*s (%s)\n", got.line, nvapi::problem_name(got.problem),
+                         int(got.name.size()), got.name.data(), int(got.value.size()), got.value.data(),
+                         got.why.c_str());
+            ++wrong;
+        }
+    }
+
+    std::printf("%zu lines, %zu settings, %zu problems\n", p.items, p.settings.size(), p.problems.size());
+    std::printf("compile  best %.3f ms, median %.3f ms (%.2f us a line), budget %.1f ms\n", best,
+                times[times.size() / 2], best * 1000.0 / double(p.items), budget);
+    if (wrong) {
+        std::fprintf(stderr, "error: the profile is not what the checklist says\n");
+        return 1;
+    }
+    if (best > budget) {
+        std::fprintf(stderr, "error: over budget\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,106 @@
+// bench_nvapi_defaults.cpp
+//
+// Builds the default table from a snapshot, then asks which settings of a
+// profile holding every setting in the dump are not the default, and fails
+// if one pass takes longer than the budget:
+//
+//   bench_nvapi_defaults nvapi.snap [budget us, default 50] [passes, default 2000]
+//
+// Half the profile's values are the default and half are changed. The
+// answer is checked against resolving each setting's DEFAULT row again.
+
+#include "nvapi_defaults.h"
+#include "nvapi_snapshot.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    if (argc < 2 || argc > 4) {
+        std::fprintf(stderr, "usage: bench_nvapi_defaults <snapshot> [budget us] [passes]\n");
+        return 2;
+    }
+    double budget = argc > 2 ? std::atof(argv[2]) : 50.0;
+    int passes = argc > 3 ? std::atoi(argv[3]) : 2000;
+    if (passes < 1)
+        passes = 1;
+
+    nvapi::Snapshot snap;
+    std::string why;
+    if (!snap.open(argv[1], &why)) {
+        std::fprintf(stderr, "error: %s: %s\n", argv[1], why.c_str());
+        return 1;
+    }
+
+    using Clock = std::chrono::steady_clock;
+    auto t0 = Clock::now();
+    nvapi::DefaultTable table = nvapi::DefaultTable::build(snap);
+    double build_ms = std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+
+    // Every setting once: its default, or something else of the same type.
+    std::mt19937 rng(12345);
+    std::vector<nvapi::SettingValue> profile;
+    std::vector<bool> want;
+    nvapi::SectionRecord r;
+    for (uint32_t i = 0; i < snap.size(); ++i) {
+        snap.read(i, r);
+        nvapi::Value v = table.value(i);
+        bool keep = v.type() != nvapi::ValueType::Unknown && rng() % 2;
+        if (!keep) {
+            switch (r.section.type) {
+            case nvapi::ValueType::Qword:  v = nvapi::Value::qword(uint64_t(rng()) << 32 | 7); break;
+            case nvapi::ValueType::Float:  v = nvapi::Value::real(float(rng() % 1000) + 0.25f); break;
+            case nvapi::ValueType::String: v = nvapi::Value::string("C:\\changed\\" + std::to_string(rng())); break;
+            case nvapi::ValueType::Binary: v = nvapi::Value::binary("\x01\x02"); break;
+            default:                       v = nvapi::Value::dword(rng() | 0x80000000u); break;
+            }
+        }
+        // The slow way: resolve the DEFAULT row again and compare.
+        bool is_default = false;
+        for (const nvapi::Default& d : r.defaults) {
+            nvapi::Value dv;
+            if (d.label == "DEFAULT" && nvapi::resolve_default(r, d, dv)) {
+                is_default = dv == v;
+                break;
+            }
+        }
+        want.push_back(!is_default);
+        profile.push_back({i, std::move(v)});
+    }
+
+    std::vector<uint32_t> changed;
+    t0 = Clock::now();
+    size_t total = 0;
+    for (int p = 0; p < passes; ++p) {
+        table.changed(profile, changed);
+        total += changed.size();
+    }
+    double us = std::chrono::duration<double, std::micro>(Clock::now() - t0).count() / passes;
+
+    size_t wrong = 0, k = 0;
+    for (uint32_t i = 0; i < profile.size(); ++i) {
+        bool got = k < changed.size() && changed[k] == i;
+        k += got;
+        if (got != want[i] && wrong++ < 5)
+            std::fprintf(stderr, "mismatch: setting %u is %s\n", i, got ? "changed" : "default");
+    }
+
+    std::printf("%zu settings, %zu with a default, table built in %.3f ms\n", table.size(), table.resolved_count(),
+                build_ms);
+    std::printf("%zu of %zu changed, %.2f us per pass (%.1f ns per setting), budget %.1f us (%zu)\n", changed.size(),
+                profile.size(), us, us * 1000 / double(profile.size()), budget, total);
+    if (wrong) {
+        std::fprintf(stderr, "error: %zu settings answered wrong\n", wrong);
+        return 1;
+    }
+    if (us > budget) {
+        std::fprintf(stderr, "error: over budget\n");
+        return 1;
+    }
+    return 0;
+}
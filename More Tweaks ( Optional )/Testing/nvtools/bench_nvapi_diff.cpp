@@ -0,0 +1,185 @@
+// bench_nvapi_diff.cpp
+//
+// Makes a second driver's dump out of a parameter dump with known edits
+// (bench_edit.h), one setting replaced by a new one, a setting moved to debug
+// drivers, a symbol renumbered and a DEFAULT changed, and checks nvapi_diff
+// reports exactly those five changes, and as many the other way round. Then
+// times parsing both dumps and diffing them, and fails if the best run is
+// over budget:
+//
+//   bench_nvapi_diff ../NVAPI-PARAMETERS-DUMP-NEW-VERSION.txt [budget ms, default 50] [runs, default 10]
+//
+// A dump diffed against itself has to give no changes.
+
+#include "bench_edit.h"
+#include "mapped_file.h"
+#include "nvapi_diff.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using nvtools::Edit;
+using nvtools::offset_in;
+
+constexpr std::string_view kAlways = "This key is defined all the time - even with release driver";
+constexpr std::string_view kDebug = "This key is defined only for develop/debug driver";
+
+std::string line_of(const nvapi::Change& c)
+{
+    return std::string(nvapi::change_name(c.kind)) + "\t" + std::string(c.setting) + "\t" + std::string(c.item)
+        + "\t" + c.before + "\t" + c.after;
+}
+
+std::string hex(uint64_t v)
+{
+    char buf[24];
+    std::snprintf(buf, sizeof buf, "0x%08llx", (unsigned long long)v);
+    return buf;
+}
+
+// Where section i's opening separator line starts.
+size_t section_start(const nvapi::Dump& d, size_t i)
+{
+    size_t name = d.sections[i].offset;
+    size_t nl = name >= 2 ? d.source.rfind('\n', name - 2) : std::string_view::npos;
+    return nl == std::string_view::npos ? 0 : nl + 1;
+}
+
+// The edits, and the changes nvapi_diff has to find for them in its order.
+// false if the dump has no setting to make one of them with.
+bool plan(const nvapi::Dump& d, std::vector<Edit>& edits, std::vector<std::string>& want)
+{
+    std::vector<std::pair<size_t, std::string>> changes;
+    bool replaced = false, hidden = false, renumbered = false, defaulted = false;
+    for (size_t i = 1; i + 1 < d.sections.size(); ++i) {
+        const nvapi::Section& s = d.sections[i];
+        std::string name(s.name);
+        if (d.by_name.at(s.name) != i)
+            continue;
+        if (!replaced && s.type == nvapi::ValueType::Dword) {
+            replaced = true;
+            size_t begin = section_start(d, i), end = section_start(d, i + 1);
+            std::string_view sep = d.source.substr(begin, d.source.find('\n', begin) + 1 - begin);
+            edits.push_back({begin, end, std::string(sep) + "BENCH DIFF ADDED\n" + std::string(sep)
+                                             + "This key is of type DWORD\n" + std::string(kAlways) + "\n\n"});
+            want.push_back("removed\t" + name + "\t\tDWORD\t");
+            changes.push_back({begin, "added\tBENCH DIFF ADDED\t\t\tDWORD"});
+            continue;
+        }
+        size_t always = d.source.find(kAlways, s.offset);
+        if (!hidden && s.availability == nvapi::Availability::Always && always < section_start(d, i + 1)) {
+            hidden = true;
+            edits.push_back({always, always + kAlways.size(), std::string(kDebug)});
+            changes.push_back({always, "debug only\t" + name + "\t\talways\tdebug"});
+            continue;
+        }
+        if (!renumbered && !s.bitfields) {
+            for (uint32_t k = 0; k < s.symbol_count; ++k) {
+                const nvapi::Symbol& sym = d.symbols_of(s)[k];
+                std::optional<uint64_t> v = nvapi::parse_number(sym.value);
+                if (!v || *v > 0xffffffffu)
+                    continue;
+                renumbered = true;
+                size_t begin = offset_in(d.source, sym.value);
+                edits.push_back({begin, begin + sym.value.size(), hex(*v ^ 1)});
+                changes.push_back({begin, "renumbered\t" + name + "\t" + std::string(sym.name) + "\t"
+                                              + std::string(sym.value) + "\t" + hex(*v ^ 1)});
+                break;
+            }
+            if (renumbered)
+                continue;
+        }
+        if (!defaulted && s.default_count == 1) {
+            const nvapi::Default& f = d.defaults_of(s)[0];
+            std::optional<uint64_t> v = nvapi::parse_number(f.value);
+            if (!v || *v > 0xffffffffu)
+                continue;
+            defaulted = true;
+            size_t begin = offset_in(d.source, f.value);
+            edits.push_back({begin, begin + f.value.size(), hex(*v ^ 1)});
+            changes.push_back({begin, "default\t" + name + "\t" + std::string(f.label) + "\t"
+                                          + std::string(f.value) + "\t" + hex(*v ^ 1)});
+        }
+    }
+    if (!replaced || !hidden || !renumbered || !defaulted)
+        return false;
+
+    std::sort(changes.begin(), changes.end());
+    for (auto& c : changes)
+        want.push_back(c.second);
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 2 || argc > 4) {
+        std::fprintf(stderr, "usage: bench_nvapi_diff <dump> [budget ms] [runs]\n");
+        return 2;
+    }
+    double budget = argc > 2 ? std::atof(argv[2]) : 50.0;
+    int runs = argc > 3 ? std::atoi(argv[3]) : 10;
+    if (runs < 1)
+        runs = 1;
+
+    nvtools::MappedFile f;
+    if (!f.open(argv[1])) {
+        std::fprintf(stderr, "error: cannot map %s\n", argv[1]);
+        return 1;
+    }
+    nvapi::Dump a = nvapi::parse_dump(f.view());
+    std::vector<Edit> edits;
+    std::vector<std::string> want;
+    if (a.sections.empty() || !plan(a, edits, want)) {
+        std::fprintf(stderr, "error: %s has no settings to edit\n", argv[1]);
+        return 1;
+    }
+    std::string edited = nvtools::apply_edits(f.view(), edits);
+    nvapi::Dump b = nvapi::parse_dump(edited);
+
+    std::vector<std::string> got;
+    for (const nvapi::Change& c : nvapi::diff(a, b))
+        got.push_back(line_of(c));
+    bool wrong = !nvtools::same_lines(want, got) || nvapi::diff(b, a).size() != want.size()
+        || !nvapi::diff(a, a).empty() || b.sections.size() != a.sections.size();
+
+    using Clock = std::chrono::steady_clock;
+    std::vector<double> times, diff_times;
+    size_t changes = 0;
+    for (int r = 0; r < runs; ++r) {
+        auto t0 = Clock::now();
+        nvapi::Dump x = nvapi::parse_dump(f.view());
+        nvapi::Dump y = nvapi::parse_dump(edited);
+        auto t1 = Clock::now();
+        changes = nvapi::diff(x, y).size();
+        auto t2 = Clock::now();
+        times.push_back(std::chrono::duration<double, std::milli>(t2 - t0).count());
+        diff_times.push_back(std::chrono::duration<double, std::milli>(t2 - t1).count());
+    }
+    std::sort(times.begin(), times.end());
+    std::sort(diff_times.begin(), diff_times.end());
+    double best = times.front();
+
+    std::printf("%zu settings, %zu symbols, %zu changes\n", a.sections.size(), a.symbols.size(), changes);
+    for (const std::string& g : got)
+        std::printf("  %s\n", g.c_str());
+    std::printf("parse both + diff  best %.2f ms, median %.2f ms (diff alone %.2f ms), budget %.1f ms\n", best,
+                times[times.size() / 2], diff_times.front(), budget);
+    if (wrong) {
+        std::fprintf(stderr, "error: the diff is not the edits made\n");
+        return 1;
+    }
+    if (best > budget) {
+        std::fprintf(stderr, "error: over budget\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,163 @@
+// bench_nvapi_dump.cpp
+//
+// Times map + parse_dump() over a parameter dump and fails if the best run is
+// over budget:
+//
+//   bench_nvapi_dump ../NVAPI-PARAMETERS-DUMP-NEW-VERSION.txt [budget ms, default 10] [runs, default 50]
+//                    [threads, default one per core]
+//
+// It also times a SectionReader pass on its own, which is what a lookup that
+// stops at the first match pays at most, and parse_dump_parallel() with 2, 4,
+// ... threads. Exits with 1 if a parallel result differs from the serial one
+// in any field or view. On a machine with more than one core it also exits
+// with 1 if no thread count up to the number of cores parses at least
+// kScalingFloor times as fast as the serial parse; on one core the threads
+// can only take turns, so there is no floor.
+
+#include "mapped_file.h"
+#include "nvapi_dump.h"
+#include "work_steal.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr double kScalingFloor = 1.25;
+
+// Same text, same place: the views must point at the same bytes.
+bool same(std::string_view a, std::string_view b)
+{
+    return a.data() == b.data() && a.size() == b.size();
+}
+
+bool identical(const nvapi::Dump& a, const nvapi::Dump& b)
+{
+    if (a.sections.size() != b.sections.size() || a.symbols.size() != b.symbols.size()
+        || a.defaults.size() != b.defaults.size() || a.matches.size() != b.matches.size()
+        || a.by_name != b.by_name)
+        return false;
+    for (size_t i = 0; i < a.sections.size(); ++i) {
+        const nvapi::Section& x = a.sections[i];
+        const nvapi::Section& y = b.sections[i];
+        if (!same(x.name, y.name) || x.type != y.type || x.availability != y.availability
+            || x.assignment != y.assignment || x.bitfields != y.bitfields || x.names_only != y.names_only
+            || !same(x.condition, y.condition) || !same(x.description, y.description)
+            || x.offset != y.offset || x.symbol_begin != y.symbol_begin || x.symbol_count != y.symbol_count
+            || x.default_begin != y.default_begin || x.default_count != y.default_count)
+            return false;
+    }
+    for (size_t i = 0; i < a.symbols.size(); ++i)
+        if (!same(a.symbols[i].name, b.symbols[i].name) || !same(a.symbols[i].value, b.symbols[i].value)
+            || !same(a.symbols[i].comment, b.symbols[i].comment))
+            return false;
+    for (size_t i = 0; i < a.defaults.size(); ++i)
+        if (!same(a.defaults[i].label, b.defaults[i].label) || !same(a.defaults[i].value, b.defaults[i].value)
+            || a.defaults[i].match_begin != b.defaults[i].match_begin
+            || a.defaults[i].match_count != b.defaults[i].match_count)
+            return false;
+    for (size_t i = 0; i < a.matches.size(); ++i)
+        if (!same(a.matches[i], b.matches[i]))
+            return false;
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 2 || argc > 5) {
+        std::fprintf(stderr, "usage: bench_nvapi_dump <dump> [budget ms] [runs] [threads]\n");
+        return 2;
+    }
+    double budget = argc > 2 ? std::atof(argv[2]) : 10.0;
+    int runs = argc > 3 ? std::atoi(argv[3]) : 50;
+    if (runs < 1)
+        runs = 1;
+    unsigned max_threads = argc > 4 ? unsigned(std::max(1, std::atoi(argv[4]))) : nvtools::default_threads();
+
+    using Clock = std::chrono::steady_clock;
+    std::vector<double> times, stream_times;
+    size_t sections = 0, symbols = 0, bytes = 0, streamed = 0;
+    for (int r = 0; r < runs; ++r) {
+        auto t0 = Clock::now();
+        nvtools::MappedFile f;
+        if (!f.open(argv[1])) {
+            std::fprintf(stderr, "error: cannot map %s\n", argv[1]);
+            return 1;
+        }
+        nvapi::Dump d = nvapi::parse_dump(f.view());
+        times.push_back(std::chrono::duration<double, std::milli>(Clock::now() - t0).count());
+        sections = d.sections.size();
+        symbols = d.symbols.size();
+        bytes = f.size();
+
+        t0 = Clock::now();
+        nvapi::SectionReader reader(f.view());
+        streamed = 0;
+        while (reader.next())
+            ++streamed;
+        stream_times.push_back(std::chrono::duration<double, std::milli>(Clock::now() - t0).count());
+    }
+    if (streamed != sections) {
+        std::fprintf(stderr, "error: the reader saw %zu sections, parse_dump %zu\n", streamed, sections);
+        return 1;
+    }
+    std::sort(times.begin(), times.end());
+    std::sort(stream_times.begin(), stream_times.end());
+    double best = times.front();
+    double median = times[times.size() / 2];
+    std::printf("%zu bytes, %zu sections, %zu symbols\n", bytes, sections, symbols);
+    std::printf("parse_dump     best %.3f ms, median %.3f ms (%.0f MB/s), budget %.1f ms\n",
+                best, median, double(bytes) / best / 1000.0, budget);
+    std::printf("SectionReader  best %.3f ms\n", stream_times.front());
+
+    // The map stays open for the parallel runs, so they only time the parse.
+    nvtools::MappedFile f;
+    if (!f.open(argv[1])) {
+        std::fprintf(stderr, "error: cannot map %s\n", argv[1]);
+        return 1;
+    }
+    const nvapi::Dump serial = nvapi::parse_dump(f.view());
+    double serial_best = 1e30;
+    for (int r = 0; r < runs; ++r) {
+        auto t0 = Clock::now();
+        nvapi::Dump d = nvapi::parse_dump(f.view());
+        serial_best = std::min(serial_best, std::chrono::duration<double, std::milli>(Clock::now() - t0).count());
+    }
+    // Always at least 2 threads, so the chunked path runs on one core too.
+    const unsigned cores = std::thread::hardware_concurrency();
+    double best_speedup = 0;
+    for (unsigned threads = 2; threads <= std::max(2u, max_threads); threads *= 2) {
+        double best_parallel = 1e30;
+        for (int r = 0; r < runs; ++r) {
+            auto t0 = Clock::now();
+            nvapi::Dump d = nvapi::parse_dump_parallel(f.view(), threads);
+            best_parallel = std::min(best_parallel,
+                                     std::chrono::duration<double, std::milli>(Clock::now() - t0).count());
+            if (!identical(d, serial)) {
+                std::fprintf(stderr, "error: %u threads gave a different dump\n", threads);
+                return 1;
+            }
+        }
+        std::printf("%2u threads     best %.3f ms, %.2fx the serial parse\n", threads, best_parallel,
+                    serial_best / best_parallel);
+        if (threads <= cores)
+            best_speedup = std::max(best_speedup, serial_best / best_parallel);
+    }
+    if (cores > 1 && best_speedup < kScalingFloor) {
+        std::fprintf(stderr, "error: %u cores, and no thread count parses %.2fx as fast as the serial parse\n",
+                     cores, kScalingFloor);
+        return 1;
+    }
+
+    if (best > budget) {
+        std::fprintf(stderr, "error: over budget\n");
+        return 1;
+    }
+    return 0;
+}
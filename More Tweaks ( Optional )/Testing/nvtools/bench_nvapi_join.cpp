@@ -0,0 +1,98 @@
+// bench_nvapi_join.cpp
+//
+// Opens a join index, looks up every ID, name and dump key in it over and
+// over, and fails if a lookup takes longer than the budget on average:
+//
+//   bench_nvapi_join nvapi.join [budget ns, default 100] [rounds, default 2000]
+//
+// Every lookup has to come back to the entry the key was taken from, and a
+// key that is in no entry has to miss. Opening the index is timed too, as
+// the cost a tool pays before its first lookup.
+
+#include "nvapi_join.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    if (argc < 2 || argc > 4) {
+        std::fprintf(stderr, "usage: bench_nvapi_join <index> [budget ns] [rounds]\n");
+        return 2;
+    }
+    double budget = argc > 2 ? std::atof(argv[2]) : 100.0;
+    int rounds = argc > 3 ? std::atoi(argv[3]) : 2000;
+    if (rounds < 1)
+        rounds = 1;
+
+    using Clock = std::chrono::steady_clock;
+    auto t0 = Clock::now();
+    nvapi::JoinIndex idx;
+    std::string why;
+    if (!idx.open(argv[1], &why)) {
+        std::fprintf(stderr, "error: %s: %s\n", argv[1], why.c_str());
+        return 1;
+    }
+    double open_us = std::chrono::duration<double, std::micro>(Clock::now() - t0).count();
+
+    // Queries in a case the index did not store them in, where a key has
+    // spaces the other spelling, so the folding is paid for.
+    struct Query {
+        int kind;               // 0 ID, 1 name, 2 key
+        uint32_t id;
+        std::string text;
+        uint32_t entry;
+    };
+    std::vector<Query> queries;
+    for (uint32_t e = 0; e < idx.size(); ++e) {
+        nvapi::JoinEntry j = idx.entry(e);
+        if (j.has_id)
+            queries.push_back({0, j.id, {}, e});
+        for (uint32_t a = 0; a < j.alias_count; ++a) {
+            std::string s(idx.alias(e, a));
+            for (char& c : s)
+                c = c >= 'A' && c <= 'Z' ? char(c - 'A' + 'a') : c;
+            queries.push_back({1, 0, s, e});
+        }
+        if (j.section != nvapi::kNoSection) {
+            std::string s(j.dump_name);
+            for (char& c : s)
+                c = c == ' ' ? '_' : c;
+            queries.push_back({2, 0, s, e});
+        }
+    }
+    queries.push_back({1, 0, "no such setting", ~0u});
+    queries.push_back({2, 0, "NO_SUCH_KEY", ~0u});
+    if (queries.size() < 3) {
+        std::fprintf(stderr, "error: %s joins nothing\n", argv[1]);
+        return 1;
+    }
+
+    size_t wrong = 0;
+    t0 = Clock::now();
+    for (int r = 0; r < rounds; ++r)
+        for (const Query& q : queries) {
+            std::optional<uint32_t> e = q.kind == 0 ? idx.by_id(q.id)
+                : q.kind == 1                       ? idx.by_name(q.text)
+                                                    : idx.by_key(q.text);
+            wrong += e.value_or(~0u) != q.entry;
+        }
+    double ns = std::chrono::duration<double, std::nano>(Clock::now() - t0).count()
+        / (double(rounds) * double(queries.size()));
+
+    if (wrong) {
+        std::fprintf(stderr, "error: %zu of %zu lookups came back wrong\n", wrong / size_t(rounds), queries.size());
+        return 1;
+    }
+
+    std::printf("%zu settings, %zu lookups x %d rounds\n", idx.size(), queries.size(), rounds);
+    std::printf("open %.1f us, lookup %.1f ns (budget %.0f ns)\n", open_us, ns, budget);
+    if (ns > budget) {
+        std::fprintf(stderr, "error: over budget\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,202 @@
+// bench_nvapi_merge.cpp
+//
+// Makes a base export of thousands of profiles and two edited copies of it,
+// merges them three ways, and fails if the merge takes longer than the
+// budget:
+//
+//   bench_nvapi_merge [budget ms, default 150] [profiles, default 5000]
+//
+// Most of a merge is writing the UTF-16 result, so writing ours on its own
+// is timed too, as the floor the merge is measured against.
+//
+// The edits are planned, so the outcome is known: each side changes
+// settings of its own, one removes some and the other adds some and adds
+// executables, both flip different bits of a bitfield, both write a
+// two-bit field of another (the same value, or 1 and 2, which has to be a
+// conflict and not 3), and a few settings are changed both ways. The merged
+// file is read back and every setting in it checked, along with the counts
+// and the conflicts.
+
+#include "nvapi_merge.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace {
+
+enum Side { Base, Ours, Theirs, Merged };
+
+constexpr uint32_t kSettings = 30;
+constexpr uint32_t kBitfield = 0x10000000;  // setting 0
+constexpr uint32_t kField = kSettings - 1;  // a bitfield: field 0x3, flag 0x4
+constexpr uint32_t kAdded = 0x7fffffff;     // past every other ID, so the order holds
+
+uint32_t id_of(uint32_t s)
+{
+    return kBitfield + s * 0x1111;
+}
+
+// The value of setting s of profile p on a side, or false if the side
+// does not have it.
+bool value_of(Side side, long p, uint32_t s, uint32_t& v)
+{
+    if (s == kSettings) {
+        v = uint32_t(p);
+        return (side == Theirs || side == Merged) && p % 9 == 0;
+    }
+    if (s == 0) {
+        // Ours sets 0x1, theirs clears 0x10 and sets 0x4.
+        bool edit = p % 4 == 0;
+        v = side == Base || !edit ? 0x10 : side == Ours ? 0x11 : side == Theirs ? 0x04 : 0x05;
+        return true;
+    }
+    if (s == kField) {
+        // 1 and 2 in the field conflict, and ours wins; a field and the
+        // flag merge; 2 on both sides, one adding the flag, merges too.
+        v = 0;
+        if (side != Base && p % 13 == 0)
+            v = side == Theirs ? 2 : 1;
+        if (side != Base && p % 13 == 6)
+            v = side == Ours ? 1 : side == Theirs ? 4 : 5;
+        if (side != Base && p % 13 == 3)
+            v = side == Ours ? 2 : 6;
+        return true;
+    }
+    v = uint32_t(p) * 31 + s;
+    if (s == 1 && p % 3 == 0 && side != Base && side != Theirs)
+        v += 1000000;
+    if (s == 2 && p % 5 == 0 && side != Base && side != Ours)
+        v += 2000000;
+    if (s == 3 && p % 11 == 0 && side != Base)
+        v += side == Theirs ? 2 : 1;    // a conflict, and ours wins
+    return !(s == 4 && p % 6 == 0 && side != Base && side != Theirs);
+}
+
+std::string make(Side side, long profiles)
+{
+    nvapi::NipFormat format;
+    std::string file;
+    nvapi::NipWriter w(format, file);
+    std::vector<std::string> exe_text;
+    std::vector<std::string_view> exes;
+    std::string value;
+    for (long p = 0; p < profiles; ++p) {
+        exe_text.assign({"game" + std::to_string(p) + ".exe"});
+        if (side != Base && side != Ours && p % 7 == 0)
+            exe_text.push_back("launcher" + std::to_string(p) + ".exe");
+        exes.assign(exe_text.begin(), exe_text.end());
+        w.begin_profile("Game " + std::to_string(p), exes.data(), exes.size());
+        for (uint32_t s = 0; s <= kSettings; ++s) {
+            uint32_t v;
+            if (!value_of(side, p, s, v))
+                continue;
+            value = std::to_string(v);
+            w.setting("", s == kSettings ? kAdded : id_of(s), value, "Dword");
+        }
+        w.end_profile();
+    }
+    w.finish();
+    return file;
+}
+
+// How many of the profiles have p % every == at.
+long count(long profiles, long every, long at = 0)
+{
+    return profiles > at ? (profiles - at + every - 1) / every : 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc > 3) {
+        std::fprintf(stderr, "usage: bench_nvapi_merge [budget ms] [profiles]\n");
+        return 2;
+    }
+    double budget = argc > 1 ? std::atof(argv[1]) : 150.0;
+    long profiles = argc > 2 ? std::atol(argv[2]) : 5000;
+    if (profiles < 1)
+        profiles = 1;
+
+    std::string text[3] = {make(Base, profiles), make(Ours, profiles), make(Theirs, profiles)};
+    nvapi::NipFile nip[3];
+    std::string why;
+    for (int i = 0; i < 3; ++i)
+        if (!nvapi::read_nip(text[i], nip[i], &why)) {
+            std::fprintf(stderr, "error: %s\n", why.c_str());
+            return 1;
+        }
+    nvapi::MergeRules rules;
+    rules.bitfields.push_back({kBitfield, true, 0x10, {}});
+    rules.bitfields.push_back({id_of(kField), true, 0, {0x3}});
+
+    using Clock = std::chrono::steady_clock;
+    std::string out;
+    nvapi::MergeResult r;
+    double best = 1e30;
+    for (int run = 0; run < 5; ++run) {
+        out.clear();
+        nvapi::NipWriter w(nip[Ours].format, out);
+        auto t0 = Clock::now();
+        nvapi::merge_nip(nip[Base], nip[Ours], nip[Theirs], rules, w, r);
+        best = std::min(best, std::chrono::duration<double, std::milli>(Clock::now() - t0).count());
+    }
+
+    double write_ms = 1e30;
+    for (int run = 0; run < 5; ++run) {
+        std::string copy;
+        copy.reserve(out.size());
+        auto t0 = Clock::now();
+        nvapi::write_nip(nip[Ours], copy);
+        write_ms = std::min(write_ms, std::chrono::duration<double, std::milli>(Clock::now() - t0).count());
+    }
+
+    // Everything in the merged file has to be what was planned.
+    nvapi::NipFile merged;
+    if (!nvapi::read_nip(out, merged, &why)) {
+        std::fprintf(stderr, "error: the merge is not a .nip file: %s\n", why.c_str());
+        return 1;
+    }
+    size_t wrong = merged.profile_count() != size_t(profiles);
+    for (uint32_t p = 0; p < merged.profile_count() && !wrong; ++p) {
+        uint32_t exes = merged.exe_begin[p + 1] - merged.exe_begin[p];
+        wrong += exes != (p % 7 == 0 ? 2u : 1u);
+        uint32_t i = merged.setting_begin[p], end = merged.setting_begin[p + 1];
+        for (uint32_t s = 0; s <= kSettings; ++s) {
+            uint32_t v;
+            if (!value_of(Merged, p, s, v))
+                continue;
+            if (i == end || merged.setting_id[i] != (s == kSettings ? kAdded : id_of(s))
+                || merged.setting_value[i] != std::to_string(v)) {
+                ++wrong;
+                break;
+            }
+            ++i;
+        }
+        wrong += i != end;
+    }
+    long conflicts = count(profiles, 11) + count(profiles, 13);
+    long bit_merges = count(profiles, 4) + count(profiles, 13, 6) + count(profiles, 13, 3);
+    for (const nvapi::MergeConflict& c : r.conflicts)
+        wrong += c.id != id_of(3) && c.id != id_of(kField);
+
+    std::printf("%ld profiles, %zu settings merged, %zu from theirs, %zu by bits, %zu conflicts\n", profiles,
+                r.settings, r.from_theirs, r.bit_merges, r.conflicts.size());
+    std::printf("merge %.2f ms (budget %.0f ms), writing ours alone %.2f ms, %.1f MB\n", best, budget, write_ms,
+                double(out.size()) / 1e6);
+    if (wrong || r.conflicts.size() != size_t(conflicts) || r.bit_merges != size_t(bit_merges)
+        || r.from_theirs != size_t(count(profiles, 5) + count(profiles, 9))
+        || r.settings != size_t(profiles * kSettings + count(profiles, 9) - count(profiles, 6))) {
+        std::fprintf(stderr, "error: the merge is not what was planned\n");
+        return 1;
+    }
+    if (best > budget) {
+        std::fprintf(stderr, "error: over budget\n");
+        return 1;
+    }
+    return 0;
+}
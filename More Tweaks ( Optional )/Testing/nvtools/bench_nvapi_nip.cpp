@@ -0,0 +1,115 @@
+// bench_nvapi_nip.cpp
+//
+// Writes a driver-sized export (thousands of application profiles, UTF-16
+// as NPI saves it), reads it back, and fails if reading manages less than
+// the budget:
+//
+//   bench_nvapi_nip [budget, MB/s of UTF-16 read, default 100] [profiles, default 5000]
+//
+// The file is then written again from what was read, and has to come back
+// byte for byte, in UTF-16 and in UTF-8. Names include escapes and text
+// outside the BMP, so the slow paths of the transcoder are covered too.
+
+#include "nvapi_nip.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    if (argc > 3) {
+        std::fprintf(stderr, "usage: bench_nvapi_nip [budget MB/s] [profiles]\n");
+        return 2;
+    }
+    double budget = argc > 1 ? std::atof(argv[1]) : 100.0;
+    long profiles = argc > 2 ? std::atol(argv[2]) : 5000;
+    if (profiles < 1)
+        profiles = 1;
+
+    // Made the way NPI would: the Base Profile with everything, then
+    // application profiles with a few executables and settings each.
+    std::mt19937 rng(12345);
+    nvapi::NipFormat format;
+    std::string file;
+    nvapi::NipWriter w(format, file);
+    std::vector<std::string> exe_text;
+    std::vector<std::string_view> exes;
+    long settings = 0;
+    for (long p = 0; p < profiles; ++p) {
+        std::string name = p == 0 ? "Base Profile" : "Game " + std::to_string(p);
+        if (p % 7 == 3)
+            name += " &amp; Caf\xc3\xa9 \xe2\x84\xa2 \xf0\x9f\x8e\xae";
+        exe_text.clear();
+        exes.clear();
+        for (int e = p == 0 ? 0 : 1 + int(rng() % 3); e > 0; --e)
+            exe_text.push_back("game" + std::to_string(p) + "_" + std::to_string(e) + ".exe");
+        for (const std::string& e : exe_text)
+            exes.push_back(e);
+        w.begin_profile(name, exes.data(), exes.size());
+        for (int s = p == 0 ? 90 : int(rng() % 40); s > 0; --s, ++settings) {
+            uint32_t id = rng();
+            std::string value = std::to_string(rng());
+            if (s % 13 == 0)
+                w.setting("", id, "AAAAQAAAAAA=", "Binary");
+            else if (s % 17 == 0)
+                w.setting("Preferred OpenGL GPU", id, "id,2.0:268410DE,00000100,GF - (400,2,161,24564) @ (0)", "String");
+            else
+                w.setting(s % 3 ? "" : " ", id, value, "Dword");
+        }
+        w.end_profile();
+    }
+    w.finish();
+
+    using Clock = std::chrono::steady_clock;
+    nvapi::NipFile nip;
+    std::string why;
+    int runs = 5;
+    double best = 1e30;
+    for (int r = 0; r < runs; ++r) {
+        auto t0 = Clock::now();
+        if (!nvapi::read_nip(file, nip, &why)) {
+            std::fprintf(stderr, "error: %s\n", why.c_str());
+            return 1;
+        }
+        best = std::min(best, std::chrono::duration<double>(Clock::now() - t0).count());
+    }
+    double rate = double(file.size()) / best / 1e6;
+
+    std::string again;
+    auto t0 = Clock::now();
+    nvapi::write_nip(nip, again);
+    double write_ms = std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+    bool same16 = again == file;
+
+    // And through UTF-8, as the repo keeps its copies.
+    nip.format.encoding = nvapi::NipEncoding::Utf8;
+    std::string utf8, utf16;
+    nvapi::write_nip(nip, utf8);
+    nvapi::NipFile nip8;
+    bool same8 = nvapi::read_nip(utf8, nip8, &why);
+    if (same8) {
+        nip8.format.encoding = nvapi::NipEncoding::Utf16Le;
+        nvapi::write_nip(nip8, utf16);
+        same8 = utf16 == file;
+    }
+
+    std::printf("%ld profiles, %ld settings, %.1f MB of UTF-16\n", profiles, settings, double(file.size()) / 1e6);
+    std::printf("read %.2f ms (%.0f MB/s, budget %.0f MB/s), write %.2f ms\n", best * 1e3, rate, budget, write_ms);
+    if (nip.profile_count() != size_t(profiles) || nip.setting_count() != size_t(settings)) {
+        std::fprintf(stderr, "error: read %zu profiles and %zu settings\n", nip.profile_count(), nip.setting_count());
+        return 1;
+    }
+    if (!same16 || !same8) {
+        std::fprintf(stderr, "error: the file did not come back byte for byte%s\n", same16 ? " through UTF-8" : "");
+        return 1;
+    }
+    if (rate < budget) {
+        std::fprintf(stderr, "error: under budget\n");
+        return 1;
+    }
+    return 0;
+}
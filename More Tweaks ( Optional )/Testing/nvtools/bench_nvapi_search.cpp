@@ -0,0 +1,177 @@
+// bench_nvapi_search.cpp
+//
+// Replays what a search box sends: every prefix of a sample of setting names
+// as it is typed, to both complete() and search(), plus description words,
+// and the same words with a typo. Each query is timed on its own, and the
+// run fails if the 99th percentile is over budget:
+//
+//   bench_nvapi_search nvapi.snap [budget ms, default 1]
+//
+// complete() is checked against a scan of the names for every prefix, and
+// search() against a scan of the words for every query that needs no typo
+// matching; a difference is an error.
+
+#include "nvapi_search.h"
+#include "nvapi_snapshot.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::vector<std::string> words_of(std::string_view text, size_t min_size)
+{
+    std::vector<std::string> out;
+    std::string w;
+    for (size_t i = 0; i <= text.size(); ++i) {
+        char c = i < text.size() ? text[i] : ' ';
+        if ((c >= 'a' && c <= 'z') || (c >= '0' && c <= '9'))
+            w += c;
+        else if (c >= 'A' && c <= 'Z')
+            w += char(c - 'A' + 'a');
+        else {
+            if (w.size() >= min_size)
+                out.push_back(w);
+            w.clear();
+        }
+    }
+    return out;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 2 || argc > 3) {
+        std::fprintf(stderr, "usage: bench_nvapi_search <snapshot> [budget ms]\n");
+        return 2;
+    }
+    double budget = argc > 2 ? std::atof(argv[2]) : 1.0;
+
+    nvapi::Snapshot snap;
+    std::string why;
+    if (!snap.open(argv[1], &why)) {
+        std::fprintf(stderr, "error: %s: %s\n", argv[1], why.c_str());
+        return 1;
+    }
+    std::vector<nvapi::Section> sections;
+    for (size_t i = 0; i < snap.size(); ++i)
+        sections.push_back(snap.section(i));
+
+    using Clock = std::chrono::steady_clock;
+    auto t0 = Clock::now();
+    nvapi::SearchIndex idx = nvapi::SearchIndex::build(sections);
+    double build_ms = std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+
+    // What every section's words are, for checking search().
+    std::vector<std::vector<std::string>> words(sections.size());
+    for (size_t i = 0; i < sections.size(); ++i) {
+        words[i] = words_of(sections[i].name, 1);
+        for (std::string& w : words_of(sections[i].description, 2))
+            words[i].push_back(std::move(w));
+    }
+
+    std::vector<std::string> typed, queries;
+    for (size_t i = 0; i < sections.size(); i += 7) {
+        std::string name(sections[i].name);
+        for (size_t n = 1; n <= name.size(); ++n)
+            typed.push_back(name.substr(0, n));
+    }
+    for (const char* q : {"stutter", "pstate", "gpfifo", "shader cache", "vsync", "power", "anisotropic filter",
+                          "stuter", "psate", "gpfiof", "shadre cahce", "anisotropc"})
+        queries.push_back(q);
+    // Description words, and each with one letter changed.
+    unsigned seed = 12345;
+    auto rnd = [&] { return seed = seed * 1103515245u + 12345u, (seed >> 16) & 0x7fff; };
+    for (size_t i = 0; i < sections.size(); i += 13) {
+        std::vector<std::string> w = words_of(sections[i].description, 5);
+        if (w.empty())
+            continue;
+        std::string q = w[rnd() % w.size()];
+        queries.push_back(q);
+        q[rnd() % q.size()] = char('a' + rnd() % 26);
+        queries.push_back(q);
+    }
+
+    size_t wrong = 0;
+    std::vector<double> times;
+    std::vector<uint32_t> ids;
+    std::vector<nvapi::SearchHit> hits;
+    auto timed = [&](auto fn) {
+        auto t = Clock::now();
+        fn();
+        times.push_back(std::chrono::duration<double, std::milli>(Clock::now() - t).count());
+    };
+    for (const std::string& p : typed) {
+        timed([&] { idx.complete(p, 20, ids); });
+        timed([&] { idx.search(p, 20, hits); });
+
+        std::vector<std::pair<std::string, uint32_t>> want;
+        for (uint32_t i = 0; i < sections.size(); ++i) {
+            std::string n(sections[i].name);
+            for (char& c : n)
+                c = c >= 'a' && c <= 'z' ? char(c - 'a' + 'A') : c;
+            if (n.compare(0, p.size(), p) == 0)
+                want.emplace_back(n, i);
+        }
+        std::stable_sort(want.begin(), want.end(),
+                         [](const auto& a, const auto& b) { return a.first < b.first; });
+        want.resize(std::min<size_t>(want.size(), 20));
+        bool same = want.size() == ids.size();
+        for (size_t k = 0; same && k < want.size(); ++k)
+            same = want[k].second == ids[k];
+        wrong += !same;
+    }
+    for (const std::string& q : queries) {
+        timed([&] { idx.search(q, 20, hits); });
+
+        std::vector<std::string> qw = words_of(q, 1);
+        std::set<uint32_t> want;
+        bool every_word_found = true;
+        for (const std::string& w : qw) {
+            bool found = false;
+            for (uint32_t i = 0; i < sections.size() && !found; ++i)
+                for (const std::string& sw : words[i])
+                    found = found || sw.compare(0, w.size(), w) == 0;
+            every_word_found = every_word_found && found;
+        }
+        if (!every_word_found)
+            continue;           // typo matching decides, nothing to scan for
+        for (uint32_t i = 0; i < sections.size(); ++i) {
+            bool all = true;
+            for (const std::string& w : qw) {
+                bool found = false;
+                for (const std::string& sw : words[i])
+                    found = found || sw.compare(0, w.size(), w) == 0;
+                all = all && found;
+            }
+            if (all)
+                want.insert(i);
+        }
+        idx.search(q, size_t(-1), hits);
+        std::set<uint32_t> got;
+        for (const nvapi::SearchHit& h : hits)
+            got.insert(h.section);
+        wrong += got != want;
+    }
+    if (wrong) {
+        std::fprintf(stderr, "error: %zu queries answered differently from a scan\n", wrong);
+        return 1;
+    }
+
+    std::sort(times.begin(), times.end());
+    auto pct = [&](double p) { return times[std::min(times.size() - 1, size_t(p * double(times.size())))]; };
+    std::printf("%zu settings, %zu terms, index built in %.2f ms\n", sections.size(), idx.term_count(), build_ms);
+    std::printf("%zu queries  p50 %.4f ms, p99 %.4f ms, max %.4f ms, budget p99 %.2f ms\n", times.size(), pct(0.5),
+                pct(0.99), times.back(), budget);
+    if (pct(0.99) > budget) {
+        std::fprintf(stderr, "error: over budget\n");
+        return 1;
+    }
+    return 0;
+}
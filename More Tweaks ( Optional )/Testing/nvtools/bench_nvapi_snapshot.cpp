@@ -0,0 +1,120 @@
+// bench_nvapi_snapshot.cpp
+//
+// Times what a one-shot lookup tool pays per run: open (map and check) a
+// snapshot, find a setting and read it. Fails if the best run is over budget:
+//
+//   bench_nvapi_snapshot nvapi.snap [budget ms, default 0.5] [runs, default 200] [setting name]
+//
+// Without a name it looks up the last setting in the file.
+//
+// It then looks up every enum symbol's value in the reverse value index,
+// checks each answer against a scan of all symbols and prints the time per
+// lookup; a wrong answer is an error.
+
+#include "nvapi_snapshot.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    if (argc < 2 || argc > 5) {
+        std::fprintf(stderr, "usage: bench_nvapi_snapshot <snapshot> [budget ms] [runs] [setting name]\n");
+        return 2;
+    }
+    double budget = argc > 2 ? std::atof(argv[2]) : 0.5;
+    int runs = argc > 3 ? std::atoi(argv[3]) : 200;
+    if (runs < 1)
+        runs = 1;
+
+    std::string name;
+    {
+        nvapi::Snapshot snap;
+        std::string why;
+        if (!snap.open(argv[1], &why)) {
+            std::fprintf(stderr, "error: %s: %s\n", argv[1], why.c_str());
+            return 1;
+        }
+        if (snap.size() == 0) {
+            std::fprintf(stderr, "error: %s has no settings\n", argv[1]);
+            return 1;
+        }
+        name = argc > 4 ? argv[4] : std::string(snap.section(snap.size() - 1).name);
+    }
+
+    using Clock = std::chrono::steady_clock;
+    std::vector<double> times;
+    size_t sections = 0, symbols = 0;
+    for (int r = 0; r < runs; ++r) {
+        auto t0 = Clock::now();
+        nvapi::Snapshot snap;
+        if (!snap.open(argv[1])) {
+            std::fprintf(stderr, "error: cannot open %s\n", argv[1]);
+            return 1;
+        }
+        auto i = snap.find(name);
+        if (!i) {
+            std::fprintf(stderr, "error: %s is not in %s\n", name.c_str(), argv[1]);
+            return 1;
+        }
+        nvapi::SectionRecord rec;
+        snap.read(*i, rec);
+        times.push_back(std::chrono::duration<double, std::milli>(Clock::now() - t0).count());
+        sections = snap.size();
+        symbols = rec.symbols.size();
+    }
+    std::sort(times.begin(), times.end());
+    double best = times.front();
+    double median = times[times.size() / 2];
+    std::printf("%zu settings, \"%s\" with %zu symbols\n", sections, name.c_str(), symbols);
+    std::printf("open + find + read  best %.3f ms, median %.3f ms, budget %.2f ms\n", best, median, budget);
+    if (best > budget) {
+        std::fprintf(stderr, "error: over budget\n");
+        return 1;
+    }
+
+    nvapi::Snapshot snap;
+    snap.open(argv[1]);
+    std::map<uint64_t, std::vector<nvapi::Snapshot::ValueUse>> scan;
+    std::vector<uint64_t> values;
+    for (uint32_t i = 0; i < snap.size(); ++i) {
+        nvapi::Section s = snap.section(i);
+        if (s.bitfields)
+            continue;
+        for (uint32_t k = 0; k < s.symbol_count; ++k)
+            if (auto n = snap.number(s, k)) {
+                scan[*n].push_back({i, k});
+                values.push_back(*n);
+            }
+    }
+    values.push_back(0x0badf00d);       // not in the dump, probes to an empty slot
+    size_t wrong = 0;
+    for (uint64_t v : values) {
+        nvapi::Snapshot::ValueUses got = snap.uses_of(v);
+        const std::vector<nvapi::Snapshot::ValueUse>& want = scan[v];
+        bool same = got.size() == want.size();
+        for (size_t j = 0; same && j < want.size(); ++j)
+            same = got.begin()[j].section == want[j].section && got.begin()[j].symbol == want[j].symbol;
+        wrong += !same;
+    }
+    if (wrong) {
+        std::fprintf(stderr, "error: %zu values have the wrong uses\n", wrong);
+        return 1;
+    }
+    double best_ns = 1e300;
+    size_t total = 0;
+    for (int r = 0; r < 20; ++r) {
+        auto t0 = Clock::now();
+        for (uint64_t v : values)
+            total += snap.uses_of(v).size();
+        best_ns = std::min(best_ns, std::chrono::duration<double, std::nano>(Clock::now() - t0).count());
+    }
+    std::printf("%zu enum values (%zu distinct), reverse lookup %.1f ns each (%zu uses)\n", values.size() - 1,
+                scan.size() - 1, best_ns / double(values.size()), total / 20);
+    return 0;
+}
@@ -0,0 +1,174 @@
+// bench_nvapi_value.cpp
+//
+// Converts DWORD settings to and from their .nip form, and fails if it
+// manages fewer than the budget per second or allocates anything while doing
+// it:
+//
+//   bench_nvapi_value nvapi.snap [budget, millions of conversions/s, default 10] [values, default 2000000]
+//
+// Before that, every DEFAULT in the snapshot, a sweep of float bit patterns
+// and random QWORDs go through format_value/parse_value and
+// format_nip/parse_nip, and any that does not come back the same is an
+// error.
+
+#include "nvapi_snapshot.h"
+#include "nvapi_value.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+size_t allocations = 0;
+
+} // namespace
+
+void* operator new(size_t size)
+{
+    ++allocations;
+    if (void* p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+    std::free(p);
+}
+
+namespace {
+
+long bad = 0;
+
+void round_trip(const nvapi::Value& v, nvapi::ValueType declared, const char* what)
+{
+    std::string text, nip, why;
+    nvapi::Value back;
+    nvapi::format_value(v, text);
+    if (!nvapi::parse_value(v.type(), text, back, &why) || back != v) {
+        if (bad++ < 5)
+            std::fprintf(stderr, "mismatch: %s %s -> %s\n", what, text.c_str(), why.c_str());
+        return;
+    }
+    const char* type = nvapi::format_nip(v, nip);
+    if (!type || !nvapi::parse_nip(type, nip, declared, back, &why) || back != v) {
+        if (bad++ < 5)
+            std::fprintf(stderr, "mismatch: %s %s -> %s %s -> %s\n", what, text.c_str(), type ? type : "?",
+                         nip.c_str(), why.c_str());
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 2 || argc > 4) {
+        std::fprintf(stderr, "usage: bench_nvapi_value <snapshot> [budget M/s] [values]\n");
+        return 2;
+    }
+    double budget = argc > 2 ? std::atof(argv[2]) : 10.0;
+    long count = argc > 3 ? std::atol(argv[3]) : 2000000;
+    if (count < 1)
+        count = 1;
+
+    nvapi::Snapshot snap;
+    std::string why;
+    if (!snap.open(argv[1], &why)) {
+        std::fprintf(stderr, "error: %s: %s\n", argv[1], why.c_str());
+        return 1;
+    }
+
+    size_t defaults[6] = {};
+    nvapi::SectionRecord r;
+    nvapi::Value v;
+    for (size_t i = 0; i < snap.size(); ++i) {
+        snap.read(i, r);
+        for (const nvapi::Default& d : r.defaults) {
+            if (d.label.substr(0, 7) != "DEFAULT")
+                continue;
+            if (!nvapi::resolve_default(r, d, v, &why)) {
+                if (bad++ < 5)
+                    std::fprintf(stderr, "error: %.*s: %s\n", int(r.section.name.size()), r.section.name.data(),
+                                 why.c_str());
+                continue;
+            }
+            ++defaults[size_t(v.type())];
+            round_trip(v, r.section.type, "default");
+        }
+    }
+
+    // Every 4099th float, which reaches every exponent and both signs, plus
+    // the infinities and a NaN with a payload.
+    size_t floats = 0;
+    for (uint64_t bits = 0; bits <= 0xffffffffu; bits += 4099, ++floats) {
+        float f;
+        uint32_t b = uint32_t(bits);
+        std::memcpy(&f, &b, sizeof f);
+        round_trip(nvapi::Value::real(f), nvapi::ValueType::Float, "float");
+    }
+    for (uint32_t b : {0x7f800000u, 0xff800000u, 0x7fc00001u, 0x80000000u, 0x00000001u}) {
+        float f;
+        std::memcpy(&f, &b, sizeof f);
+        round_trip(nvapi::Value::real(f), nvapi::ValueType::Float, "float");
+    }
+    std::mt19937_64 rng64(12345);
+    for (int i = 0; i < 100000; ++i)
+        round_trip(nvapi::Value::qword(rng64() >> (rng64() % 64)), nvapi::ValueType::Qword, "qword");
+    round_trip(nvapi::Value::string("id,2.0:268410DE,00000100,GF - (400,2,161,24564) @ (0)"), nvapi::ValueType::String,
+               "string");
+    round_trip(nvapi::Value::binary(std::string_view("\0\0\0\x40\0\0\0\0", 8)), nvapi::ValueType::Binary, "binary");
+
+    // The timed part: what reading and writing a profile does per DWORD.
+    std::mt19937 rng(12345);
+    std::vector<std::string> text(static_cast<size_t>(count));
+    for (long i = 0; i < count; ++i)
+        text[i] = std::to_string(rng() >> (rng() % 32));
+    std::string out;
+    out.reserve(16);
+    uint64_t sum = 0;
+    size_t before = allocations;
+    using Clock = std::chrono::steady_clock;
+    auto t0 = Clock::now();
+    for (long i = 0; i < count; ++i) {
+        if (!nvapi::parse_nip("Dword", text[i], nvapi::ValueType::Dword, v)) {
+            ++bad;
+            continue;
+        }
+        out.clear();
+        nvapi::format_nip(v, out);
+        sum += out.size() + v.as_dword();
+    }
+    double secs = std::chrono::duration<double>(Clock::now() - t0).count();
+    size_t allocated = allocations - before;
+    double rate = double(count) / secs / 1e6;
+
+    std::printf("%zu DWORD, %zu QWORD, %zu FLOAT, %zu STRING defaults round-trip\n", defaults[1], defaults[4],
+                defaults[3], defaults[2]);
+    std::printf("%zu floats, 100000 qwords round-trip\n", floats);
+    std::printf("%ld DWORD values, %.1f M conversions/s, budget %.1f M/s, %zu allocations (%llu)\n", count, rate,
+                budget, allocated, (unsigned long long)sum);
+    if (bad) {
+        std::fprintf(stderr, "error: %ld values did not come back the same\n", bad);
+        return 1;
+    }
+    if (allocated) {
+        std::fprintf(stderr, "error: DWORD conversions allocated\n");
+        return 1;
+    }
+    if (rate < budget) {
+        std::fprintf(stderr, "error: under budget\n");
+        return 1;
+    }
+    return 0;
+}
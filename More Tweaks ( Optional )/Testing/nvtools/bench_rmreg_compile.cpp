@@ -0,0 +1,174 @@
+// bench_rmreg_compile.cpp
+//
+// How long a small tool takes to compile against the catalog, four ways:
+//
+//   #include      rmreg_catalog.h and rmreg_fields.h parsed every time (cold)
+//   pch           the same through a precompiled rmreg_pch.h (warm)
+//   module        import nvtools.rmreg, rmreg.cppm over header units (warm)
+//   nvRmReg.h     the raw header with stubs/, for comparison
+//
+// The pch and module rows also show what building them once costs. Run it
+// from nvtools/; everything it builds goes in a temporary directory:
+//
+//   bench_rmreg_compile [compiler, default $CXX or g++] [runs, default 3]
+//
+// The command lines are GCC's; the module row needs -fmodules-ts (GCC 11+)
+// and is skipped when the compiler lacks it. Exits with 1 if any other
+// build fails.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <system_error>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+const char kBody[] =
+    "int main()\n"
+    "{\n"
+    "    const rmreg::Key* k = rmreg::find(\"RmOptp\");\n"
+    "    using O = rmreg::fields::RmOptp;\n"
+    "    return int(k->field_count + O::DELAY_4MS::get(O::DELAY_4MS::encode<50>()));\n"
+    "}\n";
+
+std::string quote(const fs::path& p)
+{
+    return "\"" + p.string() + "\"";
+}
+
+bool write(const fs::path& p, const std::string& text)
+{
+    std::ofstream f(p, std::ios::binary);
+    f << text;
+    return bool(f);
+}
+
+std::optional<double> run_ms(const std::string& cmd)
+{
+    auto t0 = Clock::now();
+    int rc = std::system(cmd.c_str());
+    double ms = std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+    if (rc != 0)
+        return std::nullopt;
+    return ms;
+}
+
+// Best of runs, nullopt if any run fails.
+std::optional<double> best_ms(const std::string& cmd, int runs)
+{
+    double best = 1e30;
+    for (int r = 0; r < runs; ++r) {
+        auto ms = run_ms(cmd);
+        if (!ms)
+            return std::nullopt;
+        best = std::min(best, *ms);
+    }
+    return best;
+}
+
+void row(const char* what, double ms, double cold, std::optional<double> built = std::nullopt)
+{
+    std::printf("%-20s %7.0f ms", what, ms);
+    if (built) {
+        std::printf("   %4.1fx faster, built once in %.0f ms", cold / ms, *built);
+        if (cold > ms)
+            std::printf(", pays off after %.0f TUs", std::max(1.0, *built / (cold - ms)));
+    }
+    std::printf("\n");
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc > 3) {
+        std::fprintf(stderr, "usage: bench_rmreg_compile [compiler] [runs]\n");
+        return 2;
+    }
+    const char* env = std::getenv("CXX");
+    std::string cxx = argc > 1 ? argv[1] : env && *env ? env : "g++";
+    int runs = argc > 2 ? std::max(1, std::atoi(argv[2])) : 3;
+
+    std::error_code ec;
+    const fs::path src = fs::absolute(fs::current_path());
+    if (!fs::exists(src / "rmreg_catalog.h", ec)) {
+        std::fprintf(stderr, "error: run from nvtools/, rmreg_catalog.h is not here\n");
+        return 1;
+    }
+    const fs::path tmp = fs::temp_directory_path(ec) / "nvtools_compile_bench";
+    fs::remove_all(tmp, ec);
+    if (!fs::create_directories(tmp, ec)) {
+        std::fprintf(stderr, "error: cannot create %s\n", tmp.string().c_str());
+        return 1;
+    }
+    // GCC writes module files to gcm.cache/ under the working directory.
+    fs::current_path(tmp, ec);
+
+    const std::string cxx17 = cxx + " -std=c++17 -O2";
+    const std::string cxx20 = cxx + " -std=c++20 -fmodules-ts -O2";
+    const std::string inc = " -I" + quote(src);
+    bool ok = write(tmp / "empty.cpp", "int main() { return 0; }\n")
+        && write(tmp / "include.cpp", "#include \"rmreg_catalog.h\"\n#include \"rmreg_fields.h\"\n\n" + std::string(kBody))
+        && write(tmp / "pch.cpp", "#include \"rmreg_pch.h\"\n\n" + std::string(kBody))
+        && write(tmp / "module.cpp", "import nvtools.rmreg;\n\n" + std::string(kBody))
+        && write(tmp / "raw.cpp", "#include \"nvRmReg.h\"\n\nint main() { return int(sizeof NV_REG_STR_RM_OPTP"
+                                  " + NV_REG_STR_RM_INST_LOC_PTE_VID); }\n");
+    if (!ok) {
+        std::fprintf(stderr, "error: cannot write to %s\n", tmp.string().c_str());
+        return 1;
+    }
+
+    auto empty = best_ms(cxx17 + " -c empty.cpp -o empty.o", runs);
+    auto raw = best_ms(cxx17 + " -I" + quote(src.parent_path()) + " -I" + quote(src / "stubs")
+                       + " -c raw.cpp -o raw.o", runs);
+    auto cold = best_ms(cxx17 + inc + " -c include.cpp -o include.o", runs);
+    if (!empty || !raw || !cold) {
+        std::fprintf(stderr, "error: %s failed\n", !empty ? "empty.cpp" : !raw ? "raw.cpp" : "include.cpp");
+        return 1;
+    }
+
+    // The .gch lands next to pch.cpp, where #include "rmreg_pch.h" looks first.
+    auto pch_build = run_ms(cxx17 + inc + " -x c++-header " + quote(src / "rmreg_pch.h")
+                            + " -o rmreg_pch.h.gch");
+    auto pch = pch_build ? best_ms(cxx17 + " -Winvalid-pch" + inc + " -c pch.cpp -o pch.o", runs)
+                         : std::nullopt;
+    if (!pch) {
+        std::fprintf(stderr, "error: the pch build failed\n");
+        return 1;
+    }
+
+    std::optional<double> module_build = 0.0;
+    for (const char* part : {"rmreg_catalog.h", "rmreg_fields.h"}) {
+        auto ms = module_build ? run_ms(cxx20 + inc + " -x c++-header -c " + quote(src / part))
+                               : std::nullopt;
+        module_build = ms ? std::optional<double>(*module_build + *ms) : std::nullopt;
+    }
+    if (module_build) {
+        auto ms = run_ms(cxx20 + inc + " -x c++ -c " + quote(src / "rmreg.cppm") + " -o rmreg_module.o");
+        module_build = ms ? std::optional<double>(*module_build + *ms) : std::nullopt;
+    }
+    auto module = module_build ? best_ms(cxx20 + inc + " -c module.cpp -o module.o", runs) : std::nullopt;
+
+    std::printf("%s, best of %d\n", cxx.c_str(), runs);
+    row("empty TU", *empty, *cold);
+    row("nvRmReg.h + stubs", *raw, *cold);
+    row("catalog #include", *cold, *cold);
+    row("catalog pch", *pch, *cold, pch_build);
+    if (module)
+        row("catalog module", *module, *cold, module_build);
+    else
+        std::printf("%-20s skipped, %s could not build rmreg.cppm\n", "catalog module", cxx.c_str());
+
+    fs::current_path(src, ec);
+    fs::remove_all(tmp, ec);
+    return 0;
+}
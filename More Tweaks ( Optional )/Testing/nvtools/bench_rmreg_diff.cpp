@@ -0,0 +1,212 @@
+// bench_rmreg_diff.cpp
+//
+// Makes a second revision of a header with known edits (bench_edit.h), one
+// key block replaced by a new key, a field widened and a field _DEFAULT
+// changed, and checks rmreg_diff reports exactly those four changes, and as
+// many the other way round. Then diffs a series of revisions alternating
+// between the two, as rmreg_diff does with several headers, and fails if
+// that takes longer than the budget:
+//
+//   bench_rmreg_diff ../nvRmReg.h [budget ms, default 250] [revisions, default 20]
+//
+// After the first two headers every block is already in the summary cache,
+// so the rest of the series has to summarize nothing.
+
+#include "bench_edit.h"
+#include "mapped_file.h"
+#include "rmreg_diff.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace {
+
+using nvtools::Edit;
+using nvtools::offset_in;
+
+std::string hex(uint32_t v)
+{
+    char buf[16];
+    std::snprintf(buf, sizeof buf, "0x%x", v);
+    return buf;
+}
+
+std::string line_of(const rmreg::Change& c)
+{
+    return std::string(rmreg::change_name(c.kind)) + " " + c.key + (c.field.empty() ? "" : "." + c.field) + " "
+        + c.before + " -> " + c.after;
+}
+
+// Keys whose name no other key has, so the snapshot keeps their block.
+std::vector<bool> unique_keys(const rmreg::Index& ix)
+{
+    std::vector<std::string> names;
+    for (const rmreg::KeyBlock& k : ix.keys)
+        names.push_back(nvtools::folded(ix.key_name(k)));
+    std::vector<std::string> sorted = names;
+    std::sort(sorted.begin(), sorted.end());
+    std::vector<bool> out;
+    for (const std::string& n : names)
+        out.push_back(std::upper_bound(sorted.begin(), sorted.end(), n)
+                      - std::lower_bound(sorted.begin(), sorted.end(), n) == 1);
+    return out;
+}
+
+// The edits, and the changes rmreg_diff has to find for them in header
+// order. false if the header has no key to make one of them with.
+bool plan(const rmreg::Index& ix, std::vector<Edit>& edits, std::vector<std::string>& want)
+{
+    std::vector<bool> unique = unique_keys(ix);
+    std::vector<std::pair<size_t, std::string>> changes;
+    size_t removed = ix.keys.size(), widened = ix.keys.size(), defaulted = ix.keys.size();
+
+    // A key block holding no define but its key, replaced by a new key.
+    for (size_t k = 0; k < ix.keys.size() && removed == ix.keys.size(); ++k) {
+        const rmreg::KeyBlock& kb = ix.keys[k];
+        if (!unique[k] || kb.child_count || kb.last_line >= ix.lines.size())
+            continue;
+        bool alone = true;
+        for (uint32_t l = kb.first_line; l < kb.last_line; ++l)
+            alone = alone && (ix.lines[l].kind != rmreg::LineKind::Define || l == ix.key_define(kb).line);
+        if (!alone)
+            continue;
+        removed = k;
+        size_t begin = ix.lines[kb.first_line].begin, end = ix.lines[kb.last_line].begin;
+        edits.push_back({begin, end, "#define NV_REG_STR_RM_BENCH_DIFF_ADDED \"RmBenchDiffAdded\"\n"});
+        want.push_back("removed " + std::string(ix.key_name(kb)) + " " + std::string(ix.key_macro(kb)) + " -> ");
+        changes.push_back({begin, "added RmBenchDiffAdded  -> NV_REG_STR_RM_BENCH_DIFF_ADDED"});
+    }
+
+    // A field one bit wider, and another key's field with its only
+    // _DEFAULT flipped.
+    for (size_t k = 0; k < ix.keys.size(); ++k) {
+        const rmreg::KeyBlock& kb = ix.keys[k];
+        if (!unique[k] || k == removed || ix.key_condition(kb).expr != "")
+            continue;
+        std::string macro(ix.key_macro(kb));
+        for (uint32_t c = 0; c < kb.child_count; ++c) {
+            const rmreg::Define& d = ix.defines[ix.children[kb.child_begin + c]];
+            std::optional<rmreg::BitRange> r = rmreg::parse_range(d.value);
+            if (!r || d.name.size() <= macro.size())
+                continue;
+            std::string field(d.name.substr(macro.size() + 1));
+            std::string at = " " + std::string(ix.key_name(kb)) + "." + field + " ";
+            if (widened == ix.keys.size() && r->hi < 31) {
+                widened = k;
+                std::string before = std::to_string(r->hi) + ":" + std::to_string(r->lo);
+                std::string after = std::to_string(r->hi + 1) + ":" + std::to_string(r->lo);
+                size_t begin = offset_in(ix.source, d.value);
+                edits.push_back({begin, begin + d.value.size(), after});
+                changes.push_back({begin, "field width" + at + before + " -> " + after});
+                break;
+            }
+            if (defaulted != ix.keys.size() || k == widened)
+                continue;
+            const rmreg::Define* def = nullptr;
+            size_t count = 0;
+            for (uint32_t e = 0; e < kb.child_count; ++e) {
+                const rmreg::Define& x = ix.defines[ix.children[kb.child_begin + e]];
+                if (x.name == macro + "_" + field + "_DEFAULT") {
+                    def = &x;
+                    ++count;
+                }
+            }
+            std::optional<uint32_t> v = def ? rmreg::evaluate(ix, def->value) : std::nullopt;
+            if (count != 1 || !v || def->condition != 0)
+                continue;
+            defaulted = k;
+            size_t begin = offset_in(ix.source, def->value);
+            edits.push_back({begin, begin + def->value.size(), hex(*v ^ 1)});
+            changes.push_back({begin, "default" + at + hex(*v) + " -> " + hex(*v ^ 1)});
+            break;
+        }
+    }
+    if (removed == ix.keys.size() || widened == ix.keys.size() || defaulted == ix.keys.size())
+        return false;
+
+    std::sort(changes.begin(), changes.end());
+    for (auto& c : changes)
+        want.push_back(c.second);
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 2 || argc > 4) {
+        std::fprintf(stderr, "usage: bench_rmreg_diff <header> [budget ms] [revisions]\n");
+        return 2;
+    }
+    double budget = argc > 2 ? std::atof(argv[2]) : 250.0;
+    int revisions = argc > 3 ? std::atoi(argv[3]) : 20;
+    if (revisions < 2)
+        revisions = 2;
+
+    nvtools::MappedFile f;
+    if (!f.open(argv[1])) {
+        std::fprintf(stderr, "error: cannot map %s\n", argv[1]);
+        return 1;
+    }
+    rmreg::Index old_ix = rmreg::index_header(f.view());
+    std::vector<Edit> edits;
+    std::vector<std::string> want;
+    if (!plan(old_ix, edits, want)) {
+        std::fprintf(stderr, "error: %s has no keys to edit\n", argv[1]);
+        return 1;
+    }
+    std::string edited = nvtools::apply_edits(f.view(), edits);
+    rmreg::Index new_ix = rmreg::index_header(edited);
+
+    rmreg::SummaryCache cache;
+    rmreg::Snapshot a = rmreg::snapshot(old_ix, cache);
+    size_t first = cache.misses();
+    rmreg::Snapshot b = rmreg::snapshot(new_ix, cache);
+    size_t second = cache.misses() - first;
+    std::vector<std::string> got;
+    for (const rmreg::Change& c : rmreg::diff(a, b))
+        got.push_back(line_of(c));
+    bool wrong = !nvtools::same_lines(want, got);
+    bool reverse_wrong = rmreg::diff(b, a).size() != want.size();
+
+    // The series: each header indexed, snapshotted and diffed against the
+    // one before, with one cache.
+    using Clock = std::chrono::steady_clock;
+    rmreg::SummaryCache series;
+    rmreg::Snapshot prev;
+    size_t changes = 0;
+    auto t0 = Clock::now();
+    for (int r = 0; r < revisions; ++r) {
+        rmreg::Index ix = rmreg::index_header(r % 2 ? std::string_view(edited) : f.view());
+        rmreg::Snapshot cur = rmreg::snapshot(ix, series);
+        if (r)
+            changes += rmreg::diff(prev, cur).size();
+        prev = std::move(cur);
+    }
+    double ms = std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+
+    std::printf("%zu key blocks, %zu summarized for the first header, %zu for the edited one\n",
+                old_ix.keys.size(), first, second);
+    for (const std::string& g : got)
+        std::printf("  %s\n", g.c_str());
+    std::printf("%d revisions in %.2f ms (budget %.0f ms), %zu changes, %zu summarized, %zu reused\n",
+                revisions, ms, budget, changes, series.misses(), series.hits());
+    if (wrong || reverse_wrong) {
+        std::fprintf(stderr, "error: the diff is not the edits made\n");
+        return 1;
+    }
+    // The new key and the two edited keys; nothing else.
+    if (second != 3 || series.misses() != first + second || changes != want.size() * size_t(revisions - 1)) {
+        std::fprintf(stderr, "error: unchanged blocks were summarized again\n");
+        return 1;
+    }
+    if (ms > budget) {
+        std::fprintf(stderr, "error: over budget\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,56 @@
+// bench_rmreg_index.cpp
+//
+// Times map + index_header() over a header and fails if the best run is over
+// budget, so a slow scanner change shows up as a red CI step:
+//
+//   bench_rmreg_index ../nvRmReg.h [budget ms, default 10] [runs, default 50]
+
+#include "mapped_file.h"
+#include "rmreg_scan.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+int main(int argc, char** argv)
+{
+    if (argc < 2 || argc > 4) {
+        std::fprintf(stderr, "usage: bench_rmreg_index <header> [budget ms] [runs]\n");
+        return 2;
+    }
+    double budget = argc > 2 ? std::atof(argv[2]) : 10.0;
+    int runs = argc > 3 ? std::atoi(argv[3]) : 50;
+    if (runs < 1)
+        runs = 1;
+
+    using Clock = std::chrono::steady_clock;
+    std::vector<double> times;
+    size_t keys = 0, defines = 0, lines = 0, bytes = 0;
+    for (int r = 0; r < runs; ++r) {
+        auto t0 = Clock::now();
+        nvtools::MappedFile f;
+        if (!f.open(argv[1])) {
+            std::fprintf(stderr, "error: cannot map %s\n", argv[1]);
+            return 1;
+        }
+        rmreg::Index ix = rmreg::index_header(f.view());
+        times.push_back(std::chrono::duration<double, std::milli>(Clock::now() - t0).count());
+        keys = ix.keys.size();
+        defines = ix.defines.size();
+        lines = ix.lines.size();
+        bytes = f.size();
+    }
+    std::sort(times.begin(), times.end());
+    double best = times.front();
+    double median = times[times.size() / 2];
+    std::printf("%zu bytes, %zu lines, %zu defines, %zu keys\n", bytes, lines, defines, keys);
+    std::printf("best %.3f ms, median %.3f ms (%.0f MB/s), budget %.1f ms\n",
+                best, median, double(bytes) / best / 1000.0, budget);
+    if (best > budget) {
+        std::fprintf(stderr, "error: over budget\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,140 @@
+// bench_rmreg_lint.cpp
+//
+// Lints a .reg and a .bat file written with known mistakes and checks the
+// findings are exactly those, then times what rmreg_lint pays before it
+// reads a script (index the header, build the key index) plus linting both
+// files, and fails if the best run is over budget:
+//
+//   bench_rmreg_lint ../nvRmReg.h [budget ms, default 20] [runs, default 20]
+
+#include "mapped_file.h"
+#include "rmreg_lint.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace {
+
+// CRLF, as regedit writes it. "RmOptp"= has no data at all.
+constexpr const char* kReg =
+    "Windows Registry Editor Version 5.00\r\n"
+    "\r\n"
+    "[HKEY_LOCAL_MACHINE\\SYSTEM\\CurrentControlSet\\Services\\nvlddmkm]\r\n"
+    "\"RmNumaAllocSkipReclaimPercent\"=dword:00000032\r\n"
+    "\"RmNumaAllocSkipReclaimPercent\"=dword:00000065\r\n"
+    "\"RMDeepLlEntryLatencyUsec\"=dword:00000001\r\n"
+    "\"RmOptp\"=\r\n"
+    "\"RMDisablePostL2Compression\"=hex:01,\\\r\n"
+    "  00\r\n"
+    "\"RmNumaAllocSkipReclaimPercent\"=-\r\n"
+    "\"RmOptp\"=\r\n";
+
+// /d 010 and /d 0101 are decimal to reg.exe: 10 is in range, 101 is not.
+constexpr const char* kBat =
+    "@echo off\n"
+    "reg add \"HKLM\\SYSTEM\\CurrentControlSet\\Services\\nvlddmkm\" /v RmNumaAllocSkipReclaimPercent /t REG_DWORD /d 010 /f\n"
+    "reg add \"HKLM\\SYSTEM\\CurrentControlSet\\Services\\nvlddmkm\" /v RmNumaAllocSkipReclaimPercent /t REG_DWORD /d 0101 /f\n"
+    "Reg.exe add \"HKLM\\SYSTEM\\CurrentControlSet\\Services\\nvlddmkm\" /v RmNumaAllocSkipReclaimPercent /t REG_DWORD /d 0x65 /f\n"
+    "echo reg add \"HKLM\\SYSTEM\\CurrentControlSet\\Services\\nvlddmkm\" /v RmNoSuchKey /t REG_DWORD /d 1 /f\n"
+    "reg add \"HKLM\\SYSTEM\\CurrentControlSet\\Services\\nvlddmkm\" /v RMDisablePostL2Compression /t REG_SZ /d 1 /f\n";
+
+struct Want {
+    uint32_t line;
+    const char* message;
+};
+
+const Want kRegWant[] = {
+    {5, "RmNumaAllocSkipReclaimPercent = 101 is outside 0..100"},
+    {6, "RMDeepLlEntryLatencyUsec is not a key in nvRmReg.h, did you mean RMDeepL1EntryLatencyUsec?"},
+    {7, "RmOptp has no data after the ="},
+    {8, "RMDisablePostL2Compression is a DWORD key, written as binary"},
+    {11, "RmOptp has no data after the ="},
+};
+
+const Want kBatWant[] = {
+    {3, "RmNumaAllocSkipReclaimPercent = 101 is outside 0..100"},
+    {4, "RmNumaAllocSkipReclaimPercent = 101 is outside 0..100"},
+    {6, "RMDisablePostL2Compression is a DWORD key, written as a string"},
+};
+
+// Every finding an error, each the one wanted on its line.
+template <size_t N>
+size_t check(const char* file, const std::vector<rmreg::Finding>& got, const Want (&want)[N])
+{
+    size_t wrong = got.size() != N;
+    for (size_t i = 0; i < std::max(got.size(), N); ++i) {
+        bool ok = i < got.size() && i < N && got[i].line == want[i].line
+            && got[i].severity == rmreg::Severity::Error && got[i].message == want[i].message;
+        if (!ok) {
+            std::fprintf(stderr, "%s: want %u: %s\n%s:  got %u: %s\n", file, i < N ? want[i].line : 0,
+                         i < N ? want[i].message : "", file, i < got.size() ? got[i].line : 0,
+                         i < got.size() ? got[i].message.c_str() : "");
+            ++wrong;
+        }
+    }
+    return wrong;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 2 || argc > 4) {
+        std::fprintf(stderr, "usage: bench_rmreg_lint <header> [budget ms] [runs]\n");
+        return 2;
+    }
+    double budget = argc > 2 ? std::atof(argv[2]) : 20.0;
+    int runs = argc > 3 ? std::atoi(argv[3]) : 20;
+    if (runs < 1)
+        runs = 1;
+
+    nvtools::MappedFile f;
+    if (!f.open(argv[1])) {
+        std::fprintf(stderr, "error: cannot map %s\n", argv[1]);
+        return 1;
+    }
+
+    using Clock = std::chrono::steady_clock;
+    std::vector<double> times;
+    std::vector<rmreg::RegWrite> reg, bat;
+    std::vector<rmreg::Finding> reg_found, bat_found;
+    size_t keys = 0;
+    for (int r = 0; r < runs; ++r) {
+        auto t0 = Clock::now();
+        rmreg::Index ix = rmreg::index_header(f.view());
+        rmreg::KeyIndex index(ix);
+        reg = rmreg::parse_reg_file(kReg);
+        bat = rmreg::parse_bat_file(kBat);
+        reg_found.clear();
+        bat_found.clear();
+        rmreg::lint_writes(index, reg, reg_found);
+        rmreg::lint_writes(index, bat, bat_found);
+        times.push_back(std::chrono::duration<double, std::milli>(Clock::now() - t0).count());
+        keys = index.size();
+    }
+    std::sort(times.begin(), times.end());
+    double best = times.front();
+
+    size_t wrong = check("a.reg", reg_found, kRegWant) + check("a.bat", bat_found, kBatWant);
+    // The continued hex: value takes the next line; the - deletes.
+    wrong += reg.size() != 7 || reg[4].data != "hex:01,\\\r\n  00" || reg[5].type != rmreg::RegType::Delete;
+    wrong += bat.size() != 4 || bat[0].dword != 10u || bat[1].dword != 101u || bat[2].dword != 0x65u;
+
+    std::printf("%zu keys, %zu + %zu values, %zu + %zu findings\n", keys, reg.size(), bat.size(),
+                reg_found.size(), bat_found.size());
+    std::printf("index + lint  best %.2f ms, median %.2f ms, budget %.1f ms\n", best,
+                times[times.size() / 2], budget);
+    if (wrong) {
+        std::fprintf(stderr, "error: the findings are not the mistakes made\n");
+        return 1;
+    }
+    if (best > budget) {
+        std::fprintf(stderr, "error: over budget\n");
+        return 1;
+    }
+    return 0;
+}
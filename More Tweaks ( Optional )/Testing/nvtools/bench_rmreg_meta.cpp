@@ -0,0 +1,156 @@
+// bench_rmreg_meta.cpp
+//
+// Builds the metadata store from a header, then times what a logon-time
+// validator pays per run: open (map and check) the store and find a key.
+// Fails if the best run is over budget:
+//
+//   bench_rmreg_meta ../nvRmReg.h rmreg_meta.bin [budget ms, default 0.5] [runs, default 200]
+//
+// Every key the header has is then looked up, in the case it is written in
+// and in upper case, and its record checked against what extract_meta()
+// gives; a key with a name seen before has to come back as the first one.
+// A few keys whose comments are spelled in the odd ways the normalizing is
+// for are checked against what they mean.
+
+#include "rmreg_meta.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace {
+
+bool same(const rmreg::MetaStore::Key& k, const rmreg::KeyMeta& m)
+{
+    if (k.name() != m.name || k.type() != m.type || k.type_inferred() != m.type_inferred
+        || k.boolean() != m.boolean || k.min() != m.min || k.max() != m.max
+        || k.default_value() != m.default_value || k.unit() != m.unit || k.value_count() != m.values.size())
+        return false;
+    for (size_t i = 0; i < m.values.size(); ++i)
+        if (k.value(i).name != m.values[i].name || k.value(i).value != m.values[i].value)
+            return false;
+    return true;
+}
+
+std::string upper(std::string_view s)
+{
+    std::string out(s);
+    for (char& c : out)
+        if (c >= 'a' && c <= 'z')
+            c = char(c - 'a' + 'A');
+    return out;
+}
+
+// Some of nvRmReg.h's keys, all DWORDs, and what their comments say. A key
+// the header does not have is skipped, so other revisions can be benched.
+struct Known {
+    const char* name;
+    bool type_inferred;
+    bool boolean;
+    std::optional<uint32_t> min;
+    std::optional<uint32_t> max;
+    rmreg::Unit unit;
+};
+
+const Known kKnown[] = {
+    {"RmNumaAllocSkipReclaimPercent", false, false, 0, 100, rmreg::Unit::Percent},
+    {"RMDisablePostL2Compression", false, true, 0, 1, rmreg::Unit::None},
+    {"RmEnableDHKeyExchange", false, true, 0, 1, rmreg::Unit::None},      // "Type DWORD (Boolean)"
+    {"RmPerfOverride", false, false, std::nullopt, std::nullopt, rmreg::Unit::None},   // "Type: DWROD"
+};
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 3 || argc > 5) {
+        std::fprintf(stderr, "usage: bench_rmreg_meta <header> <store> [budget ms] [runs]\n");
+        return 2;
+    }
+    double budget = argc > 3 ? std::atof(argv[3]) : 0.5;
+    int runs = argc > 4 ? std::atoi(argv[4]) : 200;
+    if (runs < 1)
+        runs = 1;
+
+    nvtools::MappedFile f;
+    if (!f.open(argv[1])) {
+        std::fprintf(stderr, "error: cannot read %s\n", argv[1]);
+        return 1;
+    }
+    rmreg::Index ix = rmreg::index_header(f.view());
+    std::vector<rmreg::KeyMeta> keys;
+    for (const rmreg::KeyBlock& k : ix.keys)
+        keys.push_back(rmreg::extract_meta(ix, k));
+    if (keys.empty()) {
+        std::fprintf(stderr, "error: %s has no keys\n", argv[1]);
+        return 1;
+    }
+    if (!rmreg::write_meta_store(argv[2], keys)) {
+        std::fprintf(stderr, "error: cannot write %s\n", argv[2]);
+        return 1;
+    }
+
+    using Clock = std::chrono::steady_clock;
+    std::vector<double> times;
+    const std::string& name = keys.back().name;
+    for (int r = 0; r < runs; ++r) {
+        auto t0 = Clock::now();
+        rmreg::MetaStore store;
+        if (!store.open(argv[2])) {
+            std::fprintf(stderr, "error: cannot open %s\n", argv[2]);
+            return 1;
+        }
+        if (!store.find(name)) {
+            std::fprintf(stderr, "error: %s is not in %s\n", name.c_str(), argv[2]);
+            return 1;
+        }
+        times.push_back(std::chrono::duration<double, std::milli>(Clock::now() - t0).count());
+    }
+    std::sort(times.begin(), times.end());
+    double best = times.front();
+    double median = times[times.size() / 2];
+
+    rmreg::MetaStore store;
+    store.open(argv[2]);
+    std::set<std::string> seen;
+    size_t wrong = 0;
+    for (const rmreg::KeyMeta& m : keys) {
+        if (!seen.insert(nvtools::folded(m.name)).second)
+            continue;
+        std::optional<rmreg::MetaStore::Key> k = store.find(m.name);
+        std::optional<rmreg::MetaStore::Key> u = store.find(upper(m.name));
+        if (!k || !u || !same(*k, m) || !same(*u, m)) {
+            std::fprintf(stderr, "error: %s comes back wrong\n", m.name.c_str());
+            ++wrong;
+        }
+    }
+    wrong += store.size() != seen.size() || store.find("RmNoSuchKeyInTheHeader").has_value();
+    size_t known = 0;
+    for (const Known& w : kKnown) {
+        std::optional<rmreg::MetaStore::Key> k = store.find(w.name);
+        if (!k)
+            continue;
+        ++known;
+        if (k->type() != rmreg::KeyType::Dword || k->type_inferred() != w.type_inferred
+            || k->boolean() != w.boolean || k->min() != w.min || k->max() != w.max || k->unit() != w.unit) {
+            std::fprintf(stderr, "error: %s is not read the way its comments mean\n", w.name);
+            ++wrong;
+        }
+    }
+
+    std::printf("%zu keys, %zu stored, %zu checked against their comments\n", keys.size(), store.size(), known);
+    std::printf("open + find  best %.3f ms, median %.3f ms, budget %.2f ms\n", best, median, budget);
+    if (wrong) {
+        std::fprintf(stderr, "error: %zu keys are wrong in the store\n", wrong);
+        return 1;
+    }
+    if (best > budget) {
+        std::fprintf(stderr, "error: over budget\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,108 @@
+// byte_scan.h
+//
+// 16-bytes-at-a-time searches for the scanners. SSE2 is part of every x86-64
+// target, so there is no runtime dispatch; other targets get plain loops.
+
+#ifndef NVTOOLS_BYTE_SCAN_H
+#define NVTOOLS_BYTE_SCAN_H
+
+#include "text_util.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define NVTOOLS_SSE2 1
+#include <emmintrin.h>
+#endif
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace nvtools {
+
+namespace detail {
+
+inline unsigned first_bit(unsigned m)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long i;
+    _BitScanForward(&i, m);
+    return unsigned(i);
+#else
+    return unsigned(__builtin_ctz(m));
+#endif
+}
+
+} // namespace detail
+
+// Offset of the first a or b in s at or after from, or npos. Pass the same
+// byte twice to look for one.
+inline size_t find_either(std::string_view s, char a, char b, size_t from = 0)
+{
+    const char* p = s.data();
+    size_t i = from;
+#if defined(NVTOOLS_SSE2)
+    const __m128i va = _mm_set1_epi8(a);
+    const __m128i vb = _mm_set1_epi8(b);
+    for (; i + 16 <= s.size(); i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+        unsigned m = unsigned(_mm_movemask_epi8(
+            _mm_or_si128(_mm_cmpeq_epi8(v, va), _mm_cmpeq_epi8(v, vb))));
+        if (m)
+            return i + detail::first_bit(m);
+    }
+#endif
+    for (; i < s.size(); ++i)
+        if (p[i] == a || p[i] == b)
+            return i;
+    return std::string_view::npos;
+}
+
+inline size_t find_byte(std::string_view s, char c, size_t from = 0)
+{
+    return find_either(s, c, c, from);
+}
+
+// Offset of needle in s at or after from, in any case, or npos. The first
+// byte is looked for in both cases at once, then the rest compared.
+inline size_t find_nocase(std::string_view s, std::string_view needle, size_t from = 0)
+{
+    if (needle.empty())
+        return from <= s.size() ? from : std::string_view::npos;
+    char lo = fold(needle[0]);
+    char up = lo >= 'a' && lo <= 'z' ? char(lo - 'a' + 'A') : lo;
+    for (size_t i = find_either(s, lo, up, from); i != std::string_view::npos; i = find_either(s, lo, up, i + 1)) {
+        if (needle.size() > s.size() - i)
+            break;
+        if (iequals(s.substr(i, needle.size()), needle))
+            return i;
+    }
+    return std::string_view::npos;
+}
+
+// Number of c in s, e.g. newlines before an offset.
+inline size_t count_byte(std::string_view s, char c)
+{
+    const char* p = s.data();
+    size_t i = 0, n = 0;
+#if defined(NVTOOLS_SSE2)
+    const __m128i vc = _mm_set1_epi8(c);
+    for (; i + 16 <= s.size(); i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+        unsigned m = unsigned(_mm_movemask_epi8(_mm_cmpeq_epi8(v, vc)));
+        while (m) {
+            ++n;
+            m &= m - 1;
+        }
+    }
+#endif
+    for (; i < s.size(); ++i)
+        n += p[i] == c;
+    return n;
+}
+
+} // namespace nvtools
+
+#endif // NVTOOLS_BYTE_SCAN_H
@@ -0,0 +1,126 @@
+// mapped_file.cpp
+
+#include "mapped_file.h"
+
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace nvtools {
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+{
+    *this = std::move(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    if (this != &other) {
+        close();
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+#if defined(_WIN32)
+        std::swap(file_, other.file_);
+        std::swap(mapping_, other.mapping_);
+#endif
+    }
+    return *this;
+}
+
+#if defined(_WIN32)
+
+bool MappedFile::open(const char* path)
+{
+    close();
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+        CloseHandle(file);
+        return false;
+    }
+    file_ = file;
+    if (size.QuadPart == 0)
+        return true;
+    // CreateFileMapping refuses empty files, hence the early return above.
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        close();
+        return false;
+    }
+    mapping_ = mapping;
+    data_ = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    if (!data_) {
+        close();
+        return false;
+    }
+    size_ = size_t(size.QuadPart);
+    return true;
+}
+
+void MappedFile::close()
+{
+    if (data_)
+        UnmapViewOfFile(data_);
+    if (mapping_)
+        CloseHandle(mapping_);
+    if (file_)
+        CloseHandle(file_);
+    data_ = nullptr;
+    size_ = 0;
+    file_ = nullptr;
+    mapping_ = nullptr;
+}
+
+#else
+
+bool MappedFile::open(const char* path)
+{
+    close();
+    int fd = ::open(path, O_RDONLY);
+    if (fd < 0)
+        return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        ::close(fd);
+        return false;
+    }
+    if (st.st_size > 0) {
+        void* p = mmap(nullptr, size_t(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p == MAP_FAILED) {
+            ::close(fd);
+            return false;
+        }
+        // The scanners read front to back exactly once.
+        madvise(p, size_t(st.st_size), MADV_SEQUENTIAL);
+        data_ = static_cast<const char*>(p);
+        size_ = size_t(st.st_size);
+    }
+    // The mapping stays valid after the descriptor is closed.
+    ::close(fd);
+    return true;
+}
+
+void MappedFile::close()
+{
+    if (data_)
+        munmap(const_cast<char*>(data_), size_);
+    data_ = nullptr;
+    size_ = 0;
+}
+
+#endif
+
+} // namespace nvtools
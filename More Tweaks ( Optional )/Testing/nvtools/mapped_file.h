@@ -0,0 +1,48 @@
+// mapped_file.h
+//
+// Read-only memory map of a whole file. The tools index multi-megabyte
+// headers and dumps in place, so the text is never copied:
+//
+//   nvtools::MappedFile f;
+//   if (!f.open("../nvRmReg.h")) ...
+//   rmreg::Index ix = rmreg::index_header(f.view());
+//
+// Empty files open fine and give an empty view.
+
+#ifndef NVTOOLS_MAPPED_FILE_H
+#define NVTOOLS_MAPPED_FILE_H
+
+#include <cstddef>
+#include <string_view>
+
+namespace nvtools {
+
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile() { close(); }
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool open(const char* path);
+    void close();
+
+    const char* data() const { return data_; }
+    size_t size() const { return size_; }
+    std::string_view view() const { return {data_, size_}; }
+
+private:
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+#if defined(_WIN32)
+    void* file_ = nullptr;
+    void* mapping_ = nullptr;
+#endif
+};
+
+} // namespace nvtools
+
+#endif // NVTOOLS_MAPPED_FILE_H
@@ -0,0 +1,274 @@
+// nvapi_avail.cpp
+
+#include "nvapi_avail.h"
+
+#include "text_util.h"
+
+#include <algorithm>
+
+namespace nvapi {
+
+namespace {
+
+// Three-valued: a symbol the profile leaves open makes what depends on it
+// open too, unless the rest of the expression decides it anyway.
+enum Tri : uint8_t { kFalse, kTrue, kOpen };
+
+using nvtools::iequals;
+using nvtools::trim;
+
+using Op = AvailabilityIndex::Op;
+
+// defined(X), NVCFG(X) and a bare X all test the symbol X. Names run up to
+// the next operator or parenthesis, spaces included ("NULL HW ENABLED").
+template <class SymbolId>
+class ClauseParser {
+public:
+    ClauseParser(std::string_view s, SymbolId symbol_id) : s_(s), symbol_id_(symbol_id) {}
+
+    bool run(std::vector<Op>& out)
+    {
+        out_ = &out;
+        if (!parse_or())
+            return false;
+        skip_space();
+        return pos_ == s_.size();
+    }
+
+private:
+    void skip_space()
+    {
+        while (pos_ < s_.size() && (s_[pos_] == ' ' || s_[pos_] == '\t'))
+            ++pos_;
+    }
+
+    bool accept(std::string_view op)
+    {
+        skip_space();
+        if (s_.substr(pos_, op.size()) != op)
+            return false;
+        pos_ += op.size();
+        return true;
+    }
+
+    std::string_view name()
+    {
+        skip_space();
+        size_t b = pos_;
+        while (pos_ < s_.size() && s_[pos_] != '(' && s_[pos_] != ')' && s_[pos_] != '|' && s_[pos_] != '&'
+               && s_[pos_] != '!')
+            ++pos_;
+        return trim(s_.substr(b, pos_ - b));
+    }
+
+    bool parse_or()
+    {
+        if (!parse_and())
+            return false;
+        while (accept("||")) {
+            if (!parse_and())
+                return false;
+            out_->push_back({Op::Or, 0});
+        }
+        return true;
+    }
+
+    bool parse_and()
+    {
+        if (!parse_unary())
+            return false;
+        while (accept("&&")) {
+            if (!parse_unary())
+                return false;
+            out_->push_back({Op::And, 0});
+        }
+        return true;
+    }
+
+    bool parse_unary()
+    {
+        if (accept("!")) {
+            if (!parse_unary())
+                return false;
+            out_->push_back({Op::Not, 0});
+            return true;
+        }
+        return parse_primary();
+    }
+
+    bool parse_primary()
+    {
+        if (accept("("))
+            return parse_or() && accept(")");
+        std::string_view n = name();
+        if (n.empty())
+            return false;
+        if ((n == "defined" || n == "NVCFG") && accept("(")) {
+            n = name();
+            if (n.empty() || !accept(")"))
+                return false;
+        }
+        out_->push_back({Op::Symbol, symbol_id_(n)});
+        return true;
+    }
+
+    std::string_view s_;
+    SymbolId symbol_id_;
+    size_t pos_ = 0;
+    std::vector<Op>* out_ = nullptr;
+};
+
+} // namespace
+
+size_t SettingBits::count() const
+{
+    size_t n = 0;
+    for (uint64_t w : words_)
+        for (; w; w &= w - 1)
+            ++n;
+    return n;
+}
+
+std::optional<Profile> Profile::named(std::string_view name)
+{
+    Profile p;
+    if (iequals(name, "release")) {
+        p.set("DEBUG", false);
+        p.set("DEVELOP", false);
+        p.set("NV MODS", false);
+    } else if (iequals(name, "develop")) {
+        p.set("DEVELOP", true);
+        p.set("DEBUG", false);
+    } else if (iequals(name, "debug")) {
+        p.set("DEBUG", true);
+    } else {
+        return std::nullopt;
+    }
+    return p;
+}
+
+void Profile::set(std::string_view symbol, bool on)
+{
+    symbol = trim(symbol);
+    for (auto& pin : pins_)
+        if (iequals(pin.first, symbol)) {
+            pin.second = on;
+            return;
+        }
+    pins_.emplace_back(std::string(symbol), on);
+}
+
+uint16_t AvailabilityIndex::symbol_id(std::string_view name)
+{
+    for (size_t i = 0; i < symbols_.size(); ++i)
+        if (iequals(symbols_[i], name))
+            return uint16_t(i);
+    symbols_.emplace_back(name);
+    return uint16_t(symbols_.size() - 1);
+}
+
+uint32_t AvailabilityIndex::intern(std::string key, std::vector<Op> ops)
+{
+    auto known = std::find(predicate_keys_.begin(), predicate_keys_.end(), key);
+    if (known != predicate_keys_.end())
+        return uint32_t(known - predicate_keys_.begin());
+    predicate_keys_.push_back(std::move(key));
+    predicates_.push_back({uint32_t(ops_.size()), uint32_t(ops.size())});
+    ops_.insert(ops_.end(), ops.begin(), ops.end());
+    return uint32_t(predicates_.size() - 1);
+}
+
+AvailabilityIndex AvailabilityIndex::build(const std::vector<Section>& sections)
+{
+    AvailabilityIndex idx;
+    auto symbol = [&](std::string_view n) { return idx.symbol_id(n); };
+
+    idx.section_predicate_.reserve(sections.size());
+    for (const Section& s : sections) {
+        std::string_view clause;
+        if (s.availability == Availability::Always) {
+            idx.section_predicate_.push_back(idx.intern("always", {{Op::True, 0}}));
+            continue;
+        }
+        if (s.availability == Availability::Debug)
+            clause = "defined(DEBUG) || defined(DEVELOP)";
+        else if (s.availability == Availability::Condition)
+            clause = trim(s.condition);
+        // Interned by text, so each distinct clause is parsed once.
+        std::string key = "if " + std::string(clause);
+        auto known = std::find(idx.predicate_keys_.begin(), idx.predicate_keys_.end(), key);
+        if (known != idx.predicate_keys_.end()) {
+            idx.section_predicate_.push_back(uint32_t(known - idx.predicate_keys_.begin()));
+            continue;
+        }
+        std::vector<Op> ops;
+        if (clause.empty() || !ClauseParser<decltype(symbol)>(clause, symbol).run(ops)) {
+            ops.assign(1, {Op::Open, 0});
+            ++idx.unparsed_;
+        }
+        idx.section_predicate_.push_back(idx.intern(std::move(key), std::move(ops)));
+    }
+    idx.predicate_keys_.clear();
+    idx.predicate_keys_.shrink_to_fit();
+
+    // One bitset per clause of the settings that have it, so reach() only
+    // ORs a dozen of them together.
+    idx.setting_count_ = sections.size();
+    idx.word_count_ = (sections.size() + 63) / 64;
+    idx.masks_.assign(idx.predicates_.size() * idx.word_count_, 0);
+    for (size_t i = 0; i < sections.size(); ++i)
+        idx.masks_[idx.section_predicate_[i] * idx.word_count_ + i / 64] |= uint64_t(1) << (i % 64);
+    idx.section_predicate_.clear();
+    idx.section_predicate_.shrink_to_fit();
+    return idx;
+}
+
+void AvailabilityIndex::reach(const Profile& profile, Reachability& out) const
+{
+    std::vector<uint8_t> value(symbols_.size(), kOpen);
+    for (const auto& [name, on] : profile.pins_)
+        for (size_t i = 0; i < symbols_.size(); ++i)
+            if (iequals(symbols_[i], name))
+                value[i] = on ? kTrue : kFalse;
+
+    // Every predicate once, on a small stack.
+    std::vector<uint8_t> result(predicates_.size());
+    std::vector<uint8_t> stack;
+    for (size_t p = 0; p < predicates_.size(); ++p) {
+        stack.clear();
+        const Op* op = ops_.data() + predicates_[p].op_begin;
+        for (uint32_t k = 0; k < predicates_[p].op_count; ++k) {
+            switch (op[k].kind) {
+            case Op::Symbol: stack.push_back(value[op[k].symbol]); break;
+            case Op::True:   stack.push_back(kTrue); break;
+            case Op::Open:   stack.push_back(kOpen); break;
+            case Op::Not:
+                stack.back() = stack.back() == kOpen ? kOpen : stack.back() == kTrue ? kFalse : kTrue;
+                break;
+            case Op::And:
+            case Op::Or: {
+                uint8_t b = stack.back();
+                stack.pop_back();
+                uint8_t a = stack.back();
+                uint8_t wins = op[k].kind == Op::And ? kFalse : kTrue;
+                stack.back() = a == wins || b == wins ? wins : a == kOpen || b == kOpen ? uint8_t(kOpen) : a;
+                break;
+            }
+            }
+        }
+        result[p] = stack.back();
+    }
+
+    out.maybe.reset(setting_count_);
+    out.always.reset(setting_count_);
+    for (size_t p = 0; p < predicates_.size(); ++p) {
+        if (result[p] == kFalse)
+            continue;
+        const uint64_t* mask = masks_.data() + p * word_count_;
+        out.maybe.merge(mask);
+        if (result[p] == kTrue)
+            out.always.merge(mask);
+    }
+}
+
+} // namespace nvapi
@@ -0,0 +1,128 @@
+// nvapi_avail.h
+//
+// Which settings a given driver build reads. The dump says, for each key,
+// "defined all the time - even with release driver", "only for
+// develop/debug driver" or "defined for <condition>", where the condition
+// is a small expression:
+//
+//   defined(DEBUG) || defined(DEVELOP)
+//   NVCFG(GLOBAL ARCH TURING)
+//   NULL HW ENABLED
+//
+// AvailabilityIndex parses every distinct clause once into a predicate over
+// config symbols (DEBUG, DEVELOP, GLOBAL ARCH TURING, ...); develop/debug
+// keys get "defined(DEBUG) || defined(DEVELOP)". A Profile pins some symbols
+// on and some off and leaves the rest open, like rmreg's Variant:
+//
+//   nvapi::AvailabilityIndex idx = nvapi::AvailabilityIndex::build(dump.sections);
+//   nvapi::Profile p = *nvapi::Profile::named("release");
+//   p.set("GLOBAL ARCH TURING", true);
+//   nvapi::Reachability r;
+//   idx.reach(p, r);
+//   if (!r.maybe.test(i)) ...        // the retail driver never reads setting i
+//
+// reach() evaluates each predicate once for the profile, then ORs together
+// the precomputed bitsets of the predicates that hold. Predicates are
+// three-valued, so a setting that depends on an open symbol is in maybe but
+// not in always. A clause that does not parse, or an empty one, depends on
+// nothing the profile can pin and counts as maybe.
+
+#ifndef NVTOOLS_NVAPI_AVAIL_H
+#define NVTOOLS_NVAPI_AVAIL_H
+
+#include "nvapi_dump.h"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace nvapi {
+
+// One bit per setting, in dump order.
+class SettingBits {
+public:
+    void reset(size_t size)
+    {
+        size_ = size;
+        words_.assign((size + 63) / 64, 0);
+    }
+    size_t size() const { return size_; }
+    bool test(size_t i) const { return (words_[i / 64] >> (i % 64)) & 1; }
+    void set(size_t i) { words_[i / 64] |= uint64_t(1) << (i % 64); }
+    void merge(const uint64_t* words)
+    {
+        for (size_t w = 0; w < words_.size(); ++w)
+            words_[w] |= words[w];
+    }
+    size_t count() const;
+    const std::vector<uint64_t>& words() const { return words_; }
+
+private:
+    std::vector<uint64_t> words_;
+    size_t size_ = 0;
+};
+
+struct Reachability {
+    SettingBits maybe;          // read in some or all builds of the profile
+    SettingBits always;         // read in every build of it
+};
+
+class Profile {
+public:
+    // "release" (DEBUG, DEVELOP and NV MODS off), "develop" (DEVELOP on,
+    // DEBUG off) or "debug" (DEBUG on); nullopt for anything else.
+    static std::optional<Profile> named(std::string_view name);
+
+    // Later calls win. Names match case-insensitively.
+    void set(std::string_view symbol, bool on);
+
+private:
+    friend class AvailabilityIndex;
+    std::vector<std::pair<std::string, bool>> pins_;
+};
+
+class AvailabilityIndex {
+public:
+    static AvailabilityIndex build(const std::vector<Section>& sections);
+
+    void reach(const Profile& profile, Reachability& out) const;
+
+    // Config symbols the clauses test, in the order first seen.
+    const std::vector<std::string>& symbols() const { return symbols_; }
+
+    // Distinct clauses, and how many of them did not parse.
+    size_t predicate_count() const { return predicates_.size(); }
+    size_t unparsed_count() const { return unparsed_; }
+
+    // A predicate, compiled to postfix.
+    struct Op {
+        enum Kind : uint8_t { Symbol, True, Open, Not, And, Or } kind;
+        uint16_t symbol;        // into symbols(), for Symbol
+    };
+
+private:
+    struct Predicate {
+        uint32_t op_begin;      // postfix, into ops_
+        uint32_t op_count;
+    };
+
+    uint16_t symbol_id(std::string_view name);
+    uint32_t intern(std::string key, std::vector<Op> ops);
+
+    std::vector<std::string> symbols_;
+    std::vector<Op> ops_;
+    std::vector<Predicate> predicates_;
+    std::vector<std::string> predicate_keys_;   // only while building
+    std::vector<uint32_t> section_predicate_;   // likewise
+    std::vector<uint64_t> masks_;       // per predicate, word_count_ words of settings
+    size_t setting_count_ = 0;
+    size_t word_count_ = 0;
+    size_t unparsed_ = 0;
+};
+
+} // namespace nvapi
+
+#endif // NVTOOLS_NVAPI_AVAIL_H
@@ -0,0 +1,324 @@
+// nvapi_bits.cpp
+
+#include "nvapi_bits.h"
+
+#include "text_util.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <unordered_map>
+
+namespace nvapi {
+
+namespace {
+
+using nvtools::ends_with;
+using nvtools::iequals;
+using nvtools::trim;
+
+int popcount(uint32_t v)
+{
+    int n = 0;
+    for (; v; v &= v - 1)
+        ++n;
+    return n;
+}
+
+uint8_t lowest_bit(uint32_t v)
+{
+    uint8_t n = 0;
+    while (v && !(v & 1)) {
+        v >>= 1;
+        ++n;
+    }
+    return n;
+}
+
+// Range bounds, not values: MAX, METHOD MAX, COUNT. "... COUNT" is left
+// alone, CAPTURE BUCKET COUNT is a flag.
+bool is_limit(std::string_view name)
+{
+    return name == "MAX" || name == "MIN" || name == "COUNT" || ends_with(name, " MAX")
+        || ends_with(name, " MIN");
+}
+
+// "OFF, 0, FALSE, DISABLED" is four names for one value.
+std::string_view first_alias(std::string_view name)
+{
+    size_t comma = name.find(", ");
+    return comma == std::string_view::npos ? name : name.substr(0, comma);
+}
+
+} // namespace
+
+BitfieldPlan BitfieldPlan::build(const SectionRecord& record)
+{
+    BitfieldPlan p;
+    p.key_ = record.section.name;
+
+    struct Sym {
+        std::string_view name;
+        uint32_t value;
+    };
+    std::vector<Sym> syms;
+    for (const Symbol& s : record.symbols) {
+        std::optional<uint64_t> v = parse_number(s.value);
+        if (v && *v <= 0xffffffffu)
+            syms.push_back({s.name, uint32_t(*v)});
+    }
+
+    std::unordered_map<std::string_view, uint8_t> shifts;
+    for (const Sym& s : syms)
+        if (ends_with(s.name, " SHIFT") && s.value < 32)
+            shifts.emplace(s.name.substr(0, s.name.size() - 6), uint8_t(s.value));
+
+    std::optional<uint32_t> plain_mask;
+    std::vector<Field> candidates;
+    std::vector<Sym> regular;
+    for (const Sym& s : syms) {
+        if (s.name == "MASK") {
+            plain_mask = s.value;
+        } else if (ends_with(s.name, " MASK")) {
+            std::string_view field = s.name.substr(0, s.name.size() - 5);
+            auto sh = shifts.find(field);
+            if (s.value)
+                candidates.push_back({field, s.value, sh != shifts.end() ? sh->second : lowest_bit(s.value),
+                                      false, 0, 0});
+        } else if (ends_with(s.name, " SHIFT") || is_limit(s.name)) {
+            continue;
+        } else if (shifts.count(s.name) && s.value) {
+            // "AA RT BPP DIV 4" next to "AA RT BPP DIV 4 SHIFT": a number.
+            candidates.push_back({s.name, s.value, shifts[s.name], false, 0, 0});
+        } else {
+            regular.push_back(s);
+        }
+    }
+
+    uint32_t named = 0;
+    for (const Sym& s : regular)
+        named |= s.value;
+    for (const Field& f : candidates)
+        named |= f.mask;
+    p.mask_ = plain_mask ? *plain_mask : named;
+
+    // A mask with other masks inside it is an umbrella, and one whose values
+    // are all single bits is a group of flags. Neither is decoded as a field.
+    for (const Field& c : candidates) {
+        bool umbrella = false;
+        for (const Field& o : candidates)
+            umbrella = umbrella || (o.mask != c.mask && (o.mask & ~c.mask) == 0);
+        if (umbrella)
+            continue;
+        std::vector<Named> members;
+        bool multi = false;
+        for (const Sym& s : regular) {
+            if (!s.value || (s.value & ~c.mask))
+                continue;
+            multi = multi || popcount(s.value) > 1;
+            bool seen = false;
+            for (const Named& m : members)
+                seen = seen || m.value == s.value;
+            if (!seen)
+                members.push_back({first_alias(s.name), s.value});
+        }
+        if (!members.empty() && !multi)
+            continue;
+        Field f = c;
+        f.enumerated = !members.empty();
+        f.member_begin = uint32_t(p.members_.size());
+        f.member_count = uint32_t(members.size());
+        p.members_.insert(p.members_.end(), members.begin(), members.end());
+        p.fields_.push_back(f);
+    }
+    std::stable_sort(p.fields_.begin(), p.fields_.end(), [](const Field& a, const Field& b) {
+        return popcount(a.mask) < popcount(b.mask);
+    });
+
+    for (const Sym& s : regular) {
+        if (!s.value) {
+            if (p.zero_.empty())
+                p.zero_ = first_alias(s.name);
+            continue;
+        }
+        bool in_field = false, seen = false;
+        for (const Field& f : p.fields_)
+            in_field = in_field || (s.value & ~f.mask) == 0;
+        for (const Named& n : p.flags_)
+            seen = seen || n.value == s.value;
+        if (!in_field && !seen)
+            p.flags_.push_back({first_alias(s.name), s.value});
+    }
+    std::stable_sort(p.flags_.begin(), p.flags_.end(), [](const Named& a, const Named& b) {
+        return popcount(a.value) > popcount(b.value);
+    });
+
+    for (const Sym& s : regular) {
+        std::string_view rest = s.name;
+        for (size_t comma; (comma = rest.find(", ")) != std::string_view::npos; rest.remove_prefix(comma + 2))
+            p.names_.push_back({rest.substr(0, comma), s.value});
+        p.names_.push_back({rest, s.value});
+    }
+    return p;
+}
+
+void BitfieldPlan::decode(uint32_t value, BitDecode& out) const
+{
+    out.count = 0;
+    out.outside = value & ~mask_;
+    out.unnamed = 0;
+    uint32_t rest = value & mask_;
+    if (value == 0 && !zero_.empty()) {
+        out.parts[out.count++] = {zero_, 0, std::nullopt};
+        return;
+    }
+    for (const Field& f : fields_) {
+        uint32_t v = rest & f.mask;
+        if (!v)
+            continue;
+        rest &= ~f.mask;
+        const Named* m = members_.data() + f.member_begin;
+        const Named* hit = nullptr;
+        for (uint32_t i = 0; i < f.member_count && !hit; ++i)
+            if (m[i].value == v)
+                hit = &m[i];
+        out.parts[out.count++] = hit ? BitPart{hit->name, v, std::nullopt}
+                                     : BitPart{f.name, v, v >> f.shift};
+    }
+    // Most bits first, so a name that covers several flags wins over them.
+    for (const Named& n : flags_) {
+        if (n.value & ~rest)
+            continue;
+        out.parts[out.count++] = {n.name, n.value, std::nullopt};
+        rest &= ~n.value;
+        if (!rest)
+            break;
+    }
+    out.unnamed = rest;
+}
+
+std::optional<uint32_t> BitfieldPlan::encode(const std::vector<std::string_view>& parts, std::string* why) const
+{
+    auto fail = [&](std::string reason) -> std::optional<uint32_t> {
+        if (why)
+            *why = std::move(reason);
+        return std::nullopt;
+    };
+    uint32_t value = 0;
+    uint32_t fields_set = 0;    // enumerated field masks already given a value
+    for (std::string_view part : parts) {
+        part = trim(part);
+        if (part.empty())
+            continue;
+        uint32_t bits;
+        size_t eq = part.find('=');
+        if (eq != std::string_view::npos) {
+            std::string_view name = trim(part.substr(0, eq));
+            std::optional<uint64_t> n = parse_number(trim(part.substr(eq + 1)));
+            const Field* f = nullptr;
+            for (const Field& c : fields_)
+                if (iequals(c.name, name))
+                    f = &c;
+            if (!f)
+                return fail(std::string(name) + " is not a field of " + std::string(key_));
+            if (!n || *n > (f->mask >> f->shift))
+                return fail(std::string(part) + " does not fit the field");
+            bits = uint32_t(*n) << f->shift;
+        } else {
+            // Names first: TRI LIN OPT SLOPE calls 0x1f "15".
+            const Named* hit = nullptr;
+            for (const Named& n : names_)
+                if (!hit && iequals(n.name, part))
+                    hit = &n;
+            std::optional<uint64_t> n = hit ? std::nullopt : parse_number(part);
+            if (hit)
+                bits = hit->value;
+            else if (!n)
+                return fail(std::string(part) + " is not a name of " + std::string(key_));
+            else if (*n > 0xffffffffu)
+                return fail(std::string(part) + " is more than 32 bits");
+            else
+                bits = uint32_t(*n);
+        }
+        for (const Field& f : fields_) {
+            if (!f.enumerated || !(bits & f.mask) || (bits & ~f.mask))
+                continue;
+            if (fields_set & f.mask)
+                return fail(std::string(part) + " is a second value for " + std::string(f.name));
+            fields_set |= f.mask;
+        }
+        value |= bits;
+    }
+    return value;
+}
+
+std::vector<uint32_t> BitfieldPlan::merge_fields() const
+{
+    std::vector<uint32_t> groups;
+    for (const Field& f : fields_)
+        groups.push_back(f.mask);
+
+    // ALPHA2COVG DITHER FOOTPRINT names 1 and 2 and means three footprints,
+    // not two flags: 3 is neither.
+    std::vector<uint32_t> values;
+    uint32_t singles = 0, all = 0;
+    for (const Named& n : flags_) {
+        values.push_back(n.value);
+        all |= n.value;
+        if (popcount(n.value) == 1)
+            singles |= n.value;
+    }
+    std::sort(values.begin(), values.end());
+    bool counting = values.size() >= 2;
+    for (size_t i = 0; i < values.size() && counting; ++i)
+        counting = values[i] == i + 1;
+    if (counting) {
+        groups.push_back(all);
+    } else {
+        for (uint32_t v : values)
+            if (popcount(v) > 1 && (v & ~singles) && v != mask_ && v != 0xffffffffu)
+                groups.push_back(v);
+    }
+
+    // Overlapping groups are one.
+    for (size_t i = 0; i < groups.size(); ++i)
+        for (size_t j = i + 1; j < groups.size();) {
+            if (groups[i] & groups[j]) {
+                groups[i] |= groups[j];
+                groups.erase(groups.begin() + std::ptrdiff_t(j));
+                j = i + 1;
+            } else {
+                ++j;
+            }
+        }
+    std::sort(groups.begin(), groups.end());
+    return groups;
+}
+
+std::string format_bits(const BitDecode& d)
+{
+    std::string out;
+    char buf[48];
+    for (uint32_t i = 0; i < d.count; ++i) {
+        if (i)
+            out += " | ";
+        out += d.parts[i].name;
+        if (d.parts[i].field_value) {
+            std::snprintf(buf, sizeof buf, "=%u", *d.parts[i].field_value);
+            out += buf;
+        }
+    }
+    if (out.empty())
+        out = d.outside || d.unnamed ? "" : "0";
+    if (d.unnamed) {
+        std::snprintf(buf, sizeof buf, "%sunnamed 0x%08x", out.empty() ? "" : " | ", d.unnamed);
+        out += buf;
+    }
+    if (d.outside) {
+        std::snprintf(buf, sizeof buf, "%s0x%08x outside MASK", out.empty() ? "" : " | ", d.outside);
+        out += buf;
+    }
+    return out;
+}
+
+} // namespace nvapi
@@ -0,0 +1,107 @@
+// nvapi_bits.h
+//
+// Decoding and encoding of DWORD settings that the dump calls "a collection
+// of Bitfields". Their symbols mix several things:
+//
+//   FORCE AA ON R32F TEXTURES (= 0x00000200)      a flag
+//   DISABLE OVERRIDE          (= 0x00000003)      several flags under one name
+//   TIMEBASE CYCLES MASK      (= 0x00ff0000)      a field...
+//   TIMEBASE CYCLES 4K        (= 0x00030000)      ...and one of its values
+//   CLIENT PROCESSOR SHIFT    (= 0x00000008)      where a numeric field starts
+//   MASK                      (= 0xf87fffff)      every bit the key uses
+//
+// BitfieldPlan sorts that out once per key: which "X MASK"s are fields with
+// enumerated values, which are plain numbers, and which are just a group of
+// flags; the key's valid bits; and the flags ordered for decoding. decode()
+// then turns a value into as few names as it can:
+//
+//   0x00030201 -> TIMEBASE CYCLES 4K | CAPTURE BUCKET COUNT | GENERATE ENCODED PMTRIGGERID
+//
+// A field value without a name comes out as FIELD=n. Bits outside MASK, and
+// bits inside it that no symbol names, are reported apart. Synonyms decode
+// to the first name in the dump and all of them encode. Views point into
+// the dump or snapshot the plan was built from.
+
+#ifndef NVTOOLS_NVAPI_BITS_H
+#define NVTOOLS_NVAPI_BITS_H
+
+#include "nvapi_dump.h"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace nvapi {
+
+struct BitPart {
+    std::string_view name;      // symbol, or the field for a FIELD=n part
+    uint32_t bits;              // the bits of the value this part accounts for
+    std::optional<uint32_t> field_value;    // n, already shifted down
+};
+
+// Fixed size, so decoding allocates nothing: a 32-bit value has at most 32
+// parts.
+struct BitDecode {
+    BitPart parts[32];
+    uint32_t count = 0;
+    uint32_t outside = 0;       // set bits outside the key's mask
+    uint32_t unnamed = 0;       // set bits inside it that nothing names
+};
+
+class BitfieldPlan {
+public:
+    // From any section with numeric symbols; for keys that are not
+    // bitfields it still works, but the dump's names are meant to be used
+    // one at a time there.
+    static BitfieldPlan build(const SectionRecord& record);
+
+    std::string_view key() const { return key_; }
+
+    // The "MASK" symbol, or every bit the symbols name if there is none.
+    uint32_t mask() const { return mask_; }
+
+    void decode(uint32_t value, BitDecode& out) const;
+
+    // Names (any synonym, any case), FIELD=n, or numbers, OR-ed together. A
+    // part that is both a name and a number is taken as the name.
+    std::optional<uint32_t> encode(const std::vector<std::string_view>& parts, std::string* why = nullptr) const;
+
+    // Disjoint masks of bits that only mean something together, for merging
+    // two edits of one value a group at a time (nvapi_merge.h): each field,
+    // the values of a key that counts 1, 2, 3... rather than naming flags,
+    // and flags sharing bits with another multi-bit name. A name made only
+    // of flags named on their own, or of every bit, joins nothing. Bits in
+    // no mask are flags of their own, or unnamed.
+    std::vector<uint32_t> merge_fields() const;
+
+private:
+    struct Named {
+        std::string_view name;
+        uint32_t value;
+    };
+    struct Field {
+        std::string_view name;  // "TIMEBASE CYCLES" for TIMEBASE CYCLES MASK
+        uint32_t mask;
+        uint8_t shift;
+        bool enumerated;
+        uint32_t member_begin;  // range into members_
+        uint32_t member_count;
+    };
+
+    std::string_view key_;
+    uint32_t mask_ = 0;
+    std::string_view zero_;     // name for 0, if the key has one
+    std::vector<Field> fields_;     // smallest mask first
+    std::vector<Named> members_;    // values of enumerated fields
+    std::vector<Named> flags_;      // most bits first, synonyms dropped
+    std::vector<Named> names_;      // every alias of every symbol, for encode
+};
+
+// "A | B | FIELD=0x3", and " (outside MASK 0x...)" / " (unnamed 0x...)".
+std::string format_bits(const BitDecode& d);
+
+} // namespace nvapi
+
+#endif // NVTOOLS_NVAPI_BITS_H
@@ -0,0 +1,302 @@
+// nvapi_bulk.cpp
+
+#include "nvapi_bulk.h"
+
+#include "mapped_file.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace nvapi {
+
+namespace {
+
+uint64_t fnv1a(uint64_t h, std::string_view s)
+{
+    for (char c : s) {
+        h ^= uint8_t(c);
+        h *= 0x100000001b3ull;
+    }
+    // A separator, so "ab" "c" and "a" "bc" differ.
+    h ^= 0xff;
+    return h * 0x100000001b3ull;
+}
+
+uint64_t block_hash(const std::vector<BlockSetting>& settings)
+{
+    uint64_t h = 0xcbf29ce484222325ull;
+    for (const BlockSetting& s : settings) {
+        char id[4] = {char(s.id), char(s.id >> 8), char(s.id >> 16), char(s.id >> 24)};
+        h = fnv1a(h, std::string_view(id, 4));
+        h = fnv1a(h, s.name_info);
+        h = fnv1a(h, s.value);
+        h = fnv1a(h, s.type);
+    }
+    return h;
+}
+
+bool same_settings(const std::vector<BlockSetting>& a, const std::vector<BlockSetting>& b)
+{
+    if (a.size() != b.size())
+        return false;
+    for (size_t i = 0; i < a.size(); ++i)
+        if (a[i].id != b[i].id || a[i].value != b[i].value || a[i].type != b[i].type
+            || a[i].name_info != b[i].name_info)
+            return false;
+    return true;
+}
+
+// The next tab-separated field of line, or all that is left.
+std::string_view field(std::string_view& line)
+{
+    size_t tab = line.find('\t');
+    std::string_view f = line.substr(0, tab);
+    line = tab == std::string_view::npos ? std::string_view() : line.substr(tab + 1);
+    return f;
+}
+
+} // namespace
+
+BlockRef::BlockRef(SettingBlock* block) : block_(block)
+{
+    if (block_)
+        ++block_->refs_;
+}
+
+BlockRef::BlockRef(const BlockRef& other) : block_(other.block_)
+{
+    if (block_)
+        ++block_->refs_;
+}
+
+BlockRef& BlockRef::operator=(BlockRef other) noexcept
+{
+    std::swap(block_, other.block_);
+    return *this;
+}
+
+BlockRef::~BlockRef()
+{
+    if (block_ && --block_->refs_ == 0)
+        block_->pool_->release(block_);
+}
+
+BlockRef BlockPool::intern(std::vector<BlockSetting> settings)
+{
+    ++interned_;
+    std::stable_sort(settings.begin(), settings.end(),
+                     [](const BlockSetting& a, const BlockSetting& b) { return a.id < b.id; });
+    size_t kept = 0;
+    for (size_t i = 0; i < settings.size(); ++i) {
+        if (kept && settings[kept - 1].id == settings[i].id)
+            --kept;
+        if (kept != i)
+            settings[kept] = std::move(settings[i]);
+        ++kept;
+    }
+    settings.resize(kept);
+
+    uint64_t h = block_hash(settings);
+    auto range = blocks_.equal_range(h);
+    for (auto it = range.first; it != range.second; ++it)
+        if (same_settings(it->second->settings_, settings)) {
+            ++shared_;
+            return BlockRef(it->second.get());
+        }
+
+    auto block = std::make_unique<SettingBlock>();
+    block->pool_ = this;
+    block->hash_ = h;
+    std::string unused;
+    NipWriter w = NipWriter::renderer(format_, unused);
+    for (const BlockSetting& s : settings)
+        w.setting(s.name_info, s.id, s.value, s.type);
+    block->rendered_ = w.take_rendered();
+    block->settings_ = std::move(settings);
+    SettingBlock* p = block.get();
+    blocks_.emplace(h, std::move(block));
+    return BlockRef(p);
+}
+
+BlockRef BlockPool::layer(const SettingBlock& base, const SettingBlock& over)
+{
+    // Both are in ID order already, so one merge pass.
+    std::vector<BlockSetting> merged;
+    merged.reserve(base.settings_.size() + over.settings_.size());
+    const std::vector<BlockSetting>& a = base.settings_;
+    const std::vector<BlockSetting>& b = over.settings_;
+    size_t i = 0, j = 0;
+    while (i < a.size() || j < b.size()) {
+        if (j == b.size() || (i < a.size() && a[i].id < b[j].id)) {
+            merged.push_back(a[i++]);
+        } else {
+            if (i < a.size() && a[i].id == b[j].id)
+                ++i;
+            merged.push_back(b[j++]);
+        }
+    }
+    return intern(std::move(merged));
+}
+
+void BlockPool::release(SettingBlock* block)
+{
+    auto range = blocks_.equal_range(block->hash_);
+    for (auto it = range.first; it != range.second; ++it)
+        if (it->second.get() == block) {
+            blocks_.erase(it);
+            return;
+        }
+}
+
+void BulkGenerator::add_block(std::string_view name, std::vector<BlockSetting> settings)
+{
+    named_[std::string(name)] = pool_.intern(std::move(settings));
+    // Block lists made with the old block would keep it.
+    composed_.clear();
+}
+
+bool BulkGenerator::add_block(std::string_view name, const NipFile& nip, std::string* why)
+{
+    if (!nip.profile_count()) {
+        if (why)
+            *why = "the file has no profile";
+        return false;
+    }
+    std::vector<BlockSetting> settings;
+    for (uint32_t i = nip.setting_begin[0]; i < nip.setting_begin[1]; ++i)
+        settings.push_back({nip.setting_id[i], std::string(nip.name_info[i]), std::string(nip.setting_value[i]),
+                            std::string(nip.value_type[i])});
+    add_block(name, std::move(settings));
+    return true;
+}
+
+BlockRef BulkGenerator::compose(std::string_view blocks, std::string* why)
+{
+    key_.assign(blocks.data(), blocks.size());
+    auto done = composed_.find(key_);
+    if (done != composed_.end())
+        return done->second;
+
+    BlockRef result;
+    std::string name;
+    while (true) {
+        size_t plus = blocks.find('+');
+        name.assign(blocks.substr(0, plus));
+        auto it = named_.find(name);
+        if (it == named_.end()) {
+            if (why)
+                *why = "no block named '" + name + "'";
+            return {};
+        }
+        result = result ? pool_.layer(*result, *it->second) : it->second;
+        if (plus == std::string_view::npos)
+            break;
+        blocks.remove_prefix(plus + 1);
+    }
+    composed_.emplace(key_, result);
+    return result;
+}
+
+bool BulkGenerator::run(std::string_view manifest, const std::string& dir, FILE* out, BulkStats* stats,
+                        std::string* why)
+{
+    BulkStats st;
+    std::string buffer, name, exe_text;
+    std::vector<size_t> exe_end;
+    std::vector<std::string_view> exes;
+    NipWriter w(format_, buffer);
+    std::string reason;
+    uint32_t line_no = 0;
+
+    auto write = [&]() {
+        st.buffer_peak = std::max(st.buffer_peak, buffer.size());
+        st.bytes += buffer.size();
+        bool ok = std::fwrite(buffer.data(), 1, buffer.size(), out) == buffer.size();
+        buffer.clear();
+        return ok;
+    };
+    auto fail = [&](const std::string& what) {
+        if (why)
+            *why = "line " + std::to_string(line_no) + ": " + what;
+        if (stats)
+            *stats = st;
+        return false;
+    };
+
+    while (!manifest.empty()) {
+        size_t nl = manifest.find('\n');
+        std::string_view line = manifest.substr(0, nl);
+        manifest = nl == std::string_view::npos ? std::string_view() : manifest.substr(nl + 1);
+        ++line_no;
+        if (!line.empty() && line.back() == '\r')
+            line.remove_suffix(1);
+        if (line.empty() || line[0] == '#')
+            continue;
+
+        std::string_view kind = field(line);
+        if (kind == "block") {
+            std::string_view block = field(line);
+            std::string_view file_name = field(line);
+            bool absolute = !file_name.empty()
+                && (file_name[0] == '/' || file_name[0] == '\\' || file_name.find(':') != std::string_view::npos);
+            std::string path = dir.empty() || absolute ? std::string() : dir + "/";
+            path += file_name;
+            nvtools::MappedFile file;
+            NipFile nip;
+            if (block.empty() || !line.empty())
+                return fail("expected block <TAB> name <TAB> file.nip");
+            if (!file.open(path.c_str()))
+                return fail("cannot read " + path);
+            if (!read_nip(file.view(), nip, &reason) || !add_block(block, nip, &reason))
+                return fail(path + ": " + reason);
+            continue;
+        }
+        if (kind != "profile")
+            return fail("expected a block or profile line");
+
+        std::string_view profile = field(line);
+        std::string_view blocks = field(line);
+        if (profile.empty() || blocks.empty())
+            return fail("expected profile <TAB> name <TAB> blocks <TAB> executables");
+        BlockRef settings = compose(blocks, &reason);
+        if (!settings)
+            return fail(reason);
+
+        // Escaped into one string, then viewed, so nothing moves under the
+        // views.
+        name.clear();
+        xml_escape(profile, name);
+        exe_text.clear();
+        exe_end.clear();
+        while (!line.empty()) {
+            std::string_view exe = field(line);
+            if (exe.empty())
+                continue;
+            xml_escape(exe, exe_text);
+            exe_end.push_back(exe_text.size());
+        }
+        exes.clear();
+        for (size_t i = 0, from = 0; i < exe_end.size(); from = exe_end[i++])
+            exes.push_back(std::string_view(exe_text).substr(from, exe_end[i] - from));
+
+        w.begin_profile(name, exes.data(), exes.size());
+        w.settings_text(settings->rendered());
+        w.end_profile();
+        ++st.profiles;
+        st.exes += exes.size();
+        st.settings += settings->settings().size();
+        if (!write())
+            return fail("cannot write the output");
+    }
+    w.finish();
+    if (!write())
+        return fail("cannot write the output");
+
+    st.blocks = pool_.size();
+    st.block_lists = composed_.size();
+    if (stats)
+        *stats = st;
+    return true;
+}
+
+} // namespace nvapi
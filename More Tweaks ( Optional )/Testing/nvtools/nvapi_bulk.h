@@ -0,0 +1,160 @@
+// nvapi_bulk.h
+//
+// Application profiles for thousands of executables, most of them sharing
+// their settings, written as one .nip file (nvapi_nip.h). A manifest lists
+// them, one tab-separated line each:
+//
+//   # block    name   file.nip           the settings of the file's first profile
+//   block	perf	NVIDIAPerformanceProfile.nip
+//   block	nosync	nosync.nip
+//   # profile  name   blocks             executables...
+//   profile	Cyberpunk 2077	perf+nosync	Cyberpunk2077.exe	REDprelauncher.exe
+//
+// A profile's settings are its blocks layered left to right, a later
+// block's value for an ID replacing an earlier one's. Names and executables
+// are plain text; they are escaped on the way out.
+//
+// Settings are stored once however many profiles use them: BlockPool
+// interns every block and every layering by content, so "perf+nosync" and
+// a block with the same settings are one SettingBlock, and hands out
+// counted BlockRefs; a block goes when its last reference does. A block's
+// <Settings> element is rendered once (NipWriter::renderer()) and copied
+// into each profile that uses it.
+//
+// run() reads the manifest a line at a time and writes each profile to the
+// file as soon as it is made, so memory holds the distinct blocks and one
+// profile whatever the number of profiles. For the same reason a profile or
+// executable named twice is not caught.
+
+#ifndef NVTOOLS_NVAPI_BULK_H
+#define NVTOOLS_NVAPI_BULK_H
+
+#include "nvapi_nip.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace nvapi {
+
+struct BlockSetting {
+    uint32_t id;
+    std::string name_info;      // escaped, as in a .nip
+    std::string value;
+    std::string type;           // "Dword", "Binary", "String"
+};
+
+class BlockPool;
+
+class SettingBlock {
+public:
+    const std::vector<BlockSetting>& settings() const { return settings_; }    // by ID, one per ID
+    std::string_view rendered() const { return rendered_; }   // for NipWriter::settings_text()
+    uint32_t refs() const { return refs_; }
+
+private:
+    friend class BlockPool;
+    friend class BlockRef;
+
+    BlockPool* pool_ = nullptr;
+    std::vector<BlockSetting> settings_;
+    std::string rendered_;
+    uint64_t hash_ = 0;
+    uint32_t refs_ = 0;
+};
+
+// A counted reference to a pooled block; the pool has to outlive it.
+class BlockRef {
+public:
+    BlockRef() = default;
+    BlockRef(const BlockRef& other);
+    BlockRef(BlockRef&& other) noexcept : block_(other.block_) { other.block_ = nullptr; }
+    BlockRef& operator=(BlockRef other) noexcept;
+    ~BlockRef();
+
+    const SettingBlock* get() const { return block_; }
+    const SettingBlock* operator->() const { return block_; }
+    const SettingBlock& operator*() const { return *block_; }
+    explicit operator bool() const { return block_ != nullptr; }
+
+private:
+    friend class BlockPool;
+    explicit BlockRef(SettingBlock* block);
+
+    SettingBlock* block_ = nullptr;
+};
+
+class BlockPool {
+public:
+    explicit BlockPool(const NipFormat& format) : format_(format) {}
+    BlockPool(const BlockPool&) = delete;
+    BlockPool& operator=(const BlockPool&) = delete;
+
+    // The block with these settings, made if the pool has none. Settings
+    // are put in ID order; of two with one ID, the later stays.
+    BlockRef intern(std::vector<BlockSetting> settings);
+
+    // base's settings, with over's replacing those of the same ID.
+    BlockRef layer(const SettingBlock& base, const SettingBlock& over);
+
+    size_t size() const { return blocks_.size(); }
+    size_t interned() const { return interned_; }   // intern() and layer() calls
+    size_t shared() const { return shared_; }       // of them, found in the pool
+
+private:
+    friend class BlockRef;
+    void release(SettingBlock* block);
+
+    NipFormat format_;
+    std::unordered_multimap<uint64_t, std::unique_ptr<SettingBlock>> blocks_;
+    size_t interned_ = 0;
+    size_t shared_ = 0;
+};
+
+struct BulkStats {
+    size_t profiles = 0;
+    size_t exes = 0;
+    size_t settings = 0;        // written, counting each profile's
+    size_t blocks = 0;          // distinct blocks in the pool at the end
+    size_t block_lists = 0;     // distinct blocks columns ("perf+nosync")
+    uint64_t bytes = 0;         // written to the file
+    size_t buffer_peak = 0;     // most bytes held before a write
+};
+
+class BulkGenerator {
+public:
+    explicit BulkGenerator(const NipFormat& format) : format_(format), pool_(format) {}
+
+    // Named blocks for the manifest, besides its block lines. A name given
+    // again replaces the block from then on.
+    void add_block(std::string_view name, std::vector<BlockSetting> settings);
+    // The first profile's settings; false if nip has no profile.
+    bool add_block(std::string_view name, const NipFile& nip, std::string* why = nullptr);
+
+    // Writes the manifest's profiles to out as a whole .nip file. A block
+    // line's file is read relative to dir, if it is not empty. False, with
+    // the manifest line, on a line that is neither, an unknown block or a
+    // block file that does not read; out then holds what was written up to
+    // that line.
+    bool run(std::string_view manifest, const std::string& dir, FILE* out, BulkStats* stats = nullptr,
+             std::string* why = nullptr);
+
+    const BlockPool& pool() const { return pool_; }
+
+private:
+    BlockRef compose(std::string_view blocks, std::string* why);
+
+    NipFormat format_;
+    BlockPool pool_;            // before the refs, so it outlives them
+    std::unordered_map<std::string, BlockRef> named_;
+    std::unordered_map<std::string, BlockRef> composed_;
+    std::string key_;
+};
+
+} // namespace nvapi
+
+#endif // NVTOOLS_NVAPI_BULK_H
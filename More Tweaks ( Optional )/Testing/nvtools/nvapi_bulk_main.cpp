@@ -0,0 +1,68 @@
+// nvapi_bulk_main.cpp
+//
+//   nvapi_bulk [utf8|utf16] <manifest> <out.nip>
+//
+// Writes the profiles the manifest lists (nvapi_bulk.h) to out.nip as they
+// are made: utf16 (the default) the way NPI saves it, utf8 the way this repo
+// keeps its copies. Block files are read relative to the manifest. On a bad
+// manifest line the error names it and out.nip is removed. The counts, and
+// how many distinct blocks the profiles needed, go to stderr.
+
+#include "mapped_file.h"
+#include "nvapi_bulk.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+int main(int argc, char** argv)
+{
+    int a = 1;
+    bool utf8 = false;
+    if (argc > 1 && (std::strcmp(argv[1], "utf8") == 0 || std::strcmp(argv[1], "utf16") == 0)) {
+        utf8 = std::strcmp(argv[1], "utf8") == 0;
+        ++a;
+    }
+    if (argc - a != 2) {
+        std::fprintf(stderr, "usage: nvapi_bulk [utf8|utf16] <manifest> <out.nip>\n");
+        return 2;
+    }
+    const char* manifest_path = argv[a];
+    const char* out_path = argv[a + 1];
+
+    nvtools::MappedFile manifest;
+    if (!manifest.open(manifest_path)) {
+        std::fprintf(stderr, "error: cannot read %s\n", manifest_path);
+        return 1;
+    }
+    std::string dir = manifest_path;
+    size_t slash = dir.find_last_of("/\\");
+    dir.resize(slash == std::string::npos ? 0 : slash);
+
+    nvapi::NipFormat format;
+    if (utf8) {
+        format.encoding = nvapi::NipEncoding::Utf8;
+        format.crlf = false;
+        format.final_newline = true;
+    }
+    FILE* f = std::fopen(out_path, "wb");
+    if (!f) {
+        std::fprintf(stderr, "error: cannot write %s\n", out_path);
+        return 1;
+    }
+    nvapi::BulkGenerator gen(format);
+    nvapi::BulkStats st;
+    std::string why;
+    bool ok = gen.run(manifest.view(), dir, f, &st, &why);
+    bool closed = std::fclose(f) == 0;
+    if (!ok || !closed) {
+        std::fprintf(stderr, "error: %s: %s\n", ok ? out_path : manifest_path,
+                     ok ? "cannot write" : why.c_str());
+        std::remove(out_path);
+        return 1;
+    }
+    std::fprintf(stderr, "%zu profiles, %zu executables, %zu settings from %zu distinct blocks (%zu block lists),"
+                         " %.1f MB\n",
+                 st.profiles, st.exes, st.settings, st.blocks, st.block_lists, double(st.bytes) / 1e6);
+    return 0;
+}
@@ -0,0 +1,101 @@
+// nvapi_checklist.cpp
+
+#include "nvapi_checklist.h"
+
+#include "text_util.h"
+
+namespace nvapi {
+
+namespace {
+
+using nvtools::trim;
+
+bool is_rule(std::string_view s)
+{
+    return s.size() >= 3 && s.find_first_not_of('-') == std::string_view::npos;
+}
+
+// "KEY - 0x0000001F rest": a key has no spaces, so an NPI name with " - "
+// in it ("Antialiasing - Mode: ...") is never one.
+bool split_key(std::string_view s, ChecklistItem& item)
+{
+    size_t dash = s.find(" - 0x");
+    if (dash == std::string_view::npos || dash == 0 || s.substr(0, dash).find(' ') != std::string_view::npos
+        || dash + 5 >= s.size() || nvtools::hex_digit(s[dash + 5]) < 0)
+        return false;
+    item.name = s.substr(0, dash);
+    item.value = s.substr(dash + 3);
+    item.key = true;
+    return true;
+}
+
+bool split_name(std::string_view s, ChecklistItem& item)
+{
+    size_t colon = s.find(": ");
+    if (colon == std::string_view::npos || colon == 0 || s.find("://") != std::string_view::npos)
+        return false;
+    item.name = trim(s.substr(0, colon));
+    item.value = trim(s.substr(colon + 2));
+    return !item.name.empty();
+}
+
+} // namespace
+
+bool read_checklist(std::string_view source, Checklist& out, std::string* why)
+{
+    out.title = {};
+    out.items.clear();
+    if (source.substr(0, 3) == "\xef\xbb\xbf")
+        source.remove_prefix(3);
+
+    std::string_view section;
+    bool in_section = false;
+    uint32_t number = 0;
+    size_t at = 0;
+    std::string_view line, next;
+    auto read_line = [&](size_t& pos, std::string_view& l) {
+        if (pos >= source.size())
+            return false;
+        size_t nl = source.find('\n', pos);
+        if (nl == std::string_view::npos)
+            nl = source.size();
+        l = trim(source.substr(pos, nl - pos));
+        pos = nl + 1;
+        return true;
+    };
+    while (read_line(at, line)) {
+        ++number;
+        size_t peek = at;
+        if (!line.empty() && read_line(peek, next) && is_rule(next)) {
+            section = line;
+            in_section = true;
+            at = peek;
+            ++number;
+            continue;
+        }
+        if (!in_section) {
+            if (out.title.empty() && !line.empty() && line.find("://") == std::string_view::npos)
+                out.title = line;
+            continue;
+        }
+        ChecklistItem item;
+        item.section = section;
+        item.line = number;
+        std::string_view text = line;
+        if (text.substr(0, 3) == "!!!") {
+            item.flagged = true;
+            size_t mark = text.find_first_not_of('!');
+            text = mark == std::string_view::npos ? std::string_view() : trim(text.substr(mark));
+        }
+        if (split_key(text, item) || split_name(text, item))
+            out.items.push_back(item);
+    }
+    if (out.items.empty()) {
+        if (why)
+            *why = "no settings, is it an NVProfileInspector checklist?";
+        return false;
+    }
+    return true;
+}
+
+} // namespace nvapi
@@ -0,0 +1,48 @@
+// nvapi_checklist.h
+//
+// The settings checklists at the repo root (NVProfileInspectorPerf.txt,
+// NVProfileInspectorHQ.txt): what to set in nvidiaProfileInspector, by
+// hand, grouped the way NPI groups them.
+//
+//   2 - Sync and Refresh                                     <- section
+//   -------------------------
+//   Frame Rate Limiter V3: Off                               <- NPI name: value
+//   !!! Antialiasing (MSAA) - Setting (OGL): 32xS [...]      <- flagged
+//   OGL_APP_CLAW - 0x00000001 Enabled - Enable the ...       <- key - value
+//
+// A section is a line with a line of dashes under it. In a section, a line
+// is an item if it is "name: value" or "KEY - 0x... rest", where KEY has no
+// spaces and is the driver's own name for the setting. Lines that are
+// neither (notes, blank lines, the title and link above the first section)
+// are not items. Strings are views into the source.
+
+#ifndef NVTOOLS_NVAPI_CHECKLIST_H
+#define NVTOOLS_NVAPI_CHECKLIST_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace nvapi {
+
+struct ChecklistItem {
+    std::string_view section;
+    std::string_view name;      // without the "!!!" marker
+    std::string_view value;     // after ": ", or from the 0x on for a key
+    uint32_t line = 0;          // 1-based
+    bool key = false;           // name is a driver key, "KEY - 0x..."
+    bool flagged = false;       // marked "!!!"
+};
+
+struct Checklist {
+    std::string_view title;     // first line that is not a link
+    std::vector<ChecklistItem> items;
+};
+
+// False, with the reason, if source has no items.
+bool read_checklist(std::string_view source, Checklist& out, std::string* why = nullptr);
+
+} // namespace nvapi
+
+#endif // NVTOOLS_NVAPI_CHECKLIST_H
@@ -0,0 +1,273 @@
+// nvapi_compile.cpp
+
+#include "nvapi_compile.h"
+
+#include "nvapi_value.h"
+#include "text_util.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace nvapi {
+
+namespace {
+
+using nvtools::hex_digit;
+using nvtools::iequals;
+using nvtools::parse_hex;
+using nvtools::trim;
+
+// "+0.000" against "+0.0000": NPI prints some value names as numbers, to a
+// precision the checklists do not keep.
+bool decimal_name(std::string_view s, double& out)
+{
+    if (s.empty() || s.size() > 32)
+        return false;
+    size_t digits = 0, dots = 0;
+    for (size_t i = 0; i < s.size(); ++i) {
+        char c = s[i];
+        if (c >= '0' && c <= '9')
+            ++digits;
+        else if (c == '.')
+            ++dots;
+        else if (!((c == '+' || c == '-') && i == 0))
+            return false;
+    }
+    if (!digits || dots > 1)
+        return false;
+    char buf[40];
+    s.copy(buf, s.size());
+    buf[s.size()] = 0;
+    out = std::strtod(buf, nullptr);
+    return true;
+}
+
+// "0x..." at the start of s, up to the first character that is not a hex
+// digit, if a space or the end follows it.
+std::string_view leading_hex(std::string_view s)
+{
+    if (s.size() < 3 || s[0] != '0' || (s[1] != 'x' && s[1] != 'X'))
+        return {};
+    size_t n = 2;
+    while (n < s.size() && hex_digit(s[n]) >= 0)
+        ++n;
+    if (n == 2 || (n < s.size() && s[n] != ' '))
+        return {};
+    return s.substr(0, n);
+}
+
+// "0x..." in parentheses at the end of s, as in "Off (0x00)".
+std::string_view trailing_hex(std::string_view s)
+{
+    if (s.empty() || s.back() != ')')
+        return {};
+    size_t open = s.rfind('(');
+    if (open == std::string_view::npos)
+        return {};
+    std::string_view inner = trim(s.substr(open + 1, s.size() - open - 2));
+    return leading_hex(inner).size() == inner.size() ? inner : std::string_view();
+}
+
+// s without a note in () or [] at its end: "Off (screenshot tool)" is Off.
+std::string_view without_note(std::string_view s)
+{
+    if (s.empty() || (s.back() != ')' && s.back() != ']'))
+        return s;
+    size_t open = s.rfind(s.back() == ')' ? " (" : " [");
+    return open == std::string_view::npos ? s : trim(s.substr(0, open));
+}
+
+// Digits with a fraction of zeros, as the checklists print some whole
+// numbers ("0.00"), without the fraction; anything else as it is. Only the
+// compiler lets the fraction go: parse_value() reads "0.00" as no number.
+std::string_view whole(std::string_view s)
+{
+    size_t dot = s.find('.');
+    if (dot == 0 || dot == std::string_view::npos || dot + 1 == s.size()
+        || s.find_first_not_of("0123456789") != dot
+        || s.find_first_not_of('0', dot + 1) != std::string_view::npos)
+        return s;
+    return s.substr(0, dot);
+}
+
+// A decimal DWORD, "0.00" included.
+bool parse_decimal(std::string_view s, uint64_t& out)
+{
+    s = whole(s);
+    if (s.empty() || s.size() > 10)
+        return false;
+    out = 0;
+    for (char c : s) {
+        if (c < '0' || c > '9')
+            return false;
+        out = out * 10 + uint64_t(c - '0');
+    }
+    return out <= 0xffffffffu;
+}
+
+void set_value(const Value& v, CompiledSetting& out)
+{
+    out.value.clear();
+    const char* type = format_nip(v, out.value);
+    out.type = type ? type : "Dword";
+}
+
+} // namespace
+
+const char* problem_name(CompileProblem p)
+{
+    switch (p) {
+    case CompileProblem::UnknownSetting: return "unknown setting";
+    case CompileProblem::NoId:           return "no SettingID";
+    case CompileProblem::UnknownValue:   return "unknown value";
+    case CompileProblem::Duplicate:      return "duplicate";
+    }
+    return "?";
+}
+
+void ChecklistCompiler::add_names(const CustomNames& names)
+{
+    for (uint32_t s = 0; s < names.settings.size(); ++s)
+        if (names.settings[s].value_count)
+            values_.emplace(names.settings[s].id, Values{&names, s});
+}
+
+bool ChecklistCompiler::named_value(const Values& v, std::string_view text, uint32_t& out) const
+{
+    const CustomSetting& s = v.names->settings[v.setting];
+    std::string plain;
+    double number, other;
+    bool numeric = decimal_name(text, number);
+    for (uint32_t i = s.value_begin; i < s.value_begin + s.value_count; ++i) {
+        const CustomValue& cv = v.names->values[i];
+        std::string_view name = trim(cv.name);
+        if (name.find('&') != std::string_view::npos) {
+            plain.clear();
+            if (xml_unescape(name, plain))
+                name = plain;
+        }
+        uint64_t n;
+        bool same = iequals(name, text) || (numeric && decimal_name(name, other) && other == number);
+        if (same && parse_hex(trim(cv.hex), n)) {
+            out = uint32_t(n);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ChecklistCompiler::resolve(uint32_t id, uint32_t section, std::string_view text, CompiledSetting& out,
+                                std::string* why) const
+{
+    auto v = values_.find(id);
+    uint32_t named;
+    if (v != values_.end()
+        && (named_value(v->second, text, named) || named_value(v->second, without_note(text), named))) {
+        set_value(Value::dword(named), out);
+        return true;
+    }
+
+    std::string_view number = leading_hex(text);
+    if (number.empty())
+        number = trailing_hex(text);
+
+    if (snap_ && section != kNoSection) {
+        SectionRecord r;
+        snap_->read(section, r);
+        Value value;
+        bool integer = r.section.type == ValueType::Dword || r.section.type == ValueType::Qword;
+        std::string_view tries[3] = {number, text, without_note(text)};
+        for (std::string_view t : tries)
+            if (!t.empty() && resolve_value(r, integer ? whole(t) : t, value, why)) {
+                set_value(value, out);
+                return true;
+            }
+        double fractional;
+        if (why && integer && number.empty() && text.find('.') != std::string_view::npos
+            && decimal_name(text, fractional))
+            *why = std::string(text) + " is not a whole number, and " + std::string(r.section.name) + " is a "
+                + type_name(r.section.type);
+        return false;
+    }
+
+    // With no type to go by, a number written wider than 8 hex digits, like
+    // rBAR's "0x0000000040000000", is a QWORD.
+    uint64_t n;
+    if (!number.empty() ? parse_hex(number, n) : parse_decimal(text, n)) {
+        bool qword = n > 0xffffffffu || number.size() > 10;
+        set_value(qword ? Value::qword(n) : Value::dword(uint32_t(n)), out);
+        return true;
+    }
+    double fractional;
+    if (why && number.empty() && text.find('.') != std::string_view::npos && decimal_name(text, fractional))
+        *why = "not a whole number, and the setting's type is not known";
+    else if (why)
+        *why = v == values_.end() ? "not a number, and no value names are known for the setting"
+                                  : "not a number or one of the setting's value names";
+    return false;
+}
+
+void ChecklistCompiler::compile(const Checklist& list, CompiledProfile& out) const
+{
+    out.settings.clear();
+    out.problems.clear();
+    out.items = list.items.size();
+    for (uint32_t i = 0; i < list.items.size(); ++i) {
+        const ChecklistItem& item = list.items[i];
+        std::optional<uint32_t> e = item.key ? index_.by_key(item.name) : index_.by_name(item.name);
+        if (!e) {
+            out.problems.push_back({CompileProblem::UnknownSetting, item.line, item.name, item.value,
+                                    "the join index has no setting by this name"});
+            continue;
+        }
+        JoinEntry j = index_.entry(*e);
+        if (!j.has_id) {
+            out.problems.push_back({CompileProblem::NoId, item.line, item.name, item.value,
+                                    "dump key " + std::string(j.dump_name) + ", with no SettingID joined to it"});
+            continue;
+        }
+        CompiledSetting s{j.id, {}, {}, "Dword", item.line, i};
+        std::string why;
+        if (!resolve(j.id, j.section, trim(item.value), s, &why)) {
+            out.problems.push_back({CompileProblem::UnknownValue, item.line, item.name, item.value, why});
+            continue;
+        }
+        xml_escape(j.name, s.name_info);
+        out.settings.push_back(std::move(s));
+    }
+
+    // NPI writes settings by ID. A setting listed twice keeps its first
+    // value; a different second one is a problem.
+    std::stable_sort(out.settings.begin(), out.settings.end(),
+                     [](const CompiledSetting& a, const CompiledSetting& b) { return a.id < b.id; });
+    size_t kept = 0;
+    for (size_t i = 0; i < out.settings.size(); ++i) {
+        CompiledSetting& s = out.settings[i];
+        if (kept && out.settings[kept - 1].id == s.id) {
+            const CompiledSetting& first = out.settings[kept - 1];
+            if (first.value != s.value || std::string_view(first.type) != s.type) {
+                const ChecklistItem& item = list.items[s.item];
+                out.problems.push_back({CompileProblem::Duplicate, s.line, item.name, item.value,
+                                        "line " + std::to_string(first.line) + " sets it to " + first.value});
+            }
+            continue;
+        }
+        if (kept != i)
+            out.settings[kept] = std::move(s);
+        ++kept;
+    }
+    out.settings.resize(kept);
+    std::stable_sort(out.problems.begin(), out.problems.end(),
+                     [](const CompileIssue& a, const CompileIssue& b) { return a.line < b.line; });
+}
+
+void write_compiled(const CompiledProfile& p, std::string_view profile_name, NipWriter& out)
+{
+    out.begin_profile(profile_name, nullptr, 0);
+    for (const CompiledSetting& s : p.settings)
+        out.setting(s.name_info, s.id, s.value, s.type);
+    out.end_profile();
+    out.finish();
+}
+
+} // namespace nvapi
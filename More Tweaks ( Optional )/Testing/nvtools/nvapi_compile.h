@@ -0,0 +1,111 @@
+// nvapi_compile.h
+//
+// Turns a settings checklist (nvapi_checklist.h) into the profile it
+// describes, ready to write as a .nip file:
+//
+//   nvapi::ChecklistCompiler c(index, &snap);
+//   c.add_names(reference);                  // value names, first one wins
+//   nvapi::CompiledProfile p;
+//   c.compile(list, p);                      // p.settings, p.problems
+//   nvapi::write_compiled(p, "Base Profile", writer);
+//
+// A line's setting is found through the join index (nvapi_join.h): by name,
+// or by key for a "KEY - 0x..." line. Its value is tried as:
+//
+//   a value name the CustomSettingNames give the setting    "Force Off"
+//   the same, without a trailing note in () or []           "Off (screenshot tool)"
+//   a number leading the text, or in () at its end          "0x00000000 Off", "Off (0x00)"
+//   a number or symbol name of the setting in the dump      "0.00", "ON"
+//
+// Dump settings take their type from the dump, so a FLOAT is written as its
+// bits and a QWORD as Binary, as NPI does (nvapi_value.h). Other settings
+// are Dwords, unless the number is written wider than 8 hex digits. A whole
+// number may carry a fraction of zeros, "0.00" being 0, wherever a DWORD or
+// QWORD is meant; the compiler drops it before parse_value(), which stays
+// strict. Any other fraction needs a FLOAT setting. A line that resolves to
+// nothing is left out of the profile and reported, as is a setting listed
+// twice with different values. Nothing is guessed: "N/A" and a name with no
+// ID are problems, not zeros.
+
+#ifndef NVTOOLS_NVAPI_COMPILE_H
+#define NVTOOLS_NVAPI_COMPILE_H
+
+#include "nvapi_checklist.h"
+#include "nvapi_join.h"
+#include "nvapi_names.h"
+#include "nvapi_nip.h"
+#include "nvapi_snapshot.h"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace nvapi {
+
+struct CompiledSetting {
+    uint32_t id;
+    std::string name_info;      // escaped, ready for the .nip
+    std::string value;
+    const char* type;           // "Dword", "Binary" or "String"
+    uint32_t line;
+    uint32_t item;              // the line's index in Checklist::items
+};
+
+enum class CompileProblem : uint8_t {
+    UnknownSetting,     // the index joins the name to nothing
+    NoId,               // joined, but to a setting with no SettingID
+    UnknownValue,       // the setting is known, the value is not
+    Duplicate,          // listed before with another value; the first stays
+};
+
+struct CompileIssue {
+    CompileProblem problem;
+    uint32_t line;
+    std::string_view name;      // views into the checklist
+    std::string_view value;
+    std::string why;
+};
+
+struct CompiledProfile {
+    std::vector<CompiledSetting> settings;  // sorted by id
+    std::vector<CompileIssue> problems;     // in line order
+    size_t items = 0;
+};
+
+const char* problem_name(CompileProblem p);
+
+class ChecklistCompiler {
+public:
+    // snap may be null, and then only value names and numbers resolve. It
+    // has to be the snapshot the index was built against.
+    ChecklistCompiler(const JoinIndex& index, const Snapshot* snap) : index_(index), snap_(snap) {}
+
+    // Value names for the settings in names. names has to outlive the
+    // compiler; a setting already given values keeps them.
+    void add_names(const CustomNames& names);
+
+    void compile(const Checklist& list, CompiledProfile& out) const;
+
+private:
+    struct Values {
+        const CustomNames* names;
+        uint32_t setting;
+    };
+
+    bool resolve(uint32_t id, uint32_t section, std::string_view text, CompiledSetting& out,
+                 std::string* why) const;
+    bool named_value(const Values& v, std::string_view text, uint32_t& out) const;
+
+    const JoinIndex& index_;
+    const Snapshot* snap_;
+    std::unordered_map<uint32_t, Values> values_;
+};
+
+// One profile with the compiled settings and no executables, then finish().
+void write_compiled(const CompiledProfile& p, std::string_view profile_name, NipWriter& out);
+
+} // namespace nvapi
+
+#endif // NVTOOLS_NVAPI_COMPILE_H
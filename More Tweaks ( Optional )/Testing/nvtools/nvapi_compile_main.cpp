@@ -0,0 +1,117 @@
+// nvapi_compile_main.cpp
+//
+//   nvapi_compile [utf8|utf16] <join index> <snapshot> <checklist.txt> <out.nip> [<names.xml|.exe>...]
+//
+// Compiles the checklist into a Base Profile (nvapi_compile.h) and writes it
+// to out.nip: utf16 (the default) the way NPI saves it, utf8 the way this
+// repo keeps its copies. The index has to be built against the snapshot;
+// the CustomSettingNames files, usually Reference.xml and
+// nvidiaProfileInspector.exe, name the values, the first to name a setting's
+// values winning. Every line that did not compile is printed as
+//
+//   checklist:line: problem: name: value (why)
+//
+// and then the file is still written, without those lines, and the exit
+// status is 1. Run once per driver dump, it rebuilds the profiles for that
+// driver's snapshot:
+//
+//   for d in dumps/*.snap; do nvapi_compile "${d%.snap}.join" "$d" Perf.txt "${d%.snap}.nip" Reference.xml; done
+
+#include "mapped_file.h"
+#include "nvapi_compile.h"
+
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <string>
+
+int main(int argc, char** argv)
+{
+    int a = 1;
+    bool utf8 = false;
+    if (argc > 1 && (std::strcmp(argv[1], "utf8") == 0 || std::strcmp(argv[1], "utf16") == 0)) {
+        utf8 = std::strcmp(argv[1], "utf8") == 0;
+        ++a;
+    }
+    if (argc - a < 4) {
+        std::fprintf(stderr, "usage: nvapi_compile [utf8|utf16] <join index> <snapshot> <checklist.txt> <out.nip>"
+                             " [<names.xml|.exe>...]\n");
+        return 2;
+    }
+    const char* index_path = argv[a];
+    const char* snap_path = argv[a + 1];
+    const char* list_path = argv[a + 2];
+    const char* out_path = argv[a + 3];
+
+    nvapi::JoinIndex idx;
+    nvapi::Snapshot snap;
+    std::string why;
+    if (!idx.open(index_path, &why)) {
+        std::fprintf(stderr, "error: %s: %s\n", index_path, why.c_str());
+        return 1;
+    }
+    if (!snap.open(snap_path, &why)) {
+        std::fprintf(stderr, "error: %s: %s\n", snap_path, why.c_str());
+        return 1;
+    }
+    if (snap.size() != idx.dump_size()) {
+        std::fprintf(stderr, "error: %s was built against another dump than %s\n", index_path, snap_path);
+        return 1;
+    }
+
+    nvapi::ChecklistCompiler compiler(idx, &snap);
+    std::deque<nvtools::MappedFile> files;
+    std::deque<nvapi::CustomNames> names;
+    for (int n = a + 4; n < argc; ++n) {
+        files.emplace_back();
+        names.emplace_back();
+        if (!files.back().open(argv[n])) {
+            std::fprintf(stderr, "error: cannot read %s\n", argv[n]);
+            return 1;
+        }
+        if (!nvapi::read_custom_names(files.back().view(), names.back(), &why)) {
+            std::fprintf(stderr, "error: %s: %s\n", argv[n], why.c_str());
+            return 1;
+        }
+        compiler.add_names(names.back());
+    }
+
+    nvtools::MappedFile list_file;
+    nvapi::Checklist list;
+    if (!list_file.open(list_path)) {
+        std::fprintf(stderr, "error: cannot read %s\n", list_path);
+        return 1;
+    }
+    if (!nvapi::read_checklist(list_file.view(), list, &why)) {
+        std::fprintf(stderr, "error: %s: %s\n", list_path, why.c_str());
+        return 1;
+    }
+
+    nvapi::CompiledProfile profile;
+    compiler.compile(list, profile);
+    nvapi::NipFormat format;
+    if (utf8) {
+        format.encoding = nvapi::NipEncoding::Utf8;
+        format.crlf = false;
+        format.final_newline = true;
+    }
+    std::string out;
+    nvapi::NipWriter w(format, out);
+    nvapi::write_compiled(profile, "Base Profile", w);
+    FILE* f = std::fopen(out_path, "wb");
+    bool ok = f && std::fwrite(out.data(), 1, out.size(), f) == out.size();
+    if (f)
+        ok = std::fclose(f) == 0 && ok;
+    if (!ok) {
+        std::fprintf(stderr, "error: cannot write %s\n", out_path);
+        return 1;
+    }
+
+    for (const nvapi::CompileIssue& p : profile.problems)
+        std::printf("%s:%u: %s: %.*s: %.*s (%s)\n", list_path, p.line, nvapi::problem_name(p.problem),
+                    int(p.name.size()), p.name.data(), int(p.value.size()), p.value.data(), p.why.c_str());
+    std::fprintf(stderr, "%zu of %zu lines compiled into %zu settings, %zu problems\n",
+                 profile.items - profile.problems.size(), profile.items, profile.settings.size(),
+                 profile.problems.size());
+    return profile.problems.empty() ? 0 : 1;
+}
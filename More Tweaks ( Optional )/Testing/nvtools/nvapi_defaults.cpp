@@ -0,0 +1,116 @@
+// nvapi_defaults.cpp
+
+#include "nvapi_defaults.h"
+
+#include "nvapi_snapshot.h"
+
+#include <cstring>
+
+namespace nvapi {
+
+namespace {
+
+uint64_t bits_of(const Value& v)
+{
+    switch (v.type()) {
+    case ValueType::Dword: return v.as_dword();
+    case ValueType::Qword: return v.as_qword();
+    case ValueType::Float: {
+        float f = v.as_float();
+        uint32_t b;
+        std::memcpy(&b, &f, sizeof b);
+        return b;
+    }
+    default: return 0;
+    }
+}
+
+} // namespace
+
+DefaultTable DefaultTable::build(const Dump& dump)
+{
+    DefaultTable t;
+    t.entries_.reserve(dump.sections.size());
+    SectionRecord r;
+    for (size_t i = 0; i < dump.sections.size(); ++i) {
+        dump.read(i, r);
+        t.add(r);
+    }
+    return t;
+}
+
+DefaultTable DefaultTable::build(const Snapshot& snap)
+{
+    DefaultTable t;
+    t.entries_.reserve(snap.size());
+    SectionRecord r;
+    for (size_t i = 0; i < snap.size(); ++i) {
+        snap.read(i, r);
+        t.add(r);
+    }
+    return t;
+}
+
+void DefaultTable::add(const SectionRecord& r)
+{
+    Entry e{0, 0, ValueType::Unknown, 0};
+    const Default* plain = nullptr;
+    for (const Default& d : r.defaults) {
+        if (d.label == "DEFAULT" && !plain)
+            plain = &d;
+        else if (d.label.substr(0, 8) == "DEFAULT " && e.variants < 255)
+            ++e.variants;
+    }
+    Value v;
+    if (plain && resolve_default(r, *plain, v)) {
+        e.type = v.type();
+        if (v.type() == ValueType::String || v.type() == ValueType::Binary) {
+            e.bits = pool_.size();
+            e.length = uint32_t(v.bytes().size());
+            pool_ += v.bytes();
+        } else {
+            e.bits = bits_of(v);
+        }
+        ++resolved_;
+    }
+    entries_.push_back(e);
+}
+
+Value DefaultTable::value(uint32_t section) const
+{
+    const Entry& e = entries_[section];
+    switch (e.type) {
+    case ValueType::Dword: return Value::dword(uint32_t(e.bits));
+    case ValueType::Qword: return Value::qword(e.bits);
+    case ValueType::Float: {
+        uint32_t b = uint32_t(e.bits);
+        float f;
+        std::memcpy(&f, &b, sizeof f);
+        return Value::real(f);
+    }
+    case ValueType::String: return Value::string(std::string_view(pool_).substr(e.bits, e.length));
+    case ValueType::Binary: return Value::binary(std::string_view(pool_).substr(e.bits, e.length));
+    case ValueType::Unknown: break;
+    }
+    return Value();
+}
+
+bool DefaultTable::is_default(uint32_t section, const Value& v) const
+{
+    const Entry& e = entries_[section];
+    if (e.type != v.type() || e.type == ValueType::Unknown)
+        return false;
+    if (e.type == ValueType::String || e.type == ValueType::Binary)
+        return std::string_view(pool_).substr(e.bits, e.length) == v.bytes();
+    return e.bits == bits_of(v);
+}
+
+void DefaultTable::changed(const std::vector<SettingValue>& settings, std::vector<uint32_t>& out) const
+{
+    out.clear();
+    for (uint32_t i = 0; i < settings.size(); ++i)
+        if (settings[i].section >= entries_.size() || !is_default(settings[i].section, settings[i].value))
+            out.push_back(i);
+}
+
+} // namespace nvapi
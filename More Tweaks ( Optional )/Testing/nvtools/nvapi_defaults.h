@@ -0,0 +1,79 @@
+// nvapi_defaults.h
+//
+// The driver's default for every setting, resolved once into a flat array so
+// that "which of these settings did anyone change?" is a compare per
+// setting:
+//
+//   nvapi::DefaultTable defaults = nvapi::DefaultTable::build(snap);
+//   std::vector<nvapi::SettingValue> profile = ...;   // section index + value
+//   std::vector<uint32_t> changed;
+//   defaults.changed(profile, changed);               // only these need shipping
+//
+// An entry is the setting's plain "DEFAULT:" row, read by resolve_default()
+// (nvapi_value.h): 16 bytes, with STRING and BINARY defaults in one shared
+// pool. Rows such as "DEFAULT GL:" or "DEFAULT TESLA:" apply to one API or
+// architecture only, so a value matching one of them still counts as
+// changed; has_variants() says which settings have them. A setting whose
+// DEFAULT is missing or does not read as its type has no default, and any
+// value of it counts as changed.
+
+#ifndef NVTOOLS_NVAPI_DEFAULTS_H
+#define NVTOOLS_NVAPI_DEFAULTS_H
+
+#include "nvapi_dump.h"
+#include "nvapi_value.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace nvapi {
+
+class Snapshot;
+
+// One setting of a profile, by its index in the dump.
+struct SettingValue {
+    uint32_t section;
+    Value value;
+};
+
+class DefaultTable {
+public:
+    static DefaultTable build(const Dump& dump);
+    static DefaultTable build(const Snapshot& snap);
+
+    size_t size() const { return entries_.size(); }
+    bool has_default(uint32_t section) const { return entries_[section].type != ValueType::Unknown; }
+    bool has_variants(uint32_t section) const { return entries_[section].variants != 0; }
+
+    // The default, or a Value with no type.
+    Value value(uint32_t section) const;
+
+    // No allocation, whatever the type.
+    bool is_default(uint32_t section, const Value& v) const;
+
+    // Positions in settings of the values that are not their setting's
+    // default, in order. A section past size() is never a default.
+    void changed(const std::vector<SettingValue>& settings, std::vector<uint32_t>& out) const;
+
+    // Settings with a default, of size().
+    size_t resolved_count() const { return resolved_; }
+
+private:
+    struct Entry {
+        uint64_t bits;          // DWORD, QWORD, FLOAT bits; STRING, BINARY: offset into pool_
+        uint32_t length;        // STRING, BINARY
+        ValueType type;         // Unknown: no default
+        uint8_t variants;       // other DEFAULT rows, up to 255
+    };
+
+    void add(const SectionRecord& r);
+
+    std::vector<Entry> entries_;
+    std::string pool_;
+    size_t resolved_ = 0;
+};
+
+} // namespace nvapi
+
+#endif // NVTOOLS_NVAPI_DEFAULTS_H
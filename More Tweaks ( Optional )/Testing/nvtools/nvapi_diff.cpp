@@ -0,0 +1,152 @@
+// nvapi_diff.cpp
+
+#include "nvapi_diff.h"
+
+#include <unordered_map>
+
+namespace nvapi {
+
+namespace {
+
+std::string availability_text(const Section& s)
+{
+    std::string out = availability_name(s.availability);
+    if (!s.condition.empty())
+        out += " " + std::string(s.condition);
+    return out;
+}
+
+std::string assignment_text(const Section& s)
+{
+    std::string out = s.assignment == Assignment::Combination ? "combination"
+        : s.assignment == Assignment::OneOf                   ? "one of"
+                                                              : "any";
+    if (s.names_only)
+        out += ", names only";
+    if (s.bitfields)
+        out += ", bitfields";
+    return out;
+}
+
+// Pairs a[] and b[] up by key(), the n-th occurrence of a key in a with the
+// n-th in b (the dump does repeat DEFAULT labels), and calls paired(i, j),
+// added(j) or removed(i). The table is reused from one setting to the next.
+template <class T, class Key, class Paired, class Added, class Removed>
+void pair_up(const T* a, uint32_t na, const T* b, uint32_t nb, Key key, Paired paired, Added added,
+             Removed removed)
+{
+    constexpr uint32_t kNone = ~0u;
+    static thread_local std::unordered_map<std::string_view, uint32_t> first;
+    static thread_local std::vector<uint32_t> next;
+    first.clear();
+    next.assign(na, kNone);
+    for (uint32_t i = na; i-- > 0;) {
+        auto [it, fresh] = first.emplace(key(a[i]), i);
+        if (!fresh) {
+            next[i] = it->second;
+            it->second = i;
+        }
+    }
+    std::vector<bool> used(na, false);
+    for (uint32_t j = 0; j < nb; ++j) {
+        auto it = first.find(key(b[j]));
+        if (it == first.end() || it->second == kNone) {
+            added(j);
+            continue;
+        }
+        uint32_t i = it->second;
+        it->second = next[i];
+        used[i] = true;
+        paired(i, j);
+    }
+    for (uint32_t i = 0; i < na; ++i)
+        if (!used[i])
+            removed(i);
+}
+
+void diff_section(const Dump& da, const Section& a, const Dump& db, const Section& b, std::vector<Change>& out)
+{
+    if (a.type != b.type)
+        out.push_back({ChangeKind::Type, b.name, {}, type_name(a.type), type_name(b.type)});
+    if (a.availability != b.availability || a.condition != b.condition) {
+        ChangeKind kind = ChangeKind::Condition;
+        if (a.availability == Availability::Always && b.availability == Availability::Debug)
+            kind = ChangeKind::DebugOnly;
+        else if (a.availability != Availability::Always && b.availability == Availability::Always)
+            kind = ChangeKind::Release;
+        out.push_back({kind, b.name, {}, availability_text(a), availability_text(b)});
+    }
+    if (a.assignment != b.assignment || a.names_only != b.names_only || a.bitfields != b.bitfields)
+        out.push_back({ChangeKind::Assignment, b.name, {}, assignment_text(a), assignment_text(b)});
+
+    const Symbol* sa = da.symbols_of(a);
+    const Symbol* sb = db.symbols_of(b);
+    pair_up(sa, a.symbol_count, sb, b.symbol_count, [](const Symbol& s) { return s.name; },
+            [&](uint32_t i, uint32_t j) {
+                // "0x1" and "0x00000001" are the same value.
+                std::optional<uint64_t> va = parse_number(sa[i].value), vb = parse_number(sb[j].value);
+                if (va && vb ? *va != *vb : sa[i].value != sb[j].value)
+                    out.push_back({ChangeKind::Renumbered, b.name, sb[j].name, std::string(sa[i].value),
+                                   std::string(sb[j].value)});
+            },
+            [&](uint32_t j) {
+                out.push_back({ChangeKind::SymbolAdded, b.name, sb[j].name, {}, std::string(sb[j].value)});
+            },
+            [&](uint32_t i) {
+                out.push_back({ChangeKind::SymbolRemoved, b.name, sa[i].name, std::string(sa[i].value), {}});
+            });
+
+    const Default* fa = da.defaults_of(a);
+    const Default* fb = db.defaults_of(b);
+    pair_up(fa, a.default_count, fb, b.default_count, [](const Default& d) { return d.label; },
+            [&](uint32_t i, uint32_t j) {
+                if (fa[i].value != fb[j].value)
+                    out.push_back({ChangeKind::Default, b.name, fb[j].label, std::string(fa[i].value),
+                                   std::string(fb[j].value)});
+            },
+            [&](uint32_t j) {
+                out.push_back({ChangeKind::Default, b.name, fb[j].label, {}, std::string(fb[j].value)});
+            },
+            [&](uint32_t i) {
+                out.push_back({ChangeKind::Default, b.name, fa[i].label, std::string(fa[i].value), {}});
+            });
+}
+
+} // namespace
+
+std::vector<Change> diff(const Dump& before, const Dump& after)
+{
+    std::vector<Change> out;
+    for (const Section& s : before.sections)
+        if (!after.by_name.count(s.name))
+            out.push_back({ChangeKind::Removed, s.name, {}, type_name(s.type), {}});
+    for (const Section& s : after.sections) {
+        auto it = before.by_name.find(s.name);
+        if (it == before.by_name.end()) {
+            out.push_back({ChangeKind::Added, s.name, {}, {}, type_name(s.type)});
+            continue;
+        }
+        diff_section(before, before.sections[it->second], after, s, out);
+    }
+    return out;
+}
+
+const char* change_name(ChangeKind kind)
+{
+    switch (kind) {
+    case ChangeKind::Added:         return "added";
+    case ChangeKind::Removed:       return "removed";
+    case ChangeKind::Type:          return "type";
+    case ChangeKind::DebugOnly:     return "debug only";
+    case ChangeKind::Release:       return "release";
+    case ChangeKind::Condition:     return "condition";
+    case ChangeKind::Assignment:    return "assignment";
+    case ChangeKind::SymbolAdded:   return "symbol added";
+    case ChangeKind::SymbolRemoved: return "symbol removed";
+    case ChangeKind::Renumbered:    return "renumbered";
+    case ChangeKind::Default:       return "default";
+    }
+    return "?";
+}
+
+} // namespace nvapi
@@ -0,0 +1,56 @@
+// nvapi_diff.h
+//
+// Structural diff between two parameter dumps, by setting name. Sections move
+// around from one driver to the next, so a text diff of the 45k lines is
+// mostly noise; this pairs settings up by name and compares what they hold:
+//
+//   nvapi::Dump a = nvapi::parse_dump(old_file.view());
+//   nvapi::Dump b = nvapi::parse_dump(new_file.view());
+//   for (const nvapi::Change& c : nvapi::diff(a, b)) ...
+//
+// Each setting and each symbol is looked up once in a hash table, so the
+// cost is linear in the size of the two dumps. Strings are views into them.
+
+#ifndef NVTOOLS_NVAPI_DIFF_H
+#define NVTOOLS_NVAPI_DIFF_H
+
+#include "nvapi_dump.h"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace nvapi {
+
+enum class ChangeKind : uint8_t {
+    Added,
+    Removed,
+    Type,
+    DebugOnly,          // was in release drivers, now only in develop/debug ones
+    Release,            // the other way round
+    Condition,          // any other change of availability or its condition
+    Assignment,         // one of / combination, names only, bitfields
+    SymbolAdded,
+    SymbolRemoved,
+    Renumbered,         // same symbol name, another value
+    Default,            // a DEFAULT row's value; added or removed rows have an empty side
+};
+
+struct Change {
+    ChangeKind kind;
+    std::string_view setting;
+    std::string_view item;      // symbol or DEFAULT label, empty for the setting itself
+    std::string before;
+    std::string after;
+};
+
+// Removed settings in the old dump's order, then everything else in the new
+// dump's order.
+std::vector<Change> diff(const Dump& before, const Dump& after);
+
+const char* change_name(ChangeKind kind);
+
+} // namespace nvapi
+
+#endif // NVTOOLS_NVAPI_DIFF_H
@@ -0,0 +1,70 @@
+// nvapi_diff_main.cpp
+//
+// Structural diff of parameter dumps. With more than two dumps each one is
+// diffed against the one before it:
+//
+//   nvapi_diff old/NVAPI-PARAMETERS-DUMP.txt new/NVAPI-PARAMETERS-DUMP.txt
+//   nvapi_diff r535.txt r550.txt r560.txt ...
+//
+// Every change is one tab-separated line, for scripts to pick up:
+//
+//   kind <TAB> setting <TAB> symbol or DEFAULT label <TAB> before <TAB> after
+//
+// Empty columns are left empty. With a series, each pair starts with a
+// "# old -> new" line. A summary goes to stderr.
+
+#include "mapped_file.h"
+#include "nvapi_diff.h"
+
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+namespace {
+
+void print(const nvapi::Change& c)
+{
+    std::printf("%s\t%.*s\t%.*s\t%s\t%s\n", nvapi::change_name(c.kind), int(c.setting.size()), c.setting.data(),
+                int(c.item.size()), c.item.data(), c.before.c_str(), c.after.c_str());
+}
+
+struct Loaded {
+    nvtools::MappedFile file;
+    nvapi::Dump dump;
+};
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 3) {
+        std::fprintf(stderr, "usage: nvapi_diff <old dump> <new dump> [newer dumps...]\n");
+        return 2;
+    }
+    // The changes point into both dumps, so the previous one stays mapped.
+    std::unique_ptr<Loaded> prev;
+    size_t changes = 0;
+    for (int i = 1; i < argc; ++i) {
+        auto cur = std::make_unique<Loaded>();
+        if (!cur->file.open(argv[i])) {
+            std::fprintf(stderr, "error: cannot read %s\n", argv[i]);
+            return 1;
+        }
+        cur->dump = nvapi::parse_dump(cur->file.view());
+        if (cur->dump.sections.empty()) {
+            std::fprintf(stderr, "error: %s has no settings, is it a parameter dump?\n", argv[i]);
+            return 1;
+        }
+        if (prev) {
+            if (argc > 3)
+                std::printf("# %s -> %s\n", argv[i - 1], argv[i]);
+            std::vector<nvapi::Change> diff = nvapi::diff(prev->dump, cur->dump);
+            for (const nvapi::Change& c : diff)
+                print(c);
+            changes += diff.size();
+        }
+        prev = std::move(cur);
+    }
+    std::fprintf(stderr, "%zu changes\n", changes);
+    return 0;
+}
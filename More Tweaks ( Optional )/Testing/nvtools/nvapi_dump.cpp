@@ -0,0 +1,415 @@
+// nvapi_dump.cpp
+
+#include "nvapi_dump.h"
+
+#include "byte_scan.h"
+#include "work_steal.h"
+
+#include <algorithm>
+
+namespace nvapi {
+
+namespace {
+
+constexpr size_t kRuleWidth = 60;
+
+using nvtools::starts_with;
+using nvtools::trim;
+
+// The line terminator is not part of the line; a trailing '\r' is.
+bool is_rule(std::string_view line)
+{
+    if (!line.empty() && line.back() == '\r')
+        line.remove_suffix(1);
+    if (line.size() != kRuleWidth)
+        return false;
+    for (char c : line)
+        if (c != '-')
+            return false;
+    return true;
+}
+
+// Reads the line starting at pos and moves pos past its terminator.
+std::string_view take_line(std::string_view s, size_t& pos)
+{
+    size_t nl = nvtools::find_byte(s, '\n', pos);
+    size_t end = nl == std::string_view::npos ? s.size() : nl;
+    std::string_view line = s.substr(pos, end - pos);
+    pos = nl == std::string_view::npos ? s.size() : nl + 1;
+    return line;
+}
+
+bool parse_symbol(std::string_view line, Symbol& out)
+{
+    size_t open = line.find("(= ");
+    if (open == std::string_view::npos)
+        return false;
+    std::string_view name = trim(line.substr(0, open));
+    if (name.empty())
+        return false;
+    // The value ends at the first ')' that is followed by nothing or a comment.
+    for (size_t close = line.find(')', open + 3); close != std::string_view::npos;
+         close = line.find(')', close + 1)) {
+        std::string_view rest = trim(line.substr(close + 1));
+        if (rest.empty() || starts_with(rest, "//")) {
+            out.name = name;
+            out.value = trim(line.substr(open + 3, close - open - 3));
+            out.comment = rest.empty() ? rest : trim(rest.substr(2));
+            return true;
+        }
+    }
+    return false;
+}
+
+// One of the fixed lines at the top of a section. False ends the header.
+bool parse_header_line(std::string_view line, Section& s)
+{
+    if (starts_with(line, "This key is of type ")) {
+        std::string_view t = trim(line.substr(20));
+        s.type = t == "DWORD"  ? ValueType::Dword
+               : t == "STRING" ? ValueType::String
+               : t == "FLOAT"  ? ValueType::Float
+               : t == "QWORD"  ? ValueType::Qword
+               : t == "BINARY" ? ValueType::Binary
+                               : ValueType::Unknown;
+    } else if (starts_with(line, "This key is defined all the time")) {
+        s.availability = Availability::Always;
+    } else if (starts_with(line, "This key is defined only for develop/debug driver")) {
+        s.availability = Availability::Debug;
+    } else if (starts_with(line, "This key is defined for ")) {
+        s.availability = Availability::Condition;
+        s.condition = trim(line.substr(24));
+    } else if (starts_with(line, "The key is a collection of Bitfields.")) {
+        s.bitfields = true;
+    } else if (starts_with(line, "You may ")) {
+        std::string_view rest = line.substr(8);
+        if (starts_with(rest, "only ")) {
+            s.names_only = true;
+            rest.remove_prefix(5);
+        }
+        s.assignment = starts_with(rest, "assign it to some combination") ? Assignment::Combination
+                                                                          : Assignment::OneOf;
+    } else if (!starts_with(line, "but that is not required.")) {
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+const SectionRecord* SectionReader::next()
+{
+    const std::string_view s = source_;
+
+    // Opening rule, name, closing rule. Anything else before them (the dump
+    // starts with a blank line) is skipped.
+    std::string_view name;
+    size_t name_offset = 0;
+    for (;;) {
+        if (pos_ >= s.size())
+            return nullptr;
+        std::string_view line = take_line(s, pos_);
+        if (!is_rule(line))
+            continue;
+        size_t at = pos_;
+        std::string_view candidate = take_line(s, at);
+        if (is_rule(candidate))
+            continue;
+        size_t body = at;
+        if (!is_rule(take_line(s, body)))
+            continue;
+        name = trim(candidate);
+        name_offset = pos_;
+        pos_ = body;
+        break;
+    }
+
+    SectionRecord& r = record_;
+    r.symbols.clear();
+    r.defaults.clear();
+    r.matches.clear();
+    Section& sec = r.section;
+    sec = Section{};
+    sec.name = name;
+    sec.offset = uint32_t(name_offset);
+
+    enum class Part { Header, Description, Symbols, Defaults } part = Part::Header;
+    size_t desc_begin = std::string_view::npos, desc_end = 0;
+    for (;;) {
+        size_t line_begin = pos_;
+        if (line_begin >= s.size())
+            break;
+        size_t after = line_begin;
+        std::string_view line = take_line(s, after);
+        if (is_rule(line))
+            break;              // the next section's opening rule
+        pos_ = after;
+
+        if (part == Part::Header) {
+            if (parse_header_line(line, sec))
+                continue;
+            part = Part::Description;
+        }
+        std::string_view text = trim(line);
+        if (text.empty())
+            continue;
+        if (part != Part::Defaults && text == "Default values for this setting:") {
+            part = Part::Defaults;
+            continue;
+        }
+        if (part == Part::Defaults) {
+            if (line.front() == '\t') {
+                if (!r.defaults.empty()) {
+                    r.matches.push_back(text);
+                    ++r.defaults.back().match_count;
+                }
+                continue;
+            }
+            size_t colon = text.find(':');
+            if (colon != std::string_view::npos)
+                r.defaults.push_back({trim(text.substr(0, colon)), trim(text.substr(colon + 1)),
+                                      uint32_t(r.matches.size()), 0});
+            continue;
+        }
+        Symbol sym;
+        if (parse_symbol(line, sym)) {
+            r.symbols.push_back(sym);
+            part = Part::Symbols;
+            continue;
+        }
+        if (part == Part::Description) {
+            if (desc_begin == std::string_view::npos)
+                desc_begin = size_t(text.data() - s.data());
+            desc_end = size_t(text.data() + text.size() - s.data());
+        }
+    }
+
+    if (desc_begin != std::string_view::npos)
+        sec.description = s.substr(desc_begin, desc_end - desc_begin);
+    sec.symbol_count = uint32_t(r.symbols.size());
+    sec.default_count = uint32_t(r.defaults.size());
+    return &r;
+}
+
+namespace {
+
+// Appends the sections of source[begin, end) to d. Ranges in the records
+// are rebased onto d's arrays.
+void collect(Dump& d, std::string_view source, size_t begin, size_t end)
+{
+    // About 670 bytes per section and 230 per symbol in the current dump.
+    size_t bytes = end - begin;
+    d.sections.reserve(d.sections.size() + bytes / 512 + 1);
+    d.symbols.reserve(d.symbols.size() + bytes / 192 + 1);
+    d.defaults.reserve(d.defaults.size() + bytes / 768 + 1);
+    d.matches.reserve(d.matches.size() + bytes / 2048 + 1);
+
+    SectionReader reader(source.substr(0, end), begin);
+    while (const SectionRecord* r = reader.next()) {
+        Section sec = r->section;
+        sec.symbol_begin = uint32_t(d.symbols.size());
+        sec.default_begin = uint32_t(d.defaults.size());
+        d.symbols.insert(d.symbols.end(), r->symbols.begin(), r->symbols.end());
+        for (Default def : r->defaults) {
+            def.match_begin += uint32_t(d.matches.size());
+            d.defaults.push_back(def);
+        }
+        d.matches.insert(d.matches.end(), r->matches.begin(), r->matches.end());
+        d.sections.push_back(sec);
+    }
+}
+
+void index_names(Dump& d)
+{
+    d.by_name.reserve(d.sections.size());
+    for (uint32_t i = 0; i < d.sections.size(); ++i)
+        d.by_name.emplace(d.sections[i].name, i);
+}
+
+} // namespace
+
+Dump parse_dump(std::string_view source)
+{
+    Dump d;
+    d.source = source;
+    collect(d, source, 0, source.size());
+    index_names(d);
+    return d;
+}
+
+std::vector<size_t> split_dump(std::string_view source, size_t parts)
+{
+    std::vector<size_t> cuts{0};
+    for (size_t k = 1; k < parts; ++k) {
+        size_t from = std::max(cuts.back() + 1, source.size() / parts * k);
+        size_t nl = from <= source.size() ? nvtools::find_byte(source, '\n', from - 1) : std::string_view::npos;
+        if (nl == std::string_view::npos)
+            break;
+        // A rule, a name and a rule, after two lines that are not rules. The
+        // serial parse can only be standing on such a rule between sections:
+        // a closing rule always has its opening rule two lines up.
+        size_t pos = nl + 1, quiet = 0, cut = std::string_view::npos;
+        while (pos < source.size() && cut == std::string_view::npos) {
+            size_t line_begin = pos;
+            if (!is_rule(take_line(source, pos))) {
+                ++quiet;
+                continue;
+            }
+            size_t at = pos;
+            if (quiet >= 2 && !is_rule(take_line(source, at)) && at < source.size()
+                && is_rule(take_line(source, at)))
+                cut = line_begin;
+            quiet = 0;
+        }
+        if (cut == std::string_view::npos)
+            break;
+        cuts.push_back(cut);
+    }
+    cuts.push_back(source.size());
+    return cuts;
+}
+
+Dump parse_dump_parallel(std::string_view source, unsigned threads)
+{
+    if (threads == 0)
+        threads = nvtools::default_threads();
+    // Several chunks per thread so stealing has something to balance, but
+    // not so small that the per-chunk setup shows.
+    const size_t min_chunk = 64 * 1024;
+    size_t parts = std::min<size_t>(size_t(threads) * 4, source.size() / min_chunk + 1);
+    if (threads <= 1 || parts <= 1)
+        return parse_dump(source);
+
+    std::vector<size_t> cuts = split_dump(source, parts);
+    std::vector<Dump> chunks(cuts.size() - 1);
+    nvtools::parallel_for(chunks.size(), threads, [&](size_t i) {
+        collect(chunks[i], source, cuts[i], cuts[i + 1]);
+    });
+
+    // Where each chunk goes in the joined arrays. The arrays are sized once
+    // and every chunk is copied into its place on the pool, rebased as it
+    // goes, and builds a name index of its own numbered as in d.
+    struct Base {
+        size_t section, symbol, dflt, match;
+    };
+    std::vector<Base> bases(chunks.size() + 1);
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        const Dump& c = chunks[i];
+        bases[i + 1] = {bases[i].section + c.sections.size(), bases[i].symbol + c.symbols.size(),
+                        bases[i].dflt + c.defaults.size(), bases[i].match + c.matches.size()};
+    }
+    Dump d;
+    d.source = source;
+    d.sections.resize(bases.back().section);
+    d.symbols.resize(bases.back().symbol);
+    d.defaults.resize(bases.back().dflt);
+    d.matches.resize(bases.back().match);
+    nvtools::parallel_for(chunks.size(), threads, [&](size_t i) {
+        Dump& c = chunks[i];
+        const Base& b = bases[i];
+        for (size_t k = 0; k < c.sections.size(); ++k) {
+            Section& sec = d.sections[b.section + k];
+            sec = c.sections[k];
+            sec.symbol_begin += uint32_t(b.symbol);
+            sec.default_begin += uint32_t(b.dflt);
+        }
+        for (size_t k = 0; k < c.defaults.size(); ++k) {
+            Default& def = d.defaults[b.dflt + k];
+            def = c.defaults[k];
+            def.match_begin += uint32_t(b.match);
+        }
+        std::copy(c.symbols.begin(), c.symbols.end(), d.symbols.begin() + std::ptrdiff_t(b.symbol));
+        std::copy(c.matches.begin(), c.matches.end(), d.matches.begin() + std::ptrdiff_t(b.match));
+        c.by_name.reserve(c.sections.size());
+        for (size_t k = 0; k < c.sections.size(); ++k)
+            c.by_name.emplace(c.sections[k].name, uint32_t(b.section + k));
+    });
+
+    // The one serial step: merge() moves the nodes with their hashes, so it
+    // only links them in. In file order, so the first name wins, as in
+    // index_names().
+    d.by_name.reserve(bases.back().section);
+    for (Dump& c : chunks)
+        d.by_name.merge(c.by_name);
+    return d;
+}
+
+const Section* Dump::find(std::string_view name) const
+{
+    auto it = by_name.find(name);
+    if (it != by_name.end())
+        return &sections[it->second];
+    for (const Section& s : sections)
+        if (nvtools::iequals(s.name, name))
+            return &s;
+    return nullptr;
+}
+
+void Dump::read(size_t i, SectionRecord& out) const
+{
+    const Section& s = sections[i];
+    out.section = s;
+    out.section.symbol_begin = 0;
+    out.section.default_begin = 0;
+    out.symbols.assign(symbols_of(s), symbols_of(s) + s.symbol_count);
+    out.defaults.clear();
+    out.matches.clear();
+    for (uint32_t k = 0; k < s.default_count; ++k) {
+        Default d = defaults_of(s)[k];
+        out.matches.insert(out.matches.end(), matches_of(d), matches_of(d) + d.match_count);
+        d.match_begin = uint32_t(out.matches.size() - d.match_count);
+        out.defaults.push_back(d);
+    }
+}
+
+std::optional<uint64_t> parse_number(std::string_view value)
+{
+    value = trim(value);
+    int base = 10;
+    if (value.size() > 2 && value[0] == '0' && (value[1] == 'x' || value[1] == 'X')) {
+        base = 16;
+        value.remove_prefix(2);
+    }
+    if (value.empty() || value.size() > (base == 16 ? 16u : 20u))
+        return std::nullopt;
+    uint64_t v = 0;
+    for (char c : value) {
+        unsigned digit;
+        if (c >= '0' && c <= '9')
+            digit = unsigned(c - '0');
+        else if (base == 16 && c >= 'a' && c <= 'f')
+            digit = unsigned(c - 'a' + 10);
+        else if (base == 16 && c >= 'A' && c <= 'F')
+            digit = unsigned(c - 'A' + 10);
+        else
+            return std::nullopt;
+        if (base == 10 && v > (UINT64_MAX - digit) / 10)
+            return std::nullopt;
+        v = v * unsigned(base) + digit;
+    }
+    return v;
+}
+
+const char* type_name(ValueType type)
+{
+    switch (type) {
+    case ValueType::Dword:  return "DWORD";
+    case ValueType::String: return "STRING";
+    case ValueType::Float:  return "FLOAT";
+    case ValueType::Qword:  return "QWORD";
+    case ValueType::Binary: return "BINARY";
+    default:                return "?";
+    }
+}
+
+const char* availability_name(Availability availability)
+{
+    switch (availability) {
+    case Availability::Always:    return "always";
+    case Availability::Debug:     return "debug";
+    case Availability::Condition: return "condition";
+    default:                      return "?";
+    }
+}
+
+} // namespace nvapi
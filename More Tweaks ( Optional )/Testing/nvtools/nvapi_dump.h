@@ -0,0 +1,181 @@
+// nvapi_dump.h
+//
+// Parser for the driver's parameter dump (NVAPI-PARAMETERS-DUMP-*.txt). Every
+// setting is one section:
+//
+//   ------------------------------------------------------------
+//   AAMODESELECTOR                                          <- name
+//   ------------------------------------------------------------
+//   This key is of type DWORD                               <- type
+//   This key is defined all the time - even with release driver
+//   The key is a collection of Bitfields.                   <- optional
+//   You may assign it to some combination of the names listed below
+//   but that is not required. You may also enter a dword value directly.
+//
+//   Free text.                                              <- description
+//
+//   METHOD MASK    (= 0x0000ffff)  // contains one of ...   <- symbols
+//   SELECTOR MASK  (= 0x30000000)
+//
+//   Default values for this setting:
+//   DEFAULT:    0x00000000                                  <- defaults
+//   	SELECTOR APP CONTROL                                 <- matching names
+//
+// SectionReader walks the sections one at a time and parse_dump() collects
+// them into a Dump. Every string is a view into the source buffer, which must
+// outlive the result; nothing is copied.
+
+#ifndef NVTOOLS_NVAPI_DUMP_H
+#define NVTOOLS_NVAPI_DUMP_H
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace nvapi {
+
+enum class ValueType : uint8_t {
+    Unknown,
+    Dword,
+    String,
+    Float,
+    Qword,
+    Binary,
+};
+
+enum class Availability : uint8_t {
+    Unknown,
+    Always,         // "defined all the time - even with release driver"
+    Debug,          // "defined only for develop/debug driver"
+    Condition,      // "defined for <condition>", the text is in Section::condition
+};
+
+enum class Assignment : uint8_t {
+    Any,            // no "You may assign it ..." line
+    OneOf,          // "... to one of the names listed below"
+    Combination,    // "... to some combination of the names listed below"
+};
+
+// "NAME  (= VALUE)  // comment". The value is the text between "(= " and
+// ")": usually 0x%08x, but FLOAT keys have "1.000000" and a few STRING keys
+// "none" or nothing. Names may contain spaces and commas ("OFF, 0, FALSE").
+struct Symbol {
+    std::string_view name;
+    std::string_view value;
+    std::string_view comment;   // without the "//", empty if there is none
+};
+
+// "DEFAULT:    ON" and the tab-indented symbol names under it. Most sections
+// have one DEFAULT; a few add per-API or per-architecture rows such as
+// "DEFAULT GL:" and "DEFAULT TESLA:".
+struct Default {
+    std::string_view label;     // "DEFAULT", "DEFAULT GL", ...
+    std::string_view value;     // "0x00000000", "ON", "1.000000", possibly empty
+    uint32_t match_begin;       // range into Dump::matches
+    uint32_t match_count;
+};
+
+struct Section {
+    std::string_view name;
+    ValueType type;
+    Availability availability;
+    Assignment assignment;
+    bool bitfields;             // "The key is a collection of Bitfields."
+    bool names_only;            // "You may only assign it ...", no raw numbers
+    std::string_view condition;     // for Availability::Condition, may be empty
+    std::string_view description;   // paragraphs, outer blank lines removed
+    uint32_t offset;            // of the name line in the source
+    uint32_t symbol_begin;      // range into Dump::symbols
+    uint32_t symbol_count;
+    uint32_t default_begin;     // range into Dump::defaults
+    uint32_t default_count;
+};
+
+struct SectionRecord;
+
+struct Dump {
+    std::string_view source;
+    std::vector<Section> sections;
+    std::vector<Symbol> symbols;
+    std::vector<Default> defaults;
+    std::vector<std::string_view> matches;
+    std::unordered_map<std::string_view, uint32_t> by_name;
+
+    const Symbol* symbols_of(const Section& s) const { return symbols.data() + s.symbol_begin; }
+    const Default* defaults_of(const Section& s) const { return defaults.data() + s.default_begin; }
+    const std::string_view* matches_of(const Default& d) const { return matches.data() + d.match_begin; }
+
+    // Exact name first, then a case-insensitive match.
+    const Section* find(std::string_view name) const;
+
+    // Section i in the reader's record form, vectors reused.
+    void read(size_t i, SectionRecord& out) const;
+};
+
+// One section at a time, with its symbols and defaults in vectors that are
+// reused from one section to the next, so a long dump allocates nothing
+// after the first few sections:
+//
+//   nvapi::SectionReader r(text);
+//   while (const nvapi::SectionRecord* s = r.next())
+//       use(s->section.name, s->symbols);
+//
+// Section's ranges index the record's own vectors (they start at 0).
+struct SectionRecord {
+    Section section;
+    std::vector<Symbol> symbols;
+    std::vector<Default> defaults;
+    std::vector<std::string_view> matches;
+};
+
+class SectionReader {
+public:
+    explicit SectionReader(std::string_view source, size_t from = 0)
+        : source_(source), pos_(from) {}
+
+    // nullptr at the end of the text. The record stays valid until the next
+    // call.
+    const SectionRecord* next();
+
+    // Where the next section's opening separator line is, or the text size.
+    size_t position() const { return pos_; }
+
+private:
+    std::string_view source_;
+    size_t pos_;
+    SectionRecord record_;
+};
+
+// Whole dump, sections in file order. Text that is not a dump gives no
+// sections.
+Dump parse_dump(std::string_view source);
+
+// The same Dump, element for element, parsed by threads (0: one per core).
+// The text is cut into a few chunks per thread at section starts, the
+// chunks are parsed on a work-stealing pool (work_steal.h), then each is
+// copied into place in file order and indexed by name on the same pool.
+// Small texts and threads <= 1 parse serially.
+//
+// It does not scale linearly. Cutting the text, sizing the joined arrays and
+// merging the chunks' name indexes stay serial, about a tenth of a serial
+// parse of the current dump, so the speedup levels off below 10x however
+// many cores there are, and thread start-up eats into it before that.
+Dump parse_dump_parallel(std::string_view source, unsigned threads = 0);
+
+// Offsets that cut source into at most parts chunks, from 0 to the size. Each
+// inner cut is the opening rule of a section, so parsing the chunks one by
+// one yields exactly the sections of the whole text.
+std::vector<size_t> split_dump(std::string_view source, size_t parts);
+
+// Numeric symbol or default value: "0x..." (up to 64 bits) or decimal.
+// nullopt for names, floats and empty text.
+std::optional<uint64_t> parse_number(std::string_view value);
+
+const char* type_name(ValueType type);
+const char* availability_name(Availability availability);
+
+} // namespace nvapi
+
+#endif // NVTOOLS_NVAPI_DUMP_H
@@ -0,0 +1,502 @@
+// nvapi_dump_main.cpp
+//
+//   nvapi_dump stats <dump or snapshot>
+//   nvapi_dump list <dump or snapshot>
+//   nvapi_dump show <dump or snapshot> <setting name...>
+//   nvapi_dump snapshot <dump> <snapshot>
+//   nvapi_dump decode <dump or snapshot> <setting name> <value...>
+//   nvapi_dump encode <dump or snapshot> <setting name> <name | FIELD=n | number...>
+//   nvapi_dump value <dump or snapshot> <value...>
+//   nvapi_dump complete <dump or snapshot> <name prefix>
+//   nvapi_dump search <dump or snapshot> <words...>
+//   nvapi_dump reach <dump or snapshot> release|develop|debug [+SYMBOL | -SYMBOL...]
+//   nvapi_dump check <dump or snapshot> [<setting name> <value...>]
+//   nvapi_dump defaults <dump or snapshot> [<setting name>=<value>...]
+//
+// stats counts sections by type and availability, list prints one line per
+// setting and show prints settings in full. Names match case-insensitively;
+// quote the ones with spaces. show exits with 1 if a name is not in the dump.
+// snapshot parses a dump once and saves it for the other commands, which
+// then skip the parse. decode and encode work on bitfield settings
+// (nvapi_bits.h); decode exits with 1 if a value has bits nothing names.
+// value prints every enum symbol with that value, and exits with 1 if a
+// value has none; on a snapshot that is one hash probe per value. complete
+// lists the settings whose name starts with a prefix and search the best 20
+// matches for some words, typos allowed (nvapi_search.h). reach prints the
+// settings a build profile never reads, and those that depend on a config
+// symbol the profile leaves open (nvapi_avail.h); +X and -X pin X on or off.
+// check reads values as the setting's type (nvapi_value.h), checks them
+// against its MIN, MAX and names, and prints each with its .nip form; with
+// no setting it checks that every DEFAULT in the dump reads as the type of
+// its setting. It exits with 1 if a value does not fit. defaults prints
+// every setting's default (nvapi_defaults.h), or, given settings and values,
+// only those that are not the default.
+
+#include "mapped_file.h"
+#include "nvapi_avail.h"
+#include "nvapi_bits.h"
+#include "nvapi_defaults.h"
+#include "nvapi_dump.h"
+#include "nvapi_search.h"
+#include "nvapi_snapshot.h"
+#include "nvapi_value.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace {
+
+// A text dump or a snapshot of one, whichever the file is.
+class Catalog {
+public:
+    bool open(const char* path)
+    {
+        std::string why;
+        if (snap_.open(path, &why)) {
+            is_snapshot_ = true;
+            return true;
+        }
+        if (!file_.open(path)) {
+            std::fprintf(stderr, "error: cannot read %s\n", path);
+            return false;
+        }
+        dump_ = nvapi::parse_dump(file_.view());
+        if (dump_.sections.empty()) {
+            bool snapshot = why != "not a snapshot" && why != "too short for a snapshot";
+            std::fprintf(stderr, "error: %s has no settings, is it a parameter dump?%s%s\n", path,
+                         snapshot ? " As a snapshot: " : "", snapshot ? why.c_str() : "");
+            return false;
+        }
+        return true;
+    }
+
+    size_t size() const { return is_snapshot_ ? snap_.size() : dump_.sections.size(); }
+
+    nvapi::Section section(size_t i) const { return is_snapshot_ ? snap_.section(i) : dump_.sections[i]; }
+
+    void read(size_t i, nvapi::SectionRecord& out) const
+    {
+        if (is_snapshot_)
+            snap_.read(i, out);
+        else
+            dump_.read(i, out);
+    }
+
+    std::optional<size_t> find(std::string_view name) const
+    {
+        if (is_snapshot_)
+            return snap_.find(name);
+        const nvapi::Section* s = dump_.find(name);
+        return s ? std::optional<size_t>(size_t(s - dump_.sections.data())) : std::nullopt;
+    }
+
+    std::vector<nvapi::Section> sections() const
+    {
+        if (!is_snapshot_)
+            return dump_.sections;
+        std::vector<nvapi::Section> out;
+        for (size_t i = 0; i < snap_.size(); ++i)
+            out.push_back(snap_.section(i));
+        return out;
+    }
+
+    nvapi::DefaultTable defaults() const
+    {
+        return is_snapshot_ ? nvapi::DefaultTable::build(snap_) : nvapi::DefaultTable::build(dump_);
+    }
+
+    // The snapshot has an index; a text dump is scanned.
+    void uses_of(uint64_t value, std::vector<nvapi::Snapshot::ValueUse>& out) const
+    {
+        out.clear();
+        if (is_snapshot_) {
+            for (const nvapi::Snapshot::ValueUse& u : snap_.uses_of(value))
+                out.push_back(u);
+            return;
+        }
+        for (uint32_t i = 0; i < dump_.sections.size(); ++i) {
+            const nvapi::Section& s = dump_.sections[i];
+            if (s.bitfields)
+                continue;
+            for (uint32_t k = 0; k < s.symbol_count; ++k)
+                if (nvapi::parse_number(dump_.symbols_of(s)[k].value) == value)
+                    out.push_back({i, k});
+        }
+    }
+
+private:
+    nvtools::MappedFile file_;
+    nvapi::Dump dump_;
+    nvapi::Snapshot snap_;
+    bool is_snapshot_ = false;
+};
+
+void print_view(const char* fmt, std::string_view s)
+{
+    std::printf(fmt, int(s.size()), s.data());
+}
+
+void list_line(const nvapi::Section& s)
+{
+    std::printf("%-60.*s %-6s %s", int(s.name.size()), s.name.data(), nvapi::type_name(s.type),
+                nvapi::availability_name(s.availability));
+    if (s.symbol_count)
+        std::printf("%*s%u %s", 10 - int(std::strlen(nvapi::availability_name(s.availability))), "",
+                    s.symbol_count, s.bitfields ? "bitfield symbols" : "symbols");
+    std::printf("\n");
+}
+
+void show(const nvapi::SectionRecord& r)
+{
+    const nvapi::Section& s = r.section;
+    print_view("%.*s\n", s.name);
+    std::printf("  type          %s\n", nvapi::type_name(s.type));
+    std::printf("  availability  %s", nvapi::availability_name(s.availability));
+    if (!s.condition.empty())
+        print_view(" %.*s", s.condition);
+    std::printf("\n");
+    if (s.assignment != nvapi::Assignment::Any)
+        std::printf("  assign        %s%s%s\n",
+                    s.assignment == nvapi::Assignment::Combination ? "combination" : "one of",
+                    s.names_only ? ", names only" : "", s.bitfields ? ", bitfields" : "");
+    for (std::string_view text = s.description; !text.empty();) {
+        size_t nl = text.find('\n');
+        std::string_view line = text.substr(0, nl);
+        if (!line.empty() && line.back() == '\r')
+            line.remove_suffix(1);
+        print_view("  | %.*s\n", line);
+        text = nl == std::string_view::npos ? std::string_view() : text.substr(nl + 1);
+    }
+    int width = 0;
+    for (const nvapi::Symbol& sym : r.symbols)
+        width = std::max(width, int(sym.name.size()));
+    for (const nvapi::Symbol& sym : r.symbols) {
+        std::printf("  %-*.*s  ", width, int(sym.name.size()), sym.name.data());
+        if (sym.comment.empty())
+            print_view("%.*s\n", sym.value);
+        else
+            std::printf("%-10.*s  // %.*s\n", int(sym.value.size()), sym.value.data(),
+                        int(sym.comment.size()), sym.comment.data());
+    }
+    for (const nvapi::Default& def : r.defaults) {
+        int pad = 15 - int(def.label.size());
+        std::printf("  %.*s:%*s%.*s", int(def.label.size()), def.label.data(), pad > 0 ? pad : 1, "",
+                    int(def.value.size()), def.value.data());
+        for (uint32_t j = 0; j < def.match_count; ++j)
+            print_view(j ? ", %.*s" : "  = %.*s", r.matches[def.match_begin + j]);
+        std::printf("\n");
+    }
+}
+
+int write(const char* dump_path, const char* out)
+{
+    nvtools::MappedFile f;
+    if (!f.open(dump_path)) {
+        std::fprintf(stderr, "error: cannot read %s\n", dump_path);
+        return 1;
+    }
+    nvapi::Dump d = nvapi::parse_dump(f.view());
+    if (d.sections.empty()) {
+        std::fprintf(stderr, "error: %s has no settings, is it a parameter dump?\n", dump_path);
+        return 1;
+    }
+    if (!nvapi::write_snapshot(out, d)) {
+        std::fprintf(stderr, "error: cannot write %s\n", out);
+        return 1;
+    }
+    std::fprintf(stderr, "%zu settings\n", d.sections.size());
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const char* cmd = argc > 1 ? argv[1] : "";
+    bool ok_args = (std::strcmp(cmd, "stats") == 0 && argc == 3)
+        || (std::strcmp(cmd, "list") == 0 && argc == 3)
+        || (std::strcmp(cmd, "show") == 0 && argc >= 4)
+        || (std::strcmp(cmd, "snapshot") == 0 && argc == 4)
+        || ((std::strcmp(cmd, "decode") == 0 || std::strcmp(cmd, "encode") == 0) && argc >= 5)
+        || (std::strcmp(cmd, "value") == 0 && argc >= 4)
+        || (std::strcmp(cmd, "complete") == 0 && argc == 4)
+        || (std::strcmp(cmd, "search") == 0 && argc >= 4)
+        || (std::strcmp(cmd, "reach") == 0 && argc >= 4)
+        || (std::strcmp(cmd, "check") == 0 && argc != 4 && argc >= 3)
+        || (std::strcmp(cmd, "defaults") == 0 && argc >= 3);
+    if (!ok_args) {
+        std::fprintf(stderr, "usage: nvapi_dump stats|list <dump or snapshot>\n"
+                             "       nvapi_dump show <dump or snapshot> <setting name...>\n"
+                             "       nvapi_dump snapshot <dump> <snapshot>\n"
+                             "       nvapi_dump decode <dump or snapshot> <setting name> <value...>\n"
+                             "       nvapi_dump encode <dump or snapshot> <setting name> <name | FIELD=n | number...>\n"
+                             "       nvapi_dump value <dump or snapshot> <value...>\n"
+                             "       nvapi_dump complete <dump or snapshot> <name prefix>\n"
+                             "       nvapi_dump search <dump or snapshot> <words...>\n"
+                             "       nvapi_dump reach <dump or snapshot> release|develop|debug [+SYMBOL | -SYMBOL...]\n"
+                             "       nvapi_dump check <dump or snapshot> [<setting name> <value...>]\n"
+                             "       nvapi_dump defaults <dump or snapshot> [<setting name>=<value>...]\n");
+        return 2;
+    }
+    if (std::strcmp(cmd, "snapshot") == 0)
+        return write(argv[2], argv[3]);
+
+    Catalog c;
+    if (!c.open(argv[2]))
+        return 1;
+
+    if (std::strcmp(cmd, "stats") == 0) {
+        size_t types[6] = {}, avail[4] = {}, symbols = 0, defaults = 0, bitfields = 0, with_defaults = 0;
+        for (size_t i = 0; i < c.size(); ++i) {
+            nvapi::Section s = c.section(i);
+            ++types[size_t(s.type)];
+            ++avail[size_t(s.availability)];
+            symbols += s.symbol_count;
+            defaults += s.default_count;
+            bitfields += s.bitfields;
+            with_defaults += s.default_count != 0;
+        }
+        std::printf("%zu settings, %zu symbols, %zu defaults\n", c.size(), symbols, defaults);
+        for (auto t : {nvapi::ValueType::Dword, nvapi::ValueType::String, nvapi::ValueType::Float,
+                       nvapi::ValueType::Qword, nvapi::ValueType::Binary, nvapi::ValueType::Unknown})
+            if (types[size_t(t)])
+                std::printf("  %-10s %zu\n", nvapi::type_name(t), types[size_t(t)]);
+        for (auto a : {nvapi::Availability::Always, nvapi::Availability::Debug,
+                       nvapi::Availability::Condition, nvapi::Availability::Unknown})
+            if (avail[size_t(a)])
+                std::printf("  %-10s %zu\n", nvapi::availability_name(a), avail[size_t(a)]);
+        std::printf("  %-10s %zu\n  %-10s %zu\n", "bitfields", bitfields, "defaulted", with_defaults);
+        return 0;
+    }
+    if (std::strcmp(cmd, "list") == 0) {
+        for (size_t i = 0; i < c.size(); ++i)
+            list_line(c.section(i));
+        return 0;
+    }
+
+    if (std::strcmp(cmd, "complete") == 0 || std::strcmp(cmd, "search") == 0) {
+        nvapi::SearchIndex idx = nvapi::SearchIndex::build(c.sections());
+        if (std::strcmp(cmd, "complete") == 0) {
+            std::vector<uint32_t> ids;
+            idx.complete(argv[3], size_t(-1), ids);
+            for (uint32_t i : ids)
+                print_view("%.*s\n", c.section(i).name);
+            return 0;
+        }
+        std::string query;
+        for (int i = 3; i < argc; ++i)
+            query += std::string(i > 3 ? " " : "") + argv[i];
+        std::vector<nvapi::SearchHit> hits;
+        idx.search(query, 20, hits);
+        for (const nvapi::SearchHit& h : hits)
+            list_line(c.section(h.section));
+        return 0;
+    }
+
+    if (std::strcmp(cmd, "reach") == 0) {
+        std::optional<nvapi::Profile> p = nvapi::Profile::named(argv[3]);
+        if (!p) {
+            std::fprintf(stderr, "error: %s is not a profile, use release, develop or debug\n", argv[3]);
+            return 2;
+        }
+        for (int i = 4; i < argc; ++i) {
+            if (argv[i][0] != '+' && argv[i][0] != '-') {
+                std::fprintf(stderr, "error: %s should be +SYMBOL or -SYMBOL\n", argv[i]);
+                return 2;
+            }
+            p->set(argv[i] + 1, argv[i][0] == '+');
+        }
+        std::vector<nvapi::Section> sections = c.sections();
+        nvapi::AvailabilityIndex idx = nvapi::AvailabilityIndex::build(sections);
+        nvapi::Reachability reach;
+        idx.reach(*p, reach);
+        for (size_t i = 0; i < sections.size(); ++i) {
+            const nvapi::Section& s = sections[i];
+            if (!reach.maybe.test(i))
+                print_view("never    %.*s\n", s.name);
+            else if (!reach.always.test(i))
+                std::printf("depends  %-60.*s %s\n", int(s.name.size()), s.name.data(),
+                            s.condition.empty() ? nvapi::availability_name(s.availability)
+                                                : std::string(s.condition).c_str());
+        }
+        std::fprintf(stderr, "%zu settings: %zu always read, %zu depending, %zu never\n", sections.size(),
+                     reach.always.count(), reach.maybe.count() - reach.always.count(),
+                     sections.size() - reach.maybe.count());
+        return 0;
+    }
+
+    nvapi::SectionRecord r;
+    if (std::strcmp(cmd, "value") == 0) {
+        int status = 0;
+        std::vector<nvapi::Snapshot::ValueUse> uses;
+        for (int i = 3; i < argc; ++i) {
+            std::optional<uint64_t> v = nvapi::parse_number(argv[i]);
+            if (!v) {
+                std::fprintf(stderr, "error: %s is not a number\n", argv[i]);
+                status = 1;
+                continue;
+            }
+            c.uses_of(*v, uses);
+            if (uses.empty()) {
+                std::printf("0x%08llx  no symbol\n", (unsigned long long)*v);
+                status = 1;
+            }
+            for (const nvapi::Snapshot::ValueUse& u : uses) {
+                c.read(u.section, r);
+                std::printf("0x%08llx  %-50.*s %.*s\n", (unsigned long long)*v, int(r.section.name.size()),
+                            r.section.name.data(), int(r.symbols[u.symbol].name.size()),
+                            r.symbols[u.symbol].name.data());
+            }
+        }
+        return status;
+    }
+    if (std::strcmp(cmd, "check") == 0 && argc == 3) {
+        size_t defaults = 0, bad = 0;
+        nvapi::Value v;
+        std::string why;
+        for (size_t i = 0; i < c.size(); ++i) {
+            c.read(i, r);
+            for (const nvapi::Default& d : r.defaults) {
+                if (d.label.substr(0, 7) != "DEFAULT")
+                    continue;           // "Could not locate information ..."
+                ++defaults;
+                if (nvapi::resolve_default(r, d, v, &why) && nvapi::check_value(r, v, &why))
+                    continue;
+                ++bad;
+                std::printf("%-50.*s %-12.*s %s\n", int(r.section.name.size()), r.section.name.data(),
+                            int(d.label.size()), d.label.data(), why.c_str());
+            }
+        }
+        std::fprintf(stderr, "%zu defaults, %zu do not fit their setting\n", defaults, bad);
+        return bad ? 1 : 0;
+    }
+    if (std::strcmp(cmd, "check") == 0) {
+        std::optional<size_t> at = c.find(argv[3]);
+        if (!at) {
+            std::fprintf(stderr, "error: %s is not in %s\n", argv[3], argv[2]);
+            return 1;
+        }
+        c.read(*at, r);
+        int status = 0;
+        nvapi::Value v;
+        std::string why, text, nip;
+        for (int i = 4; i < argc; ++i) {
+            if (!nvapi::resolve_value(r, argv[i], v, &why) || !nvapi::check_value(r, v, &why)) {
+                std::fprintf(stderr, "error: %s\n", why.c_str());
+                status = 1;
+                continue;
+            }
+            text.clear();
+            nip.clear();
+            nvapi::format_value(v, text);
+            const char* type = nvapi::format_nip(v, nip);
+            std::printf("%-24s %-6s %s\n", text.c_str(), type, nip.c_str());
+        }
+        return status;
+    }
+    if (std::strcmp(cmd, "defaults") == 0) {
+        nvapi::DefaultTable defaults = c.defaults();
+        std::string text;
+        if (argc == 3) {
+            size_t variants = 0;
+            for (uint32_t i = 0; i < defaults.size(); ++i) {
+                nvapi::Section s = c.section(i);
+                text.clear();
+                nvapi::format_value(defaults.value(i), text);
+                variants += defaults.has_variants(i);
+                std::printf("%-60.*s %-6s %s%s\n", int(s.name.size()), s.name.data(), nvapi::type_name(s.type),
+                            defaults.has_default(i) ? text.c_str() : "-", defaults.has_variants(i) ? "  (+ per-API rows)" : "");
+            }
+            std::fprintf(stderr, "%zu settings, %zu with a default, %zu with more DEFAULT rows\n", defaults.size(),
+                         defaults.resolved_count(), variants);
+            return 0;
+        }
+        std::vector<nvapi::SettingValue> profile;
+        std::string why;
+        for (int i = 3; i < argc; ++i) {
+            const char* eq = std::strchr(argv[i], '=');
+            std::optional<size_t> at = eq ? c.find(std::string_view(argv[i], size_t(eq - argv[i]))) : std::nullopt;
+            if (!eq || !at) {
+                std::fprintf(stderr, "error: %s should be a setting name, '=' and a value\n", argv[i]);
+                return 2;
+            }
+            c.read(*at, r);
+            nvapi::Value v;
+            if (!nvapi::resolve_value(r, eq + 1, v, &why)) {
+                std::fprintf(stderr, "error: %s\n", why.c_str());
+                return 1;
+            }
+            profile.push_back({uint32_t(*at), std::move(v)});
+        }
+        std::vector<uint32_t> changed;
+        defaults.changed(profile, changed);
+        for (uint32_t k : changed) {
+            nvapi::Section s = c.section(profile[k].section);
+            text.clear();
+            nvapi::format_value(profile[k].value, text);
+            text += "  default ";
+            if (defaults.has_default(profile[k].section))
+                nvapi::format_value(defaults.value(profile[k].section), text);
+            else
+                text += "unknown";
+            std::printf("%-60.*s %s\n", int(s.name.size()), s.name.data(), text.c_str());
+        }
+        std::fprintf(stderr, "%zu of %zu settings are not the default\n", changed.size(), profile.size());
+        return 0;
+    }
+    if (std::strcmp(cmd, "decode") == 0 || std::strcmp(cmd, "encode") == 0) {
+        std::optional<size_t> at = c.find(argv[3]);
+        if (!at) {
+            std::fprintf(stderr, "error: %s is not in %s\n", argv[3], argv[2]);
+            return 1;
+        }
+        c.read(*at, r);
+        if (!r.section.bitfields)
+            std::fprintf(stderr, "warning: %s is not a collection of bitfields, its names are not meant"
+                                 " to be combined\n", argv[3]);
+        nvapi::BitfieldPlan plan = nvapi::BitfieldPlan::build(r);
+        if (std::strcmp(cmd, "encode") == 0) {
+            std::vector<std::string_view> parts(argv + 4, argv + argc);
+            std::string why;
+            std::optional<uint32_t> v = plan.encode(parts, &why);
+            if (!v) {
+                std::fprintf(stderr, "error: %s\n", why.c_str());
+                return 1;
+            }
+            std::printf("0x%08x\n", *v);
+            return 0;
+        }
+        int status = 0;
+        nvapi::BitDecode d;
+        for (int i = 4; i < argc; ++i) {
+            std::optional<uint64_t> v = nvapi::parse_number(argv[i]);
+            if (!v || *v > 0xffffffffu) {
+                std::fprintf(stderr, "error: %s is not a DWORD\n", argv[i]);
+                status = 1;
+                continue;
+            }
+            plan.decode(uint32_t(*v), d);
+            std::printf("0x%08x  %s\n", uint32_t(*v), nvapi::format_bits(d).c_str());
+            if (d.outside || d.unnamed)
+                status = 1;
+        }
+        return status;
+    }
+
+    int status = 0;
+    for (int i = 3; i < argc; ++i) {
+        std::optional<size_t> at = c.find(argv[i]);
+        if (!at) {
+            std::fprintf(stderr, "error: %s is not in %s\n", argv[i], argv[2]);
+            status = 1;
+            continue;
+        }
+        c.read(*at, r);
+        show(r);
+    }
+    return status;
+}
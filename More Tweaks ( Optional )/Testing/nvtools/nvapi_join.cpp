@@ -0,0 +1,664 @@
+// nvapi_join.cpp
+
+#include "nvapi_join.h"
+
+#include "text_util.h"
+
+#include <cstdio>
+#include <cstring>
+#include <unordered_map>
+
+namespace nvapi {
+
+struct JoinIndex::Ref {
+    uint32_t offset;            // into the string table
+    uint32_t length;
+};
+
+namespace {
+
+using Ref = JoinIndex::Ref;
+
+enum Table : int {
+    kEntries,
+    kAliases,
+    kSources,
+    kUnresolved,
+    kIdSlots,
+    kNameSlots,
+    kKeySlots,
+    kStrings,
+    kTables,
+};
+
+enum Flag : uint32_t {
+    kFlagId = 1,
+};
+
+struct EntryRecord {
+    uint32_t id;
+    uint32_t section;
+    Ref name;
+    Ref group;
+    Ref dump_name;
+    uint32_t sources;
+    uint32_t flags;
+    uint32_t alias_begin;
+    uint32_t alias_count;
+};
+static_assert(sizeof(EntryRecord) == 48, "EntryRecord layout is part of the format");
+
+struct AliasRecord {
+    Ref name;
+    uint32_t entry;
+    uint32_t reserved;
+};
+static_assert(sizeof(AliasRecord) == 16, "AliasRecord layout is part of the format");
+
+struct SourceRecord {
+    Ref label;
+    uint32_t kind;
+    uint32_t reserved;
+};
+static_assert(sizeof(SourceRecord) == 16, "SourceRecord layout is part of the format");
+
+struct UnresolvedRecord {
+    Ref name;
+    uint32_t source;
+    uint32_t line;
+};
+static_assert(sizeof(UnresolvedRecord) == 16, "UnresolvedRecord layout is part of the format");
+
+constexpr char kMagic[8] = {'N', 'V', 'J', 'O', 'I', 'N', '\0', '\0'};
+constexpr uint32_t kVersion = 2;
+
+struct FileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t table_count;
+    uint32_t entry_count;
+    uint32_t alias_count;
+    uint32_t source_count;
+    uint32_t unresolved_count;
+    uint32_t id_slots;          // each a power of two
+    uint32_t name_slots;
+    uint32_t key_slots;
+    uint32_t dump_size;
+    uint64_t offsets[8];
+    uint64_t sizes[8];          // bytes
+};
+static_assert(sizeof(FileHeader) == 176, "FileHeader layout is part of the format");
+
+using nvtools::fold;
+using nvtools::folded;
+using nvtools::iequals;
+using nvtools::trim;
+
+// Keys also match with '_' for ' ': the dump prints FRL_FPS as "FRL FPS".
+char fold_key(char c)
+{
+    return c == '_' ? ' ' : fold(c);
+}
+
+uint32_t name_hash(std::string_view s)
+{
+    uint32_t h = 2166136261u;
+    for (char c : s)
+        h = (h ^ uint8_t(fold(c))) * 16777619u;
+    return h;
+}
+
+uint32_t key_hash(std::string_view s)
+{
+    uint32_t h = 2166136261u;
+    for (char c : s)
+        h = (h ^ uint8_t(fold_key(c))) * 16777619u;
+    return h;
+}
+
+uint32_t id_hash(uint32_t id)
+{
+    return uint32_t((id * 0x9e3779b97f4a7c15ull) >> 32);
+}
+
+bool key_equals(std::string_view a, std::string_view b)
+{
+    if (a.size() != b.size())
+        return false;
+    for (size_t i = 0; i < a.size(); ++i)
+        if (fold_key(a[i]) != fold_key(b[i]))
+            return false;
+    return true;
+}
+
+std::string key_folded(std::string_view s)
+{
+    std::string out(s);
+    for (char& c : out)
+        c = fold_key(c);
+    return out;
+}
+
+uint32_t slots_for(size_t n)
+{
+    // At most half full, so probes stay short and always end.
+    uint32_t slots = 8;
+    while (slots < n * 2)
+        slots *= 2;
+    return slots;
+}
+
+class TableWriter {
+public:
+    TableWriter() : buf_(sizeof(FileHeader), '\0') {}
+
+    template <class T>
+    void put(Table t, const std::vector<T>& v)
+    {
+        while (buf_.size() % 8)
+            buf_ += '\0';
+        header_.offsets[t] = buf_.size();
+        header_.sizes[t] = v.size() * sizeof(T);
+        if (!v.empty())
+            buf_.append(reinterpret_cast<const char*>(v.data()), v.size() * sizeof(T));
+    }
+
+    FileHeader& header() { return header_; }
+
+    bool save(const char* path)
+    {
+        std::memcpy(header_.magic, kMagic, sizeof kMagic);
+        header_.version = kVersion;
+        header_.table_count = kTables;
+        std::memcpy(&buf_[0], &header_, sizeof header_);
+        FILE* f = std::fopen(path, "wb");
+        if (!f)
+            return false;
+        bool ok = std::fwrite(buf_.data(), 1, buf_.size(), f) == buf_.size();
+        return std::fclose(f) == 0 && ok;
+    }
+
+private:
+    std::string buf_;
+    FileHeader header_ = {};
+};
+
+class StringPool {
+public:
+    Ref add(std::string_view s)
+    {
+        auto it = seen_.find(s);
+        if (it != seen_.end())
+            return it->second;
+        Ref r{uint32_t(chars_.size()), uint32_t(s.size())};
+        chars_.insert(chars_.end(), s.begin(), s.end());
+        seen_.emplace(s, r);
+        return r;
+    }
+    const std::vector<char>& chars() const { return chars_; }
+
+private:
+    std::vector<char> chars_;
+    std::unordered_map<std::string_view, Ref> seen_;
+};
+
+bool parse_link_id(std::string_view s, uint32_t& out)
+{
+    uint64_t v = 0;
+    bool hex = s.size() > 2 && s[0] == '0' && (s[1] == 'x' || s[1] == 'X');
+    if (hex)
+        s.remove_prefix(2);
+    if (s.empty() || s.size() > (hex ? 8u : 10u))
+        return false;
+    for (char c : s) {
+        uint32_t d;
+        if (c >= '0' && c <= '9')
+            d = uint32_t(c - '0');
+        else if (hex && c >= 'a' && c <= 'f')
+            d = uint32_t(c - 'a' + 10);
+        else if (hex && c >= 'A' && c <= 'F')
+            d = uint32_t(c - 'A' + 10);
+        else
+            return false;
+        v = v * (hex ? 16 : 10) + d;
+    }
+    if (v > 0xffffffffu)
+        return false;
+    out = uint32_t(v);
+    return true;
+}
+
+} // namespace
+
+std::string_view JoinBuilder::plain(std::string_view escaped)
+{
+    if (escaped.find('&') == std::string_view::npos)
+        return escaped;
+    std::string s;
+    if (!xml_unescape(escaped, s))
+        return escaped;
+    unescaped_.push_back(std::move(s));
+    return unescaped_.back();
+}
+
+uint32_t JoinBuilder::add_source(std::string_view label, JoinSourceKind kind)
+{
+    sources_.push_back({label, kind});
+    return uint32_t(sources_.size() - 1);
+}
+
+void JoinBuilder::add_names(std::string_view label, const CustomNames& names)
+{
+    names_.emplace_back(add_source(label, JoinSourceKind::Names), &names);
+}
+
+void JoinBuilder::add_nip(std::string_view label, const NipFile& nip)
+{
+    nips_.emplace_back(add_source(label, JoinSourceKind::Nip), &nip);
+}
+
+void JoinBuilder::add_checklist(std::string_view label, const Checklist& list)
+{
+    checklists_.emplace_back(add_source(label, JoinSourceKind::Checklist), &list);
+}
+
+bool JoinBuilder::add_links(std::string_view label, std::string_view text, std::string* why)
+{
+    uint32_t source = add_source(label, JoinSourceKind::Links);
+    uint32_t number = 0;
+    size_t at = 0;
+    while (at < text.size()) {
+        size_t nl = text.find('\n', at);
+        if (nl == std::string_view::npos)
+            nl = text.size();
+        std::string_view line = text.substr(at, nl - at);
+        at = nl + 1;
+        ++number;
+        line = trim(line.substr(0, line.find('#')));
+        if (line.empty())
+            continue;
+        size_t space = line.find_first_of(" \t");
+        uint32_t id;
+        if (space == std::string_view::npos || !parse_link_id(line.substr(0, space), id)) {
+            if (why)
+                *why = "line " + std::to_string(number) + ": expected an ID and a dump key";
+            return false;
+        }
+        links_.push_back({id, trim(line.substr(space)), source, number});
+    }
+    return true;
+}
+
+bool JoinBuilder::write(const char* path, JoinStats* stats, std::string* why)
+{
+    struct Work {
+        bool has_id = false;
+        uint32_t id = 0;
+        std::string_view group;
+        uint32_t section = kNoSection;
+        uint32_t sources = 0;
+        std::vector<std::string_view> aliases;
+    };
+    std::vector<Work> entries;
+    std::vector<UnresolvedRecord> unresolved;
+    std::vector<std::string_view> unresolved_names;
+    JoinStats st;
+
+    std::unordered_map<uint32_t, uint32_t> by_id;
+    std::unordered_map<std::string, uint32_t> by_name;
+    std::unordered_map<std::string, uint32_t> section_by_key;
+    std::vector<uint32_t> entry_of_section(dump_ ? dump_->size() : 0, kNoSection);
+    if (dump_)
+        for (uint32_t i = 0; i < dump_->size(); ++i)
+            section_by_key.emplace(key_folded((*dump_)[i].name), i);
+
+    auto mark = [&](uint32_t e, uint32_t source) {
+        if (source < 32)
+            entries[e].sources |= 1u << source;
+    };
+    auto entry_for_id = [&](uint32_t id) {
+        auto it = by_id.emplace(id, uint32_t(entries.size()));
+        if (it.second) {
+            entries.emplace_back();
+            entries.back().has_id = true;
+            entries.back().id = id;
+        }
+        return it.first->second;
+    };
+    auto alias = [&](uint32_t e, std::string_view name, bool count_conflict) {
+        name = trim(name);
+        if (name.empty())
+            return;
+        auto it = by_name.emplace(folded(name), e);
+        if (it.second)
+            entries[e].aliases.push_back(name);
+        else if (it.first->second != e && count_conflict)
+            ++st.name_conflicts;
+    };
+    auto find_section = [&](std::string_view key) {
+        auto it = section_by_key.find(key_folded(trim(key)));
+        return it == section_by_key.end() ? kNoSection : it->second;
+    };
+    auto attach = [&](uint32_t e, uint32_t section) {
+        if (entries[e].section != kNoSection || entry_of_section[section] != kNoSection)
+            return false;
+        entries[e].section = section;
+        entry_of_section[section] = e;
+        return true;
+    };
+
+    // IDs and their names first, in the order the sources were added.
+    for (const auto& [source, names] : names_)
+        for (const CustomSetting& s : names->settings) {
+            uint32_t e = entry_for_id(s.id);
+            mark(e, source);
+            if (entries[e].group.empty())
+                entries[e].group = plain(s.group);
+            alias(e, plain(s.name), true);
+        }
+    for (const auto& [source, nip] : nips_)
+        for (size_t i = 0; i < nip->setting_count(); ++i) {
+            uint32_t e = entry_for_id(nip->setting_id[i]);
+            mark(e, source);
+            alias(e, plain(nip->name_info[i]), true);
+        }
+
+    // Then the dump: joins made by hand win over names that read as keys.
+    for (const Link& l : links_) {
+        uint32_t e = entry_for_id(l.id);
+        mark(e, l.source);
+        uint32_t section = find_section(l.key);
+        if (section == kNoSection) {
+            unresolved.push_back({{}, l.source, l.line});
+            unresolved_names.push_back(l.key);
+        } else {
+            attach(e, section);
+        }
+    }
+    for (uint32_t e = 0; e < entries.size(); ++e)
+        for (size_t a = 0; a < entries[e].aliases.size() && entries[e].section == kNoSection; ++a) {
+            uint32_t section = find_section(entries[e].aliases[a]);
+            if (section != kNoSection)
+                attach(e, section);
+        }
+
+    // Last the checklists, which only name what the others define. A key
+    // the dump has but nothing gave an ID becomes an entry of its own.
+    for (const auto& [source, list] : checklists_)
+        for (const ChecklistItem& item : list->items) {
+            ++st.checklist_items;
+            uint32_t e = kNoSection;
+            auto named = by_name.find(folded(item.name));
+            if (named != by_name.end())
+                e = named->second;
+            if (e == kNoSection) {
+                uint32_t section = find_section(item.name);
+                if (section != kNoSection) {
+                    e = entry_of_section[section];
+                    if (e == kNoSection) {
+                        e = uint32_t(entries.size());
+                        entries.emplace_back();
+                        attach(e, section);
+                    }
+                }
+            }
+            if (e == kNoSection) {
+                unresolved.push_back({{}, source, item.line});
+                unresolved_names.push_back(item.name);
+                continue;
+            }
+            ++st.checklist_resolved;
+            mark(e, source);
+            alias(e, item.name, false);
+        }
+
+    // The tables. Entries keep their order of discovery.
+    StringPool pool;
+    std::vector<EntryRecord> records;
+    std::vector<AliasRecord> aliases;
+    std::vector<SourceRecord> sources;
+    std::vector<std::string_view> alias_names;
+    records.reserve(entries.size());
+    for (uint32_t e = 0; e < entries.size(); ++e) {
+        const Work& w = entries[e];
+        EntryRecord r = {};
+        r.id = w.id;
+        r.section = w.section;
+        r.name = pool.add(w.aliases.empty() ? std::string_view() : w.aliases[0]);
+        r.group = pool.add(w.group);
+        r.dump_name = pool.add(w.section == kNoSection ? std::string_view() : (*dump_)[w.section].name);
+        r.sources = w.sources;
+        r.flags = w.has_id ? uint32_t(kFlagId) : 0u;
+        r.alias_begin = uint32_t(aliases.size());
+        r.alias_count = uint32_t(w.aliases.size());
+        for (std::string_view a : w.aliases) {
+            aliases.push_back({pool.add(a), e, 0});
+            alias_names.push_back(a);
+        }
+        records.push_back(r);
+        st.with_id += w.has_id;
+        st.with_section += w.section != kNoSection;
+    }
+    for (const JoinSource& s : sources_)
+        sources.push_back({pool.add(s.label), uint32_t(s.kind), 0});
+    for (size_t i = 0; i < unresolved.size(); ++i)
+        unresolved[i].name = pool.add(unresolved_names[i]);
+
+    uint32_t id_slots = slots_for(by_id.size());
+    uint32_t name_slots = slots_for(aliases.size());
+    uint32_t key_slots = slots_for(st.with_section);
+    std::vector<uint32_t> ids(id_slots, 0), names(name_slots, 0), keys(key_slots, 0);
+    for (uint32_t e = 0; e < entries.size(); ++e) {
+        // 0 is an empty slot.
+        if (entries[e].has_id) {
+            uint32_t h = id_hash(entries[e].id) & (id_slots - 1);
+            while (ids[h])
+                h = (h + 1) & (id_slots - 1);
+            ids[h] = e + 1;
+        }
+        if (entries[e].section != kNoSection) {
+            uint32_t h = key_hash((*dump_)[entries[e].section].name) & (key_slots - 1);
+            while (keys[h])
+                h = (h + 1) & (key_slots - 1);
+            keys[h] = e + 1;
+        }
+    }
+    for (uint32_t a = 0; a < aliases.size(); ++a) {
+        uint32_t h = name_hash(alias_names[a]) & (name_slots - 1);
+        while (names[h])
+            h = (h + 1) & (name_slots - 1);
+        names[h] = a + 1;
+    }
+
+    TableWriter w;
+    w.put(kEntries, records);
+    w.put(kAliases, aliases);
+    w.put(kSources, sources);
+    w.put(kUnresolved, unresolved);
+    w.put(kIdSlots, ids);
+    w.put(kNameSlots, names);
+    w.put(kKeySlots, keys);
+    w.put(kStrings, pool.chars());
+    FileHeader& h = w.header();
+    h.entry_count = uint32_t(records.size());
+    h.alias_count = uint32_t(aliases.size());
+    h.source_count = uint32_t(sources.size());
+    h.unresolved_count = uint32_t(unresolved.size());
+    h.id_slots = id_slots;
+    h.name_slots = name_slots;
+    h.key_slots = key_slots;
+    h.dump_size = dump_ ? uint32_t(dump_->size()) : 0;
+    st.entries = records.size();
+    if (stats)
+        *stats = st;
+    if (!w.save(path)) {
+        if (why)
+            *why = "cannot write the file";
+        return false;
+    }
+    return true;
+}
+
+bool JoinIndex::open(const char* path, std::string* why)
+{
+    auto fail = [&](const char* reason) {
+        if (why)
+            *why = reason;
+        entry_count_ = 0;
+        file_.close();
+        return false;
+    };
+    entry_count_ = 0;
+    if (!file_.open(path))
+        return fail("cannot read the file");
+    if (file_.size() < sizeof(FileHeader))
+        return fail("too short for a join index");
+    FileHeader h;
+    std::memcpy(&h, file_.data(), sizeof h);
+    if (std::memcmp(h.magic, kMagic, sizeof kMagic) != 0)
+        return fail("not a join index");
+    if (h.version != kVersion || h.table_count != kTables)
+        return fail("join index version not supported, rebuild it");
+    for (uint32_t slots : {h.id_slots, h.name_slots, h.key_slots})
+        if (slots < 8 || (slots & (slots - 1)))
+            return fail("bad hash table size");
+
+    const uint64_t counts[kTables] = {h.entry_count, h.alias_count, h.source_count, h.unresolved_count,
+                                      h.id_slots,    h.name_slots,  h.key_slots,    h.sizes[kStrings]};
+    static constexpr uint64_t kWidth[kTables] = {sizeof(EntryRecord), sizeof(AliasRecord),
+                                                 sizeof(SourceRecord), sizeof(UnresolvedRecord),
+                                                 sizeof(uint32_t), sizeof(uint32_t), sizeof(uint32_t), 1};
+    for (int t = 0; t < kTables; ++t) {
+        if (h.offsets[t] % 8 || h.sizes[t] != counts[t] * kWidth[t]
+            || h.offsets[t] > file_.size() || h.sizes[t] > file_.size() - h.offsets[t])
+            return fail("table out of bounds");
+        offsets_[t] = h.offsets[t];
+    }
+
+    // As in the snapshot, everything is checked here so the accessors can
+    // index without checking.
+    const uint64_t chars = h.sizes[kStrings];
+    auto ok = [&](const Ref& r) { return uint64_t(r.offset) + r.length <= chars; };
+    const EntryRecord* entries = table<EntryRecord>(kEntries);
+    for (uint32_t i = 0; i < h.entry_count; ++i) {
+        const EntryRecord& e = entries[i];
+        if (!ok(e.name) || !ok(e.group) || !ok(e.dump_name)
+            || uint64_t(e.alias_begin) + e.alias_count > h.alias_count
+            || (e.section != kNoSection && e.section >= h.dump_size))
+            return fail("entry out of bounds");
+    }
+    const AliasRecord* aliases = table<AliasRecord>(kAliases);
+    for (uint32_t i = 0; i < h.alias_count; ++i)
+        if (!ok(aliases[i].name) || aliases[i].entry >= h.entry_count)
+            return fail("alias out of bounds");
+    const SourceRecord* sources = table<SourceRecord>(kSources);
+    for (uint32_t i = 0; i < h.source_count; ++i)
+        if (!ok(sources[i].label) || sources[i].kind > uint32_t(JoinSourceKind::Links))
+            return fail("source out of bounds");
+    const UnresolvedRecord* unresolved = table<UnresolvedRecord>(kUnresolved);
+    for (uint32_t i = 0; i < h.unresolved_count; ++i)
+        if (!ok(unresolved[i].name) || unresolved[i].source >= h.source_count)
+            return fail("unresolved name out of bounds");
+    // A full table would never end a probe.
+    for (int t : {kIdSlots, kKeySlots, kNameSlots}) {
+        const uint32_t* slot = table<uint32_t>(t);
+        uint64_t limit = t == kNameSlots ? h.alias_count : h.entry_count;
+        uint64_t used = 0;
+        for (uint64_t i = 0; i < counts[t]; ++i) {
+            if (slot[i] > limit)
+                return fail("hash slot out of bounds");
+            used += slot[i] != 0;
+        }
+        if (used == counts[t])
+            return fail("hash table has no empty slot");
+    }
+
+    entry_count_ = h.entry_count;
+    source_count_ = h.source_count;
+    unresolved_count_ = h.unresolved_count;
+    dump_size_ = h.dump_size;
+    id_mask_ = h.id_slots - 1;
+    name_mask_ = h.name_slots - 1;
+    key_mask_ = h.key_slots - 1;
+    return true;
+}
+
+std::string_view JoinIndex::string(const Ref& r) const
+{
+    return {table<char>(kStrings) + r.offset, r.length};
+}
+
+std::optional<uint32_t> JoinIndex::by_id(uint32_t id) const
+{
+    if (entry_count_ == 0)
+        return std::nullopt;
+    const uint32_t* slot = table<uint32_t>(kIdSlots);
+    const EntryRecord* entries = table<EntryRecord>(kEntries);
+    for (uint32_t h = id_hash(id) & id_mask_; slot[h]; h = (h + 1) & id_mask_) {
+        const EntryRecord& e = entries[slot[h] - 1];
+        if ((e.flags & kFlagId) && e.id == id)
+            return slot[h] - 1;
+    }
+    return std::nullopt;
+}
+
+std::optional<uint32_t> JoinIndex::by_name(std::string_view name) const
+{
+    if (entry_count_ == 0)
+        return std::nullopt;
+    const uint32_t* slot = table<uint32_t>(kNameSlots);
+    const AliasRecord* aliases = table<AliasRecord>(kAliases);
+    for (uint32_t h = name_hash(name) & name_mask_; slot[h]; h = (h + 1) & name_mask_) {
+        const AliasRecord& a = aliases[slot[h] - 1];
+        if (iequals(string(a.name), name))
+            return a.entry;
+    }
+    return std::nullopt;
+}
+
+std::optional<uint32_t> JoinIndex::by_key(std::string_view dump_name) const
+{
+    if (entry_count_ == 0)
+        return std::nullopt;
+    const uint32_t* slot = table<uint32_t>(kKeySlots);
+    const EntryRecord* entries = table<EntryRecord>(kEntries);
+    for (uint32_t h = key_hash(dump_name) & key_mask_; slot[h]; h = (h + 1) & key_mask_)
+        if (key_equals(string(entries[slot[h] - 1].dump_name), dump_name))
+            return slot[h] - 1;
+    return std::nullopt;
+}
+
+JoinEntry JoinIndex::entry(uint32_t i) const
+{
+    const EntryRecord& e = table<EntryRecord>(kEntries)[i];
+    JoinEntry j;
+    j.has_id = e.flags & kFlagId;
+    j.id = e.id;
+    j.name = string(e.name);
+    j.group = string(e.group);
+    j.dump_name = string(e.dump_name);
+    j.section = e.section;
+    j.sources = e.sources;
+    j.alias_count = e.alias_count;
+    return j;
+}
+
+std::string_view JoinIndex::alias(uint32_t entry, uint32_t i) const
+{
+    const EntryRecord& e = table<EntryRecord>(kEntries)[entry];
+    return string(table<AliasRecord>(kAliases)[e.alias_begin + i].name);
+}
+
+JoinSource JoinIndex::source(uint32_t i) const
+{
+    const SourceRecord& s = table<SourceRecord>(kSources)[i];
+    return {string(s.label), JoinSourceKind(s.kind)};
+}
+
+Unresolved JoinIndex::unresolved(uint32_t i) const
+{
+    const UnresolvedRecord& u = table<UnresolvedRecord>(kUnresolved)[i];
+    return {string(u.name), u.source, u.line};
+}
+
+} // namespace nvapi
@@ -0,0 +1,181 @@
+// nvapi_join.h
+//
+// One index that joins the three ways this repo names a driver setting:
+//
+//   .nip files         SettingID 277041154 (0x10835002)
+//   checklists         "Frame Rate Limiter V3: Off"
+//   parameter dump     FRL FPS, or OGL_APP_CLAW as NPI prints it
+//
+// No single file holds the join. The dump has no IDs, and the checklists
+// have no IDs or keys. JoinBuilder pieces it together from:
+//
+//   CustomSettingNames   ID, NPI name and group (Reference.xml, and the copy
+//                        built into nvidiaProfileInspector.exe)
+//   .nip files           ID, and the driver's name in SettingNameInfo
+//   the dump             keys; a name that reads as a key once '_' is taken
+//                        as a space ("OGL_APP_CLAW") joins its section
+//   links files          "0x10835002  FRL FPS" lines, joins made by hand
+//   checklists           names (or keys) joined to the above
+//
+// Each setting found becomes an entry; an entry can lack an ID (a key only
+// a checklist names) or a section (an ID no name joins to the dump). Names
+// that resolve to nothing are kept as unresolved, with their line.
+//
+// write() saves the index in the snapshot's way (nvapi_snapshot.h): a header
+// and 8-byte aligned tables, used from a memory map. Three hash tables make
+// each lookup one probe sequence, with no parsing:
+//
+//   nvapi::JoinIndex idx;
+//   if (idx.open("nvapi.join"))
+//       if (auto e = idx.by_name("frame rate limiter v3"))
+//           nvapi::JoinEntry j = idx.entry(*e);      // j.id, j.dump_name
+//
+// Names match case-insensitively; keys also with '_' for ' '.
+
+#ifndef NVTOOLS_NVAPI_JOIN_H
+#define NVTOOLS_NVAPI_JOIN_H
+
+#include "mapped_file.h"
+#include "nvapi_checklist.h"
+#include "nvapi_dump.h"
+#include "nvapi_names.h"
+#include "nvapi_nip.h"
+
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace nvapi {
+
+constexpr uint32_t kNoSection = 0xffffffffu;
+
+enum class JoinSourceKind : uint8_t {
+    Names,
+    Nip,
+    Checklist,
+    Links,
+};
+
+struct JoinEntry {
+    bool has_id = false;
+    uint32_t id = 0;
+    std::string_view name;      // the first name a source gave it
+    std::string_view group;     // NPI's group, if a CustomSettingNames had it
+    std::string_view dump_name; // empty with section == kNoSection
+    uint32_t section = kNoSection;
+    uint32_t sources = 0;       // bit i: source(i) names it
+    uint32_t alias_count = 0;   // every name it is known by, name first
+};
+
+struct JoinSource {
+    std::string_view label;
+    JoinSourceKind kind;
+};
+
+struct Unresolved {
+    std::string_view name;
+    uint32_t source;
+    uint32_t line;
+};
+
+struct JoinStats {
+    size_t entries = 0;
+    size_t with_id = 0;
+    size_t with_section = 0;
+    size_t checklist_items = 0;
+    size_t checklist_resolved = 0;
+    size_t name_conflicts = 0;  // a name given to two IDs; the first keeps it
+};
+
+class JoinBuilder {
+public:
+    // Sources are numbered in the order they are added, at most 32. What is
+    // passed in is read by write(), so it has to live until then.
+    void set_dump(const std::vector<Section>& sections) { dump_ = &sections; }
+    void add_names(std::string_view label, const CustomNames& names);
+    void add_nip(std::string_view label, const NipFile& nip);
+    void add_checklist(std::string_view label, const Checklist& list);
+
+    // Lines of "<hex or decimal ID> <dump key>", '#' to the end of a line is
+    // a comment. False, with the line, on a line that is neither.
+    bool add_links(std::string_view label, std::string_view text, std::string* why = nullptr);
+
+    size_t source_count() const { return sources_.size(); }
+
+    // Joins everything added and saves it. False, with the reason, if it
+    // cannot be written.
+    bool write(const char* path, JoinStats* stats = nullptr, std::string* why = nullptr);
+
+private:
+    struct Link {
+        uint32_t id;
+        std::string_view key;
+        uint32_t source;
+        uint32_t line;
+    };
+
+    std::string_view plain(std::string_view escaped);
+    uint32_t add_source(std::string_view label, JoinSourceKind kind);
+
+    const std::vector<Section>* dump_ = nullptr;
+    std::vector<JoinSource> sources_;
+    // Each with its source number.
+    std::vector<std::pair<uint32_t, const CustomNames*>> names_;
+    std::vector<std::pair<uint32_t, const NipFile*>> nips_;
+    std::vector<std::pair<uint32_t, const Checklist*>> checklists_;
+    std::vector<Link> links_;
+    std::deque<std::string> unescaped_; // stable storage for plain()
+};
+
+class JoinIndex {
+public:
+    struct Ref;                 // a string in the file, see nvapi_join.cpp
+
+    // Maps the file and checks it; false (and why, if asked) if it is not an
+    // index this build can read.
+    bool open(const char* path, std::string* why = nullptr);
+
+    size_t size() const { return entry_count_; }
+    size_t source_count() const { return source_count_; }
+    size_t unresolved_count() const { return unresolved_count_; }
+
+    // Section count of the dump the index was built against.
+    uint32_t dump_size() const { return dump_size_; }
+
+    std::optional<uint32_t> by_id(uint32_t id) const;
+    std::optional<uint32_t> by_name(std::string_view name) const;
+    std::optional<uint32_t> by_key(std::string_view dump_name) const;
+
+    // Views point into the mapping.
+    JoinEntry entry(uint32_t i) const;
+    std::string_view alias(uint32_t entry, uint32_t i) const;
+    JoinSource source(uint32_t i) const;
+    Unresolved unresolved(uint32_t i) const;
+
+private:
+    std::string_view string(const Ref& r) const;
+
+    template <class T>
+    const T* table(int t) const
+    {
+        return reinterpret_cast<const T*>(file_.data() + offsets_[t]);
+    }
+
+    nvtools::MappedFile file_;
+    uint32_t entry_count_ = 0;
+    uint32_t source_count_ = 0;
+    uint32_t unresolved_count_ = 0;
+    uint32_t dump_size_ = 0;
+    uint32_t id_mask_ = 0;
+    uint32_t name_mask_ = 0;
+    uint32_t key_mask_ = 0;
+    uint64_t offsets_[8] = {};
+};
+
+} // namespace nvapi
+
+#endif // NVTOOLS_NVAPI_JOIN_H
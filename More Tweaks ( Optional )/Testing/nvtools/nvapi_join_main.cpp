@@ -0,0 +1,245 @@
+// nvapi_join_main.cpp
+//
+//   nvapi_join build <index> <dump or snapshot> <source...>
+//   nvapi_join find <index> <ID | name | key...>
+//   nvapi_join stats <index>
+//   nvapi_join unresolved <index>
+//
+// build joins the sources against the dump (nvapi_join.h) and saves the
+// index. What a source is goes by its extension: .xml and .exe are
+// CustomSettingNames, .nip a profile export, .txt a checklist and .links
+// joins made by hand. find looks each argument up as an ID (0x... or
+// decimal), then as a name, then as a dump key, prints what the index joins
+// to it, and exits with 1 if one is not there. stats counts what the index
+// holds and unresolved lists the checklist names and links it could not
+// join, by file and line.
+
+#include "mapped_file.h"
+#include "nvapi_join.h"
+#include "nvapi_snapshot.h"
+#include "text_util.h"
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace {
+
+bool parse_id(const char* s, uint32_t& out)
+{
+    char* end = nullptr;
+    bool hex = s[0] == '0' && (s[1] == 'x' || s[1] == 'X');
+    if (!(hex ? std::isxdigit(uint8_t(s[2])) : std::isdigit(uint8_t(s[0]))))
+        return false;
+    unsigned long long v = std::strtoull(s, &end, hex ? 16 : 10);
+    if (*end || v > 0xffffffffull)
+        return false;
+    out = uint32_t(v);
+    return true;
+}
+
+const char* kind_name(nvapi::JoinSourceKind k)
+{
+    switch (k) {
+    case nvapi::JoinSourceKind::Names:
+        return "names";
+    case nvapi::JoinSourceKind::Nip:
+        return "nip";
+    case nvapi::JoinSourceKind::Checklist:
+        return "checklist";
+    case nvapi::JoinSourceKind::Links:
+        return "links";
+    }
+    return "?";
+}
+
+int build(int argc, char** argv)
+{
+    nvtools::MappedFile dump_file;
+    nvapi::Snapshot snap;
+    nvapi::Dump dump;
+    std::vector<nvapi::Section> sections;
+    std::string why;
+    if (snap.open(argv[3], &why)) {
+        for (size_t i = 0; i < snap.size(); ++i)
+            sections.push_back(snap.section(i));
+    } else {
+        if (!dump_file.open(argv[3])) {
+            std::fprintf(stderr, "error: cannot read %s\n", argv[3]);
+            return 1;
+        }
+        dump = nvapi::parse_dump(dump_file.view());
+        sections = dump.sections;
+    }
+    if (sections.empty()) {
+        std::fprintf(stderr, "error: %s has no settings, is it a parameter dump?\n", argv[3]);
+        return 1;
+    }
+
+    // Everything the builder is given has to stay put until write().
+    nvapi::JoinBuilder b;
+    b.set_dump(sections);
+    std::deque<nvtools::MappedFile> files;
+    std::deque<nvapi::CustomNames> names;
+    std::deque<nvapi::NipFile> nips;
+    std::deque<nvapi::Checklist> lists;
+    for (int a = 4; a < argc; ++a) {
+        const char* path = argv[a];
+        files.emplace_back();
+        if (!files.back().open(path)) {
+            std::fprintf(stderr, "error: cannot read %s\n", path);
+            return 1;
+        }
+        std::string_view text = files.back().view();
+        bool ok;
+        if (nvtools::ends_with_nocase(path, ".xml") || nvtools::ends_with_nocase(path, ".exe")) {
+            names.emplace_back();
+            ok = nvapi::read_custom_names(text, names.back(), &why);
+            if (ok)
+                b.add_names(path, names.back());
+        } else if (nvtools::ends_with_nocase(path, ".nip")) {
+            nips.emplace_back();
+            ok = nvapi::read_nip(text, nips.back(), &why);
+            if (ok)
+                b.add_nip(path, nips.back());
+        } else if (nvtools::ends_with_nocase(path, ".txt")) {
+            lists.emplace_back();
+            ok = nvapi::read_checklist(text, lists.back(), &why);
+            if (ok)
+                b.add_checklist(path, lists.back());
+        } else if (nvtools::ends_with_nocase(path, ".links")) {
+            ok = b.add_links(path, text, &why);
+        } else {
+            ok = false;
+            why = "not a .xml, .exe, .nip, .txt or .links file";
+        }
+        if (!ok) {
+            std::fprintf(stderr, "error: %s: %s\n", path, why.c_str());
+            return 1;
+        }
+    }
+    if (b.source_count() > 32) {
+        std::fprintf(stderr, "error: at most 32 sources\n");
+        return 1;
+    }
+
+    nvapi::JoinStats st;
+    if (!b.write(argv[2], &st, &why)) {
+        std::fprintf(stderr, "error: %s: %s\n", argv[2], why.c_str());
+        return 1;
+    }
+    std::printf("%zu settings: %zu with an ID, %zu in the dump\n", st.entries, st.with_id, st.with_section);
+    std::printf("%zu of %zu checklist items joined", st.checklist_resolved, st.checklist_items);
+    if (st.name_conflicts)
+        std::printf(", %zu names given to two IDs", st.name_conflicts);
+    std::printf("\n");
+    return 0;
+}
+
+void print_entry(const nvapi::JoinIndex& idx, uint32_t e)
+{
+    nvapi::JoinEntry j = idx.entry(e);
+    if (j.has_id)
+        std::printf("0x%08x", j.id);
+    else
+        std::printf("(no ID)   ");
+    std::printf("  %.*s", int(j.name.size()), j.name.data());
+    if (!j.group.empty())
+        std::printf("  [%.*s]", int(j.group.size()), j.group.data());
+    std::printf("\n  dump:  ");
+    if (j.section == nvapi::kNoSection)
+        std::printf("-\n");
+    else
+        std::printf("%.*s (section %u)\n", int(j.dump_name.size()), j.dump_name.data(), j.section);
+    for (uint32_t a = 1; a < j.alias_count; ++a) {
+        std::string_view s = idx.alias(e, a);
+        std::printf("  aka:   %.*s\n", int(s.size()), s.data());
+    }
+    std::printf("  in:   ");
+    for (uint32_t s = 0; s < idx.source_count() && s < 32; ++s)
+        if (j.sources >> s & 1) {
+            nvapi::JoinSource src = idx.source(s);
+            std::printf(" %.*s", int(src.label.size()), src.label.data());
+        }
+    std::printf("\n");
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const char* cmd = argc > 1 ? argv[1] : "";
+    bool ok_args = (std::strcmp(cmd, "build") == 0 && argc >= 5)
+        || (std::strcmp(cmd, "find") == 0 && argc >= 4)
+        || ((std::strcmp(cmd, "stats") == 0 || std::strcmp(cmd, "unresolved") == 0) && argc == 3);
+    if (!ok_args) {
+        std::fprintf(stderr, "usage: nvapi_join build <index> <dump or snapshot> <source...>\n"
+                             "       nvapi_join find <index> <ID | name | key...>\n"
+                             "       nvapi_join stats|unresolved <index>\n");
+        return 2;
+    }
+    if (std::strcmp(cmd, "build") == 0)
+        return build(argc, argv);
+
+    nvapi::JoinIndex idx;
+    std::string why;
+    if (!idx.open(argv[2], &why)) {
+        std::fprintf(stderr, "error: %s: %s\n", argv[2], why.c_str());
+        return 1;
+    }
+
+    if (std::strcmp(cmd, "stats") == 0) {
+        size_t ids = 0, keys = 0, both = 0;
+        for (uint32_t e = 0; e < idx.size(); ++e) {
+            nvapi::JoinEntry j = idx.entry(e);
+            ids += j.has_id;
+            keys += j.section != nvapi::kNoSection;
+            both += j.has_id && j.section != nvapi::kNoSection;
+        }
+        std::printf("%zu settings: %zu with an ID, %zu in the dump, %zu both; built against %u dump settings\n",
+                    idx.size(), ids, keys, both, idx.dump_size());
+        for (uint32_t s = 0; s < idx.source_count(); ++s) {
+            nvapi::JoinSource src = idx.source(s);
+            size_t n = 0;
+            for (uint32_t e = 0; e < idx.size() && s < 32; ++e)
+                n += idx.entry(e).sources >> s & 1;
+            std::printf("%-10s %6zu  %.*s\n", kind_name(src.kind), n, int(src.label.size()), src.label.data());
+        }
+        std::printf("%zu unresolved\n", idx.unresolved_count());
+        return 0;
+    }
+
+    if (std::strcmp(cmd, "unresolved") == 0) {
+        for (uint32_t i = 0; i < idx.unresolved_count(); ++i) {
+            nvapi::Unresolved u = idx.unresolved(i);
+            nvapi::JoinSource src = idx.source(u.source);
+            std::printf("%.*s:%u: %.*s\n", int(src.label.size()), src.label.data(), u.line, int(u.name.size()),
+                        u.name.data());
+        }
+        return 0;
+    }
+
+    int status = 0;
+    for (int a = 3; a < argc; ++a) {
+        uint32_t id;
+        std::optional<uint32_t> e;
+        if (parse_id(argv[a], id))
+            e = idx.by_id(id);
+        if (!e)
+            e = idx.by_name(argv[a]);
+        if (!e)
+            e = idx.by_key(argv[a]);
+        if (!e) {
+            std::printf("%s: not in the index\n", argv[a]);
+            status = 1;
+            continue;
+        }
+        print_entry(idx, *e);
+    }
+    return status;
+}
@@ -0,0 +1,366 @@
+// nvapi_merge.cpp
+
+#include "nvapi_merge.h"
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+
+namespace nvapi {
+
+namespace {
+
+// Profile name to position in a file.
+using ProfileMap = std::unordered_map<std::string_view, uint32_t>;
+
+ProfileMap map_profiles(const NipFile& f)
+{
+    ProfileMap m;
+    m.reserve(f.profile_count());
+    for (uint32_t p = 0; p < f.profile_count(); ++p)
+        m.emplace(f.profile_name[p], p);
+    return m;
+}
+
+const uint32_t kNoProfile = 0xffffffffu;
+
+uint32_t find_profile(const ProfileMap& m, std::string_view name)
+{
+    auto it = m.find(name);
+    return it == m.end() ? kNoProfile : it->second;
+}
+
+// The settings of profile p, as positions in f, by ID. NPI writes them
+// sorted, so the sort is only a check most of the time.
+void by_id(const NipFile& f, uint32_t p, std::vector<uint32_t>& out)
+{
+    out.clear();
+    if (p == kNoProfile)
+        return;
+    for (uint32_t i = f.setting_begin[p]; i < f.setting_begin[p + 1]; ++i)
+        out.push_back(i);
+    auto less = [&](uint32_t a, uint32_t b) { return f.setting_id[a] < f.setting_id[b]; };
+    if (!std::is_sorted(out.begin(), out.end(), less))
+        std::stable_sort(out.begin(), out.end(), less);
+}
+
+NipValue value_of(const NipFile& f, uint32_t i)
+{
+    NipValue v;
+    v.present = true;
+    v.value = f.setting_value[i];
+    v.type = f.value_type[i];
+    v.name_info = f.name_info[i];
+    return v;
+}
+
+bool same(const NipValue& a, const NipValue& b)
+{
+    return a.present == b.present && (!a.present || (a.value == b.value && a.type == b.type));
+}
+
+bool dword_of(const NipValue& v, uint32_t& out)
+{
+    if (!v.present || v.type != "Dword" || v.value.empty() || v.value.size() > 10)
+        return false;
+    uint64_t n = 0;
+    for (char c : v.value) {
+        if (c < '0' || c > '9')
+            return false;
+        n = n * 10 + uint64_t(c - '0');
+    }
+    if (n > 0xffffffffu)
+        return false;
+    out = uint32_t(n);
+    return true;
+}
+
+// ours and theirs merged against base a field at a time, each field taken
+// from the side that changed it. False if both changed a field, to
+// different values. A bit in no field is a field of its own, and two sides
+// that both changed it changed it the same way.
+bool merge_fields(const std::vector<uint32_t>& fields, uint32_t base, uint32_t ours, uint32_t theirs,
+                  uint32_t& out)
+{
+    uint32_t co = ours ^ base, ct = theirs ^ base;
+    out = ours ^ (ct & ~co);
+    for (uint32_t m : fields) {
+        if ((co & m) && (ct & m) && ((ours ^ theirs) & m))
+            return false;
+        out = (out & ~m) | ((co & m ? ours : theirs) & m);
+    }
+    return true;
+}
+
+bool has_exe(const NipFile& f, uint32_t p, std::string_view exe)
+{
+    if (p == kNoProfile)
+        return false;
+    for (uint32_t e = f.exe_begin[p]; e < f.exe_begin[p + 1]; ++e)
+        if (f.exes[e] == exe)
+            return true;
+    return false;
+}
+
+// A cursor over one file's settings for one profile, in ID order.
+struct Walk {
+    const NipFile* f;
+    const std::vector<uint32_t>* order;
+    size_t at = 0;
+
+    bool more() const { return at < order->size(); }
+    uint32_t id() const { return f->setting_id[(*order)[at]]; }
+
+    // The value for id, consumed, or absent if this file skips it.
+    NipValue take(uint32_t want)
+    {
+        if (!more() || id() != want)
+            return {};
+        return value_of(*f, (*order)[at++]);
+    }
+};
+
+uint32_t next_id(const Walk* walks, size_t n)
+{
+    uint32_t id = 0xffffffffu;
+    bool any = false;
+    for (size_t i = 0; i < n; ++i)
+        if (walks[i].more() && (!any || walks[i].id() < id)) {
+            id = walks[i].id();
+            any = true;
+        }
+    return id;
+}
+
+NipChange change(NipChangeKind kind, std::string_view profile, std::string_view exe = {})
+{
+    NipChange c;
+    c.kind = kind;
+    c.profile = profile;
+    c.exe = exe;
+    return c;
+}
+
+bool same_profile(const NipFile& a, uint32_t pa, const NipFile& b, uint32_t pb, std::vector<uint32_t>& sa,
+                  std::vector<uint32_t>& sb)
+{
+    if (a.exe_begin[pa + 1] - a.exe_begin[pa] != b.exe_begin[pb + 1] - b.exe_begin[pb])
+        return false;
+    for (uint32_t e = a.exe_begin[pa]; e < a.exe_begin[pa + 1]; ++e)
+        if (!has_exe(b, pb, a.exes[e]))
+            return false;
+    by_id(a, pa, sa);
+    by_id(b, pb, sb);
+    if (sa.size() != sb.size())
+        return false;
+    for (size_t i = 0; i < sa.size(); ++i)
+        if (a.setting_id[sa[i]] != b.setting_id[sb[i]] || !same(value_of(a, sa[i]), value_of(b, sb[i])))
+            return false;
+    return true;
+}
+
+void write_profile(const NipFile& f, uint32_t p, NipWriter& out, std::vector<uint32_t>& order,
+                   MergeResult& result)
+{
+    out.begin_profile(f.profile_name[p], f.exes.data() + f.exe_begin[p], f.exe_begin[p + 1] - f.exe_begin[p]);
+    by_id(f, p, order);
+    for (uint32_t i : order)
+        out.setting(f.name_info[i], f.setting_id[i], f.setting_value[i], f.value_type[i]);
+    out.end_profile();
+    ++result.profiles;
+    result.settings += order.size();
+}
+
+class Merger {
+public:
+    Merger(const NipFile& base, const NipFile& ours, const NipFile& theirs, const MergeRules& rules,
+           NipWriter& out, MergeResult& result)
+        : base_(base), ours_(ours), theirs_(theirs), rules_(rules), out_(out), result_(result)
+    {
+    }
+
+    void profile(std::string_view name, uint32_t pb, uint32_t po, uint32_t pt);
+
+private:
+    void setting(std::string_view profile, uint32_t id, const NipValue& b, const NipValue& o, const NipValue& t);
+
+    const NipFile& base_;
+    const NipFile& ours_;
+    const NipFile& theirs_;
+    const MergeRules& rules_;
+    NipWriter& out_;
+    MergeResult& result_;
+    std::vector<uint32_t> sb_, so_, st_;
+    std::vector<std::string_view> exes_;
+    std::string number_;
+};
+
+void Merger::profile(std::string_view name, uint32_t pb, uint32_t po, uint32_t pt)
+{
+    // Executables: whatever either side added, less whatever either
+    // removed.
+    exes_.clear();
+    for (uint32_t e = ours_.exe_begin[po]; e < ours_.exe_begin[po + 1]; ++e)
+        if (has_exe(theirs_, pt, ours_.exes[e]) || !has_exe(base_, pb, ours_.exes[e]))
+            exes_.push_back(ours_.exes[e]);
+    if (pt != kNoProfile)
+        for (uint32_t e = theirs_.exe_begin[pt]; e < theirs_.exe_begin[pt + 1]; ++e)
+            if (!has_exe(ours_, po, theirs_.exes[e]) && !has_exe(base_, pb, theirs_.exes[e]))
+                exes_.push_back(theirs_.exes[e]);
+    out_.begin_profile(name, exes_.data(), exes_.size());
+
+    by_id(base_, pb, sb_);
+    by_id(ours_, po, so_);
+    by_id(theirs_, pt, st_);
+    Walk w[3] = {{&base_, &sb_}, {&ours_, &so_}, {&theirs_, &st_}};
+    while (w[0].more() || w[1].more() || w[2].more()) {
+        uint32_t id = next_id(w, 3);
+        NipValue b = w[0].take(id);
+        NipValue o = w[1].take(id);
+        NipValue t = w[2].take(id);
+        setting(name, id, b, o, t);
+    }
+    out_.end_profile();
+    ++result_.profiles;
+}
+
+void Merger::setting(std::string_view profile, uint32_t id, const NipValue& b, const NipValue& o,
+                     const NipValue& t)
+{
+    const NipValue* take;
+    if (same(o, t) || same(b, t)) {
+        take = &o;
+    } else if (same(b, o)) {
+        take = &t;
+        result_.from_theirs += t.present;
+    } else {
+        // Both changed it, differently. A bitfield can still merge if no
+        // field was changed both ways.
+        const BitfieldSetting* bits = rules_.bitfield(id);
+        uint32_t bv = 0, ov, tv;
+        bool have_base = b.present ? dword_of(b, bv) : bits && bits->has_default;
+        if (bits && !b.present)
+            bv = bits->default_value;
+        if (bits && have_base && dword_of(o, ov) && dword_of(t, tv)) {
+            uint32_t merged;
+            if (merge_fields(bits->fields, bv, ov, tv, merged)) {
+                number_ = std::to_string(merged);
+                out_.setting(o.name_info, id, number_, o.type);
+                ++result_.bit_merges;
+                ++result_.settings;
+                return;
+            }
+        }
+        result_.conflicts.push_back({profile, id, b, o, t});
+        take = rules_.prefer_theirs ? &t : &o;
+    }
+    if (!take->present)
+        return;
+    out_.setting(take->name_info, id, take->value, take->type);
+    ++result_.settings;
+}
+
+} // namespace
+
+const BitfieldSetting* MergeRules::bitfield(uint32_t id) const
+{
+    auto it = std::lower_bound(bitfields.begin(), bitfields.end(), id,
+                               [](const BitfieldSetting& b, uint32_t v) { return b.id < v; });
+    return it != bitfields.end() && it->id == id ? &*it : nullptr;
+}
+
+void diff_nip(const NipFile& a, const NipFile& b, std::vector<NipChange>& out)
+{
+    out.clear();
+    ProfileMap in_a = map_profiles(a), in_b = map_profiles(b);
+    std::vector<uint32_t> sa, sb;
+    for (uint32_t pa = 0; pa < a.profile_count(); ++pa) {
+        std::string_view name = a.profile_name[pa];
+        uint32_t pb = find_profile(in_b, name);
+        if (pb == kNoProfile) {
+            out.push_back(change(NipChangeKind::ProfileRemoved, name));
+            continue;
+        }
+        for (uint32_t e = a.exe_begin[pa]; e < a.exe_begin[pa + 1]; ++e)
+            if (!has_exe(b, pb, a.exes[e]))
+                out.push_back(change(NipChangeKind::ExeRemoved, name, a.exes[e]));
+        for (uint32_t e = b.exe_begin[pb]; e < b.exe_begin[pb + 1]; ++e)
+            if (!has_exe(a, pa, b.exes[e]))
+                out.push_back(change(NipChangeKind::ExeAdded, name, b.exes[e]));
+        by_id(a, pa, sa);
+        by_id(b, pb, sb);
+        Walk w[2] = {{&a, &sa}, {&b, &sb}};
+        while (w[0].more() || w[1].more()) {
+            uint32_t id = next_id(w, 2);
+            NipValue before = w[0].take(id);
+            NipValue after = w[1].take(id);
+            if (same(before, after))
+                continue;
+            NipChangeKind kind = !before.present ? NipChangeKind::Added
+                : !after.present              ? NipChangeKind::Removed
+                                              : NipChangeKind::Changed;
+            NipChange c = change(kind, name);
+            c.id = id;
+            c.before = before;
+            c.after = after;
+            out.push_back(c);
+        }
+    }
+    for (uint32_t pb = 0; pb < b.profile_count(); ++pb)
+        if (find_profile(in_a, b.profile_name[pb]) == kNoProfile)
+            out.push_back(change(NipChangeKind::ProfileAdded, b.profile_name[pb]));
+}
+
+const char* change_name(NipChangeKind kind)
+{
+    switch (kind) {
+    case NipChangeKind::ProfileAdded:   return "profile added";
+    case NipChangeKind::ProfileRemoved: return "profile removed";
+    case NipChangeKind::ExeAdded:       return "exe added";
+    case NipChangeKind::ExeRemoved:     return "exe removed";
+    case NipChangeKind::Added:          return "added";
+    case NipChangeKind::Removed:        return "removed";
+    case NipChangeKind::Changed:        return "changed";
+    }
+    return "?";
+}
+
+void merge_nip(const NipFile& base, const NipFile& ours, const NipFile& theirs, const MergeRules& rules,
+               NipWriter& out, MergeResult& result)
+{
+    result = MergeResult();
+    ProfileMap in_base = map_profiles(base), in_ours = map_profiles(ours), in_theirs = map_profiles(theirs);
+    Merger m(base, ours, theirs, rules, out, result);
+    std::vector<uint32_t> s1, s2;
+
+    for (uint32_t po = 0; po < ours.profile_count(); ++po) {
+        std::string_view name = ours.profile_name[po];
+        uint32_t pb = find_profile(in_base, name);
+        uint32_t pt = find_profile(in_theirs, name);
+        if (pb != kNoProfile && pt == kNoProfile) {
+            // Theirs removed it.
+            if (same_profile(base, pb, ours, po, s1, s2))
+                continue;
+            result.conflicts.push_back({name, 0, {}, {}, {}});
+            write_profile(ours, po, out, s1, result);
+            continue;
+        }
+        m.profile(name, pb, po, pt);
+    }
+    for (uint32_t pt = 0; pt < theirs.profile_count(); ++pt) {
+        std::string_view name = theirs.profile_name[pt];
+        if (find_profile(in_ours, name) != kNoProfile)
+            continue;
+        uint32_t pb = find_profile(in_base, name);
+        if (pb != kNoProfile) {
+            // Ours removed it.
+            if (same_profile(base, pb, theirs, pt, s1, s2))
+                continue;
+            result.conflicts.push_back({name, 0, {}, {}, {}});
+        }
+        write_profile(theirs, pt, out, s1, result);
+    }
+    out.finish();
+}
+
+} // namespace nvapi
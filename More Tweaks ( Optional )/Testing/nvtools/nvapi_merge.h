@@ -0,0 +1,109 @@
+// nvapi_merge.h
+//
+// Diff and three-way merge of .nip profile exports (nvapi_nip.h), such as
+// the Performance and HighQuality variants against a machine's own edits:
+//
+//   nvapi::MergeResult r;
+//   nvapi::NipWriter out(ours.format, text);
+//   nvapi::merge_nip(base, ours, theirs, rules, out, r);   // r.conflicts
+//
+// Profiles are matched by name. Within a profile the settings are walked as
+// vectors sorted by SettingID (NPI writes them sorted, so usually no sort is
+// needed), all three at once, in one linear pass. A setting takes whichever
+// side changed it from the base. When both sides changed it differently,
+// and MergeRules says the setting is a bitfield, the two changes are merged
+// a field at a time: one side setting flag 0x4 and the other clearing flag
+// 0x1 is no conflict, but one side writing 1 and the other 2 into the same
+// two-bit field is. Bits in no field merge one at a time. A bitfield both
+// sides add is merged against the driver's default, if the rules have one.
+// Otherwise it is a conflict, and the value is taken from ours (or theirs,
+// if the rules prefer them).
+//
+// Executables are merged as sets: one side adding or removing an exe wins.
+// A profile removed on one side is removed if the other side left it
+// unchanged, and is a conflict (and stays) if it changed it.
+//
+// Views in the results point into the files' text.
+
+#ifndef NVTOOLS_NVAPI_MERGE_H
+#define NVTOOLS_NVAPI_MERGE_H
+
+#include "nvapi_nip.h"
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace nvapi {
+
+struct BitfieldSetting {
+    uint32_t id;
+    bool has_default;
+    uint32_t default_value;
+    std::vector<uint32_t> fields;   // disjoint, BitfieldPlan::merge_fields()
+};
+
+struct MergeRules {
+    std::vector<BitfieldSetting> bitfields;     // sorted by id
+    bool prefer_theirs = false;
+
+    const BitfieldSetting* bitfield(uint32_t id) const;
+};
+
+// One setting as a file has it; absent if the profile does not set it.
+struct NipValue {
+    bool present = false;
+    std::string_view value;
+    std::string_view type;
+    std::string_view name_info;
+};
+
+enum class NipChangeKind : uint8_t {
+    ProfileAdded,
+    ProfileRemoved,
+    ExeAdded,
+    ExeRemoved,
+    Added,
+    Removed,
+    Changed,
+};
+
+struct NipChange {
+    NipChangeKind kind = NipChangeKind::Changed;
+    std::string_view profile;   // escaped, as in the file
+    std::string_view exe;       // ExeAdded, ExeRemoved
+    uint32_t id = 0;            // Added, Removed, Changed
+    NipValue before;
+    NipValue after;
+};
+
+// What changes a into b, profiles in a's order then b's new ones, settings
+// by ID.
+void diff_nip(const NipFile& a, const NipFile& b, std::vector<NipChange>& out);
+
+const char* change_name(NipChangeKind kind);
+
+struct MergeConflict {
+    std::string_view profile;
+    uint32_t id;                // 0 with both values absent: the profile itself
+    NipValue base;
+    NipValue ours;
+    NipValue theirs;
+};
+
+struct MergeResult {
+    size_t profiles = 0;
+    size_t settings = 0;
+    size_t from_theirs = 0;     // settings whose value came from theirs alone
+    size_t bit_merges = 0;      // settings both sides changed, merged by bits
+    std::vector<MergeConflict> conflicts;
+};
+
+// Writes the merged profiles to out, ours' profiles in ours' order and then
+// those only theirs added, and finishes it. Formatting comes from out.
+void merge_nip(const NipFile& base, const NipFile& ours, const NipFile& theirs, const MergeRules& rules,
+               NipWriter& out, MergeResult& result);
+
+} // namespace nvapi
+
+#endif // NVTOOLS_NVAPI_MERGE_H
@@ -0,0 +1,230 @@
+// nvapi_merge_main.cpp
+//
+//   nvapi_merge diff <a.nip> <b.nip> [<join index> <snapshot>]
+//   nvapi_merge merge [--theirs] <base.nip> <ours.nip> <theirs.nip> <out.nip> [<join index> <snapshot>]
+//
+// diff prints what changes a into b (nvapi_merge.h), one tab-separated line
+// per change, like nvapi_diff:
+//
+//   kind <TAB> profile <TAB> setting or exe <TAB> before <TAB> after
+//
+// merge writes the three-way merge of the profiles to out.nip, in ours'
+// encoding, prints each conflict and exits with 1 if there were any. A
+// conflict keeps ours' value, or theirs' with --theirs. Given a join index
+// (nvapi_join.h) and the snapshot it was built against, settings the dump
+// calls bitfields merge a field at a time, and diff names the bits that
+// changed and the settings, by their NPI name.
+
+#include "mapped_file.h"
+#include "nvapi_bits.h"
+#include "nvapi_defaults.h"
+#include "nvapi_join.h"
+#include "nvapi_merge.h"
+#include "nvapi_nip.h"
+#include "nvapi_snapshot.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Loaded {
+    nvtools::MappedFile file;
+    nvapi::NipFile nip;
+};
+
+bool load(const char* path, Loaded& l)
+{
+    if (!l.file.open(path)) {
+        std::fprintf(stderr, "error: cannot read %s\n", path);
+        return false;
+    }
+    std::string why;
+    if (!nvapi::read_nip(l.file.view(), l.nip, &why)) {
+        std::fprintf(stderr, "error: %s: %s\n", path, why.c_str());
+        return false;
+    }
+    return true;
+}
+
+// The bitfield settings the index can place in the dump, with their
+// DWORD defaults and the fields their symbols make.
+bool load_rules(const char* index, const char* snapshot, nvapi::JoinIndex& idx, nvapi::MergeRules& rules)
+{
+    nvapi::Snapshot snap;
+    std::string why;
+    if (!idx.open(index, &why)) {
+        std::fprintf(stderr, "error: %s: %s\n", index, why.c_str());
+        return false;
+    }
+    if (!snap.open(snapshot, &why)) {
+        std::fprintf(stderr, "error: %s: %s\n", snapshot, why.c_str());
+        return false;
+    }
+    if (snap.size() != idx.dump_size()) {
+        std::fprintf(stderr, "error: %s was built against another dump than %s\n", index, snapshot);
+        return false;
+    }
+    nvapi::DefaultTable defaults = nvapi::DefaultTable::build(snap);
+    nvapi::SectionRecord rec;
+    for (uint32_t e = 0; e < idx.size(); ++e) {
+        nvapi::JoinEntry j = idx.entry(e);
+        if (!j.has_id || j.section == nvapi::kNoSection || !snap.section(j.section).bitfields)
+            continue;
+        nvapi::Value v = defaults.value(j.section);
+        bool dword = v.type() == nvapi::ValueType::Dword;
+        snap.read(j.section, rec);
+        rules.bitfields.push_back({j.id, dword, dword ? v.as_dword() : 0,
+                                   nvapi::BitfieldPlan::build(rec).merge_fields()});
+    }
+    std::sort(rules.bitfields.begin(), rules.bitfields.end(),
+              [](const nvapi::BitfieldSetting& a, const nvapi::BitfieldSetting& b) { return a.id < b.id; });
+    return true;
+}
+
+std::string setting_name(const nvapi::JoinIndex* idx, uint32_t id, std::string_view name_info)
+{
+    char hex[16];
+    std::snprintf(hex, sizeof hex, "0x%08x", id);
+    std::string s = hex;
+    std::string_view name = name_info;
+    if (idx)
+        if (auto e = idx->by_id(id))
+            name = idx->entry(*e).name;
+    if (!name.empty() && name != " ") {
+        s += ' ';
+        s.append(name.data(), name.size());
+    }
+    return s;
+}
+
+std::string value_text(const nvapi::NipValue& v)
+{
+    if (!v.present)
+        return {};
+    std::string s(v.value);
+    if (v.type != "Dword") {
+        s += " (";
+        s.append(v.type.data(), v.type.size());
+        s += ')';
+    }
+    return s;
+}
+
+bool dword(const nvapi::NipValue& v, uint32_t& out)
+{
+    if (!v.present || v.type != "Dword" || v.value.empty() || v.value.size() > 10)
+        return false;
+    uint64_t n = 0;
+    for (char c : v.value) {
+        if (c < '0' || c > '9')
+            return false;
+        n = n * 10 + uint64_t(c - '0');
+    }
+    out = uint32_t(n);
+    return n <= 0xffffffffu;
+}
+
+int diff(int argc, char** argv)
+{
+    Loaded a, b;
+    nvapi::JoinIndex idx;
+    nvapi::MergeRules rules;
+    bool named = argc == 6;
+    if (!load(argv[2], a) || !load(argv[3], b) || (named && !load_rules(argv[4], argv[5], idx, rules)))
+        return 1;
+    std::vector<nvapi::NipChange> changes;
+    nvapi::diff_nip(a.nip, b.nip, changes);
+    std::string profile;
+    for (const nvapi::NipChange& c : changes) {
+        profile.clear();
+        if (!nvapi::xml_unescape(c.profile, profile))
+            profile = std::string(c.profile);
+        std::string item, before = value_text(c.before), after = value_text(c.after);
+        if (c.kind == nvapi::NipChangeKind::ExeAdded || c.kind == nvapi::NipChangeKind::ExeRemoved) {
+            item = std::string(c.exe);
+        } else if (c.kind != nvapi::NipChangeKind::ProfileAdded && c.kind != nvapi::NipChangeKind::ProfileRemoved) {
+            item = setting_name(named ? &idx : nullptr, c.id,
+                                c.after.present ? c.after.name_info : c.before.name_info);
+            uint32_t x, y;
+            if (c.kind == nvapi::NipChangeKind::Changed && rules.bitfield(c.id) && dword(c.before, x)
+                && dword(c.after, y)) {
+                char bits[64];
+                std::snprintf(bits, sizeof bits, " (+0x%08x -0x%08x)", y & ~x, x & ~y);
+                after += bits;
+            }
+        }
+        std::printf("%s\t%s\t%s\t%s\t%s\n", nvapi::change_name(c.kind), profile.c_str(), item.c_str(),
+                    before.c_str(), after.c_str());
+    }
+    std::fprintf(stderr, "%zu changes\n", changes.size());
+    return 0;
+}
+
+int merge(int argc, char** argv)
+{
+    int a = 2;
+    nvapi::MergeRules rules;
+    if (std::strcmp(argv[a], "--theirs") == 0) {
+        rules.prefer_theirs = true;
+        ++a;
+    }
+    Loaded base, ours, theirs;
+    nvapi::JoinIndex idx;
+    bool named = argc - a == 6;
+    if (!load(argv[a], base) || !load(argv[a + 1], ours) || !load(argv[a + 2], theirs)
+        || (named && !load_rules(argv[a + 4], argv[a + 5], idx, rules)))
+        return 1;
+
+    std::string out;
+    nvapi::NipWriter w(ours.nip.format, out);
+    nvapi::MergeResult r;
+    nvapi::merge_nip(base.nip, ours.nip, theirs.nip, rules, w, r);
+    const char* path = argv[a + 3];
+    FILE* f = std::fopen(path, "wb");
+    bool ok = f && std::fwrite(out.data(), 1, out.size(), f) == out.size();
+    if (f)
+        ok = std::fclose(f) == 0 && ok;
+    if (!ok) {
+        std::fprintf(stderr, "error: cannot write %s\n", path);
+        return 1;
+    }
+
+    std::string profile;
+    for (const nvapi::MergeConflict& c : r.conflicts) {
+        profile.clear();
+        if (!nvapi::xml_unescape(c.profile, profile))
+            profile = std::string(c.profile);
+        if (!c.base.present && !c.ours.present && !c.theirs.present && c.id == 0) {
+            std::printf("conflict\t%s\t\tremoved on one side, changed on the other\n", profile.c_str());
+            continue;
+        }
+        std::string_view info = c.ours.present ? c.ours.name_info : c.theirs.name_info;
+        std::printf("conflict\t%s\t%s\t%s\t%s\t%s\n", profile.c_str(),
+                    setting_name(named ? &idx : nullptr, c.id, info).c_str(), value_text(c.base).c_str(),
+                    value_text(c.ours).c_str(), value_text(c.theirs).c_str());
+    }
+    std::fprintf(stderr, "%zu profiles, %zu settings: %zu from theirs, %zu merged by bits, %zu conflicts\n",
+                 r.profiles, r.settings, r.from_theirs, r.bit_merges, r.conflicts.size());
+    return r.conflicts.empty() ? 0 : 1;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const char* cmd = argc > 1 ? argv[1] : "";
+    bool theirs = argc > 2 && std::strcmp(argv[2], "--theirs") == 0;
+    bool ok_args = (std::strcmp(cmd, "diff") == 0 && (argc == 4 || argc == 6))
+        || (std::strcmp(cmd, "merge") == 0 && (argc - theirs == 6 || argc - theirs == 8));
+    if (!ok_args) {
+        std::fprintf(stderr, "usage: nvapi_merge diff <a.nip> <b.nip> [<join index> <snapshot>]\n"
+                             "       nvapi_merge merge [--theirs] <base.nip> <ours.nip> <theirs.nip> <out.nip>"
+                             " [<join index> <snapshot>]\n");
+        return 2;
+    }
+    return std::strcmp(cmd, "diff") == 0 ? diff(argc, argv) : merge(argc, argv);
+}
@@ -0,0 +1,144 @@
+// nvapi_names.cpp
+
+#include "nvapi_names.h"
+
+#include "text_util.h"
+
+namespace nvapi {
+
+namespace {
+
+// The child elements of one element, in order. Text is what lies between
+// the child's tags; a child's own children stay in it unparsed, which is all
+// this format needs. Comments and self-closing tags are skipped.
+class Children {
+public:
+    explicit Children(std::string_view body) : s_(body) {}
+
+    // False at the end, or on markup that does not close.
+    bool next(std::string_view& tag, std::string_view& text)
+    {
+        for (;;) {
+            size_t open = s_.find('<', at_);
+            if (open == std::string_view::npos || open + 1 >= s_.size())
+                return false;
+            if (s_.compare(open, 4, "<!--") == 0) {
+                size_t end = s_.find("-->", open + 4);
+                if (end == std::string_view::npos)
+                    return false;
+                at_ = end + 3;
+                continue;
+            }
+            size_t close = s_.find('>', open);
+            if (close == std::string_view::npos || s_[open + 1] == '/')
+                return false;
+            if (s_[close - 1] == '/') {
+                at_ = close + 1;
+                continue;
+            }
+            size_t name_end = s_.find_first_of(" \t\r\n>", open + 1);
+            tag = s_.substr(open + 1, name_end - open - 1);
+            // No element nests inside one of its own name here.
+            std::string end_tag = "</";
+            end_tag.append(tag.data(), tag.size());
+            end_tag += '>';
+            size_t end = s_.find(end_tag, close + 1);
+            if (end == std::string_view::npos)
+                return false;
+            text = s_.substr(close + 1, end - close - 1);
+            at_ = end + end_tag.size();
+            return true;
+        }
+    }
+
+private:
+    std::string_view s_;
+    size_t at_ = 0;
+};
+
+// A SettingID: "0x" and at most eight hex digits.
+bool parse_id(std::string_view s, uint32_t& out)
+{
+    s = nvtools::trim(s);
+    uint64_t v;
+    if (s.size() > 10 || !nvtools::parse_hex(s, v))
+        return false;
+    out = uint32_t(v);
+    return true;
+}
+
+} // namespace
+
+bool read_custom_names(std::string_view source, CustomNames& out, std::string* why)
+{
+    auto fail = [&](const std::string& reason) {
+        if (why)
+            *why = reason;
+        return false;
+    };
+    out.settings.clear();
+    out.values.clear();
+
+    size_t begin = source.find("<CustomSettingNames");
+    size_t end = begin == std::string_view::npos ? begin : source.find("</CustomSettingNames>", begin);
+    if (end == std::string_view::npos)
+        return fail("no CustomSettingNames element");
+    size_t body = source.find('>', begin);
+    if (body > end)
+        return fail("no CustomSettingNames element");
+    Children root(source.substr(body + 1, end - body - 1));
+    std::string_view tag, text;
+    std::string_view settings;
+    while (root.next(tag, text))
+        if (tag == "Settings")
+            settings = text;
+
+    Children list(settings);
+    while (list.next(tag, text)) {
+        if (tag != "CustomSetting")
+            continue;
+        CustomSetting s;
+        s.value_begin = uint32_t(out.values.size());
+        bool has_id = false;
+        Children fields(text);
+        std::string_view field, value;
+        while (fields.next(field, value)) {
+            if (field == "UserfriendlyName") {
+                s.name = value;
+            } else if (field == "HexSettingID") {
+                has_id = parse_id(value, s.id);
+            } else if (field == "GroupName") {
+                s.group = value;
+            } else if (field == "DataType") {
+                s.data_type = value;
+            } else if (field == "Hidden") {
+                s.hidden = value == "true";
+            } else if (field == "SettingValues") {
+                Children values(value);
+                std::string_view item, body_text;
+                while (values.next(item, body_text)) {
+                    if (item != "CustomSettingValue")
+                        continue;
+                    CustomValue v;
+                    Children parts(body_text);
+                    std::string_view part, part_text;
+                    while (parts.next(part, part_text)) {
+                        if (part == "UserfriendlyName")
+                            v.name = part_text;
+                        else if (part == "HexValue")
+                            v.hex = part_text;
+                    }
+                    out.values.push_back(v);
+                }
+            }
+        }
+        if (!has_id)
+            return fail("setting " + std::to_string(out.settings.size() + 1) + " (\"" + std::string(s.name)
+                        + "\") has no readable HexSettingID");
+        s.value_count = uint32_t(out.values.size()) - s.value_begin;
+        out.settings.push_back(s);
+    }
+    return true;
+}
+
+} // namespace nvapi
@@ -0,0 +1,63 @@
+// nvapi_names.h
+//
+// nvidiaProfileInspector's CustomSettingNames files: the names NPI shows for
+// setting IDs the driver itself leaves unnamed, with names for some of
+// their values.
+//
+//   <CustomSettingNames>
+//     <Settings>
+//       <CustomSetting>
+//         <UserfriendlyName>Frame Rate Limiter V3</UserfriendlyName>
+//         <HexSettingID>0x10835002</HexSettingID>
+//         <GroupName>2 - Sync and Refresh</GroupName>
+//         <SettingValues>
+//           <CustomSettingValue>
+//             <UserfriendlyName>Off</UserfriendlyName>
+//             <HexValue>0x00000000</HexValue>
+//           </CustomSettingValue>
+//           ...
+//
+// NPI ships one inside nvidiaProfileInspector.exe and reads Reference.xml
+// next to it. read_custom_names() takes either: it reads the first
+// <CustomSettingNames> element in the bytes it is given, so the executable
+// can be passed as it is. Elements it does not know (SettingMasks,
+// Description, ...) are skipped. Strings are views into the source, still
+// XML-escaped (xml_unescape() in nvapi_nip.h).
+
+#ifndef NVTOOLS_NVAPI_NAMES_H
+#define NVTOOLS_NVAPI_NAMES_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace nvapi {
+
+struct CustomSetting {
+    std::string_view name;      // empty for the few NPI keeps hidden
+    uint32_t id = 0;
+    std::string_view group;
+    std::string_view data_type; // empty for a DWORD
+    bool hidden = false;
+    uint32_t value_begin = 0;   // into CustomNames::values
+    uint32_t value_count = 0;
+};
+
+struct CustomValue {
+    std::string_view name;
+    std::string_view hex;       // HexValue as written, "0x00000000"
+};
+
+struct CustomNames {
+    std::vector<CustomSetting> settings;    // in file order
+    std::vector<CustomValue> values;
+};
+
+// False, with the reason, if source has no CustomSettingNames element or a
+// setting without a readable HexSettingID.
+bool read_custom_names(std::string_view source, CustomNames& out, std::string* why = nullptr);
+
+} // namespace nvapi
+
+#endif // NVTOOLS_NVAPI_NAMES_H
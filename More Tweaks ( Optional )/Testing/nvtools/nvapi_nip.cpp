@@ -0,0 +1,480 @@
+// nvapi_nip.cpp
+
+#include "nvapi_nip.h"
+
+#include "byte_scan.h"
+#include "text_util.h"
+#include "utf16.h"
+
+namespace nvapi {
+
+namespace {
+
+using nvtools::is_space;
+
+// What XmlSerializer writes for the SettingID: decimal, no sign, no
+// leading zeros.
+bool parse_id(std::string_view s, uint32_t& out)
+{
+    if (s.empty() || s.size() > 10 || (s.size() > 1 && s[0] == '0'))
+        return false;
+    uint64_t v = 0;
+    for (char c : s) {
+        if (c < '0' || c > '9')
+            return false;
+        v = v * 10 + uint64_t(c - '0');
+    }
+    if (v > 0xffffffffu)
+        return false;
+    out = uint32_t(v);
+    return true;
+}
+
+void append_decimal(uint32_t v, std::string& out)
+{
+    char buf[10];
+    char* p = buf + sizeof buf;
+    do {
+        *--p = char('0' + v % 10);
+        v /= 10;
+    } while (v);
+    out.append(p, size_t(buf + sizeof buf - p));
+}
+
+// Tags in the order the layout has them; anything else is an error, not
+// something to skip.
+class Reader {
+public:
+    enum Kind { Open, Close, Empty };
+
+    Reader(std::string_view s, std::string* why) : s_(s), why_(why) {}
+
+    size_t pos() const { return pos_; }
+    void seek(size_t pos) { pos_ = pos; }
+
+    bool at_end()
+    {
+        skip_space();
+        return pos_ == s_.size();
+    }
+
+    // <name attributes>, </name> or <name attributes />.
+    bool tag(std::string_view& name, Kind& kind, std::string_view* attributes = nullptr)
+    {
+        skip_space();
+        if (pos_ >= s_.size() || s_[pos_] != '<')
+            return fail("expected a tag");
+        size_t end = nvtools::find_byte(s_, '>', pos_);
+        if (end == std::string_view::npos)
+            return fail("unterminated tag");
+        std::string_view inner = s_.substr(pos_ + 1, end - pos_ - 1);
+        kind = Open;
+        if (!inner.empty() && inner[0] == '/') {
+            kind = Close;
+            inner.remove_prefix(1);
+        } else if (!inner.empty() && inner.back() == '/') {
+            kind = Empty;
+            inner.remove_suffix(1);
+        }
+        size_t n = 0;
+        while (n < inner.size() && !is_space(inner[n]))
+            ++n;
+        name = inner.substr(0, n);
+        std::string_view rest = inner.substr(n);
+        if (kind == Empty && !rest.empty() && rest.back() == ' ')
+            rest.remove_suffix(1);      // "<X />"
+        if (attributes)
+            *attributes = rest;
+        else if (!rest.empty())
+            return fail("unexpected attributes on <" + std::string(name) + ">");
+        pos_ = end + 1;
+        return true;
+    }
+
+    bool expect(std::string_view name, Kind kind)
+    {
+        std::string_view n;
+        Kind k;
+        if (!tag(n, k))
+            return false;
+        if (n != name || k != kind)
+            return fail("expected " + describe(name, kind));
+        return true;
+    }
+
+    // <name>text</name> or <name />.
+    bool element(std::string_view name, std::string_view& text)
+    {
+        std::string_view n;
+        Kind k;
+        if (!tag(n, k))
+            return false;
+        if (n != name || k == Close)
+            return fail("expected <" + std::string(name) + ">");
+        text = {};
+        if (k == Empty)
+            return true;
+        size_t lt = nvtools::find_byte(s_, '<', pos_);
+        if (lt == std::string_view::npos)
+            return fail("unterminated <" + std::string(name) + ">");
+        text = s_.substr(pos_, lt - pos_);
+        pos_ = lt;
+        return expect(name, Close);
+    }
+
+    bool fail(std::string reason)
+    {
+        if (why_)
+            *why_ = "line " + std::to_string(1 + nvtools::count_byte(s_.substr(0, pos_), '\n')) + ": " + reason;
+        return false;
+    }
+
+private:
+    static std::string describe(std::string_view name, Kind kind)
+    {
+        return (kind == Close ? "</" : "<") + std::string(name) + (kind == Empty ? " />" : ">");
+    }
+
+    void skip_space()
+    {
+        while (pos_ < s_.size() && is_space(s_[pos_]))
+            ++pos_;
+    }
+
+    std::string_view s_;
+    std::string* why_;
+    size_t pos_ = 0;
+};
+
+bool read_profile(Reader& r, NipFile& out)
+{
+    std::string_view text, name;
+    Reader::Kind kind;
+    if (!r.element("ProfileName", text))
+        return false;
+    out.profile_name.push_back(text);
+
+    if (!r.tag(name, kind) || name != "Executeables" || kind == Reader::Close)
+        return r.fail("expected <Executeables>");
+    while (kind == Reader::Open) {
+        size_t at = r.pos();
+        if (!r.tag(name, kind))
+            return false;
+        if (name == "Executeables" && kind == Reader::Close)
+            break;
+        r.seek(at);
+        if (!r.element("string", text))
+            return false;
+        out.exes.push_back(text);
+    }
+    out.exe_begin.push_back(uint32_t(out.exes.size()));
+
+    if (!r.tag(name, kind) || name != "Settings" || kind == Reader::Close)
+        return r.fail("expected <Settings>");
+    while (kind == Reader::Open) {
+        if (!r.tag(name, kind))
+            return false;
+        if (name == "Settings" && kind == Reader::Close)
+            break;
+        if (name != "ProfileSetting" || kind != Reader::Open)
+            return r.fail("expected <ProfileSetting>");
+        uint32_t id;
+        std::string_view info, value, type;
+        if (!r.element("SettingNameInfo", info) || !r.element("SettingID", text))
+            return false;
+        if (!parse_id(text, id))
+            return r.fail(std::string(text) + " is not a SettingID");
+        if (!r.element("SettingValue", value) || !r.element("ValueType", type))
+            return false;
+        if (!r.expect("ProfileSetting", Reader::Close))
+            return false;
+        out.name_info.push_back(info);
+        out.setting_id.push_back(id);
+        out.setting_value.push_back(value);
+        out.value_type.push_back(type);
+    }
+    out.setting_begin.push_back(uint32_t(out.setting_id.size()));
+    return r.expect("Profile", Reader::Close);
+}
+
+} // namespace
+
+bool read_nip(std::string_view source, NipFile& out, std::string* why)
+{
+    out = NipFile();
+    NipFormat& f = out.format;
+    std::string_view s = source;
+    if (s.size() >= 2 && uint8_t(s[0]) == 0xff && uint8_t(s[1]) == 0xfe) {
+        f.encoding = NipEncoding::Utf16Le;
+        f.bom = true;
+        s.remove_prefix(2);
+    } else if (s.size() >= 2 && s[0] == '<' && s[1] == 0) {
+        f.encoding = NipEncoding::Utf16Le;
+        f.bom = false;
+    } else {
+        f.encoding = NipEncoding::Utf8;
+        f.bom = s.size() >= 3 && s.substr(0, 3) == "\xef\xbb\xbf";
+        if (f.bom)
+            s.remove_prefix(3);
+    }
+    if (f.encoding == NipEncoding::Utf16Le) {
+        out.text.reserve(s.size() / 2);
+        if (!nvtools::utf16le_to_utf8(s, out.text)) {
+            if (why)
+                *why = "odd number of bytes for UTF-16";
+            return false;
+        }
+        s = out.text;
+    }
+
+    size_t nl = nvtools::find_byte(s, '\n');
+    f.crlf = nl != std::string_view::npos && nl > 0 && s[nl - 1] == '\r';
+    f.final_newline = !s.empty() && s.back() == '\n';
+    f.declaration.clear();
+    Reader r(s, why);
+    if (s.substr(0, 5) == "<?xml") {
+        size_t end = s.find("?>");
+        if (end == std::string_view::npos)
+            return r.fail("unterminated XML declaration");
+        f.declaration = std::string(s.substr(0, end + 2));
+        r.seek(end + 2);
+    }
+
+    std::string_view name, attributes;
+    Reader::Kind kind;
+    if (!r.tag(name, kind, &attributes) || name != "ArrayOfProfile" || kind == Reader::Close)
+        return r.fail("expected <ArrayOfProfile>, is this a .nip file?");
+    f.root_attributes = std::string(attributes);
+    out.exe_begin.push_back(0);
+    out.setting_begin.push_back(0);
+    while (kind == Reader::Open) {
+        if (!r.tag(name, kind))
+            return false;
+        if (name == "ArrayOfProfile" && kind == Reader::Close)
+            break;
+        if (name != "Profile" || kind != Reader::Open)
+            return r.fail("expected <Profile>");
+        if (!read_profile(r, out))
+            return false;
+    }
+    if (!r.at_end())
+        return r.fail("text after </ArrayOfProfile>");
+    return true;
+}
+
+void NipWriter::start()
+{
+    if (started_)
+        return;
+    started_ = true;
+    if (format_.bom)
+        out_ += format_.encoding == NipEncoding::Utf16Le ? std::string_view("\xff\xfe", 2) : "\xef\xbb\xbf";
+    if (!format_.declaration.empty()) {
+        pending_ += format_.declaration;
+        first_line_ = false;
+    }
+}
+
+void NipWriter::line(int depth, std::string_view a, std::string_view b, std::string_view c)
+{
+    if (!first_line_)
+        pending_ += format_.crlf ? "\r\n" : "\n";
+    first_line_ = false;
+    pending_.append(size_t(2 * depth), ' ');
+    pending_ += a;
+    pending_ += b;
+    pending_ += c;
+}
+
+// XmlSerializer writes an empty string as <tag />.
+void NipWriter::element(int depth, std::string_view tag, std::string_view text)
+{
+    if (text.empty()) {
+        line(depth, "<", tag, " />");
+        return;
+    }
+    line(depth, "<", tag, ">");
+    pending_ += text;
+    pending_ += "</";
+    pending_ += tag;
+    pending_ += '>';
+}
+
+void NipWriter::flush()
+{
+    if (format_.encoding == NipEncoding::Utf16Le)
+        nvtools::utf8_to_utf16le(pending_, out_);
+    else
+        out_ += pending_;
+    pending_.clear();
+}
+
+void NipWriter::begin_profile(std::string_view name, const std::string_view* exes, size_t exe_count)
+{
+    start();
+    if (!any_profile_)
+        line(0, "<ArrayOfProfile", format_.root_attributes, ">");
+    any_profile_ = true;
+    any_setting_ = false;
+    line(1, "<Profile>");
+    element(2, "ProfileName", name);
+    if (!exe_count) {
+        line(2, "<Executeables />");
+    } else {
+        line(2, "<Executeables>");
+        for (size_t i = 0; i < exe_count; ++i)
+            element(3, "string", exes[i]);
+        line(2, "</Executeables>");
+    }
+}
+
+void NipWriter::setting(std::string_view name_info, uint32_t id, std::string_view value, std::string_view type)
+{
+    if (!any_setting_)
+        line(2, "<Settings>");
+    any_setting_ = true;
+    line(3, "<ProfileSetting>");
+    element(4, "SettingNameInfo", name_info);
+    line(4, "<SettingID>");
+    append_decimal(id, pending_);
+    pending_ += "</SettingID>";
+    element(4, "SettingValue", value);
+    element(4, "ValueType", type);
+    line(3, "</ProfileSetting>");
+}
+
+NipWriter NipWriter::renderer(const NipFormat& format, std::string& out)
+{
+    NipWriter w(format, out);
+    w.started_ = true;
+    w.first_line_ = false;
+    w.any_profile_ = true;
+    return w;
+}
+
+std::string NipWriter::take_rendered()
+{
+    any_setting_ = false;
+    std::string text = std::move(pending_);
+    pending_.clear();
+    return text;
+}
+
+void NipWriter::settings_text(std::string_view rendered)
+{
+    if (rendered.empty())
+        return;
+    pending_ += rendered;
+    any_setting_ = true;
+}
+
+void NipWriter::end_profile()
+{
+    line(2, any_setting_ ? "</Settings>" : "<Settings />");
+    line(1, "</Profile>");
+    flush();
+}
+
+void NipWriter::finish()
+{
+    start();
+    if (any_profile_)
+        line(0, "</ArrayOfProfile>");
+    else
+        line(0, "<ArrayOfProfile", format_.root_attributes, " />");
+    if (format_.final_newline)
+        pending_ += format_.crlf ? "\r\n" : "\n";
+    flush();
+}
+
+void write_nip(const NipFile& nip, std::string& out)
+{
+    NipWriter w(nip.format, out);
+    for (size_t p = 0; p < nip.profile_count(); ++p) {
+        w.begin_profile(nip.profile_name[p], nip.exes.data() + nip.exe_begin[p],
+                        nip.exe_begin[p + 1] - nip.exe_begin[p]);
+        for (uint32_t i = nip.setting_begin[p]; i < nip.setting_begin[p + 1]; ++i)
+            w.setting(nip.name_info[i], nip.setting_id[i], nip.setting_value[i], nip.value_type[i]);
+        w.end_profile();
+    }
+    w.finish();
+}
+
+void xml_escape(std::string_view text, std::string& out)
+{
+    for (char c : text) {
+        switch (c) {
+        case '&': out += "&amp;"; break;
+        case '<': out += "&lt;"; break;
+        case '>': out += "&gt;"; break;
+        default:  out += c; break;
+        }
+    }
+}
+
+bool xml_unescape(std::string_view text, std::string& out)
+{
+    for (size_t i = 0; i < text.size();) {
+        size_t amp = nvtools::find_byte(text, '&', i);
+        out += text.substr(i, amp == std::string_view::npos ? std::string_view::npos : amp - i);
+        if (amp == std::string_view::npos)
+            return true;
+        size_t semi = text.find(';', amp);
+        if (semi == std::string_view::npos)
+            return false;
+        std::string_view e = text.substr(amp + 1, semi - amp - 1);
+        if (e == "amp")
+            out += '&';
+        else if (e == "lt")
+            out += '<';
+        else if (e == "gt")
+            out += '>';
+        else if (e == "quot")
+            out += '"';
+        else if (e == "apos")
+            out += '\'';
+        else if (e.size() > 1 && e[0] == '#') {
+            bool hex = e[1] == 'x' || e[1] == 'X';
+            uint32_t cp = 0;
+            std::string_view digits = e.substr(hex ? 2 : 1);
+            if (digits.empty() || digits.size() > 6)
+                return false;
+            for (char c : digits) {
+                int d = c >= '0' && c <= '9' ? c - '0'
+                    : hex && c >= 'a' && c <= 'f' ? c - 'a' + 10
+                    : hex && c >= 'A' && c <= 'F' ? c - 'A' + 10 : -1;
+                if (d < 0)
+                    return false;
+                cp = cp * (hex ? 16 : 10) + uint32_t(d);
+            }
+            if (cp == 0 || cp > 0x10ffff)
+                return false;
+            if (cp < 0x80) {
+                out += char(cp);
+            } else if (cp < 0x800) {
+                out += char(0xc0 | cp >> 6);
+                out += char(0x80 | (cp & 0x3f));
+            } else if (cp < 0x10000) {
+                out += char(0xe0 | cp >> 12);
+                out += char(0x80 | (cp >> 6 & 0x3f));
+                out += char(0x80 | (cp & 0x3f));
+            } else {
+                out += char(0xf0 | cp >> 18);
+                out += char(0x80 | (cp >> 12 & 0x3f));
+                out += char(0x80 | (cp >> 6 & 0x3f));
+                out += char(0x80 | (cp & 0x3f));
+            }
+        } else {
+            return false;
+        }
+        i = semi + 1;
+    }
+    return true;
+}
+
+const char* encoding_name(NipEncoding encoding)
+{
+    return encoding == NipEncoding::Utf16Le ? "UTF-16LE" : "UTF-8";
+}
+
+} // namespace nvapi
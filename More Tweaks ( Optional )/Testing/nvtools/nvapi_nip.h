@@ -0,0 +1,132 @@
+// nvapi_nip.h
+//
+// nvidiaProfileInspector's .nip profile exports, read without building a
+// DOM. NPI writes them with .NET's XmlSerializer, always in this layout:
+//
+//   <?xml version="1.0" encoding="utf-16"?>
+//   <ArrayOfProfile>
+//     <Profile>
+//       <ProfileName>Base Profile</ProfileName>
+//       <Executeables />                        <- or <string>game.exe</string> lines
+//       <Settings>
+//         <ProfileSetting>
+//           <SettingNameInfo />
+//           <SettingID>390417</SettingID>
+//           <SettingValue>929060917</SettingValue>
+//           <ValueType>Dword</ValueType>
+//         </ProfileSetting>
+//         ...
+//
+// NPI saves UTF-16LE with a BOM and CRLF lines. The copies in this repo were
+// re-saved as UTF-8 with a BOM and LF lines, declaration unchanged.
+// read_nip() takes either: UTF-16 is transcoded (utf16.h) into
+// NipFile::text, UTF-8 is read in place. The fields go straight into flat
+// per-setting arrays, profile by profile. Every string is a view into the
+// UTF-8 text, still XML-escaped; xml_unescape() gives the plain text and
+// xml_escape() makes text to write.
+//
+// NipWriter writes the same layout one profile at a time in a NipFormat's
+// encoding, line ends and declaration, and write_nip() writes a whole
+// NipFile with it. A file XmlSerializer wrote comes back byte for byte.
+
+#ifndef NVTOOLS_NVAPI_NIP_H
+#define NVTOOLS_NVAPI_NIP_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace nvapi {
+
+enum class NipEncoding : uint8_t {
+    Utf8,
+    Utf16Le,
+};
+
+// How a file is written. The defaults are NPI's own.
+struct NipFormat {
+    NipEncoding encoding = NipEncoding::Utf16Le;
+    bool bom = true;
+    bool crlf = true;
+    bool final_newline = false;
+    std::string declaration = "<?xml version=\"1.0\" encoding=\"utf-16\"?>";   // empty for none
+    std::string root_attributes;    // of <ArrayOfProfile>, with the leading space
+};
+
+struct NipFile {
+    NipFormat format;
+    std::string text;           // the file as UTF-8, if it had to be transcoded
+
+    // Per profile. exe_begin and setting_begin have one more entry, so
+    // profile p has exes [exe_begin[p], exe_begin[p + 1]) and likewise
+    // settings.
+    std::vector<std::string_view> profile_name;
+    std::vector<uint32_t> exe_begin;
+    std::vector<uint32_t> setting_begin;
+    std::vector<std::string_view> exes;
+
+    // Per setting.
+    std::vector<std::string_view> name_info;    // SettingNameInfo, often empty
+    std::vector<uint32_t> setting_id;
+    std::vector<std::string_view> setting_value;
+    std::vector<std::string_view> value_type;   // "Dword", "Binary", "String"
+
+    size_t profile_count() const { return profile_name.size(); }
+    size_t setting_count() const { return setting_id.size(); }
+};
+
+// Source must outlive out when it is UTF-8, as out's views point into it.
+// False, with the line, if source is not a .nip in the layout above.
+bool read_nip(std::string_view source, NipFile& out, std::string* why = nullptr);
+
+class NipWriter {
+public:
+    // Bytes are appended to out in the format's encoding. After
+    // end_profile() out holds only whole profiles, so it can be written
+    // out and cleared there.
+    NipWriter(const NipFormat& format, std::string& out) : format_(format), out_(out) {}
+
+    // Text is written as given, so it must already be escaped.
+    void begin_profile(std::string_view name, const std::string_view* exes, size_t exe_count);
+    void setting(std::string_view name_info, uint32_t id, std::string_view value, std::string_view type);
+    void end_profile();
+    void finish();
+
+    // For settings many profiles share. A renderer takes only setting()
+    // calls, and take_rendered() then gives the <Settings> text they made.
+    // settings_text() writes that into the current profile of any writer
+    // with the same format, in place of the setting() calls. Nothing is
+    // appended to the renderer's out.
+    static NipWriter renderer(const NipFormat& format, std::string& out);
+    std::string take_rendered();
+    void settings_text(std::string_view rendered);
+
+private:
+    void start();
+    void line(int depth, std::string_view a, std::string_view b = {}, std::string_view c = {});
+    void element(int depth, std::string_view tag, std::string_view text);
+    void flush();
+
+    const NipFormat& format_;
+    std::string& out_;
+    std::string pending_;       // UTF-8 not yet in out_
+    bool started_ = false;
+    bool first_line_ = true;
+    bool any_profile_ = false;
+    bool any_setting_ = false;
+};
+
+void write_nip(const NipFile& nip, std::string& out);
+
+void xml_escape(std::string_view text, std::string& out);
+
+// The five named entities and &#...; references. False if text has any
+// other '&'.
+bool xml_unescape(std::string_view text, std::string& out);
+
+const char* encoding_name(NipEncoding encoding);
+
+} // namespace nvapi
+
+#endif // NVTOOLS_NVAPI_NIP_H
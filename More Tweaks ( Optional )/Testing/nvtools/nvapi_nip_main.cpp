@@ -0,0 +1,127 @@
+// nvapi_nip_main.cpp
+//
+//   nvapi_nip stats <file.nip...>
+//   nvapi_nip list <file.nip>
+//   nvapi_nip roundtrip <file.nip...>
+//   nvapi_nip convert <in.nip> <out.nip> utf8|utf16
+//
+// stats prints each file's encoding and counts. list prints one
+// tab-separated line per setting: profile, SettingID in hex, ValueType,
+// SettingValue and SettingNameInfo, the text unescaped. roundtrip reads and
+// writes each file again and exits with 1 if any does not come back byte
+// for byte. convert rewrites a file in the other encoding: utf16 is what NPI
+// itself saves (BOM, CRLF), utf8 what this repo keeps (BOM, LF).
+
+#include "mapped_file.h"
+#include "nvapi_nip.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+namespace {
+
+bool load(const char* path, nvtools::MappedFile& f, nvapi::NipFile& nip)
+{
+    if (!f.open(path)) {
+        std::fprintf(stderr, "error: cannot read %s\n", path);
+        return false;
+    }
+    std::string why;
+    if (!nvapi::read_nip(f.view(), nip, &why)) {
+        std::fprintf(stderr, "error: %s: %s\n", path, why.c_str());
+        return false;
+    }
+    return true;
+}
+
+std::string plain(std::string_view text)
+{
+    std::string out;
+    if (!nvapi::xml_unescape(text, out))
+        return std::string(text);
+    return out;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const char* cmd = argc > 1 ? argv[1] : "";
+    bool ok_args = ((std::strcmp(cmd, "stats") == 0 || std::strcmp(cmd, "roundtrip") == 0) && argc >= 3)
+        || (std::strcmp(cmd, "list") == 0 && argc == 3)
+        || (std::strcmp(cmd, "convert") == 0 && argc == 5
+            && (std::strcmp(argv[4], "utf8") == 0 || std::strcmp(argv[4], "utf16") == 0));
+    if (!ok_args) {
+        std::fprintf(stderr, "usage: nvapi_nip stats|roundtrip <file.nip...>\n"
+                             "       nvapi_nip list <file.nip>\n"
+                             "       nvapi_nip convert <in.nip> <out.nip> utf8|utf16\n");
+        return 2;
+    }
+
+    if (std::strcmp(cmd, "convert") == 0) {
+        nvtools::MappedFile f;
+        nvapi::NipFile nip;
+        if (!load(argv[2], f, nip))
+            return 1;
+        bool utf16 = std::strcmp(argv[4], "utf16") == 0;
+        nip.format.encoding = utf16 ? nvapi::NipEncoding::Utf16Le : nvapi::NipEncoding::Utf8;
+        nip.format.bom = true;
+        nip.format.crlf = utf16;
+        nip.format.final_newline = !utf16;
+        std::string out;
+        nvapi::write_nip(nip, out);
+        FILE* o = std::fopen(argv[3], "wb");
+        bool ok = o && std::fwrite(out.data(), 1, out.size(), o) == out.size();
+        if (o)
+            ok = std::fclose(o) == 0 && ok;
+        if (!ok) {
+            std::fprintf(stderr, "error: cannot write %s\n", argv[3]);
+            return 1;
+        }
+        return 0;
+    }
+
+    if (std::strcmp(cmd, "list") == 0) {
+        nvtools::MappedFile f;
+        nvapi::NipFile nip;
+        if (!load(argv[2], f, nip))
+            return 1;
+        for (size_t p = 0; p < nip.profile_count(); ++p) {
+            std::string profile = plain(nip.profile_name[p]);
+            for (uint32_t i = nip.setting_begin[p]; i < nip.setting_begin[p + 1]; ++i)
+                std::printf("%s\t0x%08x\t%.*s\t%s\t%s\n", profile.c_str(), nip.setting_id[i],
+                            int(nip.value_type[i].size()), nip.value_type[i].data(),
+                            plain(nip.setting_value[i]).c_str(), plain(nip.name_info[i]).c_str());
+        }
+        return 0;
+    }
+
+    int status = 0;
+    for (int a = 2; a < argc; ++a) {
+        nvtools::MappedFile f;
+        nvapi::NipFile nip;
+        if (!load(argv[a], f, nip)) {
+            status = 1;
+            continue;
+        }
+        if (std::strcmp(cmd, "stats") == 0) {
+            std::printf("%s: %s%s, %s, %zu profiles, %zu executables, %zu settings\n", argv[a],
+                        nvapi::encoding_name(nip.format.encoding), nip.format.bom ? " with BOM" : "",
+                        nip.format.crlf ? "CRLF" : "LF", nip.profile_count(), nip.exes.size(), nip.setting_count());
+            continue;
+        }
+        std::string out;
+        nvapi::write_nip(nip, out);
+        if (out != f.view()) {
+            size_t at = 0;
+            while (at < out.size() && at < f.size() && out[at] == f.data()[at])
+                ++at;
+            std::printf("%s: differs from byte %zu\n", argv[a], at);
+            status = 1;
+        } else {
+            std::printf("%s: same %zu bytes\n", argv[a], out.size());
+        }
+    }
+    return status;
+}
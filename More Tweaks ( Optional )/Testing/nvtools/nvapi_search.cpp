@@ -0,0 +1,274 @@
+// nvapi_search.cpp
+
+#include "nvapi_search.h"
+
+#include "text_util.h"
+
+#include <algorithm>
+#include <map>
+
+namespace nvapi {
+
+namespace {
+
+constexpr uint32_t kGramBuckets = 1u << 13;
+constexpr size_t kMaxFuzzyLength = 32;
+
+using nvtools::fold;
+
+bool is_word_char(char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9');
+}
+
+// Lower-cased runs of letters and digits.
+template <class Fn>
+void for_each_word(std::string_view text, Fn fn)
+{
+    std::string word;
+    for (size_t i = 0; i <= text.size(); ++i) {
+        if (i < text.size() && is_word_char(text[i])) {
+            word += fold(text[i]);
+        } else if (!word.empty()) {
+            fn(word);
+            word.clear();
+        }
+    }
+}
+
+// Trigrams of "^word$", hashed into a bucket.
+template <class Fn>
+void for_each_gram(std::string_view word, Fn fn)
+{
+    auto at = [&](size_t i) { return i == 0 ? '^' : i == word.size() + 1 ? '$' : word[i - 1]; };
+    for (size_t i = 0; i + 3 <= word.size() + 2; ++i) {
+        uint32_t h = (uint32_t(uint8_t(at(i))) * 31 + uint8_t(at(i + 1))) * 31 + uint8_t(at(i + 2));
+        fn((h * 2654435761u) >> 19);
+    }
+}
+
+} // namespace
+
+SearchIndex SearchIndex::build(const std::vector<Section>& sections)
+{
+    SearchIndex idx;
+    idx.section_count_ = uint32_t(sections.size());
+
+    for (const Section& s : sections) {
+        idx.name_begin_.push_back(uint32_t(idx.name_text_.size()));
+        for (char c : s.name)
+            idx.name_text_ += fold(c);
+    }
+    idx.name_begin_.push_back(uint32_t(idx.name_text_.size()));
+
+    idx.sorted_.resize(sections.size());
+    for (uint32_t i = 0; i < sections.size(); ++i)
+        idx.sorted_[i] = i;
+    std::stable_sort(idx.sorted_.begin(), idx.sorted_.end(), [&](uint32_t a, uint32_t b) {
+        return std::string_view(idx.name_text_).substr(idx.name_begin_[a], idx.name_begin_[a + 1] - idx.name_begin_[a])
+            < std::string_view(idx.name_text_).substr(idx.name_begin_[b], idx.name_begin_[b + 1] - idx.name_begin_[b]);
+    });
+    idx.nodes_.push_back({0, 0, 0, 0, 0, 0});
+    if (!sections.empty())
+        idx.build_node(0, 0, uint32_t(sections.size()), 0);
+
+    // Terms: every word of every name and description, with the sections
+    // that have it.
+    std::map<std::string, std::vector<uint32_t>> words;
+    for (uint32_t i = 0; i < sections.size(); ++i) {
+        for_each_word(sections[i].name, [&](const std::string& w) {
+            std::vector<uint32_t>& p = words[w];
+            if (p.empty() || p.back() != (i << 1 | 1))
+                p.push_back(i << 1 | 1);
+        });
+        for_each_word(sections[i].description, [&](const std::string& w) {
+            if (w.size() < 2)
+                return;
+            std::vector<uint32_t>& p = words[w];
+            if (p.empty() || (p.back() >> 1) != i)
+                p.push_back(i << 1);
+        });
+    }
+    for (const auto& [w, p] : words) {
+        idx.terms_.push_back({uint32_t(idx.term_text_.size()), uint32_t(w.size()),
+                              uint32_t(idx.postings_.size()), uint32_t(p.size())});
+        idx.term_text_ += w;
+        idx.postings_.insert(idx.postings_.end(), p.begin(), p.end());
+    }
+
+    // Trigram buckets -> terms, as one flat array.
+    std::vector<std::vector<uint32_t>> buckets(kGramBuckets);
+    for (uint32_t t = 0; t < idx.terms_.size(); ++t) {
+        std::string_view w = idx.term(t);
+        if (w.size() > kMaxFuzzyLength)
+            continue;
+        for_each_gram(w, [&](uint32_t b) {
+            if (buckets[b].empty() || buckets[b].back() != t)
+                buckets[b].push_back(t);
+        });
+    }
+    idx.gram_begin_.reserve(kGramBuckets + 1);
+    for (const std::vector<uint32_t>& b : buckets) {
+        idx.gram_begin_.push_back(uint32_t(idx.gram_terms_.size()));
+        idx.gram_terms_.insert(idx.gram_terms_.end(), b.begin(), b.end());
+    }
+    idx.gram_begin_.push_back(uint32_t(idx.gram_terms_.size()));
+    return idx;
+}
+
+// Fills nodes_[at] for the names in sorted_[lo, hi), which agree on their
+// first depth characters. The label runs to where they stop agreeing, and
+// the children are laid out as one block so a node only needs the first.
+void SearchIndex::build_node(uint32_t at, uint32_t lo, uint32_t hi, uint32_t depth)
+{
+    std::string_view first = name(lo), last = name(hi - 1);
+    uint32_t end = depth;
+    while (end < first.size() && end < last.size() && first[end] == last[end])
+        ++end;
+    nodes_[at] = {name_begin_[sorted_[lo]] + depth, end - depth, 0, 0, lo, hi};
+
+    std::vector<std::pair<uint32_t, uint32_t>> groups;
+    uint32_t i = lo;
+    while (i < hi && name(i).size() == end)
+        ++i;                    // a name that ends here sorts first
+    while (i < hi) {
+        uint32_t next = i + 1;
+        while (next < hi && name(next)[end] == name(i)[end])
+            ++next;
+        groups.emplace_back(i, next);
+        i = next;
+    }
+    if (groups.empty())
+        return;
+    uint32_t block = uint32_t(nodes_.size());
+    nodes_.resize(nodes_.size() + groups.size());
+    nodes_[at].first_child = block;
+    nodes_[at].child_count = uint32_t(groups.size());
+    for (size_t g = 0; g < groups.size(); ++g)
+        build_node(block + uint32_t(g), groups[g].first, groups[g].second, end);
+}
+
+std::string_view SearchIndex::name(uint32_t sorted) const
+{
+    uint32_t s = sorted_[sorted];
+    return std::string_view(name_text_).substr(name_begin_[s], name_begin_[s + 1] - name_begin_[s]);
+}
+
+std::string_view SearchIndex::term(uint32_t t) const
+{
+    return std::string_view(term_text_).substr(terms_[t].text_begin, terms_[t].text_length);
+}
+
+void SearchIndex::complete(std::string_view prefix, size_t limit, std::vector<uint32_t>& out) const
+{
+    out.clear();
+    if (section_count_ == 0)
+        return;
+    const Node* n = &nodes_[0];
+    size_t matched = 0;
+    for (;;) {
+        for (uint32_t k = 0; k < n->label_length && matched < prefix.size(); ++k, ++matched)
+            if (name_text_[n->label_begin + k] != fold(prefix[matched]))
+                return;
+        if (matched == prefix.size())
+            break;
+        const Node* next = nullptr;
+        for (uint32_t c = 0; c < n->child_count && !next; ++c) {
+            const Node& child = nodes_[n->first_child + c];
+            if (name_text_[child.label_begin] == fold(prefix[matched]))
+                next = &child;
+        }
+        if (!next)
+            return;
+        n = next;
+    }
+    for (uint32_t i = n->lo; i < n->hi && out.size() < limit; ++i)
+        out.push_back(sorted_[i]);
+}
+
+void SearchIndex::search(std::string_view query, size_t limit, std::vector<SearchHit>& out) const
+{
+    out.clear();
+    std::vector<std::string> words;
+    for_each_word(query, [&](const std::string& w) { words.push_back(w); });
+    if (words.empty())
+        return;
+
+    std::vector<uint32_t> score(section_count_, 0);
+    std::vector<uint32_t> matched(section_count_, 0);   // words matched so far
+    std::vector<uint8_t> word_score(section_count_, 0);
+    std::vector<uint32_t> touched;
+    std::vector<uint16_t> shared;
+
+    auto add = [&](uint32_t t, uint8_t in_name, uint8_t in_description) {
+        const Term& term = terms_[t];
+        for (uint32_t k = 0; k < term.posting_count; ++k) {
+            uint32_t p = postings_[term.posting_begin + k];
+            uint32_t s = p >> 1;
+            uint8_t v = p & 1 ? in_name : in_description;
+            if (!word_score[s])
+                touched.push_back(s);
+            word_score[s] = std::max(word_score[s], v);
+        }
+    };
+
+    for (uint32_t j = 0; j < words.size(); ++j) {
+        const std::string& w = words[j];
+        touched.clear();
+        // Exact and prefix matches: the sorted terms from w on.
+        auto less = [&](const Term& t, const std::string& key) {
+            return std::string_view(term_text_).substr(t.text_begin, t.text_length) < key;
+        };
+        uint32_t t = uint32_t(std::lower_bound(terms_.begin(), terms_.end(), w, less) - terms_.begin());
+        bool any = false;
+        for (; t < terms_.size() && term(t).substr(0, w.size()) == w; ++t) {
+            bool exact = term(t).size() == w.size();
+            add(t, exact ? 8 : 3, exact ? 4 : 2);
+            any = true;
+        }
+        if (!any && w.size() >= 3 && w.size() <= kMaxFuzzyLength) {
+            uint32_t max_edits = w.size() < 6 ? 1 : 2;
+            uint32_t grams = 0;
+            shared.assign(terms_.size(), 0);
+            std::vector<uint32_t> candidates;
+            for_each_gram(w, [&](uint32_t b) {
+                ++grams;
+                for (uint32_t k = gram_begin_[b]; k < gram_begin_[b + 1]; ++k)
+                    if (shared[gram_terms_[k]]++ == 0)
+                        candidates.push_back(gram_terms_[k]);
+            });
+            // An edit breaks at most three trigrams, a transposition four.
+            uint32_t need = grams > 4 * max_edits ? grams - 4 * max_edits : 1;
+            for (uint32_t c : candidates) {
+                std::string_view cand = term(c);
+                if (shared[c] < need || cand.size() + max_edits < w.size() || w.size() + max_edits < cand.size())
+                    continue;
+                uint32_t d = uint32_t(nvtools::edit_distance(w, cand, max_edits));
+                if (d <= max_edits)
+                    add(c, d == 1 ? 4 : 2, d == 1 ? 3 : 1);
+            }
+        }
+        for (uint32_t s : touched) {
+            if (matched[s] == j) {
+                matched[s] = j + 1;
+                score[s] += word_score[s];
+            }
+            word_score[s] = 0;
+        }
+    }
+
+    for (uint32_t s = 0; s < section_count_; ++s)
+        if (matched[s] == words.size())
+            out.push_back({s, score[s]});
+    auto better = [](const SearchHit& a, const SearchHit& b) {
+        return a.score != b.score ? a.score > b.score : a.section < b.section;
+    };
+    if (out.size() > limit) {
+        std::partial_sort(out.begin(), out.begin() + limit, out.end(), better);
+        out.resize(limit);
+    } else {
+        std::sort(out.begin(), out.end(), better);
+    }
+}
+
+} // namespace nvapi
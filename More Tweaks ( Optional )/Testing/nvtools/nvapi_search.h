@@ -0,0 +1,85 @@
+// nvapi_search.h
+//
+// Search over the settings of a dump, fast enough to run on every keystroke
+// of a browser's search box:
+//
+//   nvapi::SearchIndex idx = nvapi::SearchIndex::build(dump.sections);
+//   idx.complete("AA MODE", 20, ids);        // names starting with "AA MODE"
+//   idx.search("stuter pstate", 20, hits);   // words, with typos
+//
+// complete() walks a compressed trie of the case-folded names, so it costs
+// the length of the prefix plus the names it returns. search() splits the
+// query into words and keeps the settings that match all of them, each in
+// the name or the description. A word matches a term exactly, as a prefix
+// (the word being typed), or, when neither finds anything, within one or
+// two edits; the typo candidates come from a trigram index over the terms.
+// Indices are positions in the vector the index was built from. The index
+// copies what it needs and does not point into the sections.
+
+#ifndef NVTOOLS_NVAPI_SEARCH_H
+#define NVTOOLS_NVAPI_SEARCH_H
+
+#include "nvapi_dump.h"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace nvapi {
+
+struct SearchHit {
+    uint32_t section;
+    uint32_t score;             // higher is better
+};
+
+class SearchIndex {
+public:
+    static SearchIndex build(const std::vector<Section>& sections);
+
+    // Sections whose name starts with prefix (any case), in name order, at
+    // most limit of them.
+    void complete(std::string_view prefix, size_t limit, std::vector<uint32_t>& out) const;
+
+    // Best first; ties in dump order.
+    void search(std::string_view query, size_t limit, std::vector<SearchHit>& out) const;
+
+    size_t term_count() const { return terms_.size(); }
+
+private:
+    // Edge labels are ranges of the sorted, folded name of the node's first
+    // entry; a node covers sorted_[lo, hi).
+    struct Node {
+        uint32_t label_begin;
+        uint32_t label_length;
+        uint32_t first_child;
+        uint32_t child_count;
+        uint32_t lo, hi;
+    };
+    struct Term {
+        uint32_t text_begin;    // into term_text_
+        uint32_t text_length;
+        uint32_t posting_begin; // into postings_
+        uint32_t posting_count;
+    };
+
+    void build_node(uint32_t at, uint32_t lo, uint32_t hi, uint32_t depth);
+    std::string_view name(uint32_t sorted) const;
+    std::string_view term(uint32_t t) const;
+
+    std::string name_text_;             // folded names, in dump order
+    std::vector<uint32_t> name_begin_;  // per section, plus one past the end
+    std::vector<uint32_t> sorted_;      // sections by folded name
+    std::vector<Node> nodes_;           // nodes_[0] is the root
+
+    std::string term_text_;
+    std::vector<Term> terms_;           // sorted, for prefix ranges
+    std::vector<uint32_t> postings_;    // section << 1 | 1 if the term is in the name
+    std::vector<uint32_t> gram_begin_;  // trigram hash -> range of gram_terms_
+    std::vector<uint32_t> gram_terms_;
+    uint32_t section_count_ = 0;
+};
+
+} // namespace nvapi
+
+#endif // NVTOOLS_NVAPI_SEARCH_H
@@ -0,0 +1,493 @@
+// nvapi_snapshot.cpp
+
+#include "nvapi_snapshot.h"
+
+#include "text_util.h"
+
+#include <cstdio>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+namespace nvapi {
+
+struct Snapshot::Ref {
+    uint32_t offset;            // into the string table
+    uint32_t length;
+};
+
+namespace {
+
+using Ref = Snapshot::Ref;
+using ValueUse = Snapshot::ValueUse;
+
+enum Table : int {
+    kSections,
+    kEnums,
+    kBitfields,
+    kDefaults,
+    kMatches,
+    kHash,
+    kStrings,
+    kValueSlots,
+    kValueUses,
+    kTables,
+};
+
+enum Flag : uint8_t {
+    kFlagBitfields = 1,
+    kFlagNamesOnly = 2,
+};
+
+struct SectionEntry {
+    Ref name;
+    Ref condition;
+    Ref description;
+    uint8_t type;
+    uint8_t availability;
+    uint8_t assignment;
+    uint8_t flags;
+    uint32_t source_offset;
+    uint32_t symbol_begin;      // into kEnums or kBitfields
+    uint32_t symbol_count;
+    uint32_t default_begin;
+    uint32_t default_count;
+};
+static_assert(sizeof(SectionEntry) == 48, "SectionEntry layout is part of the format");
+
+struct SymbolEntry {
+    Ref name;
+    Ref value;
+    Ref comment;
+    uint32_t has_number;
+    uint32_t reserved;
+    uint64_t number;
+};
+static_assert(sizeof(SymbolEntry) == 40, "SymbolEntry layout is part of the format");
+
+struct DefaultEntry {
+    Ref label;
+    Ref value;
+    uint32_t match_begin;
+    uint32_t match_count;
+};
+static_assert(sizeof(DefaultEntry) == 24, "DefaultEntry layout is part of the format");
+
+// One distinct enum value; its uses are kValueUses[begin, begin + count).
+struct ValueSlot {
+    uint64_t value;
+    uint32_t begin;
+    uint32_t count;             // 0 is an empty slot
+};
+static_assert(sizeof(ValueSlot) == 16, "ValueSlot layout is part of the format");
+static_assert(sizeof(Snapshot::ValueUse) == 8, "ValueUse layout is part of the format");
+
+constexpr char kMagic[8] = {'N', 'V', 'S', 'N', 'A', 'P', '\0', '\0'};
+constexpr uint32_t kVersion = 3;
+
+struct FileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t table_count;
+    uint32_t section_count;
+    uint32_t enum_count;
+    uint32_t bitfield_count;
+    uint32_t default_count;
+    uint32_t match_count;
+    uint32_t hash_slots;        // a power of two
+    uint32_t value_slots;       // a power of two
+    uint32_t value_use_count;
+    uint64_t source_size;
+    uint64_t source_hash;
+    uint64_t offsets[10];
+    uint64_t sizes[10];         // bytes
+};
+static_assert(sizeof(FileHeader) == 224, "FileHeader layout is part of the format");
+
+using nvtools::fold;
+using nvtools::iequals;
+
+uint32_t name_hash(std::string_view s)
+{
+    uint32_t h = 2166136261u;
+    for (char c : s)
+        h = (h ^ uint8_t(fold(c))) * 16777619u;
+    return h;
+}
+
+uint32_t value_hash(uint64_t v)
+{
+    return uint32_t((v * 0x9e3779b97f4a7c15ull) >> 32);
+}
+
+uint64_t fnv1a64(std::string_view s)
+{
+    uint64_t h = 14695981039346656037ull;
+    for (char c : s)
+        h = (h ^ uint8_t(c)) * 1099511628211ull;
+    return h;
+}
+
+class TableWriter {
+public:
+    TableWriter() : buf_(sizeof(FileHeader), '\0') {}
+
+    template <class T>
+    void put(Table t, const std::vector<T>& v)
+    {
+        while (buf_.size() % 8)
+            buf_ += '\0';
+        header_.offsets[t] = buf_.size();
+        header_.sizes[t] = v.size() * sizeof(T);
+        if (!v.empty())
+            buf_.append(reinterpret_cast<const char*>(v.data()), v.size() * sizeof(T));
+    }
+
+    FileHeader& header() { return header_; }
+
+    bool save(const char* path)
+    {
+        std::memcpy(header_.magic, kMagic, sizeof kMagic);
+        header_.version = kVersion;
+        header_.table_count = kTables;
+        std::memcpy(&buf_[0], &header_, sizeof header_);
+        FILE* f = std::fopen(path, "wb");
+        if (!f)
+            return false;
+        bool ok = std::fwrite(buf_.data(), 1, buf_.size(), f) == buf_.size();
+        return std::fclose(f) == 0 && ok;
+    }
+
+private:
+    std::string buf_;
+    FileHeader header_ = {};
+};
+
+// Each distinct string goes into the table once; the dump repeats a lot of
+// comments ("D3D only") and values.
+class StringPool {
+public:
+    Ref add(std::string_view s)
+    {
+        auto it = seen_.find(s);
+        if (it != seen_.end())
+            return it->second;
+        Ref r{uint32_t(chars_.size()), uint32_t(s.size())};
+        chars_.insert(chars_.end(), s.begin(), s.end());
+        seen_.emplace(s, r);
+        return r;
+    }
+    const std::vector<char>& chars() const { return chars_; }
+
+private:
+    std::vector<char> chars_;
+    std::unordered_map<std::string_view, Ref> seen_;
+};
+
+} // namespace
+
+bool write_snapshot(const char* path, const Dump& dump)
+{
+    StringPool pool;
+    std::vector<SectionEntry> sections;
+    std::vector<SymbolEntry> enums, bitfields;
+    std::vector<DefaultEntry> defaults;
+    std::vector<Ref> matches;
+    sections.reserve(dump.sections.size());
+
+    for (const Section& s : dump.sections) {
+        std::vector<SymbolEntry>& symbols = s.bitfields ? bitfields : enums;
+        SectionEntry e = {};
+        e.name = pool.add(s.name);
+        e.condition = pool.add(s.condition);
+        e.description = pool.add(s.description);
+        e.type = uint8_t(s.type);
+        e.availability = uint8_t(s.availability);
+        e.assignment = uint8_t(s.assignment);
+        e.flags = uint8_t((s.bitfields ? kFlagBitfields : 0) | (s.names_only ? kFlagNamesOnly : 0));
+        e.source_offset = s.offset;
+        e.symbol_begin = uint32_t(symbols.size());
+        e.symbol_count = s.symbol_count;
+        e.default_begin = uint32_t(defaults.size());
+        e.default_count = s.default_count;
+        for (uint32_t i = 0; i < s.symbol_count; ++i) {
+            const Symbol& sym = dump.symbols_of(s)[i];
+            std::optional<uint64_t> n = parse_number(sym.value);
+            symbols.push_back({pool.add(sym.name), pool.add(sym.value), pool.add(sym.comment),
+                               n ? 1u : 0u, 0, n.value_or(0)});
+        }
+        for (uint32_t i = 0; i < s.default_count; ++i) {
+            const Default& d = dump.defaults_of(s)[i];
+            defaults.push_back({pool.add(d.label), pool.add(d.value), uint32_t(matches.size()), d.match_count});
+            for (uint32_t j = 0; j < d.match_count; ++j)
+                matches.push_back(pool.add(dump.matches_of(d)[j]));
+        }
+        sections.push_back(e);
+    }
+
+    // At most half full, so probes stay short.
+    uint32_t slots = 8;
+    while (slots < sections.size() * 2)
+        slots *= 2;
+    std::vector<uint32_t> hash(slots, 0);
+    for (uint32_t i = 0; i < dump.sections.size(); ++i) {
+        uint32_t h = name_hash(dump.sections[i].name) & (slots - 1);
+        while (hash[h])
+            h = (h + 1) & (slots - 1);
+        hash[h] = i + 1;        // 0 is an empty slot
+    }
+
+    // The reverse index: every distinct enum value to the symbols that use
+    // it, uses in dump order. Bitfield symbols are left out, their small
+    // flag values would only bury the magic constants.
+    std::unordered_map<uint64_t, std::vector<ValueUse>> by_value;
+    std::vector<uint64_t> order;        // first use of each value, for a stable file
+    for (uint32_t i = 0; i < dump.sections.size(); ++i) {
+        const Section& s = dump.sections[i];
+        if (s.bitfields)
+            continue;
+        for (uint32_t k = 0; k < s.symbol_count; ++k) {
+            std::optional<uint64_t> n = parse_number(dump.symbols_of(s)[k].value);
+            if (!n)
+                continue;
+            std::vector<ValueUse>& uses = by_value[*n];
+            if (uses.empty())
+                order.push_back(*n);
+            uses.push_back({i, k});
+        }
+    }
+    uint32_t value_slots = 8;
+    while (value_slots < order.size() * 2)
+        value_slots *= 2;
+    std::vector<ValueSlot> values(value_slots, ValueSlot{0, 0, 0});
+    std::vector<ValueUse> value_uses;
+    for (uint64_t v : order) {
+        const std::vector<ValueUse>& uses = by_value[v];
+        uint32_t h = value_hash(v) & (value_slots - 1);
+        while (values[h].count)
+            h = (h + 1) & (value_slots - 1);
+        values[h] = {v, uint32_t(value_uses.size()), uint32_t(uses.size())};
+        value_uses.insert(value_uses.end(), uses.begin(), uses.end());
+    }
+
+    TableWriter w;
+    w.put(kSections, sections);
+    w.put(kEnums, enums);
+    w.put(kBitfields, bitfields);
+    w.put(kDefaults, defaults);
+    w.put(kMatches, matches);
+    w.put(kHash, hash);
+    w.put(kStrings, pool.chars());
+    w.put(kValueSlots, values);
+    w.put(kValueUses, value_uses);
+    FileHeader& h = w.header();
+    h.section_count = uint32_t(sections.size());
+    h.enum_count = uint32_t(enums.size());
+    h.bitfield_count = uint32_t(bitfields.size());
+    h.default_count = uint32_t(defaults.size());
+    h.match_count = uint32_t(matches.size());
+    h.hash_slots = slots;
+    h.value_slots = value_slots;
+    h.value_use_count = uint32_t(value_uses.size());
+    h.source_size = dump.source.size();
+    h.source_hash = fnv1a64(dump.source);
+    return w.save(path);
+}
+
+bool Snapshot::open(const char* path, std::string* why)
+{
+    auto fail = [&](const char* reason) {
+        if (why)
+            *why = reason;
+        section_count_ = 0;
+        file_.close();
+        return false;
+    };
+    section_count_ = 0;
+    if (!file_.open(path))
+        return fail("cannot read the file");
+    if (file_.size() < sizeof(FileHeader))
+        return fail("too short for a snapshot");
+    FileHeader h;
+    std::memcpy(&h, file_.data(), sizeof h);
+    if (std::memcmp(h.magic, kMagic, sizeof kMagic) != 0)
+        return fail("not a snapshot");
+    if (h.version != kVersion || h.table_count != kTables)
+        return fail("snapshot version not supported, rebuild it");
+    if (h.hash_slots < 8 || (h.hash_slots & (h.hash_slots - 1)) || h.hash_slots < uint64_t(h.section_count) * 2)
+        return fail("bad hash table size");
+    if (h.value_slots < 8 || (h.value_slots & (h.value_slots - 1)))
+        return fail("bad value table size");
+
+    const uint64_t counts[kTables] = {h.section_count, h.enum_count, h.bitfield_count, h.default_count,
+                                      h.match_count, h.hash_slots, h.sizes[kStrings], h.value_slots,
+                                      h.value_use_count};
+    static constexpr uint64_t kWidth[kTables] = {sizeof(SectionEntry), sizeof(SymbolEntry), sizeof(SymbolEntry),
+                                                 sizeof(DefaultEntry), sizeof(Ref), sizeof(uint32_t), 1,
+                                                 sizeof(ValueSlot), sizeof(ValueUse)};
+    for (int t = 0; t < kTables; ++t) {
+        if (h.offsets[t] % 8 || h.sizes[t] != counts[t] * kWidth[t]
+            || h.offsets[t] > file_.size() || h.sizes[t] > file_.size() - h.offsets[t])
+            return fail("table out of bounds");
+        offsets_[t] = h.offsets[t];
+    }
+
+    // Every reference has to land inside its table, so the accessors can
+    // index without checking.
+    const uint64_t chars = h.sizes[kStrings];
+    auto ok = [&](const Ref& r) { return uint64_t(r.offset) + r.length <= chars; };
+    const SectionEntry* sec = table<SectionEntry>(kSections);
+    for (uint32_t i = 0; i < h.section_count; ++i) {
+        const SectionEntry& e = sec[i];
+        uint64_t symbols = e.flags & kFlagBitfields ? h.bitfield_count : h.enum_count;
+        if (!ok(e.name) || !ok(e.condition) || !ok(e.description)
+            || uint64_t(e.symbol_begin) + e.symbol_count > symbols
+            || uint64_t(e.default_begin) + e.default_count > h.default_count)
+            return fail("section out of bounds");
+    }
+    for (int t : {kEnums, kBitfields}) {
+        const SymbolEntry* sym = table<SymbolEntry>(t);
+        for (uint64_t i = 0; i < counts[t]; ++i)
+            if (!ok(sym[i].name) || !ok(sym[i].value) || !ok(sym[i].comment))
+                return fail("symbol out of bounds");
+    }
+    const DefaultEntry* def = table<DefaultEntry>(kDefaults);
+    for (uint32_t i = 0; i < h.default_count; ++i)
+        if (!ok(def[i].label) || !ok(def[i].value)
+            || uint64_t(def[i].match_begin) + def[i].match_count > h.match_count)
+            return fail("default out of bounds");
+    const Ref* match = table<Ref>(kMatches);
+    for (uint32_t i = 0; i < h.match_count; ++i)
+        if (!ok(match[i]))
+            return fail("default name out of bounds");
+    // find() counts on an empty slot to end each probe: a name table holds
+    // no more names than sections, so no more than half its slots.
+    const uint32_t* hash = table<uint32_t>(kHash);
+    uint32_t names = 0;
+    for (uint32_t i = 0; i < h.hash_slots; ++i) {
+        names += hash[i] != 0;
+        if (hash[i] > h.section_count)
+            return fail("hash slot out of bounds");
+    }
+    if (names > h.section_count || names > h.hash_slots / 2)
+        return fail("name table more than half full");
+    // A full value table would never end a probe.
+    const ValueSlot* slot = table<ValueSlot>(kValueSlots);
+    uint32_t used = 0;
+    for (uint32_t i = 0; i < h.value_slots; ++i) {
+        used += slot[i].count != 0;
+        if (uint64_t(slot[i].begin) + slot[i].count > h.value_use_count)
+            return fail("value slot out of bounds");
+    }
+    if (used == h.value_slots)
+        return fail("value table has no empty slot");
+    const ValueUse* use = table<ValueUse>(kValueUses);
+    for (uint32_t i = 0; i < h.value_use_count; ++i)
+        if (use[i].section >= h.section_count || (sec[use[i].section].flags & kFlagBitfields)
+            || use[i].symbol >= sec[use[i].section].symbol_count)
+            return fail("value use out of bounds");
+
+    section_count_ = h.section_count;
+    hash_mask_ = h.hash_slots - 1;
+    value_mask_ = h.value_slots - 1;
+    source_size_ = h.source_size;
+    source_hash_ = h.source_hash;
+    return true;
+}
+
+std::string_view Snapshot::string(const Ref& r) const
+{
+    return {table<char>(kStrings) + r.offset, r.length};
+}
+
+std::optional<uint32_t> Snapshot::find(std::string_view name) const
+{
+    if (section_count_ == 0)
+        return std::nullopt;
+    const uint32_t* hash = table<uint32_t>(kHash);
+    const SectionEntry* sec = table<SectionEntry>(kSections);
+    // The table is at most half full, so an empty slot always ends the probe.
+    for (uint32_t h = name_hash(name) & hash_mask_; hash[h]; h = (h + 1) & hash_mask_)
+        if (iequals(string(sec[hash[h] - 1].name), name))
+            return hash[h] - 1;
+    return std::nullopt;
+}
+
+Snapshot::ValueUses Snapshot::uses_of(uint64_t value) const
+{
+    if (section_count_ == 0)
+        return {};
+    const ValueSlot* slot = table<ValueSlot>(kValueSlots);
+    for (uint32_t h = value_hash(value) & value_mask_; slot[h].count; h = (h + 1) & value_mask_)
+        if (slot[h].value == value) {
+            const ValueUse* use = table<ValueUse>(kValueUses) + slot[h].begin;
+            return {use, use + slot[h].count};
+        }
+    return {};
+}
+
+Section Snapshot::section(size_t i) const
+{
+    const SectionEntry& e = table<SectionEntry>(kSections)[i];
+    Section s;
+    s.name = string(e.name);
+    s.type = ValueType(e.type);
+    s.availability = Availability(e.availability);
+    s.assignment = Assignment(e.assignment);
+    s.bitfields = e.flags & kFlagBitfields;
+    s.names_only = e.flags & kFlagNamesOnly;
+    s.condition = string(e.condition);
+    s.description = string(e.description);
+    s.offset = e.source_offset;
+    s.symbol_begin = e.symbol_begin;
+    s.symbol_count = e.symbol_count;
+    s.default_begin = e.default_begin;
+    s.default_count = e.default_count;
+    return s;
+}
+
+Symbol Snapshot::symbol(const Section& s, size_t i) const
+{
+    const SymbolEntry& e = table<SymbolEntry>(s.bitfields ? kBitfields : kEnums)[s.symbol_begin + i];
+    return {string(e.name), string(e.value), string(e.comment)};
+}
+
+std::optional<uint64_t> Snapshot::number(const Section& s, size_t i) const
+{
+    const SymbolEntry& e = table<SymbolEntry>(s.bitfields ? kBitfields : kEnums)[s.symbol_begin + i];
+    if (!e.has_number)
+        return std::nullopt;
+    return e.number;
+}
+
+Default Snapshot::default_row(const Section& s, size_t i) const
+{
+    const DefaultEntry& e = table<DefaultEntry>(kDefaults)[s.default_begin + i];
+    return {string(e.label), string(e.value), e.match_begin, e.match_count};
+}
+
+std::string_view Snapshot::match(const Default& d, size_t i) const
+{
+    return string(table<Ref>(kMatches)[d.match_begin + i]);
+}
+
+void Snapshot::read(size_t i, SectionRecord& out) const
+{
+    out.section = section(i);
+    out.symbols.clear();
+    out.defaults.clear();
+    out.matches.clear();
+    for (uint32_t k = 0; k < out.section.symbol_count; ++k)
+        out.symbols.push_back(symbol(out.section, k));
+    for (uint32_t k = 0; k < out.section.default_count; ++k) {
+        Default d = default_row(out.section, k);
+        for (uint32_t j = 0; j < d.match_count; ++j)
+            out.matches.push_back(match(d, j));
+        d.match_begin = uint32_t(out.matches.size() - d.match_count);
+        out.defaults.push_back(d);
+    }
+    out.section.symbol_begin = 0;
+    out.section.default_begin = 0;
+}
+
+} // namespace nvapi
@@ -0,0 +1,113 @@
+// nvapi_snapshot.h
+//
+// A parsed parameter dump saved in a form that is used straight from a
+// memory map. Tools that run many times an hour open the snapshot instead of
+// parsing the 1.9 MB text each time:
+//
+//   nvapi::write_snapshot("nvapi.snap", nvapi::parse_dump(f.view()));
+//
+//   nvapi::Snapshot snap;
+//   if (snap.open("nvapi.snap"))
+//       if (auto i = snap.find("AAFEATUREBITS"))
+//           nvapi::Section s = snap.section(*i);
+//
+// The file is a fixed header followed by 8-byte aligned tables, all
+// addressed by offset:
+//
+//   sections    one 48-byte record per setting, in dump order
+//   enums       symbols of the sections that are not bitfields
+//   bitfields   symbols of "collection of Bitfields" sections
+//   defaults    DEFAULT rows, then the names under them in matches
+//   hash        open-addressing slots over the case-folded setting names
+//   strings     every distinct string once
+//   values      open-addressing slots over the distinct enum symbol values,
+//               each pointing at its run in value uses
+//
+// Symbols carry their value already parsed (parse_number) where it is a
+// number. The value index answers "which settings call 0x71066283 what?" in
+// one probe, for values pulled out of a profile. open() checks the header
+// and every offset once, so the accessors never have to. Like rmreg_meta's
+// store, the file is little-endian.
+
+#ifndef NVTOOLS_NVAPI_SNAPSHOT_H
+#define NVTOOLS_NVAPI_SNAPSHOT_H
+
+#include "mapped_file.h"
+#include "nvapi_dump.h"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace nvapi {
+
+bool write_snapshot(const char* path, const Dump& dump);
+
+class Snapshot {
+public:
+    struct Ref;                 // a string in the file, see nvapi_snapshot.cpp
+
+    // An enum symbol: symbol() of section(section) at index symbol.
+    struct ValueUse {
+        uint32_t section;
+        uint32_t symbol;
+    };
+    struct ValueUses {
+        const ValueUse* first = nullptr;
+        const ValueUse* last = nullptr;
+        const ValueUse* begin() const { return first; }
+        const ValueUse* end() const { return last; }
+        size_t size() const { return size_t(last - first); }
+    };
+
+    // Maps the file and checks it; false (and why, if asked) if it is not a
+    // snapshot this build can read.
+    bool open(const char* path, std::string* why = nullptr);
+
+    size_t size() const { return section_count_; }
+
+    // Case-insensitive, through the hash table.
+    std::optional<uint32_t> find(std::string_view name) const;
+
+    // Every symbol of a non-bitfield setting whose value is value, in dump
+    // order; empty if none. Points into the mapping.
+    ValueUses uses_of(uint64_t value) const;
+
+    // Views point into the mapping. symbol_begin indexes the enum or the
+    // bitfield table, depending on Section::bitfields; symbol() picks the
+    // right one.
+    Section section(size_t i) const;
+    Symbol symbol(const Section& s, size_t i) const;
+    std::optional<uint64_t> number(const Section& s, size_t i) const;
+    Default default_row(const Section& s, size_t i) const;
+    std::string_view match(const Default& d, size_t i) const;
+
+    // The whole section in the reader's record form, vectors reused.
+    void read(size_t i, SectionRecord& out) const;
+
+    // Size and FNV-1a hash of the dump the snapshot was built from.
+    uint64_t source_size() const { return source_size_; }
+    uint64_t source_hash() const { return source_hash_; }
+
+private:
+    std::string_view string(const Ref& r) const;
+
+    template <class T>
+    const T* table(int t) const
+    {
+        return reinterpret_cast<const T*>(file_.data() + offsets_[t]);
+    }
+
+    nvtools::MappedFile file_;
+    uint32_t section_count_ = 0;
+    uint32_t hash_mask_ = 0;
+    uint32_t value_mask_ = 0;
+    uint64_t source_size_ = 0;
+    uint64_t source_hash_ = 0;
+    uint64_t offsets_[10] = {};
+};
+
+} // namespace nvapi
+
+#endif // NVTOOLS_NVAPI_SNAPSHOT_H
@@ -0,0 +1,601 @@
+// nvapi_value.cpp
+
+#include "nvapi_value.h"
+
+#include "text_util.h"
+
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace nvapi {
+
+namespace {
+
+constexpr char kBase64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+using nvtools::fail;
+using nvtools::hex_digit;
+using nvtools::iequals;
+using nvtools::trim;
+
+uint32_t float_bits(float f)
+{
+    uint32_t b;
+    std::memcpy(&b, &f, sizeof b);
+    return b;
+}
+
+float bits_float(uint32_t b)
+{
+    float f;
+    std::memcpy(&f, &b, sizeof f);
+    return f;
+}
+
+int base64_digit(char c)
+{
+    if (c >= 'A' && c <= 'Z')
+        return c - 'A';
+    if (c >= 'a' && c <= 'z')
+        return c - 'a' + 26;
+    if (c >= '0' && c <= '9')
+        return c - '0' + 52;
+    return c == '+' ? 62 : c == '/' ? 63 : -1;
+}
+
+// Bytes decoded into a stack buffer when they fit, so short BINARY values
+// cost no allocation on the way to a Value.
+class ByteSink {
+public:
+    explicit ByteSink(size_t most)
+    {
+        if (most > Value::kInline)
+            big_.reserve(most);
+    }
+    void push(char c)
+    {
+        if (size_ < Value::kInline && big_.empty()) {
+            small_[size_++] = c;
+            return;
+        }
+        if (big_.empty())
+            big_.assign(small_, size_);
+        big_ += c;
+    }
+    std::string_view view() const { return big_.empty() ? std::string_view(small_, size_) : std::string_view(big_); }
+
+private:
+    char small_[Value::kInline];
+    size_t size_ = 0;
+    std::string big_;
+};
+
+bool decode_base64(std::string_view text, ByteSink& out)
+{
+    while (!text.empty() && text.back() == '=')
+        text.remove_suffix(1);
+    uint32_t acc = 0;
+    int bits = 0;
+    for (char c : text) {
+        int d = base64_digit(c);
+        if (d < 0)
+            return false;
+        acc = acc << 6 | uint32_t(d);
+        bits += 6;
+        if (bits >= 8) {
+            bits -= 8;
+            out.push(char(acc >> bits));
+            acc &= (1u << bits) - 1;
+        }
+    }
+    return bits < 6;            // one leftover digit is not a whole byte
+}
+
+void encode_base64(std::string_view bytes, std::string& out)
+{
+    size_t i = 0;
+    for (; i + 3 <= bytes.size(); i += 3) {
+        uint32_t v = uint32_t(uint8_t(bytes[i])) << 16 | uint32_t(uint8_t(bytes[i + 1])) << 8 | uint8_t(bytes[i + 2]);
+        char quad[4] = {kBase64[v >> 18], kBase64[v >> 12 & 63], kBase64[v >> 6 & 63], kBase64[v & 63]};
+        out.append(quad, 4);
+    }
+    if (i < bytes.size()) {
+        uint32_t v = uint32_t(uint8_t(bytes[i])) << 16;
+        if (i + 1 < bytes.size())
+            v |= uint32_t(uint8_t(bytes[i + 1])) << 8;
+        char quad[4] = {kBase64[v >> 18], kBase64[v >> 12 & 63],
+                        i + 1 < bytes.size() ? kBase64[v >> 6 & 63] : '=', '='};
+        out.append(quad, 4);
+    }
+}
+
+// What snprintf("%u") gives, without its cost on every DWORD of a profile.
+void append_decimal(uint32_t v, std::string& out)
+{
+    char buf[10];
+    char* p = buf + sizeof buf;
+    do {
+        *--p = char('0' + v % 10);
+        v /= 10;
+    } while (v);
+    out.append(p, size_t(buf + sizeof buf - p));
+}
+
+// A .nip Dword is decimal, ten digits at most, so it needs none of
+// parse_number()'s overflow checks. Anything else goes to parse_number().
+std::optional<uint64_t> parse_decimal(std::string_view text)
+{
+    if (text.empty() || text.size() > 10)
+        return parse_number(text);
+    uint64_t v = 0;
+    for (char c : text) {
+        if (c < '0' || c > '9')
+            return parse_number(text);
+        v = v * 10 + uint64_t(c - '0');
+    }
+    return v;
+}
+
+// "OFF, 0, FALSE, DISABLED" answers to each of its four names.
+const Symbol* find_symbol(const SectionRecord& r, std::string_view name)
+{
+    for (const Symbol& s : r.symbols) {
+        std::string_view rest = s.name;
+        for (size_t comma; (comma = rest.find(", ")) != std::string_view::npos; rest.remove_prefix(comma + 2))
+            if (iequals(rest.substr(0, comma), name))
+                return &s;
+        if (iequals(rest, name))
+            return &s;
+    }
+    return nullptr;
+}
+
+const Symbol* find_limit(const SectionRecord& r, std::string_view name)
+{
+    for (const Symbol& s : r.symbols)
+        if (s.name == name)
+            return &s;
+    return nullptr;
+}
+
+uint64_t number_of(const Value& v)
+{
+    return v.type() == ValueType::Dword ? v.as_dword() : v.as_qword();
+}
+
+std::string text_of(const Value& v)
+{
+    std::string s;
+    format_value(v, s);
+    return s;
+}
+
+} // namespace
+
+Value Value::dword(uint32_t v)
+{
+    Value out;
+    out.type_ = ValueType::Dword;
+    out.u_.dword = v;
+    return out;
+}
+
+Value Value::qword(uint64_t v)
+{
+    Value out;
+    out.type_ = ValueType::Qword;
+    out.u_.qword = v;
+    return out;
+}
+
+Value Value::real(float v)
+{
+    Value out;
+    out.type_ = ValueType::Float;
+    out.u_.real = v;
+    return out;
+}
+
+Value Value::string(std::string_view text)
+{
+    Value out;
+    out.assign(ValueType::String, text.data(), text.size());
+    return out;
+}
+
+Value Value::binary(std::string_view bytes)
+{
+    Value out;
+    out.assign(ValueType::Binary, bytes.data(), bytes.size());
+    return out;
+}
+
+Value::Value(const Value& other)
+{
+    *this = other;
+}
+
+Value::Value(Value&& other) noexcept
+{
+    *this = std::move(other);
+}
+
+Value& Value::operator=(const Value& other)
+{
+    if (this == &other)
+        return *this;
+    if (other.type_ == ValueType::String || other.type_ == ValueType::Binary) {
+        std::string_view b = other.bytes();
+        assign(other.type_, b.data(), b.size());
+        return *this;
+    }
+    release();
+    type_ = other.type_;
+    u_ = other.u_;
+    return *this;
+}
+
+Value& Value::operator=(Value&& other) noexcept
+{
+    if (this == &other)
+        return *this;
+    release();
+    type_ = other.type_;
+    size_ = other.size_;
+    u_ = other.u_;
+    other.type_ = ValueType::Unknown;
+    other.size_ = 0;
+    other.u_.qword = 0;
+    return *this;
+}
+
+void Value::assign(ValueType type, const char* data, size_t size)
+{
+    // data may point into this value, so copy before letting go of it.
+    char* heap = nullptr;
+    if (size > kInline) {
+        heap = new char[size];
+        std::memcpy(heap, data, size);
+    } else {
+        char small[kInline];
+        if (size)
+            std::memcpy(small, data, size);
+        release();
+        if (size)
+            std::memcpy(u_.small, small, size);
+    }
+    if (heap) {
+        release();
+        u_.heap = heap;
+    }
+    type_ = type;
+    size_ = uint32_t(size);
+}
+
+void Value::release()
+{
+    if (on_heap())
+        delete[] u_.heap;
+    type_ = ValueType::Unknown;
+    size_ = 0;
+    std::memset(&u_, 0, sizeof u_);
+}
+
+std::string_view Value::bytes() const
+{
+    if (type_ != ValueType::String && type_ != ValueType::Binary)
+        return {};
+    return on_heap() ? std::string_view(u_.heap, size_) : std::string_view(u_.small, size_);
+}
+
+bool Value::operator==(const Value& other) const
+{
+    if (type_ != other.type_)
+        return false;
+    switch (type_) {
+    case ValueType::Dword: return u_.dword == other.u_.dword;
+    case ValueType::Qword: return u_.qword == other.u_.qword;
+    case ValueType::Float: return float_bits(u_.real) == float_bits(other.u_.real);
+    case ValueType::String:
+    case ValueType::Binary: return bytes() == other.bytes();
+    case ValueType::Unknown: return true;
+    }
+    return false;
+}
+
+bool parse_value(ValueType type, std::string_view text, Value& out, std::string* why)
+{
+    if (type != ValueType::String)
+        text = trim(text);
+    switch (type) {
+    case ValueType::Dword:
+    case ValueType::Qword: {
+        std::optional<uint64_t> n = parse_number(text);
+        if (!n)
+            return fail(why, std::string(text) + " is not a number");
+        if (type == ValueType::Dword && *n > 0xffffffffu)
+            return fail(why, std::string(text) + " is more than 32 bits");
+        out = type == ValueType::Dword ? Value::dword(uint32_t(*n)) : Value::qword(*n);
+        return true;
+    }
+    case ValueType::Float: {
+        if (text.substr(0, 4) == "nan:") {
+            std::optional<uint64_t> n = parse_number(text.substr(4));
+            if (!n || *n > 0xffffffffu || !std::isnan(bits_float(uint32_t(*n))))
+                return fail(why, std::string(text) + " is not a NaN");
+            out = Value::real(bits_float(uint32_t(*n)));
+            return true;
+        }
+        char buf[64];
+        if (text.empty() || text.size() >= sizeof buf)
+            return fail(why, std::string(text) + " is not a FLOAT");
+        std::memcpy(buf, text.data(), text.size());
+        buf[text.size()] = 0;
+        char* end = nullptr;
+        errno = 0;
+        float f = std::strtof(buf, &end);
+        if (end != buf + text.size())
+            return fail(why, std::string(text) + " is not a FLOAT");
+        if (errno == ERANGE && (std::isinf(f) || f == 0))
+            return fail(why, std::string(text) + " is out of FLOAT range");
+        out = Value::real(f);
+        return true;
+    }
+    case ValueType::String:
+        out = Value::string(text);
+        return true;
+    case ValueType::Binary: {
+        ByteSink bytes(text.size() / 2 + 1);
+        while (!text.empty()) {
+            size_t comma = text.find(',');
+            std::string_view item = trim(text.substr(0, comma));
+            int hi = item.size() == 2 ? hex_digit(item[0]) : item.size() == 1 ? 0 : -1;
+            int lo = item.empty() ? -1 : hex_digit(item.back());
+            if (hi < 0 || lo < 0)
+                return fail(why, "\"" + std::string(item) + "\" is not a hex byte");
+            bytes.push(char(hi << 4 | lo));
+            text = comma == std::string_view::npos ? std::string_view() : text.substr(comma + 1);
+        }
+        out = Value::binary(bytes.view());
+        return true;
+    }
+    case ValueType::Unknown:
+        break;
+    }
+    return fail(why, "the value has no type");
+}
+
+void format_value(const Value& v, std::string& out)
+{
+    char buf[32];
+    switch (v.type()) {
+    case ValueType::Dword:
+        out.append(buf, size_t(std::snprintf(buf, sizeof buf, "0x%08x", v.as_dword())));
+        return;
+    case ValueType::Qword:
+        out.append(buf, size_t(std::snprintf(buf, sizeof buf, "0x%016llx", (unsigned long long)v.as_qword())));
+        return;
+    case ValueType::Float: {
+        float f = v.as_float();
+        if (std::isnan(f)) {
+            out.append(buf, size_t(std::snprintf(buf, sizeof buf, "nan:0x%08x", float_bits(f))));
+            return;
+        }
+        // Nine significant digits always come back to the same float; most
+        // values need far fewer.
+        int n = 0;
+        for (int digits = 1; digits <= 9; ++digits) {
+            n = std::snprintf(buf, sizeof buf, "%.*g", digits, double(f));
+            if (float_bits(std::strtof(buf, nullptr)) == float_bits(f))
+                break;
+        }
+        out.append(buf, size_t(n));
+        return;
+    }
+    case ValueType::String:
+        out += v.bytes();
+        return;
+    case ValueType::Binary: {
+        std::string_view b = v.bytes();
+        for (size_t i = 0; i < b.size(); ++i)
+            out.append(buf, size_t(std::snprintf(buf, sizeof buf, i ? ",%02x" : "%02x", uint8_t(b[i]))));
+        return;
+    }
+    case ValueType::Unknown:
+        return;
+    }
+}
+
+bool parse_nip(std::string_view value_type, std::string_view text, ValueType declared, Value& out, std::string* why)
+{
+    auto mismatch = [&]() {
+        return fail(why, "a " + std::string(value_type) + " value for a " + type_name(declared) + " setting");
+    };
+    if (iequals(value_type, "Dword")) {
+        std::optional<uint64_t> n = parse_decimal(trim(text));
+        if (!n || *n > 0xffffffffu)
+            return fail(why, std::string(text) + " is not a Dword");
+        uint32_t v = uint32_t(*n);
+        switch (declared) {
+        case ValueType::Float:   out = Value::real(bits_float(v)); return true;
+        case ValueType::Qword:   out = Value::qword(v); return true;
+        case ValueType::Dword:
+        case ValueType::Unknown: out = Value::dword(v); return true;
+        default:                 return mismatch();
+        }
+    }
+    if (iequals(value_type, "Binary")) {
+        text = trim(text);
+        ByteSink bytes(text.size() / 4 * 3 + 3);
+        if (!decode_base64(text, bytes))
+            return fail(why, std::string(text) + " is not base64");
+        std::string_view b = bytes.view();
+        if (declared == ValueType::Qword) {
+            if (b.size() != 8)
+                return fail(why, "a QWORD is 8 bytes, not " + std::to_string(b.size()));
+            uint64_t v = 0;
+            for (size_t i = 8; i-- > 0;)
+                v = v << 8 | uint8_t(b[i]);
+            out = Value::qword(v);
+            return true;
+        }
+        if (declared != ValueType::Binary && declared != ValueType::Unknown)
+            return mismatch();
+        out = Value::binary(b);
+        return true;
+    }
+    if (iequals(value_type, "String")) {
+        if (declared != ValueType::String && declared != ValueType::Unknown)
+            return mismatch();
+        out = Value::string(text);
+        return true;
+    }
+    return fail(why, std::string(value_type) + " is not a .nip value type");
+}
+
+const char* format_nip(const Value& v, std::string& out)
+{
+    switch (v.type()) {
+    case ValueType::Dword:
+    case ValueType::Float:
+        append_decimal(v.type() == ValueType::Dword ? v.as_dword() : float_bits(v.as_float()), out);
+        return "Dword";
+    case ValueType::Qword: {
+        char le[8];
+        for (int i = 0; i < 8; ++i)
+            le[i] = char(v.as_qword() >> (8 * i));
+        encode_base64(std::string_view(le, 8), out);
+        return "Binary";
+    }
+    case ValueType::String:
+        out += v.bytes();
+        return "String";
+    case ValueType::Binary:
+        encode_base64(v.bytes(), out);
+        return "Binary";
+    case ValueType::Unknown:
+        break;
+    }
+    return nullptr;
+}
+
+bool resolve_value(const SectionRecord& r, std::string_view text, Value& out, std::string* why)
+{
+    const Section& s = r.section;
+    switch (s.type) {
+    case ValueType::String:
+        out = Value::string(trim(text) == "(null)" ? std::string_view() : text);
+        return true;
+    case ValueType::Binary:
+        return parse_value(s.type, text, out, why);
+    case ValueType::Float: {
+        const Symbol* sym = find_symbol(r, trim(text));
+        return parse_value(s.type, sym ? sym->value : text, out, why);
+    }
+    case ValueType::Dword:
+    case ValueType::Qword: {
+        uint64_t value = 0;
+        size_t items = 0;
+        while (!text.empty()) {
+            size_t bar = s.bitfields ? text.find('|') : std::string_view::npos;
+            std::string_view item = trim(text.substr(0, bar));
+            text = bar == std::string_view::npos ? std::string_view() : text.substr(bar + 1);
+            if (item.empty())
+                continue;
+            // Names first, as in BitfieldPlan::encode.
+            const Symbol* sym = find_symbol(r, item);
+            std::optional<uint64_t> n = parse_number(sym ? sym->value : item);
+            if (!n)
+                return fail(why, std::string(item) + " is neither a number nor a name of " + std::string(s.name));
+            value |= *n;
+            ++items;
+        }
+        if (!items)
+            return fail(why, std::string(s.name) + " needs a value");
+        if (s.type == ValueType::Dword && value > 0xffffffffu)
+            return fail(why, std::string(s.name) + " is a DWORD, the value is more than 32 bits");
+        out = s.type == ValueType::Dword ? Value::dword(uint32_t(value)) : Value::qword(value);
+        return true;
+    }
+    case ValueType::Unknown:
+        break;
+    }
+    return fail(why, std::string(s.name) + " has no type");
+}
+
+bool resolve_default(const SectionRecord& r, const Default& d, Value& out, std::string* why)
+{
+    std::string_view value = trim(d.value);
+    if (value.empty() || value.back() != '|' || !d.match_count)
+        return resolve_value(r, d.value, out, why);
+    std::string joined(value);
+    for (uint32_t j = 0; j < d.match_count; ++j) {
+        std::string_view m = trim(r.matches[d.match_begin + j]);
+        joined += joined.back() == '|' ? " " : " | ";
+        joined += m;
+    }
+    return resolve_value(r, joined, out, why);
+}
+
+bool check_value(const SectionRecord& r, const Value& v, std::string* why)
+{
+    const Section& s = r.section;
+    if (v.type() != s.type)
+        return fail(why, std::string(s.name) + " is a " + type_name(s.type) + " setting, not " + type_name(v.type()));
+    if (s.type != ValueType::Dword && s.type != ValueType::Qword && s.type != ValueType::Float)
+        return true;
+
+    // The dump's own defaults fit, even the few under MIN (0 for off) or
+    // not among the names.
+    for (const Default& d : r.defaults) {
+        Value dv;
+        if (d.label.substr(0, 7) == "DEFAULT" && resolve_default(r, d, dv) && dv == v)
+            return true;
+    }
+
+    // In a bitfield setting MIN and MAX are flags (DX11 DISABLE COALESCED
+    // ATOMICS), not limits. A MIN over the MAX is a signed range:
+    // LODBIASADJUST goes from 0xffffff80 to 0x00000080.
+    const Symbol* min_sym = s.bitfields ? nullptr : find_limit(r, "MIN");
+    const Symbol* max_sym = s.bitfields ? nullptr : find_limit(r, "MAX");
+    Value lo, hi;
+    bool has_lo = min_sym && parse_value(s.type, min_sym->value, lo);
+    bool has_hi = max_sym && parse_value(s.type, max_sym->value, hi);
+    bool under = false, over = false;
+    if (s.type == ValueType::Float) {
+        float f = v.as_float();
+        under = has_lo && (std::isnan(f) || f < lo.as_float());
+        over = has_hi && (std::isnan(f) || f > hi.as_float());
+    } else {
+        auto key = [&](const Value& x) {
+            return number_of(x) ^ (s.type == ValueType::Dword ? uint64_t(1) << 31 : uint64_t(1) << 63);
+        };
+        bool is_signed = has_lo && has_hi && number_of(lo) > number_of(hi);
+        under = has_lo && (is_signed ? key(v) < key(lo) : number_of(v) < number_of(lo));
+        over = has_hi && (is_signed ? key(v) > key(hi) : number_of(v) > number_of(hi));
+    }
+    if (under || over)
+        return fail(why, text_of(v) + " is " + (under ? "under the MIN" : "over the MAX") + " of "
+                             + std::string(s.name) + ", " + text_of(under ? lo : hi));
+
+    if (!s.names_only || s.type == ValueType::Float || r.symbols.empty())
+        return true;
+    uint64_t named = 0;
+    for (const Symbol& sym : r.symbols) {
+        std::optional<uint64_t> n = parse_number(sym.value);
+        if (!n)
+            continue;
+        if (!s.bitfields && *n == number_of(v))
+            return true;
+        named |= *n;
+    }
+    if (s.bitfields && (number_of(v) & ~named) == 0)
+        return true;
+    return fail(why, text_of(v) + (s.bitfields ? " has bits that no name of " : " is not a name of ")
+                         + std::string(s.name) + (s.bitfields ? " covers" : ""));
+}
+
+} // namespace nvapi
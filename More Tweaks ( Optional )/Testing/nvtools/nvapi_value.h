@@ -0,0 +1,116 @@
+// nvapi_value.h
+//
+// Setting values of every type the dump declares, and their .nip form.
+// Value is a tagged union: a DWORD, QWORD or FLOAT is stored in place, and so
+// is a STRING or BINARY value of up to 24 bytes, so most values never touch
+// the heap:
+//
+//   nvapi::Value v;
+//   nvapi::parse_nip("Dword", "1065353216", nvapi::ValueType::Float, v);  // 1.0f
+//   std::string text;
+//   nvapi::format_value(v, text);                 // "1"
+//
+// A .nip file (nvidiaProfileInspector) knows three value types: Dword,
+// Binary and String. A FLOAT setting goes in a Dword as its IEEE bits and a
+// QWORD setting as 8 bytes of little-endian Binary ("AAAAQAAAAAA=" is
+// 0x40000000); writing a QWORD as a Dword drops the high half. parse_nip()
+// takes the setting's type from the dump to tell these apart.
+//
+// The text form is the dump's: numbers in hex or decimal, floats in decimal,
+// BINARY as comma-separated hex bytes like rmreg_blob ("04,17,00,22"). Floats
+// print as the shortest decimal that reads back to the same bits, and a NaN
+// as "nan:0x7fc00000", so format_value() and parse_value() round-trip
+// exactly. Appending to a string that already has the room allocates
+// nothing.
+
+#ifndef NVTOOLS_NVAPI_VALUE_H
+#define NVTOOLS_NVAPI_VALUE_H
+
+#include "nvapi_dump.h"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace nvapi {
+
+class Value {
+public:
+    static constexpr size_t kInline = 24;
+
+    Value() {}                  // no value, ValueType::Unknown
+    static Value dword(uint32_t v);
+    static Value qword(uint64_t v);
+    static Value real(float v);
+    static Value string(std::string_view text);
+    static Value binary(std::string_view bytes);
+
+    Value(const Value& other);
+    Value(Value&& other) noexcept;
+    Value& operator=(const Value& other);
+    Value& operator=(Value&& other) noexcept;
+    ~Value() { release(); }
+
+    ValueType type() const { return type_; }
+    uint32_t as_dword() const { return u_.dword; }
+    uint64_t as_qword() const { return u_.qword; }
+    float as_float() const { return u_.real; }
+    // STRING text or BINARY bytes; empty for the other types.
+    std::string_view bytes() const;
+    bool on_heap() const { return size_ > kInline; }
+
+    // Floats compare by bits, so a NaN equals itself and -0 is not 0.
+    bool operator==(const Value& other) const;
+    bool operator!=(const Value& other) const { return !(*this == other); }
+
+private:
+    void assign(ValueType type, const char* data, size_t size);
+    void release();
+
+    ValueType type_ = ValueType::Unknown;
+    uint32_t size_ = 0;         // of bytes(); over kInline, they are in u_.heap
+    union {
+        uint32_t dword;
+        uint64_t qword;
+        float real;
+        char small[kInline];
+        char* heap;
+    } u_{};
+};
+
+// Dump or command-line text as a value of the given type. No names; see
+// resolve_value() for those.
+bool parse_value(ValueType type, std::string_view text, Value& out, std::string* why = nullptr);
+
+// Appends the text form; parse_value() of it gives back the same value.
+void format_value(const Value& v, std::string& out);
+
+// <ValueType> and <SettingValue> of a .nip setting, XML entities already
+// replaced. declared is the setting's type in the dump, Unknown if the
+// setting is not in it, in which case Dword, Binary and String are taken as
+// they are.
+bool parse_nip(std::string_view value_type, std::string_view text, ValueType declared, Value& out,
+               std::string* why = nullptr);
+
+// Appends the <SettingValue> text and returns the <ValueType>, or nullptr for
+// a value with no type.
+const char* format_nip(const Value& v, std::string& out);
+
+// Text as a value of the setting: a number, one of its symbol names (any
+// case, any alias of "OFF, 0, FALSE"), or for a bitfield setting names and
+// numbers joined by '|'. A STRING setting takes the text as it is, except
+// that "(null)" is empty.
+bool resolve_value(const SectionRecord& r, std::string_view text, Value& out, std::string* why = nullptr);
+
+// The value a DEFAULT row gives. "CONFORM |" continues with the names under
+// it.
+bool resolve_default(const SectionRecord& r, const Default& d, Value& out, std::string* why = nullptr);
+
+// Whether the setting can hold v: the same type, within the MIN and MAX
+// symbols if it has them, and one of its symbols (or only their bits, for a
+// bitfield) if it takes names only.
+bool check_value(const SectionRecord& r, const Value& v, std::string* why = nullptr);
+
+} // namespace nvapi
+
+#endif // NVTOOLS_NVAPI_VALUE_H
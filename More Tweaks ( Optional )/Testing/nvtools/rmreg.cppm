@@ -0,0 +1,20 @@
+// rmreg.cppm
+//
+// The catalog as a C++20 named module, nvtools.rmreg. It re-exports the two
+// catalog headers as header units, so importers see the same rmreg::
+// names that the headers declare:
+//
+//   g++ -std=c++20 -fmodules-ts -O2 -x c++-header -c rmreg_catalog.h
+//   g++ -std=c++20 -fmodules-ts -O2 -x c++-header -c rmreg_fields.h
+//   g++ -std=c++20 -fmodules-ts -O2 -x c++ -c rmreg.cppm -o rmreg_module.o
+//
+//   import nvtools.rmreg;
+//   static_assert(rmreg::find("RmOptp")->field_count == 5);
+//
+// Macros do not cross a module boundary. Code that needs the NV_REG_STR_*
+// spellings can import "nvRmReg.h" as a header unit, built with -Istubs.
+
+export module nvtools.rmreg;
+
+export import "rmreg_catalog.h";
+export import "rmreg_fields.h";
@@ -0,0 +1,209 @@
+// rmreg.h
+//
+// Registry key catalog types for nvRmReg.h.
+//
+// The tables themselves live in rmreg_catalog.h, which is generated from the
+// header by rmreg_gen. Everything here is constexpr so a lookup can be folded
+// at compile time, and at run time it is a hash, two table reads and one
+// string compare - no allocation.
+
+#ifndef NVTOOLS_RMREG_H
+#define NVTOOLS_RMREG_H
+
+#include "text_util.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace rmreg {
+
+enum class KeyType : uint8_t {
+    Unknown,    // no "// Type ..." comment near the key
+    Dword,
+    Binary,
+    String,
+};
+
+// One DRF "hi:lo" field of a packed DWORD key.
+struct FieldDesc {
+    std::string_view name;      // DELAY_4MS, the macro with the key's prefix removed
+    uint8_t hi;
+    uint8_t lo;
+    uint16_t condition;         // index into kConditions, fields can be #if'd alone
+
+    constexpr uint32_t mask() const
+    {
+        return (hi - lo == 31 ? 0xffffffffu : ((1u << (hi - lo + 1)) - 1)) << lo;
+    }
+    constexpr uint32_t get(uint32_t word) const { return (word & mask()) >> lo; }
+};
+
+// Build-variant conditions. Every config symbol the header tests with #if
+// (NV_VERIF_FEATURES, DEBUG, RMCFG_FEATURE_VIRTUALIZATION, ...) is treated as
+// a switch that is either on or off, so a condition is a truth table over all
+// 2^kMaxSymbols combinations. Bit a of the table is the condition's value
+// when symbol i is on exactly when bit i of a is set.
+constexpr size_t kMaxSymbols = 8;
+
+struct TruthTable {
+    uint64_t w[4];
+
+    static constexpr TruthTable all() { return {{~0ull, ~0ull, ~0ull, ~0ull}}; }
+    static constexpr TruthTable none() { return {{0, 0, 0, 0}}; }
+
+    // True exactly where symbol i is on. Bits 0-5 of an assignment index
+    // within a word, bits 6-7 pick the word.
+    static constexpr TruthTable symbol(size_t i)
+    {
+        constexpr uint64_t kInWord[6] = {
+            0xaaaaaaaaaaaaaaaaull, 0xccccccccccccccccull, 0xf0f0f0f0f0f0f0f0ull,
+            0xff00ff00ff00ff00ull, 0xffff0000ffff0000ull, 0xffffffff00000000ull,
+        };
+        TruthTable t = none();
+        for (size_t w = 0; w < 4; ++w)
+            t.w[w] = i < 6 ? kInWord[i] : ((w >> (i - 6)) & 1) ? ~0ull : 0;
+        return t;
+    }
+
+    constexpr bool test(uint32_t assignment) const
+    {
+        return (w[assignment / 64] >> (assignment % 64)) & 1;
+    }
+    constexpr bool empty() const { return (w[0] | w[1] | w[2] | w[3]) == 0; }
+
+    friend constexpr TruthTable operator&(TruthTable a, TruthTable b)
+    {
+        return {{a.w[0] & b.w[0], a.w[1] & b.w[1], a.w[2] & b.w[2], a.w[3] & b.w[3]}};
+    }
+    friend constexpr TruthTable operator|(TruthTable a, TruthTable b)
+    {
+        return {{a.w[0] | b.w[0], a.w[1] | b.w[1], a.w[2] | b.w[2], a.w[3] | b.w[3]}};
+    }
+    friend constexpr TruthTable operator~(TruthTable a)
+    {
+        return {{~a.w[0], ~a.w[1], ~a.w[2], ~a.w[3]}};
+    }
+    friend constexpr bool operator==(TruthTable a, TruthTable b)
+    {
+        return a.w[0] == b.w[0] && a.w[1] == b.w[1] && a.w[2] == b.w[2] && a.w[3] == b.w[3];
+    }
+};
+
+// A build variant pins some symbols on and some off; the rest can be either.
+struct Variant {
+    uint8_t on;                 // bit i: symbol i is on
+    uint8_t off;                // bit i: symbol i is off
+
+    constexpr TruthTable builds() const
+    {
+        TruthTable t = TruthTable::all();
+        for (size_t i = 0; i < kMaxSymbols; ++i) {
+            if (on & (1u << i))
+                t = t & TruthTable::symbol(i);
+            if (off & (1u << i))
+                t = t & ~TruthTable::symbol(i);
+        }
+        return t;
+    }
+};
+
+enum class Liveness : uint8_t {
+    Never,      // compiled out of every build of the variant
+    Depends,    // present in some, e.g. only with RMCFG_FEATURE_VIRTUALIZATION
+    Always,
+};
+
+// The #if nesting a define sits under, folded into one expression.
+struct Condition {
+    std::string_view expr;      // "NV_VERIF_FEATURES", "" when unconditional
+    TruthTable truth;
+
+    constexpr Liveness live(Variant v) const
+    {
+        TruthTable b = v.builds();
+        TruthTable t = truth & b;
+        return t.empty() ? Liveness::Never : t == b ? Liveness::Always : Liveness::Depends;
+    }
+};
+
+struct Key {
+    std::string_view macro;     // NV_REG_STR_RM_OPTP
+    std::string_view name;      // RmOptp, as written under the registry key
+    KeyType type;
+    bool has_default;
+    uint32_t default_value;
+    uint16_t field_begin;       // range into kFields
+    uint16_t field_count;
+    uint16_t condition;         // index into kConditions, 0 is unconditional
+};
+
+struct FieldRange {
+    const FieldDesc* first;
+    size_t count;
+
+    constexpr const FieldDesc* begin() const { return first; }
+    constexpr const FieldDesc* end() const { return first + count; }
+    constexpr size_t size() const { return count; }
+};
+
+// Registry value names are case-insensitive, and nvRmReg.h mixes "RM" and
+// "Rm" prefixes, so hashing and comparison fold ASCII case (text_util.h).
+using nvtools::fold;
+using nvtools::iequals;
+
+constexpr uint64_t hash_name(std::string_view s)
+{
+    uint64_t h = 0xcbf29ce484222325ull;
+    for (char c : s) {
+        h ^= uint8_t(fold(c));
+        h *= 0x100000001b3ull;
+    }
+    return h;
+}
+
+constexpr uint64_t mix(uint64_t x)
+{
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdull;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ull;
+    x ^= x >> 33;
+    return x;
+}
+
+// Hash-and-displace perfect hash. The name hash picks a bucket, the bucket's
+// displacement picks the slot, and the slot holds the key index (or kEmpty).
+// rmreg_gen searches the displacements so that no two keys share a slot.
+struct PerfectHash {
+    static constexpr uint16_t kEmpty = 0xffff;
+
+    const uint16_t* displace;
+    uint32_t bucket_count;
+    const uint16_t* slots;
+    uint32_t slot_mask;         // slot count - 1, slot count is a power of two
+
+    static constexpr uint32_t slot_of(uint64_t h, uint16_t d, uint32_t mask)
+    {
+        return uint32_t(mix(h + d * 0x9e3779b97f4a7c15ull)) & mask;
+    }
+
+    constexpr uint16_t lookup(uint64_t h) const
+    {
+        return slots[slot_of(h, displace[h % bucket_count], slot_mask)];
+    }
+};
+
+template <size_t N>
+constexpr const Key* find_in(const Key (&keys)[N], const PerfectHash& index,
+                             std::string_view name)
+{
+    uint16_t i = index.lookup(hash_name(name));
+    if (i == PerfectHash::kEmpty || !iequals(keys[i].name, name))
+        return nullptr;
+    return &keys[i];
+}
+
+} // namespace rmreg
+
+#endif // NVTOOLS_RMREG_H
@@ -0,0 +1,640 @@
+// rmreg_blob.cpp
+
+#include "rmreg_blob.h"
+
+#include "rmreg_catalog.h"
+#include "text_util.h"
+
+#include <cctype>
+#include <cstdio>
+
+namespace rmreg {
+
+namespace {
+
+using nvtools::fail;
+using nvtools::hex_digit;
+
+constexpr BlobField u8(std::string_view name, uint16_t offset)
+{
+    return {name, BlobKind::Uint, offset, 1, 7, 0, -1};
+}
+constexpr BlobField u16(std::string_view name, uint16_t offset)
+{
+    return {name, BlobKind::Uint, offset, 2, 15, 0, -1};
+}
+constexpr BlobField u32(std::string_view name, uint16_t offset)
+{
+    return {name, BlobKind::Uint, offset, 4, 31, 0, -1};
+}
+constexpr BlobField u64(std::string_view name, uint16_t offset)
+{
+    return {name, BlobKind::Uint, offset, 8, 63, 0, -1};
+}
+constexpr BlobField bits8(std::string_view name, uint16_t offset, uint8_t hi, uint8_t lo)
+{
+    return {name, BlobKind::Uint, offset, 1, hi, lo, -1};
+}
+constexpr BlobField bytes(std::string_view name, uint16_t offset, uint16_t size)
+{
+    return {name, BlobKind::Bytes, offset, size, 0, 0, -1};
+}
+constexpr BlobField tail(std::string_view name, uint16_t offset, int8_t count = -1)
+{
+    return {name, BlobKind::Bytes, offset, 0, 0, 0, count};
+}
+constexpr BlobField text(std::string_view name)
+{
+    return {name, BlobKind::Text, 0, 0, 0, 0, -1};
+}
+constexpr BlobField item(std::string_view name, uint16_t number)
+{
+    return {name, BlobKind::Item, number, 0, 0, 0, -1};
+}
+
+struct Name {
+    std::string_view key;
+    uint8_t stem;
+    BlobSuffix suffix;
+    uint8_t digits;
+};
+
+constexpr Name exact(std::string_view key)
+{
+    return {key, uint8_t(key.size()), BlobSuffix::None, 0};
+}
+
+template <size_t N>
+constexpr BlobSchema plain(Name n, const BlobField (&f)[N], uint32_t min, uint32_t max,
+                           std::string_view note)
+{
+    return {n.key, n.stem, n.suffix, n.digits, f, uint8_t(N), nullptr, 0, 0, -1, min, max, note};
+}
+
+template <size_t N, size_t M>
+constexpr BlobSchema records(Name n, const BlobField (&f)[N], const BlobField (&r)[M],
+                             uint16_t size, int8_t count, std::string_view note)
+{
+    return {n.key, n.stem, n.suffix, n.digits, f, uint8_t(N), r, uint8_t(M), size, count, 0, 0, note};
+}
+
+template <size_t M>
+constexpr BlobSchema records(Name n, const BlobField (&r)[M], uint16_t size, uint32_t min,
+                             uint32_t max, std::string_view note)
+{
+    return {n.key, n.stem, n.suffix, n.digits, nullptr, 0, r, uint8_t(M), size, -1, min, max, note};
+}
+
+constexpr BlobField kOpaque[] = {tail("data", 0)};
+
+constexpr BlobSchema opaque(Name n, std::string_view note, uint32_t max = 0)
+{
+    return plain(n, kOpaque, 0, max, note);
+}
+
+// OverrideStart and OverrideSize are declared NvU32 but the byte column puts
+// them at Byte[12] and Byte[13], which is what EDIDdata at Byte[14] needs.
+constexpr BlobField kEdidFlags[] = {
+    u16("manufacturer_id", 0),
+    u16("product_id", 2),
+    u16("min_year_week", 4),
+    u16("max_year_week", 6),
+    u32("flags", 8),
+    u8("override_start", 12),
+    u8("override_size", 13),
+    tail("edid_data", 14, 6),
+};
+
+constexpr BlobField kRomOverride[] = {
+    bytes("bios_number", 0, 4),
+    u8("oem", 4),
+    u32("offset", 5),
+    u8("count", 9),
+    tail("data", 10, 3),
+};
+
+constexpr BlobField kEdidBlock[] = {bytes("block", 0, 128)};
+
+constexpr BlobField kPanelStrap[] = {
+    item("descriptor", 0),
+    item("manufacturer_id", 1),
+    item("feature_support", 2),
+    item("product_code", 3),
+};
+
+constexpr BlobField kGpuInit[] = {
+    u32("index", 0),
+    u32("and_mask", 4),
+    u32("or_mask", 8),
+};
+
+constexpr BlobField kHdcpKeys[] = {
+    bytes("seed", 0, 4),
+    bytes("keyglob", 4, 576),
+};
+
+constexpr BlobField kAdt7473[] = {u8("version", 0), u8("entries", 1)};
+constexpr BlobField kAdt7473Entry[] = {u8("reg_index", 0), u8("reg_value", 1)};
+
+constexpr BlobField kAspmDt[] = {bits8("l0s", 0, 0, 0), bits8("l1", 0, 1, 1)};
+
+constexpr BlobField kOpsbOverride[] = {u8("override", 0)};
+
+constexpr BlobField kPageAddress[] = {u64("address", 0)};
+
+constexpr BlobField kXidList[] = {text("xids")};
+
+constexpr BlobSchema kBlobSchemas[] = {
+    plain({"OverrideEdidFlags", 17, BlobSuffix::Decimal, 0}, kEdidFlags, 14, 14 + 255,
+          "Binary Structure table; EDIDdata is override_size bytes"),
+    plain({"romOverride", 11, BlobSuffix::Hex, 2}, kRomOverride, 10, 10 + 246,
+          "Bytes 0-3 BIOS number, 4 OEM, 5-8 offset, 9 count, 10+ data (max 246)"),
+    records({"Static EDID 0x????????", 14, BlobSuffix::Hex, 8}, kEdidBlock, 128, 128, 256,
+            "the EDID, exactly 128 or 256 bytes"),
+    plain({"Panel00", 5, BlobSuffix::Hex, 2}, kPanelStrap, 0, 0,
+          "comma-separated, an empty item leaves that field alone"),
+    opaque({"OverDriveData0", 13, BlobSuffix::Hex, 1}, "format not in the header (bug 135902)"),
+    opaque({"OverDriveDataSerialNo0", 21, BlobSuffix::Hex, 1},
+           "format not in the header (bug 135902)"),
+    records(exact("OverrideGpuInit"), kGpuInit, 12, 0, 0, "{index, and_mask, or_mask} per entry"),
+    records(exact("OverrideGpuDevinit"), kGpuInit, 12, 0, 0, "{index, and_mask, or_mask} per entry"),
+    opaque(exact("vbios"), "the VBIOS image"),
+    opaque(exact("vbiosSource"), "saved VBIOS source"),
+    opaque({"vbios000", 5, BlobSuffix::Decimal, 3}, "one piece of a VBIOS split over several keys"),
+    opaque(exact("RmNVIFFunctions"), "copy of the RM's NVIF_Functions table"),
+    opaque(exact("RmThermalProviderInfo"), "thermal provider cache, format not in the header"),
+    plain(exact("RMHdcpSetKeys"), kHdcpKeys, 580, 580, "struct { NvU8 seed[4]; NvU8 keyglob[576]; }"),
+    records(exact("RmProviderRsAdt7473"), kAdt7473, kAdt7473Entry, 2, 1,
+            "version (0x10 = 1.0), entries, then {regIndex, regValue} per entry"),
+    plain(exact("RMSbiosEnableASPMDT"), kAspmDt, 1, 1, "bit 0 L0s, bit 1 L1, 7:2 reserved"),
+    opaque(exact("MXMSize"), "MXM structure size, width not in the header"),
+    opaque(exact("MXMData"), "the whole MXM structure"),
+    opaque(exact("MXMVersion"), "MXM version, format not in the header"),
+    opaque(exact("RMMinionSetUCode"), "MINION ucode image"),
+    opaque(exact("RMMinionSetUCodeHdr"), "MINION ucode header"),
+    opaque(exact("RM442643"), "struct ALTERNATIVE_PWM_CONTROL from dac.h, not in the tree"),
+    plain(exact("RM580312"), kOpsbOverride, 1, 1, "one byte: 0 disable, 1 enable"),
+    records(exact("RmBlackListAddresses"), kPageAddress, 8, 0, 0,
+            "NvU64 addresses[NV2080_CTRL_FB_OFFLINED_PAGES_MAX_PAGES]"),
+    opaque(exact("RmBlobData"), "SBIOS blob parameter override"),
+    opaque(exact("RMPsdlCert"), "PSDL license"),
+    opaque(exact("RMHulkCert"), "HULK license"),
+    opaque({"AcpiDsmShimThirdArgument", 24, BlobSuffix::Decimal, 0}, "_DSM argument"),
+    opaque({"AcpiDsmShimReturnData", 21, BlobSuffix::Decimal, 0}, "_DSM return data"),
+    plain(exact("RmSuppressXidDump"), kXidList, 0, 64, "comma-separated XIDs, e.g. 43,31"),
+};
+
+// Every BINARY key in the catalog has a schema, and every schema is for one.
+// Keys are looked up by index, not through find(): GCC does not take a
+// pointer's comparison with null as constant under -fsanitize=undefined.
+constexpr bool covers_catalog()
+{
+    size_t binary = 0;
+    for (const Key& k : kKeys)
+        binary += k.type == KeyType::Binary;
+    if (binary != sizeof kBlobSchemas / sizeof kBlobSchemas[0])
+        return false;
+    for (const BlobSchema& s : kBlobSchemas) {
+        uint16_t i = kIndex.lookup(hash_name(s.key));
+        if (i == PerfectHash::kEmpty || !iequals(kKeys[i].name, s.key) || kKeys[i].type != KeyType::Binary)
+            return false;
+    }
+    return true;
+}
+static_assert(covers_catalog(), "kBlobSchemas is out of step with the catalog");
+
+uint64_t read_le(const uint8_t* p, size_t size)
+{
+    uint64_t v = 0;
+    for (size_t i = size; i-- > 0;)
+        v = v << 8 | p[i];
+    return v;
+}
+
+void write_le(uint8_t* p, size_t size, uint64_t v)
+{
+    for (size_t i = 0; i < size; ++i, v >>= 8)
+        p[i] = uint8_t(v);
+}
+
+const BlobField* tail_of(const BlobSchema& s)
+{
+    for (size_t i = 0; i < s.field_count; ++i)
+        if (s.fields[i].tail())
+            return &s.fields[i];
+    return nullptr;
+}
+
+bool is_text(const BlobSchema& s)
+{
+    return s.field_count > 0
+        && (s.fields[0].kind == BlobKind::Text || s.fields[0].kind == BlobKind::Item);
+}
+
+// Bits of a partially used integer that no field covers, e.g. 7:2 of the
+// RMSbiosEnableASPMDT byte.
+bool check_reserved(const BlobView& v, const BlobField* fields, size_t count, size_t base,
+                    std::string* why)
+{
+    for (size_t i = 0; i < count; ++i) {
+        const BlobField& f = fields[i];
+        if (!f.partial())
+            continue;
+        uint64_t used = 0;
+        for (size_t j = 0; j < count; ++j)
+            if (fields[j].kind == BlobKind::Uint && fields[j].offset == f.offset)
+                used |= fields[j].max() << fields[j].lo;
+        uint64_t raw = read_le(v.data() + base + f.offset, f.size);
+        if (raw & ~used) {
+            char buf[96];
+            std::snprintf(buf, sizeof buf, "byte %zu has reserved bits 0x%llx set",
+                          base + f.offset, (unsigned long long)(raw & ~used));
+            return fail(why, buf);
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+const BlobSchema* blob_schemas()
+{
+    return kBlobSchemas;
+}
+
+size_t blob_schema_count()
+{
+    return sizeof kBlobSchemas / sizeof kBlobSchemas[0];
+}
+
+const BlobSchema* find_blob_schema(std::string_view value_name)
+{
+    for (const BlobSchema& s : kBlobSchemas) {
+        if (value_name.size() < s.stem || !iequals(value_name.substr(0, s.stem), s.key.substr(0, s.stem)))
+            continue;
+        std::string_view rest = value_name.substr(s.stem);
+        bool ok = true;
+        switch (s.suffix) {
+        case BlobSuffix::None:
+            ok = rest.empty();
+            break;
+        case BlobSuffix::Hex:
+            ok = rest.size() == s.suffix_digits;
+            for (char c : rest)
+                ok = ok && hex_digit(c) >= 0;
+            break;
+        case BlobSuffix::Decimal:
+            ok = s.suffix_digits == 0 || rest.size() == s.suffix_digits;
+            for (char c : rest)
+                ok = ok && std::isdigit(uint8_t(c));
+            break;
+        }
+        if (ok)
+            return &s;
+    }
+    return nullptr;
+}
+
+std::string_view BlobView::text() const
+{
+    std::string_view t(reinterpret_cast<const char*>(data_), size_);
+    size_t nul = t.find('\0');
+    return nul == std::string_view::npos ? t : t.substr(0, nul);
+}
+
+size_t BlobView::record_count() const
+{
+    const BlobSchema& s = *schema_;
+    if (s.record_size == 0)
+        return 0;
+    if (s.record_count >= 0)
+        return size_t(number(s.fields[s.record_count]).value_or(0));
+    size_t header = s.header_size();
+    return size_ > header ? (size_ - header) / s.record_size : 0;
+}
+
+const BlobField* BlobView::field(std::string_view name) const
+{
+    const BlobSchema& s = *schema_;
+    for (size_t i = 0; i < s.field_count; ++i)
+        if (s.fields[i].name == name)
+            return &s.fields[i];
+    for (size_t i = 0; i < s.record_field_count; ++i)
+        if (s.record[i].name == name)
+            return &s.record[i];
+    return nullptr;
+}
+
+bool BlobView::is_record_field(const BlobField& f) const
+{
+    return schema_->record && &f >= schema_->record && &f < schema_->record + schema_->record_field_count;
+}
+
+std::optional<size_t> BlobView::start(const BlobField& f, size_t record) const
+{
+    size_t at = f.offset;
+    if (is_record_field(f))
+        at += schema_->header_size() + record * schema_->record_size;
+    if (at > size_)
+        return std::nullopt;
+    return at;
+}
+
+std::optional<uint64_t> BlobView::number(const BlobField& f, size_t record) const
+{
+    auto at = start(f, record);
+    if (f.kind != BlobKind::Uint || !at || *at + f.size > size_)
+        return std::nullopt;
+    return (read_le(data_ + *at, f.size) >> f.lo) & f.max();
+}
+
+std::optional<uint64_t> BlobView::number(std::string_view name, size_t record) const
+{
+    const BlobField* f = field(name);
+    return f ? number(*f, record) : std::nullopt;
+}
+
+std::optional<std::string_view> BlobView::bytes(const BlobField& f, size_t record) const
+{
+    if (f.kind == BlobKind::Text)
+        return text();
+    if (f.kind == BlobKind::Item) {
+        std::string_view t = text();
+        for (size_t i = 0; i < f.offset; ++i) {
+            size_t comma = t.find(',');
+            if (comma == std::string_view::npos)
+                return std::nullopt;
+            t.remove_prefix(comma + 1);
+        }
+        return t.substr(0, t.find(','));
+    }
+    auto at = start(f, record);
+    if (f.kind != BlobKind::Bytes || !at)
+        return std::nullopt;
+    size_t n = f.size;
+    if (f.tail()) {
+        n = size_ - *at;
+        if (f.count >= 0) {
+            auto c = number(schema_->fields[f.count]);
+            if (!c || *c > n)
+                return std::nullopt;
+            n = size_t(*c);
+        }
+    }
+    if (*at + n > size_)
+        return std::nullopt;
+    return std::string_view(reinterpret_cast<const char*>(data_) + *at, n);
+}
+
+std::optional<std::string_view> BlobView::bytes(std::string_view name, size_t record) const
+{
+    const BlobField* f = field(name);
+    return f ? bytes(*f, record) : std::nullopt;
+}
+
+bool BlobView::check(std::string* why) const
+{
+    const BlobSchema& s = *schema_;
+    if (size_ < s.min_size)
+        return fail(why, std::to_string(size_) + " bytes, needs at least " + std::to_string(s.min_size));
+    if (s.max_size && size_ > s.max_size)
+        return fail(why, std::to_string(size_) + " bytes, at most " + std::to_string(s.max_size) + " allowed");
+
+    if (is_text(s)) {
+        std::string_view t = text();
+        for (size_t i = t.size(); i < size_; ++i)
+            if (data_[i] != 0)
+                return fail(why, "data after the NUL at byte " + std::to_string(t.size()));
+        for (char c : t)
+            if (uint8_t(c) < 0x20 || uint8_t(c) > 0x7e)
+                return fail(why, "not ASCII text");
+        if (s.fields[0].kind == BlobKind::Item) {
+            size_t items = 1;
+            for (char c : t)
+                items += c == ',';
+            if (items > s.field_count)
+                return fail(why, std::to_string(items) + " items, the layout has "
+                            + std::to_string(s.field_count));
+        }
+        return true;
+    }
+
+    const size_t header = s.header_size();
+    if (size_ < header)
+        return fail(why, std::to_string(size_) + " bytes, the header alone is " + std::to_string(header));
+    if (!check_reserved(*this, s.fields, s.field_count, 0, why))
+        return false;
+
+    if (const BlobField* t = tail_of(s)) {
+        if (t->count >= 0) {
+            uint64_t n = *number(s.fields[t->count]);
+            if (header + n != size_)
+                return fail(why, std::string(s.fields[t->count].name) + " is " + std::to_string(n)
+                            + " but " + std::to_string(size_ - header) + " bytes follow the header");
+        }
+        return true;
+    }
+    if (s.record_size == 0) {
+        if (size_ != header)
+            return fail(why, std::to_string(size_) + " bytes, the layout has " + std::to_string(header));
+        return true;
+    }
+
+    const size_t body = size_ - header;
+    if (s.record_count >= 0) {
+        size_t n = record_count();
+        if (n * s.record_size != body)
+            return fail(why, std::string(s.fields[s.record_count].name) + " is " + std::to_string(n)
+                        + " but " + std::to_string(body) + " bytes of "
+                        + std::to_string(s.record_size) + "-byte entries follow the header");
+    } else if (body % s.record_size) {
+        return fail(why, std::to_string(body) + " bytes is not a whole number of "
+                    + std::to_string(s.record_size) + "-byte entries");
+    }
+    for (size_t r = 0, n = record_count(); r < n; ++r)
+        if (!check_reserved(*this, s.record, s.record_field_count, header + r * s.record_size, why))
+            return false;
+    return true;
+}
+
+std::vector<BlobValue> decode_blob(const BlobView& view)
+{
+    const BlobSchema& s = view.schema();
+    std::vector<BlobValue> out;
+    auto add = [&](const BlobField& f, size_t record) {
+        if (f.kind == BlobKind::Uint) {
+            if (auto n = view.number(f, record))
+                out.push_back({f.name, uint32_t(record), *n, {}});
+        } else if (auto b = view.bytes(f, record)) {
+            out.push_back({f.name, uint32_t(record), 0, std::string(*b)});
+        }
+    };
+    for (size_t i = 0; i < s.field_count; ++i)
+        add(s.fields[i], 0);
+    for (size_t r = 0, n = view.record_count(); r < n; ++r)
+        for (size_t i = 0; i < s.record_field_count; ++i)
+            add(s.record[i], r);
+    return out;
+}
+
+bool encode_blob(const BlobSchema& s, const std::vector<BlobValue>& values,
+                 std::vector<uint8_t>& out, std::string* why)
+{
+    // Resolve the fields first: the record count and the tail decide the size.
+    BlobView shape(s, nullptr, 0);
+    std::vector<const BlobField*> fields(values.size());
+    size_t records = 0;
+    const BlobField* tail = tail_of(s);
+    const BlobValue* tail_value = nullptr;
+    std::vector<const BlobValue*> items;
+    for (size_t i = 0; i < values.size(); ++i) {
+        const BlobValue& v = values[i];
+        const BlobField* f = shape.field(v.field);
+        if (!f)
+            return fail(why, std::string(s.key) + " has no field " + std::string(v.field));
+        if (shape.is_record_field(*f))
+            records = v.record + 1 > records ? v.record + 1 : records;
+        else if (v.record != 0)
+            return fail(why, std::string(v.field) + " is not part of an entry");
+        if (f == tail)
+            tail_value = &v;
+        if (f->kind == BlobKind::Item) {
+            if (items.size() <= f->offset)
+                items.resize(f->offset + 1);
+            items[f->offset] = &v;
+        }
+        fields[i] = f;
+    }
+
+    if (is_text(s)) {
+        std::string t;
+        if (s.fields[0].kind == BlobKind::Text) {
+            if (!values.empty())
+                t = values.back().bytes;
+        } else {
+            for (size_t i = 0; i < items.size(); ++i) {
+                if (i)
+                    t += ',';
+                if (items[i])
+                    t += items[i]->bytes;
+            }
+        }
+        out.assign(t.begin(), t.end());
+        return BlobView(s, out.data(), out.size()).check(why);
+    }
+
+    const size_t header = s.header_size();
+    const size_t tail_size = tail_value ? tail_value->bytes.size() : 0;
+    out.assign(header + tail_size + records * s.record_size, 0);
+    if (tail_value)
+        std::copy(tail_value->bytes.begin(), tail_value->bytes.end(), out.begin() + tail->offset);
+
+    auto put = [&](const BlobField& f, size_t at, uint64_t n) {
+        if (n > f.max())
+            return fail(why, std::string(f.name) + " = " + std::to_string(n) + " does not fit in "
+                        + std::to_string(f.hi - f.lo + 1) + " bits");
+        uint64_t mask = f.max() << f.lo;
+        uint64_t raw = read_le(out.data() + at, f.size);
+        write_le(out.data() + at, f.size, (raw & ~mask) | n << f.lo);
+        return true;
+    };
+    std::vector<bool> given(s.field_count, false);
+    for (size_t i = 0; i < values.size(); ++i) {
+        const BlobField& f = *fields[i];
+        const BlobValue& v = values[i];
+        size_t at = f.offset;
+        if (shape.is_record_field(f))
+            at += header + v.record * s.record_size;
+        else
+            given[&f - s.fields] = true;
+        if (f.kind == BlobKind::Uint) {
+            if (!put(f, at, v.number))
+                return false;
+        } else if (!f.tail()) {
+            if (v.bytes.size() != f.size)
+                return fail(why, std::string(f.name) + " is " + std::to_string(f.size) + " bytes, got "
+                            + std::to_string(v.bytes.size()));
+            std::copy(v.bytes.begin(), v.bytes.end(), out.begin() + at);
+        }
+    }
+    if (tail && tail->count >= 0 && !given[tail->count]
+        && !put(s.fields[tail->count], s.fields[tail->count].offset, tail_size))
+        return false;
+    if (s.record_size && s.record_count >= 0 && !given[s.record_count]
+        && !put(s.fields[s.record_count], s.fields[s.record_count].offset, records))
+        return false;
+    return BlobView(s, out.data(), out.size()).check(why);
+}
+
+std::vector<BlobChange> diff_blobs(const BlobView& a, const BlobView& b)
+{
+    const BlobSchema& s = a.schema();
+    std::vector<BlobChange> out;
+    auto same = [&](const BlobField& f, size_t ra, size_t rb) {
+        if (f.kind == BlobKind::Uint)
+            return a.number(f, ra) == b.number(f, rb);
+        return a.bytes(f, ra) == b.bytes(f, rb);
+    };
+    for (size_t i = 0; i < s.field_count; ++i)
+        if (!same(s.fields[i], 0, 0))
+            out.push_back({&s.fields[i], 0});
+    const size_t na = a.record_count(), nb = b.record_count();
+    for (size_t r = 0; r < (na > nb ? na : nb); ++r)
+        for (size_t i = 0; i < s.record_field_count; ++i)
+            if (r >= na || r >= nb || !same(s.record[i], r, r))
+                out.push_back({&s.record[i], uint32_t(r)});
+    return out;
+}
+
+std::optional<std::vector<uint8_t>> parse_hex(std::string_view text)
+{
+    if (text.size() >= 4 && iequals(text.substr(0, 4), "hex:"))
+        text.remove_prefix(4);
+    std::vector<uint8_t> out;
+    out.reserve(text.size() / 3 + 1);
+    for (size_t i = 0; i < text.size();) {
+        char c = text[i];
+        if (c == ',' || c == '\\' || std::isspace(uint8_t(c))) {
+            ++i;
+            continue;
+        }
+        int hi = hex_digit(c);
+        if (hi < 0)
+            return std::nullopt;
+        int lo = i + 1 < text.size() ? hex_digit(text[i + 1]) : -1;
+        if (lo < 0) {
+            out.push_back(uint8_t(hi));
+            ++i;
+        } else {
+            out.push_back(uint8_t(hi << 4 | lo));
+            i += 2;
+        }
+    }
+    return out;
+}
+
+std::string format_reg_hex(std::string_view name, const std::vector<uint8_t>& bytes)
+{
+    std::string out = "\"";
+    for (char c : name) {
+        if (c == '"' || c == '\\')
+            out += '\\';
+        out += c;
+    }
+    out += "\"=hex:";
+    size_t line = out.size();
+    for (size_t i = 0; i < bytes.size(); ++i) {
+        char buf[4];
+        std::snprintf(buf, sizeof buf, i + 1 < bytes.size() ? "%02x," : "%02x", bytes[i]);
+        // regedit keeps lines, continuation backslash included, within 80 columns.
+        if (line + 3 > 78) {
+            out += "\\\n  ";
+            line = 2;
+        }
+        out += buf;
+        line += 3;
+    }
+    return out;
+}
+
+} // namespace rmreg
@@ -0,0 +1,181 @@
+// rmreg_blob.h
+//
+// Layouts of the BINARY keys in nvRmReg.h, and a view that reads a blob in
+// place. The header describes these layouts only in comments, e.g. "Bytes 5-8:
+// 32 bit offset (Byte 5 - Least significant byte)". kBlobSchemas writes each
+// layout down as a table of fields, so a captured blob can be checked and
+// printed field by field, and a new one built without hand-assembling hex:
+//
+//   const rmreg::BlobSchema* s = rmreg::find_blob_schema("romOverride0A");
+//   rmreg::BlobView v(*s, bytes.data(), bytes.size());
+//   if (v.check())
+//       offset = *v.number("offset");
+//
+// A blob is a fixed header, followed by either a tail or an array of fixed-size
+// records. A tail is bytes counted by a header field, or the rest of the blob.
+// A record array is counted by a header field or runs to the end. Integers are
+// little-endian. Some keys have no format in the header (OverDriveData0 only
+// names a bug number). Those keys have a single opaque "data" field.
+
+#ifndef NVTOOLS_RMREG_BLOB_H
+#define NVTOOLS_RMREG_BLOB_H
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace rmreg {
+
+enum class BlobKind : uint8_t {
+    Uint,       // 1, 2, 4 or 8 byte integer, or bits hi:lo of one
+    Bytes,      // size bytes; a tail when size is 0
+    Text,       // ASCII to the end of the blob or the first NUL
+    Item,       // one comma-separated item of the text, offset is its number
+};
+
+struct BlobField {
+    std::string_view name;
+    BlobKind kind;
+    uint16_t offset;            // in the header or the record
+    uint16_t size;              // bytes
+    uint8_t hi, lo;             // Uint: the bits used, hi < 8 * size
+    int8_t count;               // tail: header field with its length, -1 = to the end
+
+    constexpr bool partial() const { return kind == BlobKind::Uint && (lo != 0 || hi != size * 8 - 1); }
+    constexpr bool tail() const { return kind == BlobKind::Bytes && size == 0; }
+    constexpr uint64_t max() const { return hi - lo == 63 ? ~0ull : (1ull << (hi - lo + 1)) - 1; }
+};
+
+// How value names are numbered: "romOverride" is read as romOverride00 ..
+// romOverrideFF, "Panel00" as Panel00 .. Panel0F.
+enum class BlobSuffix : uint8_t {
+    None,
+    Hex,                        // exactly suffix_digits hex digits
+    Decimal,                    // exactly suffix_digits decimal digits, any number if 0
+};
+
+struct BlobSchema {
+    std::string_view key;       // value name as in the catalog
+    uint8_t stem;               // key[0, stem) is the fixed part of the name
+    BlobSuffix suffix;
+    uint8_t suffix_digits;
+    const BlobField* fields;    // header, then the tail if there is one
+    uint8_t field_count;
+    const BlobField* record;
+    uint8_t record_field_count;
+    uint16_t record_size;       // 0 = no records
+    int8_t record_count;        // header field with the record count, -1 = to the end
+    uint32_t min_size;
+    uint32_t max_size;          // 0 = no limit
+    std::string_view note;      // where the layout comes from
+
+    // A single tail field: the header does not give the format.
+    constexpr bool opaque() const
+    {
+        return field_count == 1 && record_size == 0 && fields[0].kind == BlobKind::Bytes
+            && fields[0].size == 0 && fields[0].count < 0;
+    }
+
+    // Bytes before the tail or the records.
+    constexpr size_t header_size() const
+    {
+        size_t n = 0;
+        for (size_t i = 0; i < field_count; ++i)
+            if ((fields[i].kind == BlobKind::Uint || fields[i].kind == BlobKind::Bytes)
+                && fields[i].offset + fields[i].size > n)
+                n = fields[i].offset + fields[i].size;
+        return n;
+    }
+};
+
+// Every BINARY key in the catalog, one entry per key.
+const BlobSchema* blob_schemas();
+size_t blob_schema_count();
+
+// Matches numbered names too ("OverrideEdidFlags3", "Static EDID 0x00001234").
+// Case-insensitive, like the registry.
+const BlobSchema* find_blob_schema(std::string_view value_name);
+
+// Reads a blob where it lies; nothing is copied. Byte and text values come
+// back as views into the blob.
+class BlobView {
+public:
+    BlobView(const BlobSchema& schema, const uint8_t* data, size_t size)
+        : schema_(&schema), data_(data), size_(size)
+    {
+    }
+
+    const BlobSchema& schema() const { return *schema_; }
+    const uint8_t* data() const { return data_; }
+    size_t size() const { return size_; }
+
+    // Whether the blob has the schema's shape. If it does not and why is
+    // given, why says what is wrong.
+    bool check(std::string* why = nullptr) const;
+
+    // Records present, from the count field or from the size.
+    size_t record_count() const;
+
+    // A header or record field by name, nullptr if the schema has none.
+    const BlobField* field(std::string_view name) const;
+    bool is_record_field(const BlobField& f) const;
+
+    // Uint fields; nullopt if the field lies outside the blob.
+    std::optional<uint64_t> number(const BlobField& f, size_t record = 0) const;
+    std::optional<uint64_t> number(std::string_view name, size_t record = 0) const;
+
+    // Bytes, Text and Item fields.
+    std::optional<std::string_view> bytes(const BlobField& f, size_t record = 0) const;
+    std::optional<std::string_view> bytes(std::string_view name, size_t record = 0) const;
+
+private:
+    std::optional<size_t> start(const BlobField& f, size_t record) const;
+    std::string_view text() const;
+
+    const BlobSchema* schema_;
+    const uint8_t* data_;
+    size_t size_;
+};
+
+// One field of a decoded blob, or one to encode. field refers to a name in
+// the schema when it comes from decode_blob.
+struct BlobValue {
+    std::string_view field;
+    uint32_t record;            // 0 for header fields
+    uint64_t number;            // Uint
+    std::string bytes;          // Bytes, Text, Item
+};
+
+// Every field of a blob that passes check(), header first, then the
+// records in order.
+std::vector<BlobValue> decode_blob(const BlobView& view);
+
+// Builds a blob from field values. Fields that are not given are zero.
+// Count fields are filled in from the tail and the records when they are not
+// given. For any blob that passes check(), encode_blob(decode_blob(v))
+// returns the same bytes. The one exception is NUL padding after text,
+// which is dropped.
+bool encode_blob(const BlobSchema& schema, const std::vector<BlobValue>& values,
+                 std::vector<uint8_t>& out, std::string* why = nullptr);
+
+struct BlobChange {
+    const BlobField* field;
+    uint32_t record;
+};
+
+// Fields whose values differ. Records that exist in only one of the blobs
+// count as changed in every field.
+std::vector<BlobChange> diff_blobs(const BlobView& a, const BlobView& b);
+
+// Accepts regedit's hex:01,02,\ with continuation lines, "01 02" and "0102".
+std::optional<std::vector<uint8_t>> parse_hex(std::string_view text);
+
+// "name"=hex:.. wrapped the way regedit wraps it.
+std::string format_reg_hex(std::string_view name, const std::vector<uint8_t>& bytes);
+
+} // namespace rmreg
+
+#endif // NVTOOLS_RMREG_BLOB_H
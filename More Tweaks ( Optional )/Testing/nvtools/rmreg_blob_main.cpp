@@ -0,0 +1,207 @@
+// rmreg_blob_main.cpp
+//
+//   rmreg_blob list
+//   rmreg_blob show <value name> <hex>
+//   rmreg_blob encode <value name> [field=value | field[entry]=value ...]
+//   rmreg_blob diff <value name> <hex> <hex>
+//
+// show checks a blob against its layout and prints it field by field, exiting
+// with 1 if it does not fit. encode prints a .reg line. Numbers take 0x
+// for hex, byte fields take hex, text fields are taken as they are. diff
+// exits with 1 if the blobs differ.
+
+#include "rmreg_blob.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace {
+
+const rmreg::BlobSchema* schema_for(const char* name)
+{
+    const rmreg::BlobSchema* s = rmreg::find_blob_schema(name);
+    if (!s)
+        std::fprintf(stderr, "error: %s is not a BINARY key in nvRmReg.h\n", name);
+    return s;
+}
+
+void print_bytes(std::string_view b)
+{
+    for (size_t i = 0; i < b.size(); ++i) {
+        if (i && i % 16 == 0)
+            std::printf("\n%23s", "");
+        std::printf(i % 16 ? " %02x" : "%02x", uint8_t(b[i]));
+    }
+    std::printf("\n");
+}
+
+void print_field(const rmreg::BlobView& v, const rmreg::BlobField& f, size_t record)
+{
+    char label[64];
+    if (v.is_record_field(f))
+        std::snprintf(label, sizeof label, "%.*s[%zu]", int(f.name.size()), f.name.data(), record);
+    else
+        std::snprintf(label, sizeof label, "%.*s", int(f.name.size()), f.name.data());
+    std::printf("  %-20s ", label);
+    if (f.kind == rmreg::BlobKind::Uint) {
+        if (auto n = v.number(f, record))
+            std::printf("0x%0*llx (%llu)\n", int(f.hi - f.lo + 4) / 4, (unsigned long long)*n,
+                        (unsigned long long)*n);
+        else
+            std::printf("-\n");
+    } else if (auto b = v.bytes(f, record)) {
+        if (f.kind == rmreg::BlobKind::Bytes)
+            print_bytes(*b);
+        else
+            std::printf("\"%.*s\"\n", int(b->size()), b->data());
+    } else {
+        std::printf("-\n");
+    }
+}
+
+int list()
+{
+    for (size_t i = 0; i < rmreg::blob_schema_count(); ++i) {
+        const rmreg::BlobSchema& s = rmreg::blob_schemas()[i];
+        std::printf("%-26.*s %s%.*s\n", int(s.key.size()), s.key.data(), s.opaque() ? "opaque, " : "",
+                    int(s.note.size()), s.note.data());
+        if (s.opaque())
+            continue;
+        for (size_t f = 0; f < s.field_count; ++f)
+            std::printf("    %.*s\n", int(s.fields[f].name.size()), s.fields[f].name.data());
+        for (size_t f = 0; f < s.record_field_count; ++f)
+            std::printf("    %.*s[]\n", int(s.record[f].name.size()), s.record[f].name.data());
+    }
+    return 0;
+}
+
+int show(const char* name, const char* hex)
+{
+    const rmreg::BlobSchema* s = schema_for(name);
+    if (!s)
+        return 1;
+    auto bytes = rmreg::parse_hex(hex);
+    if (!bytes) {
+        std::fprintf(stderr, "error: %s is not hex\n", hex);
+        return 1;
+    }
+    rmreg::BlobView v(*s, bytes->data(), bytes->size());
+    std::string why;
+    bool ok = v.check(&why);
+    std::printf("%s: %zu bytes, %.*s\n", name, bytes->size(), int(s->note.size()), s->note.data());
+    if (!ok) {
+        std::printf("error: %s\n", why.c_str());
+        return 1;
+    }
+    for (size_t f = 0; f < s->field_count; ++f)
+        if (s->fields[f].kind != rmreg::BlobKind::Item || v.bytes(s->fields[f]))
+            print_field(v, s->fields[f], 0);
+    for (size_t r = 0; r < v.record_count(); ++r)
+        for (size_t f = 0; f < s->record_field_count; ++f)
+            print_field(v, s->record[f], r);
+    return 0;
+}
+
+// field=value or field[entry]=value.
+bool parse_assignment(const rmreg::BlobSchema& s, const char* arg, rmreg::BlobValue& out)
+{
+    const char* eq = std::strchr(arg, '=');
+    if (!eq)
+        return false;
+    std::string_view lhs(arg, size_t(eq - arg));
+    out.record = 0;
+    if (size_t open = lhs.find('['); open != std::string_view::npos && lhs.back() == ']') {
+        out.record = uint32_t(std::strtoul(std::string(lhs.substr(open + 1)).c_str(), nullptr, 0));
+        lhs = lhs.substr(0, open);
+    }
+    rmreg::BlobView shape(s, nullptr, 0);
+    const rmreg::BlobField* f = shape.field(lhs);
+    if (!f)
+        return false;
+    out.field = f->name;
+    const char* value = eq + 1;
+    if (f->kind == rmreg::BlobKind::Uint) {
+        char* end = nullptr;
+        out.number = std::strtoull(value, &end, 0);
+        return *value && *end == '\0';
+    }
+    if (f->kind == rmreg::BlobKind::Bytes) {
+        auto b = rmreg::parse_hex(value);
+        if (!b)
+            return false;
+        out.bytes.assign(b->begin(), b->end());
+        return true;
+    }
+    out.bytes = value;
+    return true;
+}
+
+int encode(const char* name, int count, char** args)
+{
+    const rmreg::BlobSchema* s = schema_for(name);
+    if (!s)
+        return 1;
+    std::vector<rmreg::BlobValue> values(static_cast<size_t>(count));
+    for (int i = 0; i < count; ++i) {
+        if (!parse_assignment(*s, args[i], values[size_t(i)])) {
+            std::fprintf(stderr, "error: %s: not field=value for %s\n", args[i], name);
+            return 1;
+        }
+    }
+    std::vector<uint8_t> out;
+    std::string why;
+    if (!rmreg::encode_blob(*s, values, out, &why)) {
+        std::fprintf(stderr, "error: %s\n", why.c_str());
+        return 1;
+    }
+    std::printf("%s\n", rmreg::format_reg_hex(name, out).c_str());
+    return 0;
+}
+
+int diff(const char* name, const char* hex_a, const char* hex_b)
+{
+    const rmreg::BlobSchema* s = schema_for(name);
+    if (!s)
+        return 1;
+    auto a = rmreg::parse_hex(hex_a), b = rmreg::parse_hex(hex_b);
+    if (!a || !b) {
+        std::fprintf(stderr, "error: %s is not hex\n", a ? hex_b : hex_a);
+        return 1;
+    }
+    rmreg::BlobView va(*s, a->data(), a->size()), vb(*s, b->data(), b->size());
+    std::string why;
+    if (!va.check(&why) || !vb.check(&why)) {
+        std::fprintf(stderr, "error: %s\n", why.c_str());
+        return 1;
+    }
+    std::vector<rmreg::BlobChange> changes = rmreg::diff_blobs(va, vb);
+    for (const rmreg::BlobChange& c : changes) {
+        std::printf("-");
+        print_field(va, *c.field, c.record);
+        std::printf("+");
+        print_field(vb, *c.field, c.record);
+    }
+    return changes.empty() ? 0 : 1;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc >= 2 && std::strcmp(argv[1], "list") == 0)
+        return list();
+    if (argc == 4 && std::strcmp(argv[1], "show") == 0)
+        return show(argv[2], argv[3]);
+    if (argc >= 3 && std::strcmp(argv[1], "encode") == 0)
+        return encode(argv[2], argc - 3, argv + 3);
+    if (argc == 5 && std::strcmp(argv[1], "diff") == 0)
+        return diff(argv[2], argv[3], argv[4]);
+    std::fprintf(stderr,
+                 "usage: rmreg_blob list\n"
+                 "       rmreg_blob show <value name> <hex>\n"
+                 "       rmreg_blob encode <value name> [field=value | field[entry]=value ...]\n"
+                 "       rmreg_blob diff <value name> <hex> <hex>\n");
+    return 2;
+}
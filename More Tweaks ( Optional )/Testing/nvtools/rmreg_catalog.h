@@ -0,0 +1,1703 @@
+// rmreg_catalog.h
+//
+// Generated by rmreg_gen from nvRmReg.h - do not edit.
+
+#ifndef NVTOOLS_RMREG_CATALOG_H
+#define NVTOOLS_RMREG_CATALOG_H
+
+#include "rmreg.h"
+
+namespace rmreg {
+
+// Config symbols the header's #if lines test; bit i of a TruthTable
+// assignment is kSymbols[i].
+inline constexpr std::string_view kSymbols[8] = {
+    "DEBUG",
+    "QA_BUILD",
+    "RMCFG_FEATURE_PLATFORM_GSP",
+    "NV_VERIF_FEATURES",
+    "NV_MODS",
+    "DEVELOP",
+    "RMCFG_FEATURE_VIRTUALIZATION",
+    "RMCFG_MODULE_CONF_COMPUTE",
+};
+
+inline constexpr Condition kConditions[9] = {
+    {"", {{0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff}}},
+    {"((defined(DEBUG) || defined(QA_BUILD)) && (!defined(RMCFG_FEATURE_PLATFORM_GSP) || (defined(RMCFG_FEATURE_PLATFORM_GSP) && !RMCFG_FEATURE_PLATFORM_GSP)))", {{0x0e0e0e0e0e0e0e0e, 0x0e0e0e0e0e0e0e0e, 0x0e0e0e0e0e0e0e0e, 0x0e0e0e0e0e0e0e0e}}},
+    {"!(((defined(DEBUG) || defined(QA_BUILD)) && (!defined(RMCFG_FEATURE_PLATFORM_GSP) || (defined(RMCFG_FEATURE_PLATFORM_GSP) && !RMCFG_FEATURE_PLATFORM_GSP))))", {{0xf1f1f1f1f1f1f1f1, 0xf1f1f1f1f1f1f1f1, 0xf1f1f1f1f1f1f1f1, 0xf1f1f1f1f1f1f1f1}}},
+    {"NV_VERIF_FEATURES", {{0xff00ff00ff00ff00, 0xff00ff00ff00ff00, 0xff00ff00ff00ff00, 0xff00ff00ff00ff00}}},
+    {"NV_MODS", {{0xffff0000ffff0000, 0xffff0000ffff0000, 0xffff0000ffff0000, 0xffff0000ffff0000}}},
+    {"defined(DEBUG) || defined(DEVELOP)", {{0xffffffffaaaaaaaa, 0xffffffffaaaaaaaa, 0xffffffffaaaaaaaa, 0xffffffffaaaaaaaa}}},
+    {"defined(DEVELOP) || defined(DEBUG) || defined(NV_MODS)", {{0xffffffffffffaaaa, 0xffffffffffffaaaa, 0xffffffffffffaaaa, 0xffffffffffffaaaa}}},
+    {"(defined(RMCFG_FEATURE_VIRTUALIZATION) && RMCFG_FEATURE_VIRTUALIZATION)", {{0x0000000000000000, 0xffffffffffffffff, 0x0000000000000000, 0xffffffffffffffff}}},
+    {"(defined(RMCFG_MODULE_CONF_COMPUTE) && RMCFG_MODULE_CONF_COMPUTE)", {{0x0000000000000000, 0x0000000000000000, 0xffffffffffffffff, 0xffffffffffffffff}}},
+};
+
+// Retail driver: DEBUG, DEVELOP, QA_BUILD, NV_MODS and NV_VERIF_FEATURES
+// off, RMCFG_* features either way.
+inline constexpr Variant kRelease{0x00, 0x3b};
+
+inline constexpr FieldDesc kFields[608] = {
+    {"ENABLE", 1, 0, 0},
+    {"VBLANK_COUNT", 15, 8, 0},
+    {"TODECREASE_COUNT", 23, 16, 0},
+    {"INERTIA_COUNT", 31, 24, 0},
+    {"ENABLE", 0, 0, 0},
+    {"LOWER_MCLK", 1, 1, 0},
+    {"DELAY_4MS", 15, 8, 0},
+    {"TARGET_PERCENT_HIGH", 23, 16, 0},
+    {"TARGET_PERCENT_LOW", 31, 24, 0},
+    {"DENOM", 7, 0, 0},
+    {"NUM", 15, 8, 0},
+    {"AC", 16, 16, 0},
+    {"DECOUPLED_DOMAINS", 1, 1, 0},
+    {"INTERVAL_MS", 15, 0, 0},
+    {"LOWERING", 23, 16, 0},
+    {"BOOST", 31, 24, 0},
+    {"NV_LINK_UPGRADE", 1, 0, 0},
+    {"HOT_RESET", 5, 4, 0},
+    {"FAST_UPGRADE", 9, 8, 0},
+    {"GEN2_LINK_UPGRADE", 11, 10, 0},
+    {"READ", 1, 0, 0},
+    {"WRITE", 5, 4, 0},
+    {"DISABLE", 0, 0, 0},
+    {"LIMITS", 1, 1, 0},
+    {"RATED_LIMIT", 2, 2, 0},
+    {"INTEGRAL_CONTROL", 3, 3, 0},
+    {"MIN_CLIENT_SAMPLE_PERIOD", 19, 4, 0},
+    {"HIGH_POWER_FIT_ONLY", 0, 0, 0},
+    {"DISABLE", 0, 0, 0},
+    {"VALUE", 6, 0, 0},
+    {"RSVD", 31, 8, 0},
+    {"VALUE", 4, 0, 0},
+    {"RSVD", 31, 5, 0},
+    {"VALUE", 8, 0, 0},
+    {"RSVD", 31, 9, 0},
+    {"VALUE", 3, 0, 0},
+    {"RSVD", 31, 4, 0},
+    {"VALUE", 1, 0, 0},
+    {"RSVD", 31, 3, 0},
+    {"SKIP_RESTORE_BOOT_STATE_ON_UNLOAD", 0, 0, 0},
+    {"RSVD", 31, 1, 0},
+    {"LOAD", 0, 0, 0},
+    {"TRRD_WAR", 2, 1, 0},
+    {"RSVD", 31, 3, 0},
+    {"DLPPC_1X", 0, 0, 0},
+    {"GSP_UTIL", 2, 1, 0},
+    {"CLFC", 0, 0, 0},
+    {"CLVC", 1, 1, 0},
+    {"RSVD", 31, 2, 0},
+    {"LOCK", 0, 0, 0},
+    {"SKIP_VOLT_RANGE_TRIM", 1, 1, 0},
+    {"RSVD", 31, 2, 0},
+    {"LOCK", 1, 0, 0},
+    {"CACHING_ENABLE", 3, 2, 0},
+    {"ARBITRATE_AND_APPLY_WORKITEM", 5, 4, 0},
+    {"RSVD", 31, 6, 0},
+    {"MCLK", 4, 4, 0},
+    {"UNUSED", 7, 0, 0},
+    {"VBIOSRW", 9, 8, 0},
+    {"DXGKIFACE", 11, 10, 0},
+    {"LEVELS", 13, 12, 0},
+    {"PBI", 15, 14, 0},
+    {"FORCE", 17, 16, 0},
+    {"LEVEL", 5, 0, 0},
+    {"CAP", 7, 6, 0},
+    {"POWER", 15, 8, 0},
+    {"DEBOUNCE_PERIOD_MS", 23, 16, 0},
+    {"SLI_LEVEL", 31, 24, 0},
+    {"ENABLE", 1, 0, 3},
+    {"INSTBLK", 0, 0, 0},
+    {"RAMFC", 1, 1, 0},
+    {"RUNLIST", 2, 2, 0},
+    {"MMU_READ", 3, 3, 0},
+    {"MMU_WRITE", 4, 4, 0},
+    {"DEPRECATED_0", 1, 0, 0},
+    {"ISO_CRIT_ALWAYS", 3, 2, 0},
+    {"SCALER_AMORTIZATION", 5, 4, 0},
+    {"DEPRECATED_2", 7, 6, 0},
+    {"DEPRECATED_3", 9, 8, 0},
+    {"ASR", 11, 10, 0},
+    {"DEPRECATED_4", 13, 12, 0},
+    {"DYNAMIC_MEMPOOL", 15, 14, 0},
+    {"DEPRECATED_5", 17, 16, 0},
+    {"IMP", 19, 18, 0},
+    {"RESERVED", 21, 20, 0},
+    {"DEPRECATED_6", 23, 22, 0},
+    {"DYNAMIC_DISP_CLK", 25, 24, 0},
+    {"DEPRECATED_7", 27, 26, 0},
+    {"LINE_BUFFERING", 29, 28, 0},
+    {"FORCE_MIN_MEMPOOL", 31, 30, 0},
+    {"MEMPOOL_COMPRESSION", 1, 0, 0},
+    {"ADVANCED_FETCH_METERING", 3, 2, 0},
+    {"SOFTWARE_SLOWDOWN", 1, 0, 0},
+    {"PEAK_POWER_SLOWDOWN", 3, 2, 0},
+    {"ELCG", 5, 4, 0},
+    {"ELPG", 7, 6, 0},
+    {"PCIE_DEEP_L1", 9, 8, 0},
+    {"PCIE_CLKREQ", 11, 10, 0},
+    {"DEEP_IDLE", 13, 12, 0},
+    {"FB_ACPD", 15, 14, 0},
+    {"DUAL_PIXEL", 17, 16, 0},
+    {"BLCG2", 21, 18, 0},
+    {"ADAPTIVE_POWER", 23, 22, 0},
+    {"_DEPRECATED", 25, 24, 0},
+    {"PWR_RAIL_GATE", 27, 26, 0},
+    {"PWR_RAIL_GATE_PREDICTIVE", 29, 28, 0},
+    {"FSPG", 31, 30, 0},
+    {"FLCG", 1, 0, 0},
+    {"MSCG_SETTINGS_OWNER", 3, 2, 0},
+    {"OPERATION_MODE", 5, 4, 0},
+    {"SLCG", 7, 6, 0},
+    {"CLK_NDIV_SLIDING", 9, 8, 0},
+    {"NVVDD_PSI", 11, 10, 0},
+    {"GC6_ROMLESS", 13, 12, 0},
+    {"GC6_ROM", 15, 14, 0},
+    {"DIDLE_SSC", 17, 16, 0},
+    {"DIDLE_OS", 19, 18, 0},
+    {"PCIE_L1_SUBSTATES", 21, 20, 0},
+    {"LPWR_ONESHOT", 23, 22, 0},
+    {"RPPG", 25, 24, 0},
+    {"IST_CG", 27, 26, 0},
+    {"LPWR_ENG", 1, 0, 0},
+    {"IDLE_SNAP_DBG", 3, 2, 0},
+    {"PPU_THRESHOLD", 5, 4, 0},
+    {"LPWR_CTRL_HW_DISABLE", 7, 6, 0},
+    {"API_OPTIMIZATION", 9, 8, 0},
+    {"EXT_API_OPTIMIZATION", 11, 10, 0},
+    {"EI_COUPLED_GR_RG", 13, 12, 0},
+    {"REG_FILTER_PSTATE_CONTROL", 15, 14, 0},
+    {"GR_COUPLED_DFPR", 17, 16, 0},
+    {"DFPR_COUPLED_DIFR_SW_ASR", 19, 18, 0},
+    {"RM", 1, 0, 0},
+    {"PMU_LPWR", 3, 2, 0},
+    {"PRGX", 9, 8, 0},
+    {"PRGE", 11, 10, 0},
+    {"JT_ENABLED", 0, 0, 0},
+    {"NVSR_ENABLED", 2, 1, 0},
+    {"REVISION_ID", 31, 20, 0},
+    {"STYLE", 0, 0, 0},
+    {"ENABLED", 0, 0, 0},
+    {"FAKE_I2CS", 1, 0, 0},
+    {"PMU_CFG_SPACE_RESTORE", 3, 2, 0},
+    {"EXIT_BOOT_VOLTAGE", 5, 4, 0},
+    {"D3HOT_WAR", 7, 6, 0},
+    {"SKIP_COMPACTION_NORESET", 9, 8, 0},
+    {"FBSR_PMU_ENTRY", 11, 10, 0},
+    {"RTD3_SUPPORT", 13, 12, 0},
+    {"FAST_GC6_SUPPORT", 15, 14, 0},
+    {"SUPPORT_HDA_OSPM_D3", 17, 16, 0},
+    {"IFR_DRIVEN_PATH", 19, 18, 0},
+    {"PCIE_LINK_STATE_CHECK", 21, 20, 0},
+    {"P0_BOOST", 1, 0, 0},
+    {"ENTRY", 1, 0, 0},
+    {"SLEEP_AWARE_CALLBACK", 1, 0, 0},
+    {"DEFERRED_PMU_CALLBACK", 3, 2, 0},
+    {"PMU_HANDLE_MODESET", 5, 4, 0},
+    {"BSOD_MODESET", 7, 6, 0},
+    {"XTAL4XPLL", 1, 0, 0},
+    {"THERM_SENSOR", 3, 2, 0},
+    {"OSM_CLKS", 5, 4, 0},
+    {"DISP_PLLS", 7, 6, 0},
+    {"DFE_VAL", 9, 8, 0},
+    {"GPU_READY", 11, 10, 0},
+    {"RSVD", 13, 12, 0},
+    {"RPPG", 15, 14, 0},
+    {"NO_PSTATE_SUPPORT", 17, 16, 0},
+    {"PLL_IDDQ", 19, 18, 0},
+    {"VOLTAGE_UPDATE", 21, 20, 0},
+    {"ALT_MUX_SEL", 23, 22, 0},
+    {"XTAL_GATE", 25, 24, 0},
+    {"TIME", 29, 0, 0},
+    {"MODE", 31, 30, 0},
+    {"DRIVER_CFG_SPACE_RESTORE", 1, 0, 0},
+    {"COMPUTE", 0, 0, 0},
+    {"TEX", 1, 1, 0},
+    {"DFMA", 2, 2, 0},
+    {"GR", 1, 0, 0},
+    {"PPP", 3, 2, 0},
+    {"MPEG", 3, 2, 0},
+    {"CE0", 5, 4, 0},
+    {"PDEC", 7, 6, 0},
+    {"SEC", 9, 8, 0},
+    {"VIC", 9, 8, 0},
+    {"VLD", 11, 10, 0},
+    {"CE1", 13, 12, 0},
+    {"DISP", 15, 14, 0},
+    {"CE2", 17, 16, 0},
+    {"SEC2", 19, 18, 0},
+    {"MSENC", 21, 20, 0},
+    {"MSENC1", 23, 22, 0},
+    {"CE3", 25, 24, 0},
+    {"CE4", 27, 26, 0},
+    {"CE5", 29, 28, 0},
+    {"MSENC2", 31, 30, 0},
+    {"GR", 3, 0, 0},
+    {"PPP", 7, 4, 0},
+    {"FB", 11, 8, 0},
+    {"FBPA", 11, 8, 0},
+    {"LTCG", 11, 8, 0},
+    {"XBAR", 11, 8, 0},
+    {"PDEC", 15, 12, 0},
+    {"VLD", 19, 16, 0},
+    {"XVE", 23, 20, 0},
+    {"CE", 27, 24, 0},
+    {"MISC", 31, 28, 0},
+    {"GR", 0, 0, 0},
+    {"PDEC", 1, 1, 0},
+    {"GR_RG", 2, 2, 0},
+    {"DO_NOT_USE", 3, 3, 0},
+    {"MS", 4, 4, 0},
+    {"EI", 5, 5, 0},
+    {"MS_LTC", 6, 6, 0},
+    {"MS_PASSIVE", 7, 7, 0},
+    {"EI_PASSIVE", 8, 8, 0},
+    {"DFPR", 9, 9, 0},
+    {"MS_DIFR_SW_ASR", 10, 10, 0},
+    {"MS_DIFR_CG", 11, 11, 0},
+    {"GR", 0, 0, 0},
+    {"GC5", 1, 1, 0},
+    {"GR", 0, 0, 0},
+    {"CE0", 1, 1, 0},
+    {"CE1", 2, 2, 0},
+    {"CE2", 3, 3, 0},
+    {"PMU", 4, 4, 0},
+    {"FB", 5, 5, 0},
+    {"FBPA", 5, 5, 0},
+    {"LTCG", 5, 5, 0},
+    {"XBAR", 5, 5, 0},
+    {"ACB", 6, 6, 0},
+    {"PERF", 7, 7, 0},
+    {"FIFO", 8, 8, 0},
+    {"CHIPLETS", 9, 9, 0},
+    {"BUS", 10, 10, 0},
+    {"THERM", 11, 11, 0},
+    {"SEC2", 12, 12, 0},
+    {"NVDEC", 13, 13, 0},
+    {"MSPDEC", 13, 13, 0},
+    {"NVENC", 14, 14, 0},
+    {"MSENC", 14, 14, 0},
+    {"NVJPG", 15, 15, 0},
+    {"GSP", 16, 16, 0},
+    {"OFA", 17, 17, 0},
+    {"THERMAL__RESERVED", 17, 0, 0},
+    {"_DEPRECATED", 19, 18, 0},
+    {"NV", 23, 22, 0},
+    {"HOST", 25, 24, 0},
+    {"IDLE_PSTATE", 27, 26, 0},
+    {"GRAPHICS", 0, 0, 0},
+    {"VIDEO", 1, 1, 0},
+    {"VIC", 2, 2, 0},
+    {"FB", 3, 3, 0},
+    {"NVIF", 0, 0, 0},
+    {"EXTDEVICE", 1, 1, 0},
+    {"THERMAL", 2, 2, 0},
+    {"I2CPORTVALIDATE", 3, 3, 0},
+    {"TARGET", 1, 0, 0},
+    {"POLICY", 5, 4, 0},
+    {"RESUME_CALLBACK", 8, 8, 0},
+    {"L0S", 0, 0, 0},
+    {"L1", 1, 1, 0},
+    {"L0S", 0, 0, 0},
+    {"L1", 1, 1, 0},
+    {"L0S", 0, 0, 0},
+    {"L1", 1, 1, 0},
+    {"L0S", 0, 0, 0},
+    {"L1", 1, 1, 0},
+    {"L0S", 0, 0, 0},
+    {"L1", 1, 1, 0},
+    {"L0S", 0, 0, 0},
+    {"L1", 1, 1, 0},
+    {"L1_CPM", 2, 2, 0},
+    {"FRTS_SYSMEM", 1, 0, 0},
+    {"FRTS_VIDMEM", 3, 2, 0},
+    {"GSPFMC", 5, 4, 0},
+    {"POLL_FOR_INIT_ACK", 1, 0, 0},
+    {"GSP", 3, 0, 0},
+    {"SEC2", 7, 4, 0},
+    {"PMU", 11, 8, 0},
+    {"NVDEC", 15, 12, 0},
+    {"RSVD", 31, 16, 0},
+    {"ENABLE", 0, 0, 0},
+    {"THRESHOLD_US", 31, 16, 0},
+    {"USE_PWR_CLK_TICKS", 1, 0, 0},
+    {"FREQ_CHANGE", 3, 2, 0},
+    {"POLL_FOR_INIT_ACK", 5, 4, 0},
+    {"EVENTS_PER_RECORD", 7, 0, 0},
+    {"FLUSH_WATERMARKS", 15, 8, 0},
+    {"EVENTS_PER_NSI", 19, 16, 0},
+    {"LOG_EVENTS", 31, 30, 0},
+    {"ADR_TRAIN", 0, 0, 0},
+    {"WCK_TRAIN", 1, 1, 0},
+    {"RD_TRAIN", 2, 2, 0},
+    {"WR_TRAIN", 3, 3, 0},
+    {"PERIODIC", 8, 8, 0},
+    {"SDDR3_WR_TRAIN", 9, 9, 0},
+    {"SDDR3_WR_TRAIN_CTRL", 10, 10, 0},
+    {"SDDR3_QUSE_TRAIN", 11, 11, 0},
+    {"RESERVED", 31, 31, 0},
+    {"ADR_TRAIN", 0, 0, 0},
+    {"WCK_TRAIN", 1, 1, 0},
+    {"RD_TRAIN", 2, 2, 0},
+    {"WR_TRAIN", 3, 3, 0},
+    {"PERIODIC", 8, 8, 0},
+    {"RESERVED", 31, 31, 0},
+    {"ASR", 1, 0, 0},
+    {"RESERVED", 3, 2, 0},
+    {"CLKREQ", 5, 4, 0},
+    {"DEEP_L1", 7, 6, 0},
+    {"DEEP_IDLE", 9, 8, 0},
+    {"AELPG", 11, 10, 0},
+    {"VIDEO_ELPG", 13, 12, 0},
+    {"ENABLE", 1, 0, 0},
+    {"MONOTONICITY_ENABLE", 1, 0, 0},
+    {"SMOOTHENING_ENABLE", 3, 2, 0},
+    {"ENABLE", 0, 0, 0},
+    {"ON", 4, 4, 0},
+    {"PATTERN_VBIOS", 5, 5, 0},
+    {"PATTERN_INTERNAL", 6, 6, 0},
+    {"RASTER_BBOX_PAD", 7, 0, 0},
+    {"RASTER_BBOX_PAD_LINE", 15, 8, 0},
+    {"VPC_STIPPLED_LINE", 13, 6, 0},
+    {"VPC_CULLED_SMALL_TRIANGLES_LINE", 21, 14, 0},
+    {"VPC_NONCULLED_TRIANGLES_LINE", 29, 22, 0},
+    {"ARCH_OVERRIDE", 30, 30, 0},
+    {"GPU", 31, 31, 0},
+    {"VPC_CULLED_SMALL_LINES", 7, 0, 0},
+    {"VPC_CULLED_SMALL_TRIANGLES", 15, 8, 0},
+    {"VPC_NONCULLED_LINES_AND_POINTS", 23, 16, 0},
+    {"VPC_NONCULLED_TRIANGLES_LINE", 31, 24, 0},
+    {"CMD_TRIMMER_LSB", 0, 0, 0},
+    {"DATALO_TRIMMER_LSB", 1, 1, 0},
+    {"DATAHI_TIMMER_LSB", 3, 3, 0},
+    {"ALL_TRIMMER_MSB", 8, 8, 0},
+    {"RESERVED", 31, 31, 0},
+    {"MODE", 3, 0, 0},
+    {"MODE_VRR", 4, 4, 0},
+    {"MODE_OSM", 5, 5, 0},
+    {"ADDITIONAL_DELAY", 15, 8, 0},
+    {"REPLACEMENT_DELAY", 23, 16, 0},
+    {"ON_INIT", 1, 0, 0},
+    {"SYSCLK_SLOWDOWN", 1, 0, 0},
+    {"CG", 3, 2, 0},
+    {"RPG", 5, 4, 0},
+    {"GSP", 7, 6, 0},
+    {"SWASR", 9, 8, 0},
+    {"ISO_STUTTER", 13, 12, 0},
+    {"DISPLAY", 15, 14, 0},
+    {"FB_TRAINING", 17, 16, 0},
+    {"PG_ENG_GR", 19, 18, 0},
+    {"RPPG", 21, 20, 0},
+    {"MSCG_WITH_IMMED_FLIP", 23, 22, 0},
+    {"NVDCLK_SLOWDOWN", 25, 24, 0},
+    {"SEC2_RTOS", 27, 26, 0},
+    {"PERF", 29, 28, 0},
+    {"UNUSED_1", 31, 30, 0},
+    {"DISABLE", 0, 0, 0},
+    {"WITH_VSYNC", 0, 0, 0},
+    {"WITH_FRL", 1, 1, 0},
+    {"GSP", 1, 0, 0},
+    {"PERF", 3, 2, 0},
+    {"SWASR", 1, 0, 0},
+    {"FB_TRAINING", 3, 2, 0},
+    {"DISPLAY", 5, 4, 0},
+    {"ISO_STUTTER", 7, 6, 0},
+    {"SEC2", 9, 8, 0},
+    {"GSP", 11, 10, 0},
+    {"HSHUB", 13, 12, 0},
+    {"CG", 1, 0, 0},
+    {"ISO_STUTTER", 3, 2, 0},
+    {"RPPG", 5, 4, 0},
+    {"PSI", 7, 6, 0},
+    {"SYSCLK_SLOWDOWN", 9, 8, 0},
+    {"NVDCLK_SLOWDOWN", 11, 10, 0},
+    {"PGENG_FEATURE_STATE", 1, 0, 0},
+    {"DEEP_L1", 3, 2, 0},
+    {"L1SS", 5, 4, 0},
+    {"UNUSED", 1, 0, 0},
+    {"NEW_HOST_SEQ", 3, 2, 0},
+    {"ELPG", 5, 4, 0},
+    {"RPPG", 7, 6, 0},
+    {"PSI", 9, 8, 0},
+    {"PRIV_RING", 11, 10, 0},
+    {"UNBIND", 13, 12, 0},
+    {"SAVE_GLOBAL_STATE", 15, 14, 0},
+    {"RESET", 17, 16, 0},
+    {"HW_SEQUENCE", 19, 18, 0},
+    {"ELPG_SRAM", 21, 20, 0},
+    {"ELPG_LOGIC", 23, 22, 0},
+    {"ELPG_L2RPPG", 25, 24, 0},
+    {"FG_RPPG_EXCLUSION", 27, 26, 0},
+    {"SEC2", 29, 28, 0},
+    {"GSP", 31, 30, 0},
+    {"PRIV_RING", 1, 0, 0},
+    {"UNBIND", 3, 2, 0},
+    {"SAVE_GLOBAL_STATE", 5, 4, 0},
+    {"RESET", 7, 6, 0},
+    {"HW_SEQUENCE", 9, 8, 0},
+    {"GSP", 11, 10, 0},
+    {"SEC2", 13, 12, 0},
+    {"RG_GPCCS_BS", 15, 14, 0},
+    {"RG_PERF_CHANGE_SEQ", 17, 16, 0},
+    {"XVE", 19, 18, 0},
+    {"UNUSED", 21, 20, 0},
+    {"RG_GPCCS_BS_PMU", 23, 22, 0},
+    {"RG_TS_PD", 25, 24, 0},
+    {"NEW_HOST_SEQ", 27, 26, 0},
+    {"BUFFER_FLAGS", 7, 0, 0},
+    {"BUFFER_SIZE", 23, 8, 0},
+    {"RUNTIME_LEVEL", 28, 25, 0},
+    {"TIMESTAMP", 30, 29, 0},
+    {"INITED", 31, 31, 0},
+    {"INIT", 1, 0, 0},
+    {"TYPE_1", 0, 0, 0},
+    {"TYPE_2", 1, 1, 0},
+    {"LINK_MASK", 15, 8, 0},
+    {"ALL", 31, 0, 0},
+    {"DISPLAY", 1, 0, 0},
+    {"AVP", 3, 2, 0},
+    {"GPU", 5, 4, 0},
+    {"DISABLE", 0, 0, 0},
+    {"DISABLE", 0, 0, 0},
+    {"ALLOW_GEN2", 1, 0, 0},
+    {"ALLOW_GEN3", 3, 2, 0},
+    {"ALLOW_GEN4", 5, 4, 0},
+    {"ALLOW_GEN5", 7, 6, 0},
+    {"LOCK_AT_LOAD", 31, 31, 0},
+    {"OVERRIDE", 1, 0, 0},
+    {"VALUE", 11, 2, 0},
+    {"SCALE", 14, 12, 0},
+    {"ALLOW_LTR", 1, 0, 0},
+    {"SNOOP_LAT_VALUE", 11, 2, 0},
+    {"SNOOP_LAT_SCALE", 14, 12, 0},
+    {"NO_SNOOP_LAT_VALUE", 24, 15, 0},
+    {"NO_SNOOP_LAT_SCALE", 27, 25, 0},
+    {"NVINT", 0, 0, 0},
+    {"AD1032_COMPAT", 1, 1, 0},
+    {"ADT7473", 2, 2, 0},
+    {"NVSYSCON", 3, 3, 0},
+    {"SKIP_TABLE", 1, 0, 0},
+    {"PD_WORKLOAD", 3, 2, 0},
+    {"SKIP_MASK", 15, 8, 0},
+    {"PERIOD", 31, 0, 0},
+    {"DISABLE", 0, 0, 0},
+    {"POR", 1, 0, 0},
+    {"COMPLETELY", 0, 0, 0},
+    {"WRITE_BY_RM", 1, 1, 0},
+    {"WRITE_BY_CLIENT", 2, 2, 0},
+    {"PERIODIC_FLUSH", 3, 3, 0},
+    {"FATAL_ERROR_LOGGING", 0, 0, 0},
+    {"CORRECTABLE_ERROR_LOGGING", 1, 1, 0},
+    {"MASK", 31, 0, 0},
+    {"POR", 1, 0, 0},
+    {"STATE", 0, 0, 0},
+    {"WPR_BLOB_VERSION", 0, 0, 0},
+    {"SST", 0, 0, 0},
+    {"MST", 1, 1, 0},
+    {"VPR", 0, 0, 0},
+    {"WPR", 1, 1, 0},
+    {"HDCP", 2, 2, 0},
+    {"UCODE_ADDRMODE", 0, 0, 0},
+    {"REGISTERS", 0, 0, 0},
+    {"DISABLE", 2, 1, 0},
+    {"MODE", 4, 3, 0},
+    {"FORCE_DISABLE", 0, 0, 0},
+    {"TRAIN_AT_LOAD", 1, 1, 0},
+    {"SKIP_TRAIN", 2, 2, 0},
+    {"RESERVED_0", 7, 3, 0},
+    {"FORCE_AUTOCONFIG", 8, 8, 0},
+    {"FORCE_ENABLE", 31, 31, 0},
+    {"ENABLE", 0, 0, 3},
+    {"ENABLE", 0, 0, 0},
+    {"LANE_INIT", 0, 0, 0},
+    {"TX_EQ", 1, 1, 0},
+    {"LINK_TRAIN", 2, 2, 0},
+    {"POWER_DOWN", 3, 3, 0},
+    {"UPHY_VER", 4, 4, 0},
+    {"TYPE", 1, 0, 0},
+    {"VAL", 1, 0, 0},
+    {"SPEED", 4, 0, 0},
+    {"FOM_FORMAT", 2, 0, 0},
+    {"OPTIMIZATION_ALGORITHM", 10, 3, 0},
+    {"ADJUSTMENT_ALGORITHM", 15, 11, 0},
+    {"MINIMUM_TRAIN_TIME_MANTISSA", 19, 16, 0},
+    {"MINIMUM_TRAIN_TIME_EXPONENT", 23, 20, 0},
+    {"ENABLE", 3, 0, 0},
+    {"PHY_CONFIG", 7, 4, 0},
+    {"DL_STATUS", 11, 8, 0},
+    {"INITNEGOTIATE", 15, 12, 0},
+    {"INITOPTIMIZE", 19, 16, 0},
+    {"CACHE_SEEDS", 23, 20, 0},
+    {"BOOT_CORE", 27, 24, 0},
+    {"ALI_TRAINING", 30, 28, 0},
+    {"GFW_BOOT", 31, 31, 0},
+    {"MODE", 3, 0, 0},
+    {"SHORT_ALARMS", 6, 4, 0},
+    {"SHORT_ALARMS_RESERVED", 7, 7, 0},
+    {"MODE", 3, 0, 0},
+    {"MODE", 1, 0, 0},
+    {"REGINIT", 0, 0, 0},
+    {"TLC", 0, 0, 3},
+    {"MIF", 1, 1, 3},
+    {"RESERVED_0", 31, 2, 3},
+    {"ENABLE", 0, 0, 0},
+    {"DUMP", 1, 1, 0},
+    {"RESERVED_0", 3, 2, 0},
+    {"UNIT", 5, 4, 0},
+    {"RESERVED_1", 7, 6, 0},
+    {"FLITFILTER", 15, 8, 0},
+    {"L1_FILTER_ENABLE", 16, 16, 0},
+    {"L1_FILTER", 19, 17, 0},
+    {"RESERVED_2", 31, 20, 0},
+    {"SINGLE_LANE_MODE", 1, 0, 0},
+    {"PROD_WRITES", 3, 2, 0},
+    {"L1_MODE", 5, 4, 0},
+    {"L2_MODE", 7, 6, 0},
+    {"RESERVED", 31, 8, 0},
+    {"BREAK_AFTER_UPHY_INIT", 0, 0, 4},
+    {"BREAK_AFTER_DLPL_INIT", 1, 1, 4},
+    {"CONTROL", 1, 0, 3},
+    {"REDACTION", 0, 0, 0},
+    {"BUFFERSIZE", 31, 16, 0},
+    {"PRE_FRAME_WEIGHT", 3, 0, 0},
+    {"CUR_FRAME_WEIGHT", 7, 4, 0},
+    {"THRESHOLD", 15, 8, 0},
+    {"MAX_DELAY_TIME", 19, 16, 0},
+    {"MIN_MARGIN_TIME", 23, 20, 0},
+    {"REV_ID", 15, 0, 5},
+    {"SUB_FUNC", 27, 16, 5},
+    {"ENABLE", 28, 28, 5},
+    {"SET_DEFAULT", 1, 0, 3},
+    {"PAGE_SHUFFLE", 3, 2, 3},
+    {"QUADRO", 0, 0, 0},
+    {"VGPU", 1, 1, 0},
+    {"GEFORCE", 2, 2, 0},
+    {"COMPUTE", 3, 3, 0},
+    {"VGPU_BLOCKED", 4, 4, 7},
+    {"VALUE", 31, 0, 3},
+    {"ENABLE", 0, 0, 0},
+    {"ARR_ENABLE", 1, 1, 0},
+    {"SCHED_POLICY", 7, 4, 0},
+    {"USE_SUBMIT_OFFSET", 8, 8, 0},
+    {"PREVENT_EXTRA_CONTEXT_SWITCH", 9, 9, 0},
+    {"FREQUENCY", 21, 12, 0},
+    {"TIMESLICE", 23, 16, 0},
+    {"AVERAGE_FACTOR", 31, 24, 0},
+    {"TRAIN", 0, 0, 0},
+    {"NO_CAP_PROBE", 1, 1, 0},
+    {"ENGAGE", 0, 0, 0},
+    {"LOWER_LIMIT_DIFF_PERCENTAGE", 7, 1, 0},
+    {"UPPER_LIMIT_DIFF_PERCENTAGE", 14, 8, 0},
+    {"LOWER_LIMIT_NEW_L1_RESIDENCY", 21, 15, 0},
+    {"UPPER_LIMIT_NEW_L1_RESIDENCY", 28, 22, 0},
+    {"ALLOWLIST", 0, 0, 0},
+    {"RESERVATION", 1, 1, 0},
+    {"SEGMENT_SIZE", 2, 0, 0},
+    {"INTERNAL", 3, 0, 0},
+    {"EXTERNAL", 7, 4, 0},
+    {"TRIGGER_TCON_D0_VIA_I2C", 0, 0, 0},
+    {"FORCE_DYNAMIC_MODE", 1, 1, 0},
+    {"DISABLE_IGPU_PSR_SB", 2, 2, 0},
+    {"ENABLE_FSM_UPDATE_ONLY_FOR_SWITCH", 3, 3, 0},
+    {"ALWAYS_SKIP_EDP_POWERDOWN", 4, 4, 0},
+    {"SKIP_SR_EXIT_RECOVERY", 5, 5, 0},
+    {"EMULATE_TCON_IDX_VAL", 15, 8, 0},
+    {"EMULATE_TCON_IDX_VALID", 16, 16, 0},
+    {"FORCE_MUX_COMPLIANCE", 17, 17, 0},
+    {"EMULATE_MUX_IDX_VALID", 18, 18, 0},
+    {"EMULATE_MUX_IDX_VAL", 27, 20, 0},
+    {"ENABLE", 0, 0, 0},
+    {"DELAY_MS_VAL", 8, 1, 0},
+    {"DELAY_VAL", 15, 0, 0},
+    {"MS_VAL", 8, 0, 0},
+    {"USING_CALLBACK", 0, 0, 0},
+    {"USING_SOR_SEQ", 1, 1, 0},
+    {"DISABLE", 0, 0, 0},
+    {"DISABLE_INTR_ROUTING", 1, 1, 0},
+    {"STAGING_BUFFER_SIZE_IN_4k", 15, 0, 0},
+    {"EVENT_BUFFER_SIZE_IN_4k", 31, 16, 0},
+    {"ACR_AHESASC", 1, 0, 0},
+    {"ACR_ASB", 3, 2, 0},
+    {"ACR_UNLOAD", 5, 4, 0},
+    {"NVDEC_SCRUBBER", 7, 6, 0},
+    {"NVDEC", 9, 8, 0},
+    {"SEC2", 11, 10, 0},
+    {"GSP", 13, 12, 0},
+    {"VAL", 15, 0, 0},
+    {"IDX", 23, 16, 0},
+    {"RSVD", 31, 24, 0},
+    {"VAL", 15, 0, 0},
+    {"IDX", 23, 16, 0},
+    {"RSVD", 31, 24, 0},
+    {"CLKREQ", 1, 0, 0},
+    {"DEEP_L1", 3, 2, 0},
+    {"ENABLED", 0, 0, 8},
+    {"DEV_MODE_ENABLED", 1, 1, 8},
+    {"GPUS_READY_CHECK", 2, 2, 8},
+    {"ENABLED", 0, 0, 8},
+    {"WRITES", 1, 0, 0},
+    {"READS", 3, 2, 0},
+    {"ATOMICS", 5, 4, 0},
+    {"DOWNSTREAM_WRITES", 7, 6, 0},
+    {"DOWNSTREAM_CPLS", 10, 8, 0},
+    {"PMU", 0, 0, 0},
+    {"I2C", 1, 1, 0},
+    {"FBFALCON", 2, 2, 0},
+    {"SEC2", 3, 3, 0},
+    {"GSP", 4, 4, 0},
+    {"NVDEC", 5, 5, 0},
+};
+
+inline constexpr Key kKeys[928] = {
+    {"NV_HOTKEY_PRIM_DEV_SCHEME", "HotkeyPrimaryDevScheme", KeyType::Unknown, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_RM_TWIN_PEAKS_SUPPORT", "RMTwinPeaksSupport", KeyType::Unknown, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_MMU_MEMORY_MAP", "RMMmuMemoryMap", KeyType::Dword, true, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_RESERVE_PTE_SYSMEM_MB", "RmReservePteSysmemMB", KeyType::Dword, true, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_COMPBIT_BACKING_SIZE", "RMCompbitBackingSize", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_RM_COMPTAGLINE_MULTIPLIER", "RMCompTagLineMultiplier", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_RM_FORCE_MAX_COMPTAGLINE", "RMForceMaxComptagline", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_RM_USE_1TO1_COMPTAGLINE_ALLOCATION", "RMUse1to1ComptaglineAllocation", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_RM_USE_1TO4_COMPTAGLINE_ALLOCATION", "RMUse1to4ComptaglineAllocation", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_1TO4_COMPTAGLINE_ALLOCATION", "RMDisable1to4ComptaglineAllocation", KeyType::Dword, true, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_RM_ENABLE_FLA", "RMEnableFla", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_STRADDLING_CTAG_SUPPORT", "RMStraddlingCtagSupport", KeyType::Unknown, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_FERMI_BIG_PAGE_SIZE", "RMFermiBigPageSize", KeyType::Unknown, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_RM_SYSMEM_PAGE_SIZE", "RMSysmemPageSize", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_FERMI_CB_SIZE", "RMFermiCBSize", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_GFXP_CB_SIZE", "RMGfxpCBSize", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_FERMI_ALPHA_CB_SIZE", "RMFermiAlphaCBSize", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_SETUP_BETA_AS_TPC_PER_PPC_MAX", "RMSetupBetaAsTpcPerPpcMax", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_SCALE_BETA_CB_TO_LTS", "RMScaleBetaCBToLTS", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_FERMI_BUNDLE_CB_SIZE", "RMFermiBundleCBSize", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_FERMI_PAGEPOOL_SIZE", "RMFermiPagepoolSize", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_GFXP_SPILL_SIZE", "RMGfxpSpillSize", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_GFXP_CBE_RESERVE_SLOTS", "RMGfxpCbeReserveSlots", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_RTV_CB_SIZE", "RMRtvCBSize", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_RTV_CB_GFXP_ADD_SIZE", "RMRtvCBGfxpAddSize", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_RTV_CB_DEEPBIN_ADD_SIZE", "RMRtvCBDeepBinAddSize", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_CB_ALLOC_VPR", "RMCBAllocVPR", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_CB_ALLOC_PER_CHANNEL", "RMCBAllocPerChannel", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_FERMI_MIN_GPM_FIFO_DEPTH", "RMFermiMinGpmFifoDepth", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_FERMI_BUNDLE_CB_TOKEN_LIMIT", "RMFermiBundleCBTokenLimit", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_FERMI_SCREEN_TILE_ROW_OFFSET", "RMFermiScreenTileRowOffset", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_FERMI_ROP_PREFETCH_DISABLE", "RM625316", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_USE_UNCACHED_PCI_MAPPINGS", "UseUncachedPCIMappings", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_LID_BEHAVIOR", "LidBehavior", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_MOBILE", "Mobile", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_OVERRIDE_SBIOS_DEVS", "OverrideSBIOSDevs", KeyType::Dword, true, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_FORCE_EXT_ON_S3_RESUME", "ForceExtOnS3Resume", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_TEST_ANALOG_LOAD", "TestAnalogLoadAlways", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_OVERRIDE_EDID_FLAGS", "OverrideEdidFlags", KeyType::Binary, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_SBIOS_EDID_OVERRIDE_DISABLE", "RmSbiosEdidOverrideDisable", KeyType::Dword, true, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_VRR_FRAME_SMOOTHING_MAX_FRAME_DELTA_OVERRIDE", "RmVrrMaxFrameDeltaOverride", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_RM_BURST_MODE_NLT", "RMBurstModeNLT", KeyType::Dword, true, 0x00000001, 0, 0, 0},
+    {"NV_REG_STR_RM_DISPLAY_REMAP_SUPPORT", "RMDisplayRemapSupport", KeyType::Dword, true, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_DEV_SWITCH_SUPPRESS_MASK", "DevSwitchSuppressMask", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_SBIOS_HANDLES_HOTKEY_INHIBIT", "SBIOSHandlesHotkeyInhibit", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_RM_MAINTAIN_DEVS", "RMMaintainDevs", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_ROM_OVERRIDE", "romOverride", KeyType::Binary, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_OVERRIDE_PANEL_STRAP_INDEX", "OverridePanelStrapAndIndex", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_DEVICE_SPECIFIC_DPMS", "DeviceSpecificDPMS", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_MASK_SECONDARY_DEVICES", "MaskSecondaryDevice", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_STATIC_EDID", "Static EDID 0x????????", KeyType::Binary, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_STRAP_PANEL_FIELD_OVERRIDE", "Panel00", KeyType::Binary, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_USE_GENERIC_EDID_MANUFACTURER", "UseGenericEDIDManufacturer", KeyType::Unknown, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_OVER_DRIVE_DATA", "OverDriveData0", KeyType::Binary, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_ENABLE_OVERDRIVE_DATA_FROM_EDID_INFO", "EnableOverdriveDataFromEdidInfo", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_OVERDRIVE_PANEL_PRODUCT_CODE", "OverdrivePanelProductCode0", KeyType::Unknown, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_OVERDRIVE_PANEL_SERIAL_NO", "OverdrivePanelSerialNo0", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_OVER_DRIVE_SERIALNO_DATA", "OverDriveDataSerialNo0", KeyType::Binary, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_FMIN_VCO", "FminVCO", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_FMAX_VCO", "FmaxVCO", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_IMAGE_ENABLE_VBLANK_MISS_LIMIT", "ImageEnableVblankMissLimit", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_PLL_SETTLE_TIME", "PllSettleTime", KeyType::Dword, true, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_SLIDE_MCLK", "SlideMCLK", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_TWIN_VIEW_DISABLED", "TwinViewDisabled", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_BACKLIGHT_CONTROL", "backlight-control", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_DEVICES_CONNECTED", "DevicesConnected", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_OVERRIDE_FB_SIZE", "OverrideFbSize", KeyType::Dword, true, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_OVERRIDE_FB_START_KB", "OverrideFbStartKB", KeyType::Dword, true, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_PM_ENABLE", "PowerMizerEnable", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_PM_LEVEL", "PowerMizerLevel", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_PM_LEVEL_AC", "PowerMizerLevelAC", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_PM_HARD_LEVEL", "PowerMizerHardLevel", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_PM_HARD_LEVEL_AC", "PowerMizerHardLevelAC", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_PM_DEFAULT", "PowerMizerDefault", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_PM_DEFAULT_AC", "PowerMizerDefaultAC", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_DC_PERF_LIMIT_SLI", "DCPerfLimitSLI", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_DC_PERF_LIMIT_NON_SLI", "DCPerfLimitNonSLI", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_ALLOW_MAX_PERF", "AllowMaxPerf", KeyType::Dword, true, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_DISABLE_DYNAMIC_PSTATE", "DisableDynamicPstate", KeyType::Dword, true, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_MAX_PERF_WITH_PERFMON", "MaxPerfWithPerfMon", KeyType::Dword, false, 0x00000000, 0, 0, 0},
+    {"NV_REG_STR_RM_PMU_PERFMON_SAMPLING", "RmPmuPerfmonSampling", KeyType::Dword, true, 0x00000002, 0, 4, 0},
+    {"NV_REG_STR_RM_OPTP", "RmOptp", KeyType::Dword, false, 0x00000000, 4, 5, 0},
+    {"NV_REG_STR_RM_OPTP2_LOWER_MCLK", "RmOptp2LowerMclk", KeyType::Dword, false, 0x00000000, 9, 3, 0},
+    {"NV_REG_STR_RM_PSTATE20", "RmPstate20", KeyType::Dword, false, 0x00000000, 12, 1, 0},
+    {"NV_REG_STR_PSTATES_SLI", "PStatesSLI", KeyType::Dword, true, 0x00000001, 13, 0, 0},
+    {"NV_REG_STR_PSTATE_FORCED", "RMForcePstate", KeyType::Dword, false, 0x00000000, 13, 0, 0},
+    {"NV_REG_STR_RM_BUG_1785342_WAR", "RMBug1785342War", KeyType::Dword, false, 0x00000000, 13, 0, 0},
+    {"NV_REG_STR_PSTATE_TIME", "PStateTime", KeyType::Dword, false, 0x00000000, 13, 3, 0},
+    {"NV_REG_STR_PERF_LEVEL_SRC", "PerfLevelSrc", KeyType::Unknown, false, 0x00000000, 16, 0, 0},
+    {"NV_REG_STR_PERF_PMA_CONTROL_REG", "PerfPmaControlReg", KeyType::Dword, false, 0x00000000, 16, 0, 0},
+    {"NV_REG_STR_DISABLE_ASYNC_PSTATES", "DisableAsyncPstates", KeyType::Dword, true, 0x00000000, 16, 0, 0},
+    {"NV_REG_STR_BUG_1469534_WAR", "RMBug1469534War", KeyType::Dword, true, 0x00000001, 16, 0, 0},
+    {"NV_REG_STR_CL_ASLM_CFG", "AslmCfg", KeyType::Dword, true, 0x00000002, 16, 4, 0},
+    {"NV_REG_STR_CL_FORCE_P2P", "ForceP2P", KeyType::Dword, true, 0x00000002, 20, 2, 0},
+    {"NV_REG_STR_P2P_MAILBOX_CLIENT_ALLOCATED", "P2PMailboxClientAllocated", KeyType::Dword, false, 0x00000000, 22, 0, 0},
+    {"NV_REG_STR_PEERMAPPING_OVERRIDE", "PeerMappingOverride", KeyType::Dword, true, 0x00000000, 22, 0, 0},
+    {"NV_REG_STR_VAR_BUS_LINK_WIDTH", "VarBusLinkWidth", KeyType::Unknown, true, 0x00000000, 22, 0, 0},
+    {"NV_REG_STR_MIN_PSTATE_FOR_HD_VIDEO", "MinPstateForHDVideo", KeyType::Unknown, true, 0x00000008, 22, 0, 0},
+    {"NV_REG_STR_MIN_PSTATE_FOR_SD_VIDEO", "MinPstateForSDVideo", KeyType::Dword, true, 0x0000000a, 22, 0, 0},
+    {"NV_REG_STR_DISABLE_GR_AUTO", "DisableGrAuto", KeyType::Dword, true, 0x00000000, 22, 0, 0},
+    {"NV_REG_STR_ENABLE_CORE_VOLTAGE", "EnableCoreVoltage", KeyType::Dword, true, 0x00000000, 22, 0, 0},
+    {"NV_REG_STR_OVERRIDE_IDLE_SLOWDOWN_SETTINGS", "RmOverrideIdleSlowdownSettings", KeyType::Dword, false, 0x00000000, 22, 0, 0},
+    {"NV_REG_STR_ENABLE_MCLK_SLOWDOWN", "EnableMClkSlowdown", KeyType::Dword, false, 0x00000000, 22, 0, 0},
+    {"NV_REG_STR_GR_CTXSW_MODE", "GrCtxSwMode", KeyType::Dword, false, 0x00000000, 22, 0, 0},
+    {"NV_REG_STR_DISABLE_OVERLAY", "DisableOverlay", KeyType::Dword, false, 0x00000000, 22, 0, 0},
+    {"NV_REG_STR_FORCE_GEFORCE", "feeb3241", KeyType::Dword, true, 0x00000000, 22, 0, 0},
+    {"NV_REG_STR_RM_ROBUST_CHANNELS", "RmRobustChannels", KeyType::Unknown, true, 0x00000000, 22, 0, 0},
+    {"NV_REG_STR_RM_FORCE_FULL_RC_RECOVERY", "RmForceFullRcRecovery", KeyType::Unknown, true, 0x00000000, 22, 0, 0},
+    {"NV_REG_STR_RM_RC_WATCHDOG", "RmRcWatchdog", KeyType::Unknown, true, 0x00000001, 22, 0, 0},
+    {"NV_REG_STR_RM_WATCHDOG_TIMEOUT", "RmWatchDogTimeOut", KeyType::Unknown, true, 0x00000007, 22, 0, 0},
+    {"NV_REG_STR_RM_WATCHDOG_INTERVAL", "RmWatchDogInterval", KeyType::Unknown, true, 0x00000007, 22, 0, 0},
+    {"NV_REG_STR_RM_DO_LOG_RC_EVENTS", "RmLogonRC", KeyType::Dword, false, 0x00000000, 22, 0, 0},
+    {"NV_REG_STR_RM_BREAK_ON_RC", "RmBreakonRC", KeyType::Dword, true, 0x00000000, 22, 0, 0},
+    {"NV_REG_STR_RM_BREAK", "RmBreak", KeyType::Dword, false, 0x00000000, 22, 0, 0},
+    {"NV_REG_STR_RM_BREAK_ON_RC_DISABLE_OVERRIDE", "RmBreakonRCDisableOverride", KeyType::Dword, true, 0x00000000, 22, 0, 0},
+    {"NV_REG_STR_RM_RC_DISABLE_OVERRIDE_COUNT", "RmRCDisableOverrideCount", KeyType::Unknown, true, 0x00000028, 22, 0, 0},
+    {"NV_REG_STR_RM_ENABLE_ADDRESS_SPACE_RC", "RmEnableAddressSpaceRC", KeyType::Dword, true, 0x00000000, 22, 0, 0},
+    {"NV_REG_STR_RM_RC_MEM_BACKTRACE_STACK_DEPTH", "RmMemBacktraceStackDepth", KeyType::Dword, true, 0x00000001, 22, 0, 0},
+    {"NV_REG_STR_RM_RC_PREV_DRIVER_VERSION", "RmRCPrevDriverVersion", KeyType::Unknown, false, 0x00000000, 22, 0, 0},
+    {"NV_REG_STR_RM_RC_PREV_DRIVER_BRANCH", "RmRCPrevDriverBranch", KeyType::Unknown, false, 0x00000000, 22, 0, 0},
+    {"NV_REG_STR_RM_RC_PREV_DRIVER_CHANGELIST", "RmRCPrevDriverChangelist", KeyType::Unknown, false, 0x00000000, 22, 0, 0},
+    {"NV_REG_STR_RM_RC_PREV_DRIVER_LOAD_COUNT", "RmRCPrevDriverLoadCount", KeyType::Unknown, false, 0x00000000, 22, 0, 0},
+    {"NV_REG_STR_RM_NUM_FIFOS", "RmNumFifos", KeyType::Dword, false, 0x00000000, 22, 0, 0},
+    {"NV_REG_STR_LOCAL_TEMP_HIGH_LIMIT", "LocalTempHighLimit", KeyType::Dword, false, 0x00000000, 22, 0, 0},
+    {"NV_REG_STR_EXT_TEMP_HIGH_LIMIT", "ExtTempHighLimit", KeyType::Dword, false, 0x00000000, 22, 0, 0},
+    {"NV_REG_STR_THERMAL_SB_H1", "ThermalSBH1", KeyType::Dword, false, 0x00000000, 22, 0, 0},
+    {"NV_REG_STR_THERMAL_SB_H2", "ThermalSBH2", KeyType::Dword, false, 0x00000000, 22, 0, 0},
+    {"NV_REG_STR_THERMAL_THRESH00_TARGET000", "ThermalThresh00Target000", KeyType::Dword, false, 0x00000000, 22, 0, 0},
+    {"NV_REG_STR_THERMAL_CHIP_TYPE", "ThermalChipType", KeyType::Dword, false, 0x00000000, 22, 0, 0},
+    {"NV_REG_STR_THERMAL_POLICY_SW1", "ThermalPolicySW1", KeyType::Dword, false, 0x00000000, 22, 0, 0},
+    {"NV_REG_STR_RM_THERMAL_CONVERSION_RATE", "RMThermalConversionRate", KeyType::Unknown, false, 0x00000000, 22, 0, 0},
+    {"NV_REG_STR_RM_PMGR_PWR_POLICY_OVERRIDE", "RmPmgrPwrPolicyOverride", KeyType::Unknown, false, 0x00000000, 22, 5, 0},
+    {"NV_REG_STR_RM_PMGR_PWR_DEVICE_BA00_OVERRIDE", "RmPmgrPwrDeviceBa00Override", KeyType::Unknown, false, 0x00000000, 27, 1, 0},
+    {"NV_REG_STR_RM_PMGR_PMU_OVERRIDE", "RmPmgrPmuOverride", KeyType::Dword, false, 0x00000000, 28, 1, 0},
+    {"NV_REG_STR_RM_PMGR_IDDQ_OVVERRIDE", "RmPmgrIddqOverride", KeyType::Dword, true, 0x00000000, 29, 0, 0},
+    {"NV_REG_STR_RM_PMGR_IDDQ_1_OVVERRIDE", "RmPmgrIddq1Override", KeyType::Dword, true, 0x00000000, 29, 0, 0},
+    {"NV_REG_STR_RM_PMGR_IDDQ_NVVDD_OVVERRIDE", "RmPmgrIddqNvvddOverride", KeyType::Dword, true, 0x00000000, 29, 0, 0},
+    {"NV_REG_STR_RM_PMGR_IDDQ_MSVDD_OVVERRIDE", "RmPmgrIddqMsvddOverride", KeyType::Dword, true, 0x00000000, 29, 0, 0},
+    {"NV_REG_STR_RM_PMGR_IDDQ_CHECK_IGNORE", "RmPmgrIddqCheckIgnore", KeyType::Dword, false, 0x00000000, 29, 0, 0},
+    {"NV_REG_STR_RM_SRAM_VMIN_CHECK_IGNORE", "RmSramVminCheckIgnore", KeyType::Dword, false, 0x00000000, 29, 0, 0},
+    {"NV_REG_STR_RM_PMGR_ISENSE_CHECK_IGNORE", "RmPmgrIsenseCheckIgnore", KeyType::Dword, false, 0x00000000, 29, 0, 0},
+    {"NV_REG_STR_RM_PMGR_ISENSE_VCM_OFFSET_OVERRIDE", "RmPmgrIsenseVcmOffsetOverride", KeyType::Dword, false, 0x00000000, 29, 2, 0},
+    {"NV_REG_STR_RM_PMGR_ISENSE_DIFF_GAIN_OVERRIDE", "RmPmgrIsenseDiffGainOverride", KeyType::Dword, false, 0x00000000, 31, 2, 0},
+    {"NV_REG_STR_RM_PMGR_ISENSE_DIFF_OFFSET_OVERRIDE", "RmPmgrIsenseDiffOffsetOverride", KeyType::Dword, false, 0x00000000, 33, 2, 0},
+    {"NV_REG_STR_RM_PMGR_ISENSE_VCM_COARSE_OFFSET_OVERRIDE", "RmPmgrIsenseVcmCoarseOffsetOverride", KeyType::Dword, false, 0x00000000, 35, 2, 0},
+    {"NV_REG_STR_RM_PMGR_ISENSE_DIFFERENTIAL_COARSE_GAIN_OVERRIDE", "RmPmgrIsenseDiffCoarseGainOverride", KeyType::Dword, false, 0x00000000, 37, 2, 0},
+    {"NV_REG_STR_RM_PERF_RATED_TDP_LIMIT", "RmPerfRatedTdpLimit", KeyType::Dword, false, 0x00000000, 39, 0, 0},
+    {"NV_REG_STR_RM_PERF_OVERRIDE", "RmPerfOverride", KeyType::Dword, false, 0x00000000, 39, 2, 0},
+    {"NV_REG_STR_RM_PERF_CF_OVERRIDE", "RmPerfCfOverride", KeyType::Dword, false, 0x00000000, 41, 3, 0},
+    {"NV_REG_STR_RM_PERF_CF_POLICY_OVERRIDES", "RmPerfCfPolicyOverrides", KeyType::Dword, false, 0x00000000, 44, 2, 0},
+    {"NV_REG_STR_RM_CLK_CONTROLLERS_OVERRIDE", "RmClkControllersOverride", KeyType::Dword, false, 0x00000000, 46, 3, 0},
+    {"NV_REG_STR_RM_PERF_CHANGE_SEQ_OVERRIDE", "RmPerfChangeSeqOverride", KeyType::Dword, false, 0x00000000, 49, 3, 0},
+    {"NV_REG_STR_RM_PERF_LIMITS_OVERRIDE", "RmPerfLimitsOverride", KeyType::Dword, false, 0x00000000, 52, 4, 0},
+    {"NV_REG_STR_PCI_LATENCY_TIMER_CONTROL", "PciLatencyTimerControl", KeyType::Dword, false, 0x00000000, 56, 0, 0},
+    {"NV_REG_STR_RM_MB_CHECK_REV", "MB_CheckREV", KeyType::Dword, true, 0x00000001, 56, 0, 0},
+    {"NV_REG_STR_RM_MB_DISABLE_VIDEO_LINK", "MB_DisableVideoLink", KeyType::Dword, false, 0x00000000, 56, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_BR03_FLOW_CONTROL", "MB_DisableBr03FlowControl", KeyType::Dword, false, 0x00000000, 56, 0, 0},
+    {"NV_REG_STR_I2C_SPEED", "RMI2cSpeed", KeyType::Dword, true, 0x00000000, 56, 0, 0},
+    {"NV_REG_STR_USE_SW_I2C", "RMUseSwI2c", KeyType::Dword, true, 0x00000000, 56, 0, 0},
+    {"NV_REG_STR_USE_PMU_I2C", "RMUsePmuI2c", KeyType::Dword, true, 0x00000000, 56, 0, 0},
+    {"NV_REG_STR_USE_PMU_SW_I2C", "RMUsePmuSwI2c", KeyType::Dword, true, 0x00000000, 56, 0, 0},
+    {"NV_REG_STR_USE_PMU_HW_I2C", "RMUsePmuHwI2c", KeyType::Dword, true, 0x00000000, 56, 0, 0},
+    {"NV_REG_STR_HOTPLUG_I2C_DISPLAYS", "RMHotPlugI2cDisplays", KeyType::Dword, false, 0x00000000, 56, 0, 0},
+    {"NV_REG_STR_I2C_PMU_MUTEX_TIMEOUT_US", "RMI2cPmuMutexTimeoutus", KeyType::Dword, false, 0x00000000, 56, 0, 0},
+    {"NV_REG_STR_USE_PMU_SPI", "RMUsePmuSpi", KeyType::Dword, true, 0x00000000, 56, 0, 0},
+    {"NV_REG_STR_HOTPLUG_SUPPORT_DISABLE", "RMHotPlugSupportDisable", KeyType::Dword, false, 0x00000000, 56, 0, 0},
+    {"NV_REG_STR_RM_HDCP_REAUTHENICATE", "RMHDCPReAuthenicate", KeyType::Unknown, false, 0x00000000, 56, 0, 0},
+    {"NV_REG_STR_RM_HDCP_MAX_ERROR", "RMHDCPMAXERROR", KeyType::Unknown, false, 0x00000000, 56, 0, 0},
+    {"NV_REG_STR_RM_HDMI_FORCE_CHN_STATUS_FREQ", "RMHDMIForceChnStatusFreq", KeyType::Dword, false, 0x00000000, 56, 0, 0},
+    {"NV_REG_STR_RM_FORCE_ZCULL_RAM_FORMAT", "RMForceZCullRamFormat", KeyType::Dword, false, 0x00000000, 56, 0, 0},
+    {"NV_REG_STR_RM_FORCE_ZCULL_RAM_SIZE", "RMForceZCullRamSize", KeyType::Dword, false, 0x00000000, 56, 0, 0},
+    {"NV_REG_STR_GLITCH_FREE_MCLK", "GlitchFreeMClk", KeyType::Dword, false, 0x00000000, 56, 0, 0},
+    {"NV_REG_STR_RM_MAX_MCLK_FBSTOP_TIME", "RMMaxMclkFbstopTime", KeyType::Dword, false, 0x00000000, 56, 0, 0},
+    {"NV_REG_STR_REPORT_MCLK_SWITCH_FB_STOP_TIME", "RMReportMclkSwitchFbStopTime", KeyType::Dword, true, 0x00000000, 56, 0, 0},
+    {"NV_REG_STR_CLK_SWITCH_WITHIN_MARGIN", "RMClkSwitchWithinMargin", KeyType::Dword, false, 0x00000000, 56, 1, 0},
+    {"NV_REG_STR_ENABLE_BRIGHTNESS_CONTROL", "EnableBrightnessControl", KeyType::Dword, false, 0x00000000, 57, 0, 0},
+    {"NV_REG_STR_PANEL_PWM_FREQUENCY", "PanelPWMFrequency", KeyType::Dword, false, 0x00000000, 57, 0, 0},
+    {"NV_REG_STR_PANEL_PWM_DUTY_RANGE", "PanelPWMDutyRange", KeyType::Dword, false, 0x00000000, 57, 0, 0},
+    {"NV_REG_STR_PANEL_BRIGHTNESS_LIMITS", "PanelBrightnessLimits", KeyType::Dword, false, 0x00000000, 57, 0, 0},
+    {"NV_REG_STR_PANEL_SMOOTH_BRIGHTNESS_DEFAULT_ENABLE", "SmoothBrightnessDefaultEnable", KeyType::Dword, false, 0x00000000, 57, 0, 0},
+    {"NV_REG_STR_PANEL_SMOOTH_BRIGHTNESS_TRANSITION_TIME_UP_MS", "SmoothBrightnessTransitionTimeUpMs", KeyType::Dword, false, 0x00000000, 57, 0, 0},
+    {"NV_REG_STR_PANEL_SMOOTH_BRIGHTNESS_TRANSITION_TIME_DOWN_MS", "SmoothBrightnessTransitionTimeDownMs", KeyType::Dword, false, 0x00000000, 57, 0, 0},
+    {"NV_REG_STR_PANEL_SMOOTH_BRIGHTNESS_STEP_INTERVAL_MS", "SmoothBrightnessStepIntervalMs", KeyType::Dword, false, 0x00000000, 57, 0, 0},
+    {"NV_REG_STR_BRIGHTNESS_CONTROL_FLAGS", "RMBrightnessControlFlags", KeyType::Dword, false, 0x00000000, 57, 6, 0},
+    {"NV_REG_STR_RM_NON_COHERENT_USE_TC0_ONLY", "RMUseTc0NonCoherent", KeyType::Dword, true, 0x00000001, 63, 0, 0},
+    {"NV_REG_STR_ENABLE_CTXT_SW_WAR", "RMEnableHybridP", KeyType::Dword, false, 0x00000000, 63, 0, 0},
+    {"NV_REG_STR_OVERRIDE_GPU_INIT", "OverrideGpuInit", KeyType::Binary, false, 0x00000000, 63, 0, 0},
+    {"NV_REG_STR_OVERRIDE_GPU_DEVINIT", "OverrideGpuDevinit", KeyType::Binary, false, 0x00000000, 63, 0, 3},
+    {"NV_REG_STR_RM_HEAD_DCLK_MODE_PREFIX", "Head", KeyType::Dword, false, 0x00000000, 63, 0, 0},
+    {"NV_REG_STR_RM_HEAD_DCLK_MODE_POSTFIX", "DClkMode", KeyType::Dword, false, 0x00000000, 63, 0, 0},
+    {"NV_REG_STR_RM_PCLK_MODE", "PClkMode", KeyType::Dword, false, 0x00000000, 63, 0, 0},
+    {"NV_REG_STR_RM_ENABLE_FRAC_DIVIDE", "RmEnableFracDivide", KeyType::Dword, false, 0x00000000, 63, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_FRAC_DIVIDE", "RmDisableFracDivide", KeyType::Dword, false, 0x00000000, 63, 0, 0},
+    {"NV_REG_STR_RM_ENABLE_LINEAR_DIVIDE", "RmEnableLinearDivide", KeyType::Dword, false, 0x00000000, 63, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_LINEAR_DIVIDE", "RmDisableLinearDivide", KeyType::Dword, false, 0x00000000, 63, 0, 0},
+    {"NV_REG_STR_RM_DISP_INTR_DURING_SHTDWN", "IntrDuringShtDwn", KeyType::Dword, false, 0x00000000, 63, 0, 0},
+    {"NV_REG_STR_RM_SKIP_SW_STATE_ERR_CHECKS", "SkipSwStateErrChecks", KeyType::Dword, true, 0x00000000, 63, 0, 0},
+    {"NV_REG_STR_RM_PD_PIORS_FOR_MODESET", "PDPiorsForModeset", KeyType::Dword, false, 0x00000000, 63, 0, 0},
+    {"NV_REG_STR_RM_SYNC_RG_DIVS", "syncRgDivs", KeyType::Dword, false, 0x00000000, 63, 0, 0},
+    {"NV_REG_STR_RM_ALLOW_ANY_SCAN_LOCK_PIN_FOR_FLIP_LOCK", "AllowAnyScanLockPinForFlipLock", KeyType::Dword, false, 0x00000000, 63, 0, 0},
+    {"NV_REG_STR_RM_LEAVE_DBG_MODE_ON_AT_UNFR_UPD", "LeaveDbgModeOnAtUnfrUpd", KeyType::Dword, false, 0x00000000, 63, 0, 0},
+    {"NV_REG_OVERRIDE_VBIOS", "vbios", KeyType::Binary, false, 0x00000000, 63, 0, 0},
+    {"NV_REG_VBIOS_SOURCE", "vbiosSource", KeyType::Binary, false, 0x00000000, 63, 0, 0},
+    {"NV_REG_OVERRIDE_VBIOS_GROUP_INIT", "vbios000", KeyType::Binary, false, 0x00000000, 63, 0, 0},
+    {"NV_REG_STR_RM_VBIOS_FROM_ROM", "VbiosFromROM", KeyType::Dword, false, 0x00000000, 63, 0, 0},
+    {"NV_REG_STR_RM_ONDEMAND_VBLANK", "RMOnDemandVBlank", KeyType::Dword, true, 0x00000000, 63, 0, 0},
+    {"NV_REG_STR_RM_EXTPERFCONTROL", "RMExtPerfControl", KeyType::Dword, true, 0xffffffff, 63, 5, 0},
+    {"NV_REG_STR_RM_PWRSPLYCAP", "RMPowerSupplyCapacity", KeyType::Dword, true, 0xffffffff, 68, 0, 0},
+    {"NV_REG_STR_RM_PWRSPLYCAPEN", "RMEnablePowerSupplyCapacity", KeyType::Dword, true, 0x00000001, 68, 0, 0},
+    {"NV_REG_STR_RM_SKIP_ACPI_BATT_PERF_CAP", "RMSkipACPIBattCap", KeyType::Dword, false, 0x00000000, 68, 0, 0},
+    {"NV_REG_STR_RM_SKIP_BAR2_TEST", "RMSkipBar2Test", KeyType::Dword, false, 0x00000000, 68, 0, 3},
+    {"NV_REG_STR_RM_BAR2_SYSMEM", "RMBar2SysmemEnable", KeyType::Dword, false, 0x00000000, 68, 1, 3},
+    {"NV_REG_STR_RM_INST_VPR", "RMInstVPR", KeyType::Dword, false, 0x00000000, 69, 5, 0},
+    {"NV_REG_STR_RM_VAS_REVERSE", "RMVASReverse", KeyType::Dword, true, 0x00000000, 74, 0, 0},
+    {"NV_REG_STR_RM_RESTRICT_VA_RANGE", "RMRestrictVARange", KeyType::Dword, true, 0x00000000, 74, 0, 0},
+    {"NV_REG_STR_RM_SKIP_RC_ON_EXCEPTIONS", "RMSkipRCOnExceptions", KeyType::Unknown, true, 0x00000000, 74, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_FEATURE_DISABLEMENT", "RMDisableFeatureDisablement", KeyType::Dword, false, 0x00000000, 74, 0, 0},
+    {"NV_REG_STR_RM_BANDWIDTH_FEATURES", "RMBandwidthFeature", KeyType::Unknown, false, 0x00000000, 74, 16, 0},
+    {"NV_REG_STR_RM_BANDWIDTH_FEATURES_2", "RMBandwidthFeature2", KeyType::Unknown, false, 0x00000000, 90, 2, 0},
+    {"NV_REG_STR_RM_GLITCHLESS_MODESET", "RMGlitchlessModeset", KeyType::Dword, true, 0x00000000, 92, 0, 0},
+    {"NV_REG_STR_RM_IMP_PERF_LIMIT_MASK", "RMImpPerfLimitMask", KeyType::Unknown, false, 0x00000000, 92, 0, 4},
+    {"NV_REG_STR_RM_POWER_FEATURES", "RMPowerFeature", KeyType::Dword, false, 0x00000000, 92, 15, 0},
+    {"NV_REG_STR_RM_POWER_FEATURES2", "RMPowerFeature2", KeyType::Unknown, false, 0x00000000, 107, 14, 0},
+    {"NV_REG_STR_RM_LPWR_ARCH", "RMLpwrArch", KeyType::Dword, false, 0x00000000, 121, 10, 0},
+    {"NV_REG_STR_RM_LPWR_EI_CLIENT", "RMLpwrEiClient", KeyType::Dword, false, 0x00000000, 131, 2, 0},
+    {"NV_REG_STR_RM_LPWR_TEST_CALLBACK_TIME_MS", "RMLpwrTestCbkTimeMs", KeyType::Dword, true, 0x00000000, 133, 0, 0},
+    {"NV_REG_STR_RM_EDP_POWER_ON_TO_ML_TIME_MS", "RMEdpPowerOnToMLTimeMs", KeyType::Dword, true, 0x000000d2, 133, 0, 0},
+    {"NV_REG_STR_RM_SCI_VID_PWM", "RMSCIVidPWM", KeyType::Dword, true, 0x00000001, 133, 0, 0},
+    {"NV_REG_STR_RM_FULL_GC5", "RMFullGC5", KeyType::Dword, true, 0x00000000, 133, 0, 0},
+    {"NV_REG_STR_RM_200124428", "RmWar200124428", KeyType::Dword, true, 0x00000000, 133, 0, 0},
+    {"NV_REG_STR_RM_TPC_PG_AT_ALL_PSTATES", "RmTpcPgAtAllPStates", KeyType::Dword, true, 0x00000000, 133, 0, 0},
+    {"NV_REG_STR_RM_GR_RPG_AT_P3_PSTATE", "RmGrRpgAtP3Pstate", KeyType::Dword, true, 0x00000000, 133, 0, 0},
+    {"NV_REG_STR_RM_LPWR_GR_IDLE_THRESHOLD_US", "RMLpwrGrIdleThresholdUs", KeyType::Dword, true, 0x00000000, 133, 0, 0},
+    {"NV_REG_STR_RM_LPWR_GR_RG_IDLE_THRESHOLD_US", "RMLpwrGrRgIdleThresholdUs", KeyType::Dword, true, 0x00000000, 133, 0, 0},
+    {"NV_REG_STR_RM_LPWR_MS_IDLE_THRESHOLD_US", "RMLpwrMsIdleThresholdUs", KeyType::Dword, true, 0x00000000, 133, 0, 0},
+    {"NV_REG_STR_RM_LPWR_MS_LTC_IDLE_THRESHOLD_US", "RMLpwrMsLtcIdleThresholdUs", KeyType::Dword, true, 0x00000000, 133, 0, 0},
+    {"NV_REG_STR_RM_LPWR_EI_IDLE_THRESHOLD_US", "RMLpwrEiIdleThresholdUs", KeyType::Dword, true, 0x00000000, 133, 0, 0},
+    {"NV_REG_STR_RM_LPWR_MS_DIFR_SW_ASR_IDLE_THRESHOLD_US", "RMLpwrMsDifrSwAsrIdleThresholdUs", KeyType::Dword, true, 0x00000000, 133, 0, 0},
+    {"NV_REG_STR_RM_LPWR_MS_DIFR_CG_IDLE_THRESHOLD_US", "RMLpwrMsDifrCgIdleThresholdUs", KeyType::Dword, true, 0x00000000, 133, 0, 0},
+    {"NV_REG_STR_RM_LPWR_CACHE_STATS_ON_D3_SUPPORT", "RmLpwrCacheStatsOnD3", KeyType::Dword, true, 0x00000000, 133, 0, 0},
+    {"NV_REG_STR_RM_LPWR_FG_RPPG_SUPPORT", "RmLpwrFgRppg", KeyType::Dword, true, 0x00000000, 133, 0, 0},
+    {"NV_REG_STR_RM_JT_POWER_CONTROL", "RMJTPowerControl", KeyType::Unknown, false, 0x00000000, 133, 2, 0},
+    {"NV_REG_STR_RM_JT_VERIF_CAPS", "RMJTVerifCaps", KeyType::Dword, false, 0x00000000, 135, 3, 0},
+    {"NV_REG_STR_RM_GC6_ONLY_SR_STEP", "RunOnlyNVSR", KeyType::Dword, true, 0x00000000, 138, 0, 0},
+    {"NV_REG_STR_RM_COPROC_REFCOUNT", "RMCoprocrefCount", KeyType::Dword, false, 0x00000000, 138, 1, 0},
+    {"NV_REG_STR_RM_GC6_STATS", "RMGC6Stats", KeyType::Dword, false, 0x00000000, 139, 1, 0},
+    {"NV_REG_STR_RM_GC6_FEATURE", "RMGC6Feature", KeyType::Dword, false, 0x00000000, 140, 11, 0},
+    {"NV_REG_STR_RM_GCOFF_FEATURE", "RMGCOffFeature", KeyType::Dword, false, 0x00000000, 151, 1, 0},
+    {"NV_REG_STR_RM_FORCE_RTD3_D3HOT", "RMForceRtd3D3Hot", KeyType::Dword, false, 0x00000000, 152, 1, 0},
+    {"NV_REG_STR_RM_GC6_PARAMETERS", "RMGC6Parameters", KeyType::Dword, false, 0x00000000, 153, 4, 0},
+    {"NV_REG_STR_RM_DI_FEATURE", "RMDidleFeatureGC5", KeyType::Dword, false, 0x00000000, 157, 13, 0},
+    {"NV_REG_STR_RM_DI_WAKEUP_TIMER", "RMDiWakeupTimer", KeyType::Dword, false, 0x00000000, 170, 2, 0},
+    {"NV_REG_STR_RM_D3_FEATURE", "RMD3Feature", KeyType::Dword, false, 0x00000000, 172, 1, 0},
+    {"NV_REG_STR_RM_OPERATION_MODE", "RMGpuOperationMode", KeyType::Dword, false, 0x00000000, 173, 3, 0},
+    {"NV_REG_STR_RM_2644249", "RM2644249", KeyType::Dword, true, 0x00000000, 176, 0, 0},
+    {"NV_REG_STR_RM_ELCG", "RMElcg", KeyType::Dword, false, 0x00000000, 176, 18, 0},
+    {"NV_REG_STR_RM_BLCG2", "RMBlcg", KeyType::Dword, false, 0x00000000, 194, 11, 0},
+    {"NV_REG_STR_RM_1760398", "RmWar1760398", KeyType::Dword, true, 0x00000000, 205, 0, 0},
+    {"NV_REG_STR_RM_1895530_CE_ELCG_WAR", "RmCeElcgWar1895530", KeyType::Dword, true, 0x00000000, 205, 0, 0},
+    {"NV_REG_STR_BUG_2519005_WAR", "RMBug2519005War", KeyType::Dword, true, 0x00000000, 205, 0, 0},
+    {"NV_REG_STR_RM_1976365_WAR", "RmWar1976365", KeyType::Dword, true, 0x00000000, 205, 0, 0},
+    {"NV_REG_STR_RM_ELPG", "RMElpg", KeyType::Dword, true, 0x00000000, 205, 12, 0},
+    {"NV_REG_STR_RM_ADAPTIVE_PWR_DEBUG", "RMAdaptivePwrDebug", KeyType::Dword, false, 0x00000000, 217, 2, 0},
+    {"NV_REG_STR_RM_PER_INTR_DPC_QUEUING", "RMDisablePerIntrDPCQueueing", KeyType::Dword, false, 0x00000000, 219, 0, 0},
+    {"NV_REG_STR_BSOD_ON_FIRST_RC", "RMChkSuppl200405980Driv", KeyType::Dword, true, 0x00000000, 219, 0, 0},
+    {"NV_REG_STR_RM_SLCG", "RMSlcg", KeyType::Dword, true, 0x00000000, 219, 23, 0},
+    {"NV_REG_STR_RM_CLOCK_SLOWDOWN", "RMClkSlowDown", KeyType::Dword, false, 0x00000000, 242, 5, 0},
+    {"NV_REG_STR_RM_FSPG", "RMFspg", KeyType::Dword, true, 0x00000000, 247, 4, 0},
+    {"NV_REG_STR_RM_ASR_ENABLE", "RMAsrEnable", KeyType::Unknown, false, 0x00000000, 251, 0, 0},
+    {"NV_REG_STR_RM_ASR_WAKEUP", "RMAsrWakeup", KeyType::Dword, true, 0x00000001, 251, 0, 0},
+    {"NV_REG_STR_RM_INDUCE_DEVICE_SCAN", "RMInduceDeviceScan", KeyType::Dword, false, 0x00000000, 251, 0, 0},
+    {"NV_REG_STR_RM_DOCK_WAR_922492", "RM922492", KeyType::Dword, false, 0x00000000, 251, 0, 0},
+    {"NV_REG_STR_RM_FORCE_DOCK_DETECTION_METHOD", "RmDockPolicy", KeyType::Dword, false, 0x00000000, 251, 0, 0},
+    {"NV_REG_STR_RM_FORCE_LID_DETECTION_METHOD", "RmLidPolicy", KeyType::Dword, false, 0x00000000, 251, 0, 0},
+    {"NV_REG_STR_RM_CACHE_CONNECTOR_DCS", "RmCacheConnectorDCS", KeyType::Dword, true, 0x00000000, 251, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_REGISTRY_CACHE", "RmDisableRegistryCaching", KeyType::Dword, false, 0x00000000, 251, 4, 0},
+    {"NV_REG_STR_RM_NVIF_FUNCTIONS", "RmNVIFFunctions", KeyType::Binary, false, 0x00000000, 255, 0, 0},
+    {"NV_REG_STR_RM_EXT_DEVICE_CACHE", "RmExtDeviceCache", KeyType::Dword, false, 0x00000000, 255, 0, 0},
+    {"NV_REG_STR_THERMAL_PROVIDER_NUM", "RmThermalProviderNum", KeyType::Unknown, false, 0x00000000, 255, 0, 0},
+    {"NV_REG_STR_THERMAL_PROVIDER_INFO", "RmThermalProviderInfo", KeyType::Binary, false, 0x00000000, 255, 0, 0},
+    {"NV_REG_STR_THERMAL_CACHE_DISABLE", "RmThermalCacheDisable", KeyType::Dword, false, 0x00000000, 255, 0, 0},
+    {"NV_REG_STR_I2C_VALIDATED_PORT_MASK", "RMI2cValidatedPortMask", KeyType::Dword, false, 0x00000000, 255, 0, 0},
+    {"NV_REG_STR_I2C_REVALIDATE_DDC_PORT_WAR", "RMI2cRevalidateDdcPortWAR", KeyType::Dword, true, 0x00000000, 255, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_ACPI", "RmDisableACPI", KeyType::Dword, false, 0x00000000, 255, 0, 0},
+    {"NV_REG_STR_RM_GPU_ID", "RMGpuId", KeyType::Dword, false, 0x00000000, 255, 0, 0},
+    {"NV_REG_STR_RM_TCIPHER_WEAK_KEY", "RMTCipherWeakKey", KeyType::Dword, false, 0x00000000, 255, 0, 0},
+    {"NV_REG_STR_RM_SKIP_DH_KEY", "RMSkipDHKey", KeyType::Dword, false, 0x00000000, 255, 0, 0},
+    {"NV_REG_STR_RM_DBG_DH", "RMDbgDh", KeyType::Dword, false, 0x00000000, 255, 0, 0},
+    {"NV_REG_STR_RM_HDCP_KEYGLOB_ZERO", "RMHdcpKeyglobZero", KeyType::Dword, false, 0x00000000, 255, 0, 0},
+    {"NV_REG_STR_RM_HDCP_SET_KEYS", "RMHdcpSetKeys", KeyType::Binary, false, 0x00000000, 255, 0, 0},
+    {"NV_REG_STR_PROVIDER_REGISTER_SCRIPT_ADT7473", "RmProviderRsAdt7473", KeyType::Binary, false, 0x00000000, 255, 0, 0},
+    {"NV_REG_STR_RM_ENABLE_DH_KEY_EXCHANGE", "RmEnableDHKeyExchange", KeyType::Dword, false, 0x00000000, 255, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_DH_KEY_EXCHANGE", "RmDisableDHKeyExchange", KeyType::Dword, false, 0x00000000, 255, 0, 0},
+    {"NV_REG_STR_RM_IMP_ENABLE", "RMEnableIMP", KeyType::Dword, false, 0x00000000, 255, 0, 0},
+    {"NV_REG_STR_RM_IMP_DYNAMIC_MEMPOOL_ALLOCATION", "RMIMPDynamicMempoolAllocation", KeyType::Dword, false, 0x00000000, 255, 0, 0},
+    {"NV_REG_STR_MIN_OVERLAY_PSTATE", "RMIMPMinOverlayPstate", KeyType::Dword, false, 0x00000000, 255, 0, 0},
+    {"NV_REG_STR_RM_LIMIT_MEMPOOL_ALLOCATION_RELATIVE_TO_MSCG_HIGH_WM", "RMLimitMempoolRelativeToMscgWM", KeyType::Dword, false, 0x00000000, 255, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_DISPLAY", "RmDisableDisplay", KeyType::Dword, false, 0x00000000, 255, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_MPEG", "RmDisableMpeg", KeyType::Dword, false, 0x00000000, 255, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_FAST_FLUSH", "RmDisableFastFlush", KeyType::Dword, false, 0x00000000, 255, 0, 0},
+    {"NV_REG_NATIVE_PCIE_L1_WAR_FLAGS", "RMNativePcieL1WarFlags", KeyType::Dword, false, 0x00000000, 255, 3, 0},
+    {"NV_REG_NATIVE_PCIE_L1_WAR_FLAGS_ALIAS", "RM303107", KeyType::Dword, false, 0x00000000, 258, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_GPU_ASPM_FLAGS", "RMDisableGpuASPMFlags", KeyType::Dword, false, 0x00000000, 258, 2, 0},
+    {"NV_REG_STR_RM_SBIOS_ENABLE_ASPM_DT", "RMSbiosEnableASPMDT", KeyType::Binary, false, 0x00000000, 260, 2, 0},
+    {"NV_REG_STR_RM_ENABLE_ASPM_DT", "RMEnableASPMDT", KeyType::Dword, false, 0x00000000, 262, 2, 0},
+    {"NV_REG_STR_RM_OVERRIDE_SUPPORT_CHIPSET_ASPM", "RmOverrideSupportChipsetAspm", KeyType::Dword, false, 0x00000000, 264, 2, 0},
+    {"NV_REG_STR_RM_ENABLE_ASPM_AT_LOAD", "RMEnableASPMAtLoad", KeyType::Dword, false, 0x00000000, 266, 2, 0},
+    {"NV_REG_STR_RM_ENABLE_ASPM_PUBLIC_BITS", "RMEnableASPMPublicBits", KeyType::Dword, false, 0x00000000, 268, 3, 0},
+    {"NV_REG_STR_RM_PCIE_L1_EXIT_LATENCY_OVERRIDE", "RML1ExitLatencyOverride", KeyType::Dword, false, 0x00000000, 271, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_BSP", "RmDisableBsp", KeyType::Dword, false, 0x00000000, 271, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_BSP_LOAD", "RmDisableBspLoad", KeyType::Dword, false, 0x00000000, 271, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_CE", "RmDisableCe", KeyType::Dword, false, 0x00000000, 271, 0, 0},
+    {"NV_REG_STR_RM_CE_PCE_MAP", "RmCePceMap", KeyType::Unknown, false, 0x00000000, 271, 0, 0},
+    {"NV_REG_STR_RM_CE_PCE_MAP_1", "RmCePceMap1", KeyType::Unknown, false, 0x00000000, 271, 0, 0},
+    {"NV_REG_STR_RM_CE_PCE_MAP_2", "RmCePceMap2", KeyType::Unknown, false, 0x00000000, 271, 0, 0},
+    {"NV_REG_STR_RM_CE_PCE_MAP_3", "RmCePceMap3", KeyType::Dword, false, 0x00000000, 271, 0, 0},
+    {"NV_REG_STR_RM_CE_GRCE_SHARED", "RmCeGrceShared", KeyType::Dword, false, 0x00000000, 271, 0, 0},
+    {"NV_REG_STR_RM_CE_ONE_TO_ONE_MAP", "RmCeOneToOneMap", KeyType::Unknown, false, 0x00000000, 271, 0, 0},
+    {"NV_REG_STR_RM_CE_ENABLE_AUTO_CONFIG", "RmCeEnableAutoConfig", KeyType::Dword, false, 0x00000000, 271, 0, 0},
+    {"NV_REG_STR_RM_EXPOSE_ALL_LCE", "RmCeExposeAllLce", KeyType::Dword, false, 0x00000000, 271, 0, 0},
+    {"NV_REG_STR_RM_CE_USE_GEN4_MAPPING", "RmCeUseGen4Mapping", KeyType::Dword, false, 0x00000000, 271, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_MSENC", "RmDisableMsenc", KeyType::Dword, false, 0x00000000, 271, 0, 0},
+    {"NV_REG_STR_RM_ENABLE_NVJPG", "RmEnableNvjpg", KeyType::Dword, false, 0x00000000, 271, 0, 0},
+    {"NV_REG_STR_RM_ENABLE_OFA", "RmEnableOfa", KeyType::Dword, false, 0x00000000, 271, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_FSP", "RmDisableFsp", KeyType::Dword, false, 0x00000000, 271, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_COT_CMD", "RmDisableCotCmd", KeyType::Dword, true, 0x00000000, 271, 3, 0},
+    {"NV_REG_STR_RM_MSENC_FALCTRACE", "RmMsencFalcTrace", KeyType::Dword, true, 0x00000000, 274, 0, 0},
+    {"NV_REG_STR_RM_GSP_RTOS_OVERRIDES", "RmGspRtosOverrides", KeyType::Dword, false, 0x00000000, 274, 1, 0},
+    {"NV_REG_STR_RM_GSP_BOOT_LIBOS", "RmGspBootLibos", KeyType::Dword, false, 0x00000000, 275, 0, 0},
+    {"NV_REG_STR_RM_GSP_BOOT_NVOS_SAMPLE", "RmGspNvosSample", KeyType::Dword, false, 0x00000000, 275, 0, 0},
+    {"NV_REG_STR_RM_GSP_BOOT_STRESS_TEST", "RmGspBootStressTest", KeyType::Dword, false, 0x00000000, 275, 0, 0},
+    {"NV_REG_STR_RM_OVERRIDE_UPROC_ENGINE_ARCH", "RmOverrideUprocEngineArch", KeyType::Dword, false, 0x00000000, 275, 5, 0},
+    {"NV_REG_STR_RM_DISABLE_SEC2", "RmDisableSec2", KeyType::Dword, false, 0x00000000, 280, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_GSP", "RmDisableGsp", KeyType::Dword, false, 0x00000000, 280, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_GSP_LOAD", "RmDisableGspLoad", KeyType::Dword, false, 0x00000000, 280, 0, 0},
+    {"NV_REG_STR_RM_GSP_HALT_ON_INIT", "RmGspHaltOnInit", KeyType::Dword, true, 0x00000000, 280, 0, 0},
+    {"NV_REG_STR_RM_ENABLE_FBFLCN", "RmEnableFbflcn", KeyType::Dword, false, 0x00000000, 280, 0, 0},
+    {"NV_REG_STR_RM_MCLK_SWITCH_ON_FBFLCN", "RmMClkSwitchOnFbflcn", KeyType::Dword, false, 0x00000000, 280, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_FBFLCN_DEVINIT_BOOT", "RmDisableFbflcnDevinitBoot", KeyType::Dword, false, 0x00000000, 280, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_SEC2_LOAD", "RmDisableSec2Load", KeyType::Dword, false, 0x00000000, 280, 0, 0},
+    {"NV_REG_STR_RM_ENABLE_HDA", "RmEnableHda", KeyType::Dword, false, 0x00000000, 280, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_VP", "RmDisableVp", KeyType::Dword, false, 0x00000000, 280, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_MMU_INVALIDATE", "RmDisableMmuInvalidate", KeyType::Dword, false, 0x00000000, 280, 0, 0},
+    {"NV_REG_STR_FORCE_PERF_D3COLD", "RMForcePerfLevelOnD3Cold", KeyType::Dword, false, 0x00000000, 280, 0, 0},
+    {"NV_REG_STR_RM_EXTERNAL_HEAP", "RMExternalHeap", KeyType::Dword, false, 0x00000000, 280, 0, 0},
+    {"NV_REG_STR_RESET_PERFMON_D4", "RMResetPerfMonD4", KeyType::Dword, false, 0x00000000, 280, 0, 0},
+    {"NV_REG_STR_RM_ENABLE_PRE_EXCEPTION", "RmEnablePreException", KeyType::Dword, false, 0x00000000, 280, 0, 0},
+    {"NV_REG_STR_RM_HDMI_DISALLOWED", "RmHDMIDisallowDisplayMask", KeyType::Dword, false, 0x00000000, 280, 0, 0},
+    {"NV_REG_STR_RM_1536122", "Rm1536122", KeyType::Dword, false, 0x00000000, 280, 0, 0},
+    {"NV_REG_STR_RM_POLLING_NEVER", "RmNeverPoll", KeyType::Dword, false, 0x00000000, 280, 0, 0},
+    {"NV_REG_OVERRIDE_MXM_SIZE", "MXMSize", KeyType::Binary, false, 0x00000000, 280, 0, 0},
+    {"NV_REG_OVERRIDE_MXM_DATA", "MXMData", KeyType::Binary, false, 0x00000000, 280, 0, 0},
+    {"NV_REG_OVERRIDE_MXM_VERSION", "MXMVersion", KeyType::Binary, false, 0x00000000, 280, 0, 0},
+    {"NV_REG_MXM_DISABLE", "MXMDisable", KeyType::Dword, false, 0x00000000, 280, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_VISTA_WARS", "RMDisableVistaWars", KeyType::Dword, false, 0x00000000, 280, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_VISTA_BUG_295770_WAR", "RMDisableVistaBug295770War", KeyType::Dword, false, 0x00000000, 280, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_VISTA_BUG_320752_WAR", "RMDisableVistaBug320752War", KeyType::Dword, false, 0x00000000, 280, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_VISTA_BUG_794077_WAR", "RMDisableVistaBug794077War", KeyType::Dword, false, 0x00000000, 280, 0, 0},
+    {"NV_REG_STR_RM_ORIG_FB_REQ_SIZE", "RmOrigFbReqSize", KeyType::Dword, false, 0x00000000, 280, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_VISTA_BUG_340746_WAR", "RMDisableVistaBug340746War", KeyType::Unknown, false, 0x00000000, 280, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_VISTA_BUG_261723_WAR", "RMDisableVistaBug261723War", KeyType::Dword, false, 0x00000000, 280, 0, 0},
+    {"NV_REG_STR_RM_FORCE_VISTA_BUG_290175_WAR", "RMForceVistaBug290175War", KeyType::Dword, false, 0x00000000, 280, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_WIN8_BUG_1169134_WAR", "RMDisableWin8Bug1169134War", KeyType::Dword, false, 0x00000000, 280, 0, 0},
+    {"NV_REG_STR_RM_MINION_SET_UCODE", "RMMinionSetUCode", KeyType::Binary, false, 0x00000000, 280, 0, 0},
+    {"NV_REG_STR_RM_MINION_SET_UCODE_HDR", "RMMinionSetUCodeHdr", KeyType::Binary, false, 0x00000000, 280, 0, 0},
+    {"NV_REG_STR_RM_BINDATA_FILE_DIR", "BindataFileDir", KeyType::String, false, 0x00000000, 280, 0, 0},
+    {"NV_REG_STR_RM_BINDATA_FILE_FILTER", "BindataFileFilter", KeyType::String, false, 0x00000000, 280, 0, 0},
+    {"NV_REG_STR_RM_DPU_HDCP_OFFLOAD", "RmDpuHdcpOffload", KeyType::Dword, false, 0x00000000, 280, 0, 0},
+    {"NV_REG_STR_RM_DPU_FALCTRACE", "RmDpuFalcTrace", KeyType::Unknown, false, 0x00000000, 280, 0, 0},
+    {"NV_REG_STR_RM_DPU_RTOS_FREQ_CHANGE_DISABLE", "RmDpuRtosFreqChangeDisable", KeyType::Dword, true, 0x00000000, 280, 0, 0},
+    {"NV_REG_STR_RM_DPU_FORCE_FRAME_RELEASE", "RmDpuForceFrameRelease", KeyType::Dword, false, 0x00000000, 280, 2, 0},
+    {"NV_REG_STR_RM_SEC2_UCODE_PROFILE", "RmSec2UcodeProfile", KeyType::Dword, true, 0x00000000, 282, 0, 0},
+    {"NV_REG_STR_RM_ACR_SIGNING_ALGO", "RmAcrSigningAlgo", KeyType::Dword, false, 0x00000000, 282, 0, 0},
+    {"NV_REG_STR_RM_USE_AUTO_ACR", "RmUseAutoAcr", KeyType::Dword, false, 0x00000000, 282, 0, 0},
+    {"NV_REG_STR_RM_ALLOW_PRIV_SEC_DISABLED", "RmAllowPrivSecDisabled", KeyType::Dword, false, 0x00000000, 282, 0, 0},
+    {"NV_REG_STR_RM_SEC2_FALCTRACE", "RmSec2FalcTrace", KeyType::Dword, true, 0x00000000, 282, 0, 0},
+    {"NV_REG_STR_RM_SEC2_ENABLE_RTOS", "RmSec2EnableRtos", KeyType::Dword, false, 0x00000000, 282, 0, 0},
+    {"NV_REG_STR_RM_SEC2_LOAD_PR_MODS", "RmSec2LoadPrMods", KeyType::Dword, false, 0x00000000, 282, 0, 0},
+    {"NV_REG_STR_RM_SEC2_RTOS_OVERRIDES", "RmSec2RtosOverrides", KeyType::Dword, false, 0x00000000, 282, 3, 0},
+    {"NV_REG_STR_RM_SEC2_BUG_2540582_WAR", "RmSec2Bug2540582War", KeyType::Dword, false, 0x00000000, 285, 0, 0},
+    {"NV_REG_STR_RM_SEC2_ENABLE_APM", "RmSec2EnableApm", KeyType::Dword, false, 0x00000000, 285, 0, 0},
+    {"NV_REG_STR_RM_PMU_BOOTSTRAP_MODE", "RmPmuBootstrapMode", KeyType::Dword, true, 0x00000000, 285, 0, 0},
+    {"NV_REG_STR_RM_PMU_UCODE_PROFILE", "RmPmuUcodeProfile", KeyType::Dword, true, 0x00000000, 285, 0, 0},
+    {"NV_REG_STR_RM_PMU_UCODE_ADDRMODE", "RmPmuUcodeAddrMode", KeyType::Unknown, true, 0x00000000, 285, 0, 0},
+    {"NV_REG_STR_RM_PMU_FORCE_PHYS_MAPPINGS", "RmPmuForcePhysMappings", KeyType::Dword, false, 0x00000000, 285, 0, 0},
+    {"NV_REG_STR_RM_PMU_RPC_PROFILING", "RmPmuRpcProfiling", KeyType::Dword, true, 0x00000000, 285, 0, 0},
+    {"NV_REG_STR_RM_PMU_SUPER_SURFACE_RPC", "RmPmuSuperSurfaceRPC", KeyType::Dword, true, 0x00000000, 285, 0, 0},
+    {"NV_REG_STR_RM_PG_LOG_PARAMS", "RmPmuPgLogParams", KeyType::Unknown, false, 0x00000000, 285, 4, 0},
+    {"NV_REG_STR_RM_SLI_ALWAYS_APPROVED", "RMSLIAlwaysApproved", KeyType::Dword, false, 0x00000000, 289, 0, 0},
+    {"NV_REG_STR_RM_DYNAMIC_SLI_ALLOWED", "RMDynamicSLIAllowed", KeyType::Dword, true, 0x00000001, 289, 0, 0},
+    {"NV_REG_STR_RM_WS_FEATURE_OVERRIDE", "RMWSFeatureOverride", KeyType::Dword, true, 0x00000000, 289, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_VISTA_BUG_331820_WAR", "RMDisableVistaBug331820War", KeyType::Dword, false, 0x00000000, 289, 0, 0},
+    {"NV_REG_STR_LID_CLOSE_DISPLAY_MASK", "LidCloseDisplayMask", KeyType::Dword, false, 0x00000000, 289, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_UNDERFLOW", "RMDisableUnderflow", KeyType::Dword, false, 0x00000000, 289, 0, 0},
+    {"NV_REG_STR_RM_SKIP_P8_BUG_200433138_WAR", "RMSkipP8Bug200433138War", KeyType::Dword, false, 0x00000000, 289, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_ZBC_DEFAULT_LOAD", "RMDisableZBCDefaultLoad", KeyType::Dword, false, 0x00000000, 289, 0, 0},
+    {"NV_REG_STR_RM_ENABLE_I2C_NANNY", "RmEnableI2CNanny", KeyType::Dword, true, 0x00000001, 289, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_GEN2_LINK_RETRAINING", "RmDisableGen2LinkRetraining", KeyType::Dword, false, 0x00000000, 289, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_GEN2", "RMNoGen2", KeyType::Dword, true, 0x00000000, 289, 0, 0},
+    {"NV_REG_STR_RM_FORCE_ENABLE_GEN2", "RmForceEnableGen2", KeyType::Dword, true, 0x00000000, 289, 0, 0},
+    {"NV_REG_STRM_RM_FORCE_ENABLE_PCIEGEN_SWITCHING", "RmForceEnablePcieGenSwitching", KeyType::Dword, true, 0x00000000, 289, 0, 0},
+    {"NV_REG_STR_EMULATED_NBSI_TABLE", "RMemNBSItable", KeyType::Unknown, false, 0x00000000, 289, 0, 0},
+    {"NV_REG_STR_RM_GPU_CACHE_ENABLE", "RMGpuCacheEnable", KeyType::Dword, true, 0x00000001, 289, 0, 0},
+    {"NV_REG_STR_RM_MAP_P2P_PEER_ID", "RMP2PPeerId", KeyType::Dword, false, 0x00000000, 289, 0, 0},
+    {"NV_REG_STR_SEC_PRIV_CONT_WAR", "RM413740", KeyType::Dword, false, 0x00000000, 289, 0, 0},
+    {"NV_REG_BINARY_ALTERNATIVE_PWM_CONTROL", "RM442643", KeyType::Binary, false, 0x00000000, 289, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_AGGRESSIVE_VBLANK", "RmDisableAggressiveVblank", KeyType::Dword, true, 0x00000000, 289, 0, 0},
+    {"NV_REG_STR_RM_ENABLE_PBI", "RMEnablePbi", KeyType::Dword, true, 0x00000000, 289, 0, 0},
+    {"NV_REG_STR_DISABLE_OVERCLOCKED_PSTATES", "DisableOverclockedPstates", KeyType::Dword, true, 0x00000000, 289, 0, 0},
+    {"NV_REG_STR_ENABLE_OVERCLOCKING_ALL_PSTATES", "RMEnableOverclockingAllPstates", KeyType::Dword, true, 0x00000000, 289, 0, 0},
+    {"NV_REG_STR_ENABLE_TESLA_OVERVOLTAGING", "RMEnableTeslaOvervoltaging", KeyType::Dword, true, 0x00000000, 289, 0, 0},
+    {"NV_REG_STR_DISABLE_PEX_LINK_SPEED_WAR", "DisablePexLinkSpeedWAR", KeyType::Dword, true, 0x00000000, 289, 0, 0},
+    {"NV_REG_STR_RM_FPGA_DISABLE_SI570", "RMFPGADisableSi570", KeyType::Dword, true, 0x00000000, 289, 0, 0},
+    {"NV_REG_STR_RM_SKIP_SNOOZE_FRAMES", "RMSkipSnoozeFrames", KeyType::Dword, true, 0x00000000, 289, 0, 0},
+    {"NV_REG_STR_RM_SUPPRESS_GPIO_INTR_ERR_LOG", "RMSuppressGPIOIntrErrLog", KeyType::Dword, true, 0x00000000, 289, 0, 0},
+    {"NV_REG_STR_RM_ENABLE_NON_SILICON_DP_AUX", "RMEnableNonSiliconDpAux", KeyType::Dword, false, 0x00000000, 289, 0, 0},
+    {"NV_REG_STR_RM_FBSR_PAGED_DMA", "RmFbsrPagedDMA", KeyType::Dword, true, 0x00000000, 289, 0, 0},
+    {"NV_REG_STR_RM_FBSR_WDDM_MODE", "RmFbsrWDDMMode", KeyType::Dword, true, 0x00000000, 289, 0, 0},
+    {"NV_REG_STR_RM_FBSR_FILE_MODE", "RmFbsrFileMode", KeyType::Dword, true, 0x00000000, 289, 0, 0},
+    {"NV_REG_STR_RM_FB_TRAINING_CMOS", "RMFBTrainingCMOS", KeyType::Dword, false, 0x00000000, 289, 9, 0},
+    {"NV_REG_STR_RM_FB_TRAINING_CML", "RMFBTrainingCML", KeyType::Dword, false, 0x00000000, 298, 6, 0},
+    {"NV_REG_STR_FAKE_DISPLAY_MASK", "FakeDispMask", KeyType::Dword, false, 0x00000000, 304, 0, 5},
+    {"NV_REG_STR_RM_PCIDEVID_CHECK_IGNORE", "RMDevidCheckIgnore", KeyType::Dword, false, 0x00000000, 304, 0, 0},
+    {"NV_REG_STR_RM_VFE_VARS_VERSION_CHECK_IGNORE", "RMVfeVarsVersionCheckIgnore", KeyType::Dword, false, 0x00000000, 304, 0, 0},
+    {"NV_REG_STR_RM_HW_SPEEDO_CHECK_IGNORE", "RMHwSpeedoCheckIgnore", KeyType::Dword, false, 0x00000000, 304, 0, 0},
+    {"NV_REG_STR_RM_HW_SPEEDO_OVERRIDE", "RMHwSpeedoOverride", KeyType::Dword, false, 0x00000000, 304, 0, 0},
+    {"NV_REG_STR_RM_PMGR_SPEEDO_COEFFICIENT", "RmPmgrSpeedoCoefficient", KeyType::Dword, false, 0x00000000, 304, 0, 0},
+    {"NV_REG_STR_RM_PMGR_SPEEDO_OFFSET", "RmPmgrSpeedoOffset", KeyType::Dword, false, 0x00000000, 304, 0, 0},
+    {"NV_REG_STR_RM_HW_SPEEDO_1_OVERRIDE", "RMHwSpeedo1Override", KeyType::Dword, false, 0x00000000, 304, 0, 0},
+    {"NV_REG_STR_RM_HW_SPEEDO_2_OVERRIDE", "RMHwSpeedo2Override", KeyType::Dword, false, 0x00000000, 304, 0, 0},
+    {"NV_REG_STR_RM_GLOBAL_POISON_OVERRIDE", "RmGlobalPoisonOverride", KeyType::Dword, true, 0x00000000, 304, 0, 0},
+    {"NV_REG_STR_RM_ECC_FUSE_IGNORE", "RMNoECCFuseCheck", KeyType::Dword, false, 0x00000000, 304, 0, 0},
+    {"NV_REG_STR_RM_NO_ECC_FB_SCRUB", "RMNoECCFBScrub", KeyType::Dword, false, 0x00000000, 304, 0, 0},
+    {"NV_REG_STR_RM_ECC_L1_ENABLE", "RMEnableL1ECC", KeyType::Dword, false, 0x00000000, 304, 0, 0},
+    {"NV_REG_STR_RM_ECC_SM_ENABLE", "RMEnableSMECC", KeyType::Dword, false, 0x00000000, 304, 0, 0},
+    {"NV_REG_STR_RM_ECC_SHM_ENABLE", "RMEnableSHMECC", KeyType::Dword, false, 0x00000000, 304, 0, 0},
+    {"NV_REG_STR_RM_AERR_FORCE_DISABLE", "RMAERRForceDisable", KeyType::Dword, false, 0x00000000, 304, 0, 0},
+    {"NV_REG_STR_RM_STALL_CYCLES_ISO_COMMIT_UNALLOCATE", "RMIsoCommitUnallocate", KeyType::Dword, false, 0x00000000, 304, 0, 0},
+    {"NV_REG_ASSERT_ON_ECC_ERRORS", "RMAssertOnEccErrors", KeyType::Dword, false, 0x00000000, 304, 0, 0},
+    {"NV_REG_STR_DISABLE_ROBUST_CHANNEL_RECOVERY_ON_DBE", "RMDisableRCOnDBE", KeyType::Dword, false, 0x00000000, 304, 0, 0},
+    {"NV_REG_STR_SYSTEM_CRASH_ON_ECC_DBE", "RMSystemCrashOnEccDBE", KeyType::Dword, true, 0x00000000, 304, 0, 0},
+    {"NV_REG_STR_SYSTEM_CRASH_ON_NVLINK_TL_ERR", "RMSystemCrashOnNvLinkTlErr", KeyType::Dword, true, 0x00000000, 304, 0, 0},
+    {"NV_REG_STR_RM_INIT_SCRUB", "RMInitScrub", KeyType::Dword, false, 0x00000000, 304, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_SCRUB_ON_FREE", "RMDisableScrubOnFree", KeyType::Dword, true, 0x00000000, 304, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_FAST_SCRUBBER", "RMDisableFastScrubber", KeyType::Dword, true, 0x00000000, 304, 0, 0},
+    {"NV_REG_STR_RM_SCRUB_BLOCK_SHIFT", "RMScrubBlockShift", KeyType::Dword, false, 0x00000000, 304, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_ASYNC_MEM_SCRUB", "RMDisableAsyncMemScrub", KeyType::Dword, true, 0x00000000, 304, 0, 0},
+    {"NV_REG_STR_RM_INCREASE_ECC_SCRUB_TIMEOUT", "RM1441072", KeyType::Dword, true, 0x00000000, 304, 0, 0},
+    {"NV_REG_STR_FAN_SKIP_UNLOAD", "RMFanSkipUnload", KeyType::Dword, false, 0x00000000, 304, 0, 0},
+    {"NV_REG_STR_RM_VBIOS_FROM_ACPIROM", "RMEnableAcpiRom", KeyType::Dword, false, 0x00000000, 304, 0, 0},
+    {"NV_REG_STR_RM_VBIOS_PREFER_ACPIROM", "RM976975", KeyType::Dword, false, 0x00000000, 304, 0, 0},
+    {"NV_REG_STR_RM_MXM30_RETRY_DDC_PORT", "RM545179", KeyType::Dword, false, 0x00000000, 304, 0, 0},
+    {"NV_REG_STR_RM_SHARED_LVDS_SOR_WAR", "RM1292711", KeyType::Dword, false, 0x00000000, 304, 0, 0},
+    {"NV_REG_STR_RM_OPSB_OVERRIDE", "RM580312", KeyType::Binary, false, 0x00000000, 304, 0, 0},
+    {"NV_REG_STR_RM_OPSB", "RMOPSB", KeyType::Dword, false, 0x00000000, 304, 7, 0},
+    {"NV_REG_STR_RM_DUAL_HEAD_MCLK_SWITCH", "RM592311", KeyType::Dword, false, 0x00000000, 311, 1, 0},
+    {"NV_REG_STR_ATTRIBUTE_CB_TIMESLICE_MODE", "RMAttributeCbTimesliceMode", KeyType::Dword, false, 0x00000000, 312, 0, 0},
+    {"NV_REG_STR_RM_ENABLE_CLK", "RMEnableClk", KeyType::Dword, false, 0x00000000, 312, 0, 0},
+    {"NV_REG_STR_RM_PROGRAMMABLE_CLK_MASK", "RMProgrammableClkMask", KeyType::Dword, false, 0x00000000, 312, 0, 0},
+    {"NV_REG_STR_RM_CLK_VF_OVERRIDE", "RMClkVfOverride", KeyType::Dword, false, 0x00000000, 312, 2, 0},
+    {"NV_REG_STR_RM_ENABLE_FB_LINK_TRAINING", "RMFbLinkTraining", KeyType::Dword, true, 0x00000000, 314, 4, 0},
+    {"NV_REG_STR_RM_GPU_CACHE_ONLY", "RMGpuCacheOnly", KeyType::Dword, false, 0x00000000, 318, 0, 0},
+    {"NV_REG_STR_RM_ENABLE_REPLAYABLE", "RMEnableReplayable", KeyType::Dword, false, 0x00000000, 318, 0, 0},
+    {"NV_REG_STR_RM_L2_MAX_WAYS_SYSMEM", "RML2MaxWaysSysmem", KeyType::Dword, false, 0x00000000, 318, 0, 0},
+    {"NV_REG_STR_RM_L2_PRE_FILL", "RML2PreFill", KeyType::Dword, false, 0x00000000, 318, 0, 0},
+    {"NV_REG_STR_RM_BAR1_APERTURE_SIZE_MB", "RMBar1ApertureSizeMB", KeyType::Dword, false, 0x00000000, 318, 0, 0},
+    {"NV_REG_STR_RESTORE_BAR1_SIZE_BUG_3249028_WAR", "RMBar1RestoreSize", KeyType::Dword, false, 0x00000000, 318, 0, 0},
+    {"NV_REG_STR_RM_BAR2_APERTURE_SIZE_MB", "RMBar2ApertureSizeMB", KeyType::Dword, false, 0x00000000, 318, 0, 0},
+    {"NV_REG_STR_RM_PMA_VAS_USE_57B_BASE", "RMPmaVas57b", KeyType::Dword, false, 0x00000000, 318, 0, 0},
+    {"NV_REG_STR_RM_BAR2_BASE_GB", "RMBar2BaseGB", KeyType::Dword, false, 0x00000000, 318, 0, 3},
+    {"NV_REG_STR_RM_MAP_COMP_BIT_BACKING_STORE_BAR1", "RMMapCompBitBackingStore", KeyType::Dword, false, 0x00000000, 318, 0, 5},
+    {"NV_REG_STR_RM_QUADRO_TUNE", "QTNE", KeyType::Dword, false, 0x00000000, 318, 7, 0},
+    {"NV_REG_STR_RM_QUADRO_TUNE_2", "QTNE2", KeyType::Unknown, false, 0x00000000, 325, 4, 0},
+    {"NV_REG_STR_PSTATES_CHANGE_IRQL", "RM554484", KeyType::Dword, true, 0x00000000, 329, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_PSTATES", "RMDisablePStates", KeyType::Dword, false, 0x00000000, 329, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_PERF_INTERSECT", "RMDisablePerfIntersect", KeyType::Dword, false, 0x00000000, 329, 0, 0},
+    {"NV_REG_STR_RM_624000", "RM624000", KeyType::Dword, false, 0x00000000, 329, 0, 3},
+    {"NV_REG_STR_RM_572548", "RM572548", KeyType::Dword, false, 0x00000000, 329, 0, 0},
+    {"NV_REG_STR_RM_SUPPORT_USERD_MAP_DMA", "RMSupportUserdMapDma", KeyType::Dword, false, 0x00000000, 329, 0, 0},
+    {"NV_REG_STR_RM_ENABLE_QOS_RUNLIST_INTR", "RMEnableQoSRunlistIntr", KeyType::Dword, false, 0x00000000, 329, 0, 0},
+    {"NV_REG_STR_GPC_TILE_MAP", "RMGpcTileMap", KeyType::String, false, 0x00000000, 329, 0, 0},
+    {"NV_REG_STR_FERMI_L2_BYPASS", "RMFermiL2CacheBypass", KeyType::Unknown, false, 0x00000000, 329, 0, 0},
+    {"NV_REG_STR_DISABLE_LRC_COALESCING", "RMDisableLRCCoalescing", KeyType::Dword, false, 0x00000000, 329, 0, 0},
+    {"NV_REG_STR_RM_OFIFO_VAL", "RMOFIFOVal", KeyType::Unknown, false, 0x00000000, 329, 0, 0},
+    {"NV_REG_STR_RM_FB_TRIMMER_VAL", "RMFBTrimmerVal", KeyType::Unknown, false, 0x00000000, 329, 5, 0},
+    {"NV_REG_STR_RM_SKIP_NB_GPU_PLATFORM_CHECK", "RM1457588", KeyType::Dword, false, 0x00000000, 334, 0, 0},
+    {"NV_REG_STR_RM_SKIP_DT_GPU_PLATFORM_CHECK", "RM1774520", KeyType::Dword, false, 0x00000000, 334, 0, 0},
+    {"NV_REG_STR_HEADLESS_OPTIMUS", "RM628700", KeyType::Dword, false, 0x00000000, 334, 0, 0},
+    {"NV_REG_STR_RM_EPC_HWSLOW_FC7E081B", "EPC_HWSLOW_FC7E081B", KeyType::Dword, false, 0x00000000, 334, 0, 0},
+    {"NV_REG_STR_RM_RESERVED_MEM_BASE", "RMReservedMemoryBase", KeyType::Dword, true, 0x00000000, 334, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_EDC", "RMDisableEDC", KeyType::Dword, false, 0x00000000, 334, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_EDC_REPLAY", "RMDisableEDCReplay", KeyType::Dword, false, 0x00000000, 334, 0, 0},
+    {"NV_REG_STR_RM_LOCKING_MODE", "RMLockingMode", KeyType::Dword, true, 0x00000000, 334, 0, 0},
+    {"NV_REG_STR_RM_CTXSW_PG_RESET", "RMCtxSwPgReset", KeyType::Dword, true, 0x00000000, 334, 0, 0},
+    {"NV_REG_STR_INTR_STUCK_THRESHOLD", "RM654663", KeyType::Dword, false, 0x00000000, 334, 0, 0},
+    {"NV_REG_STR_RM_GR_REG_INIT_OVERRIDE", "RmGrRegInitOverride", KeyType::Dword, true, 0x00000000, 334, 0, 0},
+    {"NV_REG_STR_RM_ZBC_FLUSH_ENABLE", "RMZBCFlushEnable", KeyType::Dword, false, 0x00000000, 334, 0, 0},
+    {"NV_REG_STR_RM_ISOHUB_MCLK_SWITCH", "RmIsoHubMCLKSwitch", KeyType::Dword, false, 0x00000000, 334, 5, 0},
+    {"NV_REG_STR_RM_LPWR_FSM_STATE", "RMElpgStateOnInit", KeyType::Dword, false, 0x00000000, 339, 1, 0},
+    {"NV_REG_STR_RM_PGCTRL_MS_PARAMETERS", "RmPgCtrlParameters", KeyType::Dword, false, 0x00000000, 340, 15, 0},
+    {"NV_REG_STR_RM_DWB_MSCG", "RmDwbMscg", KeyType::Dword, false, 0x00000000, 355, 1, 0},
+    {"NV_REG_STR_RM_ENABLE_MSCG_CONFIG", "RMEnableMSCGConfig", KeyType::Dword, false, 0x00000000, 356, 2, 0},
+    {"NV_REG_STR_RM_PGCTRL_MS_ABORT_TIMEOUT", "RmPgCtrlAbortTimeout", KeyType::Dword, false, 0x00000000, 358, 0, 0},
+    {"NV_REG_STR_RM_LPWR_CTRL_MS_LTC_PARAMETERS", "RmLpwrCtrlMsLtcParameters", KeyType::Dword, false, 0x00000000, 358, 2, 0},
+    {"NV_REG_STR_RM_LPWR_CTRL_MS_DIFR_SW_ASR_PARAMETERS", "RmLpwrCtrlMsDifrSwAsrParameters", KeyType::Dword, false, 0x00000000, 360, 7, 0},
+    {"NV_REG_STR_RM_LPWR_CTRL_MS_DIFR_CG_PARAMETERS", "RmLpwrCtrlMsDifrCgParameters", KeyType::Dword, false, 0x00000000, 367, 6, 0},
+    {"NV_REG_STR_RM_PGCTRL_DI_PARAMETERS", "RmPgCtrlDiParameters", KeyType::Dword, false, 0x00000000, 373, 3, 0},
+    {"NV_REG_STR_RM_PGCTRL_GR_PARAMETERS", "RmPgCtrlGrParameters", KeyType::Dword, false, 0x00000000, 376, 16, 0},
+    {"NV_REG_STR_RM_LPWR_CTRL_GR_RG_PARAMETERS", "RmLpwrCtrlGrRgParameters", KeyType::Dword, false, 0x00000000, 392, 14, 0},
+    {"NV_REG_STR_RM_LPWR_GR_PG_SW_FILTER_FUNCTION_SUPPORT", "RmLpwrGrPgSwFilterFunction", KeyType::Dword, true, 0x00000000, 406, 0, 0},
+    {"NV_REG_STR_DEEPL1_ENTRY_LATENCY", "RMDeepL1EntryLatencyUsec", KeyType::Dword, false, 0x00000000, 406, 0, 0},
+    {"NV_REG_STR_ADAPTER_MODE", "AdapterType", KeyType::Dword, false, 0x00000000, 406, 0, 0},
+    {"NV_REG_STR_RM_NVLOG", "RMNvLog", KeyType::Dword, false, 0x00000000, 406, 5, 0},
+    {"NV_REG_STR_RM_HDCP_OFFLOAD", "RMHdcpOffload", KeyType::Dword, false, 0x00000000, 411, 1, 0},
+    {"NV_REG_STR_RM_DISABLE_FAN_DIAG", "RmDisableFanDiag", KeyType::Dword, true, 0x00000000, 412, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_NONCONTIGUOUS_ALLOCATION", "RMDisableNoncontigAlloc", KeyType::Dword, false, 0x00000000, 412, 0, 0},
+    {"NV_REG_STR_SECONDARY_BUS_RESET_ENABLED", "RMSecBusResetEnable", KeyType::Dword, false, 0x00000000, 412, 0, 0},
+    {"NV_REG_STR_FORCE_PCIE_CONFIG_SAVE", "RMForcePcieConfigSave", KeyType::Dword, false, 0x00000000, 412, 0, 0},
+    {"NV_REG_STR_RM_PCIE_FLR_POLICY", "RMPcieFLRPolicy", KeyType::Dword, true, 0x00000000, 412, 0, 0},
+    {"NV_REG_STR_RM_PCIE_FLR_DEVINIT_TIMEOUT_SCALE", "RMPcieFlrDevinitTimeout", KeyType::Dword, false, 0x00000000, 412, 0, 0},
+    {"NV_REG_STR_RM_NUM_AUX_RETRIES_EDID", "RMNumAuxRetriesEdid", KeyType::Dword, false, 0x00000000, 412, 0, 0},
+    {"NV_REG_STR_RM_BLACKLIST_ADDRESSES", "RmBlackListAddresses", KeyType::Binary, false, 0x00000000, 412, 0, 0},
+    {"NV_REG_STR_VERIF_BACK_TO_BACK_INTERRUPTS", "RmVerifBackToBackInt", KeyType::Dword, false, 0x00000000, 412, 0, 3},
+    {"NV_REG_STR_RM_FORCE_DP_DONGLE_HDMI", "RM776993", KeyType::Dword, false, 0x00000000, 412, 3, 0},
+    {"NV_REG_STR_ILLUM_ATTRIB_LOGO_BRIGHTNESS", "RmIllumLogoBrightness", KeyType::Dword, false, 0x00000000, 415, 0, 0},
+    {"NV_REG_STR_ILLUM_ATTRIB_SLI_BRIGHTNESS", "RmIllumSLIBrightness", KeyType::Dword, false, 0x00000000, 415, 0, 0},
+    {"NV_REG_STR_RM_SMMU_CONFIG", "RMSmmuConfig", KeyType::Dword, false, 0x00000000, 415, 4, 0},
+    {"NV_REG_STR_ENABLE_DYNAMIC_DRAM_RETIREMENT", "RM839040", KeyType::Dword, false, 0x00000000, 419, 0, 0},
+    {"NV_REG_STR_RM_THERM_POLICY_OVERRIDE", "RmThermPolicyOverride", KeyType::Dword, false, 0x00000000, 419, 1, 0},
+    {"NV_REG_STR_RM_THERM_POLICY_SW_SLOWDOWN_OVERRIDE", "RmThermPolicySwSlowdownOverride", KeyType::Dword, false, 0x00000000, 420, 1, 0},
+    {"NV_REG_STR_RM_GPS_ACPI_TYPE", "RmGpsACPIType", KeyType::Unknown, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GPS_PREFER_INTRINSIC_FUNCS", "RmGpsPreferIntrinsicFuncs", KeyType::Dword, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GPS_POWER_STEERING", "RmGpsPowerSteeringEnable", KeyType::Dword, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GPS_POWER_STEERING_TEMP_DELTA", "RmGpsPowerSteeringTempDelta", KeyType::Dword, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GPS_WEB_POLL", "RmGpsWebPoll", KeyType::Dword, true, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GPS_CPU_UTIL_POLL", "RmGpsCpuUtilPoll", KeyType::Dword, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GPS_UTIL_HYST_HIGH", "RmGpsUtilHystHigh", KeyType::Dword, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GPS_UTIL_HYST_LOW", "RmGpsUtilHystLow", KeyType::Dword, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GPS_UTIL_HYST_HIGH_AC", "RmGpsUtilHystHighAc", KeyType::Dword, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GPS_UTIL_HYST_HIGH_BATT", "RmGpsUtilHystHighBatt", KeyType::Dword, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GPS_UTIL_HYST_HIGH_BBOOST", "RmGpsUtilHystHighBBoost", KeyType::Dword, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GPS_UTIL_HYST_LOW_AC", "RmGpsUtilHystLowAc", KeyType::Dword, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GPS_UTIL_HYST_LOW_BATT", "RmGpsUtilHystLowBatt", KeyType::Dword, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GPS_UTIL_HYST_LOW_BBOOST", "RmGpsUtilHystLowBBoost", KeyType::Dword, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GPS_CPU_FREQ_MIN_MHZ", "RmGpsCpuFreqMinMHz", KeyType::Dword, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GPS_CPU_FREQ_MAX_MHZ", "RmGpsCpuFreqMaxMHz", KeyType::Dword, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GPS_GPU_UTIL_MIN_COEFF", "RmGpsGpuUtilMinCoeff", KeyType::Unknown, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GPS_GPU_UTIL_MAX_COEFF", "RmGpsGpuUtilMaxCoeff", KeyType::Dword, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GPS_PM1_ENABLE", "RmGPSPM1Enable", KeyType::Dword, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GPS_GENOA", "RmGpsGenoa", KeyType::Dword, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GSPC_POS_ZERO_ERR_K", "RmGspcPosZeroErrK", KeyType::Unknown, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GSPC_POS_BP_ERR_K", "RmGspcPosBpErrK", KeyType::Unknown, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GSPC_POS_BP_ERR_VAL", "RmGspcPosBpErrVal", KeyType::Unknown, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GSPC_POS_GTBP_ERR_K", "RmGspcPosGtbpErrK", KeyType::Unknown, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GSPC_NEG_ZERO_ERR_K", "RmGspcNegZeroErrK", KeyType::Unknown, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GSPC_NEG_BP_ERR_K", "RmGspcNegBpErrK", KeyType::Unknown, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GSPC_NEG_BP_ERR_VAL", "RmGspcNegBpErrVal", KeyType::Unknown, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GSPC_NEG_GTBP_ERR_K", "RmGspcNegGtbpErrK", KeyType::Dword, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GSPC_TSP_N_CNT", "RmGspcTspNcnt", KeyType::Unknown, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GSPC_FRAME_N_CNT", "RmGspcFrameNCnt", KeyType::Unknown, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GSPC_USE_MEDIAN", "RmGspcUseMedian", KeyType::Dword, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GSPC_PERIOD_US", "RmGspcPerioduS", KeyType::Unknown, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GSPC_STANDBY_CNT", "RmGspcStandbyCnt", KeyType::Unknown, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GSPC_PARKED_CNT", "RmGspcParkedCnt", KeyType::Unknown, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GSPC_ENGAGE_CNT", "RmGspcEngageCnt", KeyType::Unknown, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GSPC_ENGAGE_OUT", "RmGspcEngageOut", KeyType::Unknown, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GSPC_ALLOW_AC", "RmGspcAllowAc", KeyType::Dword, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GSPC_GPU_POWER_SRC", "RmGspcGpuPowerSrc", KeyType::Unknown, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GSPC_GPU_POWER_IDX", "RmGspcGpuPowerIdx", KeyType::Unknown, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GSPC_DEF_PROS_MW", "RmGspcDefProsmW", KeyType::Unknown, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GSPC_MIN_PROS_MW", "RmGspcMinProsmW", KeyType::Unknown, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GSPC_TSP_SMA_WIN_MS", "RmGspcTspSmaWinmS", KeyType::Unknown, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GSPC_TSP_SMA_QUEUE_MS", "RmGspcTspSmaQueuemS", KeyType::Unknown, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GSPC_READ_BATTERY", "RmGspcReadBattery", KeyType::Unknown, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GSPC_ADJUST_PROS", "RmGspcAdjustPros", KeyType::Dword, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GSPC_TSP_LIMIT_MW", "RmGspcTspLimitmW", KeyType::Unknown, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GSPC_MIN_FT_US", "RmGspcMinFtuS", KeyType::Unknown, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GSPC_MAX_FT_US", "RmGspcMaxFtuS", KeyType::Dword, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_CLK2_ENABLE", "RmClk2Enable", KeyType::Dword, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_ENABLE_NOISE_AWARE_PLL", "RmEnableNoiseAwarePll", KeyType::Dword, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_PER_PLL_PROGRAMMING", "RmPerPllProgramming", KeyType::Dword, true, 0xffffffff, 421, 0, 0},
+    {"NV_REG_STR_RM_NAPLL_CAL_VOLT_OFFSET", "RmNapllCalVoltOffset", KeyType::Dword, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_DFS_COEFF", "RmDfsCoeff", KeyType::Dword, true, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_DFS_COEFF_SLOPE", "RmDfsCoeffSlope", KeyType::Dword, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_DFS_COEFF_INTERCEPT", "RmDfsCoeffIntercept", KeyType::Dword, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_CLK_SECOND_VCO", "RmSecondVco", KeyType::Dword, true, 0xffffffff, 421, 0, 0},
+    {"NV_REG_STR_RM_CLK_NDIV_SLIDING", "RmNdivSliding", KeyType::Dword, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_CLK_NDIV_EFF_LIMIT", "RmClkNdivEffLimit", KeyType::Dword, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_CLK_NDIV_CLAMP_DELTA", "RmClkNdivClampDelta", KeyType::Dword, false, 0x00000000, 421, 0, 6},
+    {"NV_REG_STR_RM_BLOB_DATA_OVERRIDE", "RmBlobData", KeyType::Binary, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GPS_PS_ENABLE_PER_CPU_CORE_DPC", "RmGpsPsEnablePerCpuCoreDpc", KeyType::Dword, false, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_GPS_CPU_C0_THRESHOLD", "RmGpsCpuC0Threshold", KeyType::Dword, true, 0x00000014, 421, 0, 0},
+    {"NV_REG_STR_RM_ALTERNATE_L2_ARBITRATION_CYA", "RMAltL2ArbCYA", KeyType::Dword, true, 0x00000000, 421, 0, 0},
+    {"NV_REG_STR_RM_PCIE_LINK_SPEED", "RMPcieLinkSpeed", KeyType::Dword, false, 0x00000000, 421, 5, 0},
+    {"NV_REG_STR_RM_DISABLE_HIGHER_GEN_SPEEDS_DURING_GEN_SPEED_SWITCH", "RMPcieStickyGenSpeed", KeyType::Dword, true, 0x00000001, 426, 0, 0},
+    {"NV_REG_STR_RM_LTR_L1_2_THRESHOLD", "RMPcieLtrL12ThresholdOverride", KeyType::Dword, false, 0x00000000, 426, 3, 0},
+    {"NV_REG_STR_RM_PCIE_LTR_OVERRIDE", "RMPcieLtrOverride", KeyType::Dword, false, 0x00000000, 429, 5, 0},
+    {"NV_REG_STR_RM_VPR_CYA_VALUE0", "RMVprCyaValue0", KeyType::Dword, false, 0x00000000, 434, 0, 0},
+    {"NV_REG_STR_RM_VPR_CYA_VALUE1", "RMVprCyaValue1", KeyType::Dword, false, 0x00000000, 434, 0, 0},
+    {"NV_REG_STR_RM_HDMI_N_LOOKUP_WAR_INTERVAL_MS", "RmHdmiNLookupWarIntervalMs", KeyType::Dword, false, 0x00000000, 434, 0, 0},
+    {"NV_REG_STR_RM_STEREO_PAIR_FLIP", "RmStereoPairFlip", KeyType::Dword, false, 0x00000000, 434, 0, 0},
+    {"NV_REG_STR_GPIO_PMU_MUTEX_TIMEOUT_US", "RMGpioPmuMutexTimeoutus", KeyType::Dword, false, 0x00000000, 434, 0, 0},
+    {"NV_REG_STR_I2C_PMGR_MUTEX_TIMEOUT_US", "RMI2cPmgrMutexTimeoutus", KeyType::Dword, false, 0x00000000, 434, 0, 0},
+    {"NV_REG_STR_RM_DEFER_INITIAL_PSTATE_WAR_BUG_988798", "RMWarBug988798", KeyType::Dword, false, 0x00000000, 434, 0, 0},
+    {"NV_REG_STR_TIME_SWAP_RDY_HI_MODIFY_LSR_MIN_TIME", "TSwapRdyHiLsrMinTime", KeyType::Dword, true, 0x000000fa, 434, 0, 0},
+    {"NV_REG_STR_TIME_SWAP_RDY_HI_MODIFY_SWAP_LOCKOUT_START", "TSwapRdyHiSwapLockoutStart", KeyType::Dword, true, 0x000000fa, 434, 0, 0},
+    {"NV_REG_STR_RM_THERM_PROVIDER_AUTODETECT_SKIP", "RmThermProviderAutoDetectSkip", KeyType::Dword, false, 0x00000000, 434, 4, 0},
+    {"NV_REG_STR_RM_S4_SURPRISE_REMOVAL_SUPPORT", "RMSupportS4SurpriseRemoval", KeyType::Dword, false, 0x00000000, 438, 0, 0},
+    {"NV_REG_STR_RM_GR_BALANCING_MODE", "RmGrBalancingMode", KeyType::Dword, true, 0x00000000, 438, 3, 0},
+    {"NV_REG_STR_RM_1165534_PPBDMA_TIMEOUT", "RmPbdmaTimeout", KeyType::Dword, false, 0x00000000, 441, 1, 0},
+    {"NV_REG_STR_RM_PPBDMA_ACQUIRE_TIMEOUT", "RmPbdmaAcquireTimeout", KeyType::Dword, false, 0x00000000, 442, 0, 0},
+    {"NV_REG_STR_RM_1295474_CHECK_FAKE_LVDS_ENTRY", "RmDisableFakeEntryCheck", KeyType::Dword, false, 0x00000000, 442, 1, 0},
+    {"NV_REG_STR_REPLAYABLE_FAULTS_DEFAULT", "RmReplayableFaultsDefault", KeyType::Dword, true, 0x00000000, 443, 0, 0},
+    {"NV_REG_STR_RM_DEFAULT_PB_TIMESLICE", "RmDefaultPbTimeslice", KeyType::Dword, false, 0x00000000, 443, 0, 0},
+    {"NV_REG_STR_RM_CLK_CAP_DIST_RENDER_MAX", "RmDistRenderMax", KeyType::Dword, false, 0x00000000, 443, 0, 0},
+    {"NV_REG_STR_RM_DUAL_MIO_INIT", "RmDualMIOInit", KeyType::Dword, true, 0x00000000, 443, 0, 0},
+    {"NV_REG_STR_RM_GC6_COMPACTION_OVERRIDE", "RmGc6CompactionOverride", KeyType::Dword, true, 0x00000000, 443, 0, 0},
+    {"NV_REG_STR_RM_BYPASS_CTXSW_IMAGE_SIZE_DISCOVERY", "RMBypassCtxswSizeDiscovery", KeyType::Unknown, true, 0x00000000, 443, 0, 0},
+    {"NV_REG_STR_INTERRUPT_ESCAPES", "RmInterruptEscapes", KeyType::Dword, false, 0x00000000, 443, 0, 0},
+    {"NV_REG_STR_RM_L2_CLEAN_FB_PULL", "RmL2CleanFbPull", KeyType::Dword, true, 0x00000000, 443, 0, 0},
+    {"NV_REG_STR_RM_OPTIMIZE_COMPUTE_OR_SPARSE_TEX", "RMOptimizeComputeOrSparseTex", KeyType::Dword, true, 0x00000000, 443, 0, 0},
+    {"NV_REG_STR_RM_FAN_2X_OVERRIDE", "RmFan2XOverride", KeyType::Dword, false, 0x00000000, 443, 1, 0},
+    {"NV_REG_STR_RM_INFOROM_DISABLE_GC", "RmDisableInforomGC", KeyType::Dword, false, 0x00000000, 444, 0, 0},
+    {"NV_REG_STR_RM_INFOROM_DISABLE_BBX", "RmDisableInforomBBX", KeyType::Dword, true, 0x00000000, 444, 4, 0},
+    {"NV_REG_STR_RM_INFOROM_BBX_WRITE_PERIODICITY", "RMInforomBBXWritePeriodicity", KeyType::Dword, true, 0x00000258, 448, 0, 0},
+    {"NV_REG_STR_RM_INFOROM_BBX_WRITE_MIN_DURATION", "RMInforomBBXWriteMinDuration", KeyType::Dword, true, 0x0000001e, 448, 0, 0},
+    {"NV_REG_STR_RM_INFOROM_DISABLE_NVLINK", "RmDisableInforomNvlink", KeyType::Dword, false, 0x00000000, 448, 2, 0},
+    {"NV_REG_STR_RM_ROP_L2_FUSE_MASK_FOR_FMODEL", "RMROPL2FuseMaskForFModel", KeyType::Dword, false, 0x00000000, 450, 1, 0},
+    {"NV_REG_STR_RM_1325336", "RMFC3GrHangBug1325336", KeyType::Dword, false, 0x00000000, 451, 0, 0},
+    {"NV_REG_STR_RM_CREATE_ACR_REGION_1", "RMCreateAcrRegion1", KeyType::Dword, false, 0x00000000, 451, 0, 0},
+    {"NV_REG_STR_RM_CREATE_ACR_REGION_2", "RMCreateAcrRegion2", KeyType::Unknown, false, 0x00000000, 451, 0, 0},
+    {"NV_REG_STR_RM_EXECUTE_ACR_ON_SEC2", "RMAcrExecuteOnSec2", KeyType::Unknown, false, 0x00000000, 451, 0, 0},
+    {"NV_REG_STR_RM_ENABLE_RISCV_LS", "RmEnableRiscvLs", KeyType::Dword, false, 0x00000000, 451, 0, 0},
+    {"NV_REG_STR_RM_SLI_GPU_BOOST_SYNC_OVERRIDE", "RmSliGpuBoostSyncOverride", KeyType::Unknown, false, 0x00000000, 451, 1, 0},
+    {"NV_REG_STR_RM_ACR_USE_CE_FOR_SHADOW_COPY", "RMAcrUseCeForShadowCopy", KeyType::Dword, false, 0x00000000, 452, 1, 0},
+    {"NV_REG_STR_RM_SLI_GPU_BOOST_SYNC_HYSTERESIS_US", "RmSliGpuBoostSyncHysteresisUs", KeyType::Dword, true, 0x00989680, 453, 0, 0},
+    {"NV_REG_STR_RM_SYNC_GPU_BOOST_OVERRIDE", "RmSyncGpuBoostOverride", KeyType::Dword, false, 0x00000000, 453, 0, 0},
+    {"NV_REG_STR_RM_LSFM_DISABLE_MASK", "RMLSFMDisableMask", KeyType::Dword, false, 0x00000000, 453, 0, 0},
+    {"NV_REG_STR_RM_LSFM_FEATURE", "RmLSFMFeature", KeyType::Dword, false, 0x00000000, 453, 1, 0},
+    {"NV_REG_STR_RM_DISABLE_ACR", "RMDisableAcr", KeyType::Dword, false, 0x00000000, 454, 0, 0},
+    {"NV_REG_STR_RM_ENABLE_ACR_RISCV", "RMEnableAcrRiscv", KeyType::Dword, false, 0x00000000, 454, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_RESIDENT_GSP_IMAGE", "RmDisableResidentGspImage", KeyType::Dword, false, 0x00000000, 454, 0, 0},
+    {"NV_REG_STR_RM_SKIP_GR_RESET_FOR_INST_SYS", "RMSkipGrResetForInstSys", KeyType::Dword, false, 0x00000000, 454, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_HDCP22", "RmDisableHdcp22", KeyType::Dword, false, 0x00000000, 454, 0, 0},
+    {"NV_REG_STR_RM_ENABLE_ACR", "RMEnableAcr", KeyType::Dword, false, 0x00000000, 454, 0, 0},
+    {"NV_REG_STR_RM_SET_MMU_DEBUG_PAGE_SIZE", "RMSetMmuDummyPageSize", KeyType::Dword, false, 0x00000000, 454, 0, 0},
+    {"NV_REG_STR_RM_SET_BAR1_ADDRESS_SPACE_BIG_PAGE_SIZE", "RMSetBAR1AddressSpaceBigPageSize", KeyType::Dword, false, 0x00000000, 454, 0, 6},
+    {"NV_REG_STR_RM_DISABLE_BIG_PAGE_PER_ADDRESS_SPACE", "RmDisableBigPagePerAddressSpace", KeyType::Dword, false, 0x00000000, 454, 0, 0},
+    {"NV_REG_STR_FORCE_GR_UCODE_LOAD", "RMForceGrUcodeLoad", KeyType::Dword, false, 0x00000000, 454, 0, 0},
+    {"NV_REG_STR_VGPU_GP_IN_BAR0", "RMVGPUGpInBAR0", KeyType::Dword, false, 0x00000000, 454, 0, 0},
+    {"NV_REG_STR_VMWARE_DEV_GPU_SUPPORT", "RMVMwareDevGPUEnable", KeyType::Dword, false, 0x00000000, 454, 0, 0},
+    {"NV_REG_STR_SIMICS_FULLSTACK", "RMSimicsFullstack", KeyType::Dword, false, 0x00000000, 454, 0, 0},
+    {"NV_REG_STR_OVERRIDE_GPU_NUMA_NODE_ID", "RMOverrideGpuNumaNodeId", KeyType::Dword, false, 0x00000000, 454, 0, 0},
+    {"NV_REG_STR_RM_REPLAY_CE_WAR_1453179", "RMClearReplayCEWAR", KeyType::Dword, false, 0x00000000, 454, 0, 0},
+    {"NV_REG_PROCESS_NONSTALL_INTR_IN_LOCKLESS_ISR", "RMProcessNonStallIntrInLocklessIsr", KeyType::Dword, false, 0x00000000, 454, 0, 0},
+    {"NV_REG_STR_RM_8L_SUBSTRATE_WAR_1482987", "RM1482987", KeyType::Dword, false, 0x00000000, 454, 0, 0},
+    {"NV_REG_STR_RM_FORCE_LOCKED_CLOCKS_MODE", "RMForceLockedClocksMode", KeyType::Dword, true, 0x00000000, 454, 0, 0},
+    {"NV_REG_STR_RM_FORCE_NETLIST_NUMBER", "RMForceNetlistNumber", KeyType::Dword, false, 0x00000000, 454, 0, 0},
+    {"NV_REG_STR_RM_FORCE_DR_SYNC_ADVANCE", "RMForceDrSyncAdvance", KeyType::Dword, false, 0x00000000, 454, 0, 4},
+    {"NV_REG_STR_RM_EXECUTE_DEVINIT_ON_PMU", "RMExecuteDevinitOnPmu", KeyType::Dword, false, 0x00000000, 454, 0, 0},
+    {"NV_REG_STR_RM_FORCE_PTE_KIND", "RMForcePteKind", KeyType::Dword, true, 0x00000000, 454, 0, 0},
+    {"NV_REG_STR_RM_USE_AGGRESSIVE_GC6", "RMUseAggressiveGC6", KeyType::Dword, true, 0x00000000, 454, 0, 0},
+    {"NV_REG_STR_RM_LOG_WARP_ESR_PC_TO_MODS", "RMLogWarpEsrPcToMods", KeyType::Dword, true, 0x00000000, 454, 0, 0},
+    {"NV_REG_STR_RM_IGNORE_UPPER_MEMORY", "RMIgnoreUpperMemory", KeyType::Dword, true, 0x00000000, 454, 0, 0},
+    {"NV_REG_STR_RM_FORCE_ENABLE_HYPERVISOR", "ForceEnableHypervisor", KeyType::Dword, false, 0x00000000, 454, 0, 0},
+    {"NV_REG_STR_RM_ENABLE_SINGLE_HEAD_MULTI_DISPLAY", "RMEnableSingleHeadMultiDisplay", KeyType::Dword, true, 0x00000000, 454, 2, 0},
+    {"NV_REG_STR_RM_ENABLE_HDMI_2", "RMEnableHdmi2", KeyType::Dword, true, 0x00000000, 456, 0, 0},
+    {"NV_REG_STR_RM_PSDL_CERT_SIZE", "RMPsdlCertSize", KeyType::Dword, false, 0x00000000, 456, 0, 0},
+    {"NV_REG_STR_RM_PSDL_STATUS", "RMPsdlCertStatus", KeyType::Dword, false, 0x00000000, 456, 0, 0},
+    {"NV_REG_STR_RM_PSDL_CERT", "RMPsdlCert", KeyType::Binary, false, 0x00000000, 456, 0, 0},
+    {"NV_REG_STR_RM_HULK_CERT_SIZE", "RMHulkCertSize", KeyType::Dword, false, 0x00000000, 456, 0, 0},
+    {"NV_REG_STR_RM_HULK_CERT", "RMHulkCert", KeyType::Binary, false, 0x00000000, 456, 0, 0},
+    {"NV_REG_STR_RM_IGNORE_HULK_ERRORS", "RmIgnoreHulkErrors", KeyType::Dword, false, 0x00000000, 456, 0, 0},
+    {"NV_REG_STR_RM_HULK_DISABLE_FEATURES", "RmHulkDisableFeatures", KeyType::Dword, false, 0x00000000, 456, 3, 0},
+    {"NV_REG_STR_RM_VRDS_SUPPORTED", "RmVrdsSupported", KeyType::Dword, false, 0x00000000, 459, 0, 0},
+    {"NV_REG_STR_RM_HDA", "RmHdaOverride", KeyType::Dword, false, 0x00000000, 459, 1, 0},
+    {"NV_REG_STR_RM_PRIV_SECURITY", "RMPrivSecurity", KeyType::Dword, false, 0x00000000, 460, 3, 0},
+    {"NV_REG_STR_RM_DISABLE_OPTIMAL_POWER_FOR_PADLINK_PLL", "RMDisableOptimalPowerForPadlinkPll", KeyType::Dword, true, 0x00000000, 463, 0, 0},
+    {"NV_REG_STR_RM_PAD_MIO_PREAMP", "RmPadMIOPreAmp", KeyType::Dword, false, 0x00000000, 463, 0, 0},
+    {"NV_REG_STR_RM_PAD_MIO_DEEMP", "RmPadMIODeEmp", KeyType::Dword, false, 0x00000000, 463, 0, 0},
+    {"NV_REG_STR_RM_NO_MIO_POWER_OFF", "RmMIONoPowerOff", KeyType::Dword, false, 0x00000000, 463, 0, 0},
+    {"NV_REG_STR_RM_ENABLE_PMA", "RMEnablePMA", KeyType::Dword, false, 0x00000000, 463, 0, 0},
+    {"NV_REG_STR_RM_ENABLE_ADDRTREE", "RMEnableAddrtree", KeyType::Dword, false, 0x00000000, 463, 0, 0},
+    {"NV_REG_STR_RM_ENABLE_PMA_MANAGED_PTABLES", "RMEnablePmaManagedPtables", KeyType::Dword, true, 0x00000001, 463, 0, 0},
+    {"NV_REG_STR_RM_FORCE_P2P_TYPE", "RMForceP2PType", KeyType::Dword, true, 0x00000000, 463, 0, 0},
+    {"NV_REG_STR_RM_NVLINK_CONTROL", "RMNvLinkControl", KeyType::Dword, false, 0x00000000, 463, 6, 0},
+    {"NV_REG_STR_RM_NVLINK_FORCE_CORE_LIB_RTL", "RMNvlinkForceCoreLibRtlsim", KeyType::Unknown, false, 0x00000000, 469, 1, 3},
+    {"NV_REG_STR_RM_SYSMEM_SELECT_ATOMICS_CONFIG", "RMSysmemSelectAtomicsConfig", KeyType::Dword, true, 0x00000100, 470, 0, 0},
+    {"NV_REG_STR_RM_SYSMEM_OVERRIDE_PCIE_REQ_ATOMIC_OPS", "RMSysmemOverridePcieReqAtomicOps", KeyType::Dword, false, 0x00000000, 470, 0, 0},
+    {"NV_REG_STR_RM_SYSMEM_SELECT_ATOMICS_CONFIG_NCOH", "RMSysmemSelectAtomicsConfigNcoh", KeyType::Dword, true, 0x00000100, 470, 0, 0},
+    {"NV_REG_STR_RM_NVLINK_PEER_THROUGH_L2", "NvLinkPeerThroughL2", KeyType::Dword, true, 0x00000000, 470, 0, 0},
+    {"NV_REG_STR_RM_NVLINK_ENABLE", "RMNvLinkEnable", KeyType::Dword, false, 0x00000000, 470, 0, 0},
+    {"NV_REG_STR_RM_NVLINK_DISABLE_LINKS", "RMNvLinkDisableLinks", KeyType::Dword, false, 0x00000000, 470, 0, 0},
+    {"NV_REG_STR_RM_NVLINK_SWITCH_LINKS", "RMNvLinkSwitchLinks", KeyType::Dword, false, 0x00000000, 470, 0, 3},
+    {"NV_REG_STR_RM_NVLINK_NISOHUB", "RMNvLinkNisohub", KeyType::Dword, false, 0x00000000, 470, 1, 0},
+    {"NV_REG_STR_RM_NVLINK_USE_PEER", "RMNvLinkUsePeer", KeyType::Dword, false, 0x00000000, 471, 0, 0},
+    {"NV_REG_STR_RM_NVLINK_UPHY_INIT_CONTROL", "RMNvlinkUPHYInitControl", KeyType::Dword, false, 0x00000000, 471, 5, 0},
+    {"NV_REG_STR_RM_NVLINK_DISABLE_P2P_LOOPBACK", "RMNvLinkDisableP2PLoopback", KeyType::Dword, true, 0x00000000, 476, 0, 0},
+    {"NV_REG_STR_RM_NVLINK_SET_LOOPBACK_MODE", "RMNvLinkSetLoopbackMode", KeyType::Dword, true, 0x00000000, 476, 0, 0},
+    {"NV_REG_STR_RM_NVLINK_SELECT_REFCLK", "RMNvLinkSelectRefclk", KeyType::Dword, false, 0x00000000, 476, 1, 0},
+    {"NV_REG_STR_RM_NVLINK_REFCLK_RATE", "RMNvLinkRefclkRate", KeyType::Dword, false, 0x00000000, 477, 1, 0},
+    {"NV_REG_STR_RM_NVLINK_SPEED_CONTROL", "RMNvLinkSpeedControl", KeyType::Dword, false, 0x00000000, 478, 1, 0},
+    {"NV_REG_STR_RM_NVLINK_TXTRAIN_CONTROL", "RMNvLinkTxTrainControl", KeyType::Dword, false, 0x00000000, 479, 5, 0},
+    {"NV_REG_STR_RM_NVLINK_MINION_CONTROL", "RMNvLinkMinionControl", KeyType::Dword, false, 0x00000000, 484, 9, 0},
+    {"NV_REG_STR_RM_NVLINK_MINION_SIMMODE_CONTROL", "RMNvLinkMinionSimModeControl", KeyType::Dword, false, 0x00000000, 493, 3, 0},
+    {"NV_REG_STR_RM_NVLINK_MINION_SMF_SETTINGS", "RMNvLinkMinionSmfSettings", KeyType::Dword, false, 0x00000000, 496, 1, 0},
+    {"NV_REG_STR_RM_NVLINK_MINION_UPHY_TABLES", "RMNvLinkMinionUphyTables", KeyType::Dword, false, 0x00000000, 497, 1, 0},
+    {"NV_REG_STR_RM_NVLINK_VERBOSE_MASK_CONTROL", "RMNvLinkverboseControlMask", KeyType::Dword, false, 0x00000000, 498, 1, 0},
+    {"NV_REG_STR_RM_NVLINK_SKIP_BUFFER_READY", "RMNvLinkSkipBufferReady", KeyType::Dword, false, 0x00000000, 499, 3, 3},
+    {"NV_REG_STR_RM_NVLINK_COUNTER_CONTROL", "RMNvLinkCounterControl", KeyType::Dword, false, 0x00000000, 502, 9, 0},
+    {"NV_REG_STR_RM_NVLINK_LINK_PM_CONTROL", "RMNvLinkControlLinkPM", KeyType::Dword, false, 0x00000000, 511, 5, 0},
+    {"NV_REG_STR_RM_NVLINK_DISABLE_RXDET", "RMNvLinkDisableRxdet", KeyType::Dword, true, 0x00000000, 516, 0, 0},
+    {"NV_REG_STR_RM_NVLINK_DISABLE_RESTORE_STATE", "RMNvLinkDisableRestoreState", KeyType::Dword, true, 0x00000000, 516, 0, 0},
+    {"NV_REG_STR_RM_NVLINK_MINION_DISABLE_PROTECTIONS", "RMNvLinkMinionDisableProtections", KeyType::Dword, true, 0x00000000, 516, 0, 0},
+    {"NV_REG_STR_RM_NVLINK_MINION_SIDELOAD", "RMNvLinkMinionSideLoad", KeyType::Dword, true, 0x00000000, 516, 0, 0},
+    {"NV_REG_STR_RM_NVLINK_FORCE_LANESHUTDOWN", "RMNvLinkForceLaneshutdown", KeyType::Dword, true, 0x00000000, 516, 0, 0},
+    {"NV_REG_STR_RM_NVLINK_SSG_CONTROL", "RMNvlinkSSGControl", KeyType::Dword, false, 0x00000000, 516, 2, 4},
+    {"NV_REG_STR_RM_NVLINK_SYSMEM_DEVICE_TYPE", "RMNvLinkForcedSysmemDeviceType", KeyType::Dword, false, 0x00000000, 518, 0, 0},
+    {"NV_REG_STR_RM_PREEMPTION_TEST_OPTIONS", "RMPreemptionTestOptions", KeyType::Unknown, false, 0x00000000, 518, 1, 3},
+    {"NV_REG_STR_RM_IGNORE_BIOS_DCB_ENTRIES_DISABLE", "RMIgnoreBiosDCBEntriesDisable", KeyType::Dword, false, 0x00000000, 519, 0, 6},
+    {"NV_REG_STR_SKIP_MIO_PADS_TOGGLE_FOR_SLI", "RM200044301", KeyType::Dword, true, 0x00000000, 519, 0, 0},
+    {"NV_REG_STR_RM_ENABLE_GFXP_MODE_AS_DEFAULT", "RMEnableGfxpModeAsDefault", KeyType::Dword, true, 0x00000000, 519, 0, 0},
+    {"NV_REG_STR_RM_SET_GFXP_WFI_TIMEOUT", "RMSetGfxpWfiTimeout", KeyType::Dword, true, 0x00000800, 519, 0, 0},
+    {"NV_REG_STR_RM_FAIL_ON_NO_GFXP", "RMFailOnNoGfxP", KeyType::Dword, true, 0x00000000, 519, 0, 0},
+    {"NV_REG_STR_RM_ENABLE_GFXP_POOL_MODE", "RMEnableGfxpPoolMode", KeyType::Dword, false, 0x00000000, 519, 0, 0},
+    {"NV_REG_STR_RM_FAIL_ON_NO_CILP", "RMFailOnNoCILP", KeyType::Dword, true, 0x00000000, 519, 0, 0},
+    {"NV_REG_STR_RM_FAIL_ON_NO_CTAP", "RMFailOnNoCTAP", KeyType::Dword, true, 0x00000000, 519, 0, 0},
+    {"NV_REG_STR_RM_SWDX_DIRECT_CTXSW_SKIP", "RMSwdxDirectCtxswSkip", KeyType::Dword, true, 0x00000000, 519, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_SWDX_DIRECT_CTXSW_SCRUB", "RMDisableSwdxDirectCtxswScrub", KeyType::Dword, true, 0x00000000, 519, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_RAMCHAIN_SCRUB", "RMDisableRamchainScrub", KeyType::Dword, true, 0x00000000, 519, 0, 0},
+    {"NV_REG_STR_RM_DP_AUXLOGGER_CONFIG", "RmDpAuxloggerConfig", KeyType::Dword, true, 0x00000400, 519, 2, 0},
+    {"NV_REG_STR_RM_NVSR_FLICKER_CONTROL", "RmNvsrFlickerControl", KeyType::Dword, false, 0x00000000, 521, 5, 0},
+    {"NV_REG_STR_RM_NVSR_BYPASS_NVSR_PACD_CHECK", "Rm719476", KeyType::Dword, false, 0x00000000, 526, 0, 0},
+    {"NV_REG_STR_ACPI_DSM_SHIM", "AcpiDsmShim", KeyType::Dword, false, 0x00000000, 526, 3, 5},
+    {"NV_REG_STR_ACPI_DSM_SHIM_GUID", "AcpiDsmShimGuid", KeyType::String, false, 0x00000000, 529, 0, 5},
+    {"NV_REG_STR_ACPI_DSM_SHIM_ARG", "AcpiDsmShimThirdArgument", KeyType::Binary, false, 0x00000000, 529, 0, 5},
+    {"NV_REG_STR_ACPI_DSM_SHIM_RET_DATA", "AcpiDsmShimReturnData", KeyType::Binary, false, 0x00000000, 529, 0, 5},
+    {"NV_REG_STR_RM_ALLOW_COMPTAG_ZERO", "RmAllowComptagZero", KeyType::Dword, true, 0x00000000, 529, 0, 0},
+    {"NV_REG_STR_RM_NONCONTIG_ALLOC_CONFIG", "RmNonContigAllocConfig", KeyType::Unknown, false, 0x00000000, 529, 2, 3},
+    {"NV_REG_STR_RM_CLK_ADC_CAL_REV_CHECK_IGNORE", "RmClkAdcCalRevCheckIgnore", KeyType::Dword, false, 0x00000000, 531, 0, 0},
+    {"NV_REG_STR_RM_CLK_ADC_TEMP_ERR_REV_CHECK_IGNORE", "RmClkAdcTempErrRevCheckIgnore", KeyType::Dword, false, 0x00000000, 531, 0, 0},
+    {"NV_REG_STR_RM_VF_POINT_CHECK_IGNORE", "RmVFPointCheckIgnore", KeyType::Dword, false, 0x00000000, 531, 0, 0},
+    {"NV_REG_STR_RM_CLK_DISABLE_DYNRAMP", "RmClkDynrampDisable", KeyType::Dword, true, 0x00000000, 531, 0, 6},
+    {"NV_REG_STR_RM_QSYNC_FW_REV_CHECK", "QuadroSyncFirmwareRevisionCheckDisable", KeyType::Dword, true, 0x00000000, 531, 0, 0},
+    {"NV_REG_STR_RM_CLK_POWER_OFF_DRAM_PLL_WHEN_UNUSED", "RmClkPowerOffDramPllWhenUnused", KeyType::Dword, false, 0x00000000, 531, 0, 0},
+    {"NV_REG_STR_RM_MCLK_P5_LINK_TRAINING_WCK_STOP_CLKS", "RmMClkP5LinkTrainingWckStopClks", KeyType::Dword, true, 0x00000000, 531, 0, 0},
+    {"NV_REG_STR_RM_GRID_SUPPORT_HYPERV_HOST", "GridSupportHypervHost", KeyType::Dword, false, 0x00000000, 531, 0, 0},
+    {"NV_REG_STR_RM_GRID_GPUP_PROFILE_TYPE", "GridGpupProfileType", KeyType::Dword, false, 0x00000000, 531, 0, 0},
+    {"NV_REG_STR_RM_GRID_LICENSED_FEATURES", "GridLicensedFeatures", KeyType::Dword, false, 0x00000000, 531, 5, 0},
+    {"NV_REG_STR_RM_GRID_BUILD_CSP", "GridSwPkg", KeyType::Dword, false, 0x00000000, 536, 0, 0},
+    {"NV_REG_STR_RM_GRID_SUPPORT_QUADRO", "GridSupportQuadro", KeyType::Dword, false, 0x00000000, 536, 0, 0},
+    {"NV_REG_STR_RM_GUEST_ECC_STATE", "RMGuestECCState", KeyType::Dword, true, 0x00000001, 536, 0, 0},
+    {"NV_REG_STR_RM_GRID_UNLICENSED_UNRESTRICTED_STATE_TIMEOUT", "UnlicensedUnrestrictedStateTimeout", KeyType::Dword, false, 0x00000000, 536, 0, 0},
+    {"NV_REG_STR_RM_GRID_UNLICENSED_RESTRICTED_1_STATE_TIMEOUT", "UnlicensedRestricted1StateTimeout", KeyType::Dword, false, 0x00000000, 536, 0, 0},
+    {"NV_REG_STR_RM_NVENC_SESSION_STATS_REPORTING_STATE", "EncSessionStatsReportingState", KeyType::Dword, false, 0x00000000, 536, 0, 0},
+    {"NV_REG_STR_RM_SKIP_2D_3D_BUNDLE_INIT", "RMSkip2d3dBundleInit", KeyType::Dword, true, 0x00000000, 536, 0, 0},
+    {"NV_REG_STR_FORCE_GRID_DISPLAYLESS", "RmForceGridDisplayless", KeyType::Dword, true, 0x00000000, 536, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_WAR_1758527", "RmDisableWar1758527", KeyType::Unknown, false, 0x00000000, 536, 0, 0},
+    {"NV_REG_STR_RM_SEC2_USE_DEBUG_FUSE_ONLY_BINARY", "RMSec2UseDebugFuseOnlyBinary", KeyType::Dword, true, 0x00000000, 536, 0, 0},
+    {"NV_REG_STR_RM_USE_PR44_ALT_UCODE_IMAGE", "RMUseAltPR44UcodeImage", KeyType::Dword, true, 0x00000000, 536, 0, 0},
+    {"NV_REG_STR_BUG_1698088_WAR", "RMBug1698088War", KeyType::Unknown, true, 0x00000000, 536, 0, 0},
+    {"NV_REG_STR_RM_CONVERT_SPLIT_RAIL_SINGLE_STEP_TO_MULTI_STEP_WAR", "RMConvertSplitRailSingleStepToMultiStepWAR", KeyType::Dword, true, 0x00000000, 536, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_PREOSAPPS", "RmDisablePreosapps", KeyType::Dword, false, 0x00000000, 536, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_FWSECLIC", "RmDisableFwseclic", KeyType::Dword, false, 0x00000000, 536, 0, 0},
+    {"NV_REG_STR_RM_GDDR5X_L2_VIDMEM_PROMOTE", "RMG5xL2VidmemPromote", KeyType::Dword, true, 0x15511554, 536, 0, 0},
+    {"NV_REG_STR_RM_FORCE_BAR_PATH", "RMForceBarPath", KeyType::Dword, true, 0x00000000, 536, 0, 0},
+    {"NV_REG_STR_RM_FAIL_ON_C2C_ABSENCE", "RMFailOnC2CAbsence", KeyType::Dword, true, 0x00000000, 536, 0, 0},
+    {"NV_REG_STR_RM_HOST_BUG_1748740_WAR", "RMHostBug1748740War", KeyType::Dword, false, 0x00000000, 536, 0, 0},
+    {"NV_REG_STR_RM_LOG_VEID_TO_MODS", "RMLogVeidToMods", KeyType::Dword, false, 0x00000000, 536, 0, 0},
+    {"NV_REG_STR_PER_SUBCTX_CONTEXT_HEADER_ENABLE", "RmPerSubctxContextHeaderEnable", KeyType::Dword, false, 0x00000000, 536, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_GPU_STATE_LOAD_BOOST", "RMDisableGpuStateLoadBoost", KeyType::Dword, true, 0x00000000, 536, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_FB_ADDRESS_RETRAINING", "RMDisableFbAddressRetraining", KeyType::Dword, true, 0x00000000, 536, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_WAR_BUG_1761410", "RMDisableWarBug1761410", KeyType::Unknown, true, 0x00000000, 536, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_INTR_ILLEGAL_COMPSTAT_ACCESS", "RMDisableIntrIllegalCompstatAccess", KeyType::Dword, true, 0x00000000, 536, 0, 0},
+    {"NV_REG_STR_RM_BUG_1771163_WAR", "RMBug1771163War", KeyType::Dword, true, 0x00000000, 536, 0, 0},
+    {"NV_REG_STR_RM_SERVICE_INLINE_DISP_INTR_BUG_1778552_WAR", "RmBug1778552War", KeyType::Dword, true, 0x00000000, 536, 0, 0},
+    {"NV_REG_STR_RM_BUG_2089053_WAR", "RmBug2089053War", KeyType::Dword, true, 0x00000001, 536, 0, 0},
+    {"NV_REG_STR_RM_DISPLAY_OVERRIDE_ELV_START", "RMDisplayOverrideElvStart", KeyType::Dword, false, 0x00000000, 536, 1, 3},
+    {"NV_REG_STR_RM_BUG_1772047_WAR", "RMBug1772047War", KeyType::Dword, true, 0x00000000, 537, 0, 0},
+    {"NV_REG_STR_RM_BUG_1779636_SEQ_DELAY", "RMBug1779636WarSeqDelay", KeyType::Unknown, true, 0x00000032, 537, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_IMP_FORCE_BITS", "RMDisableImpForceBits", KeyType::Dword, true, 0x00000000, 537, 0, 0},
+    {"NV_REG_STR_RM_BUG_1790718_WAR", "RMBug1790718War", KeyType::Unknown, true, 0x00000000, 537, 0, 0},
+    {"NV_REG_STR_RM_PVMRL", "RmPVMRL", KeyType::Dword, false, 0x00000000, 537, 8, 0},
+    {"NV_REG_STR_RM_PVMRL_USE_GFN_LSTT", "RmPVMRLUseLSTT", KeyType::Unknown, false, 0x00000000, 545, 0, 0},
+    {"NV_REG_STR_RM_BUG_1727078_WAR", "RMBug1727078War", KeyType::Unknown, true, 0x00000000, 545, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_BRIGHTNESS_OVER_AUX", "RMForceDisableBrightnessOverAux", KeyType::Dword, true, 0x00000000, 545, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_NON_NVSR_BRIGHTNESS_OVER_AUX", "RM200297641", KeyType::Dword, true, 0x00000000, 545, 0, 0},
+    {"NV_REG_STR_RM_FORCE_BRIGHTNESS_OVER_AUX", "RM3026741", KeyType::Dword, true, 0x00000000, 545, 0, 0},
+    {"NV_REG_STR_RM_FORCE_BRIGHTNESS_OVER_PWMPIN", "RMForceEnableBrightnessOverPwmPin", KeyType::Dword, true, 0x00000000, 545, 0, 0},
+    {"NV_REG_STR_RM_BUG_200324805_WAR", "RM200324805", KeyType::Dword, true, 0x00000000, 545, 0, 0},
+    {"NV_REG_STR_RM_OS_NO_PCIE_MAPPINGS_DISABLE", "RM2953508939", KeyType::Dword, false, 0x00000000, 545, 0, 0},
+    {"NV_REG_STR_RM_BUG_1848110_WAR", "RMBug1848110War", KeyType::Unknown, true, 0x00000000, 545, 0, 0},
+    {"NV_REG_STR_RM_SPI", "RMDisableSpi", KeyType::Dword, true, 0x00000000, 545, 0, 0},
+    {"NV_REG_STR_RM_SET_VGPU_GSP_PLUGIN_OFFLOAD_MODE", "RMSetVgpuGspPluginOffloadMode", KeyType::Dword, false, 0x00000000, 545, 0, 0},
+    {"NV_REG_STR_RM_SET_SRIOV_MODE", "RMSetSriovMode", KeyType::Dword, false, 0x00000000, 545, 0, 0},
+    {"NV_REG_STR_RM_SET_SRIOV_HEAVY_MODE", "RMSetSriovHeavyMode", KeyType::Dword, false, 0x00000000, 545, 0, 0},
+    {"NV_REG_STR_RM_CLIENT_RM_ALLOCATED_CTX_BUFFER", "RMSetClientRMAllocatedCtxBuffer", KeyType::Dword, false, 0x00000000, 545, 0, 0},
+    {"NV_REG_STR_RM_ITERATIVE_MMU_WALKER", "RMUseIterativeMMUWalker", KeyType::Dword, true, 0x00000000, 545, 0, 0},
+    {"NV_REG_STR_RM_SPLIT_VAS_MGMT_SERVER_CLIENT_RM", "RMSplitVasMgmtServerClientRm", KeyType::Dword, false, 0x00000000, 545, 0, 0},
+    {"NV_REG_STR_RM_ALLOW_DUMMY_P2P_OBJECT", "RMSriovAllowDummyP2PObject", KeyType::Dword, false, 0x00000000, 545, 0, 0},
+    {"NV_REG_STR_RM_SUBSCRIBE_TO_ARCH_EVENTS", "RMSubscribeToArchEvents", KeyType::Dword, false, 0x00000000, 545, 0, 0},
+    {"NV_REG_STR_RM_RUN_FUB", "RMRunFub", KeyType::Dword, false, 0x00000000, 545, 0, 0},
+    {"NV_REG_STR_RM_FUB_USE_CASE_MASK", "RMFubUseCaseMask", KeyType::Unknown, false, 0x00000000, 545, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_CLFC_WAR_1969099", "RmDisableCLFCWar1969099", KeyType::Dword, false, 0x00000000, 545, 0, 0},
+    {"NV_REG_STR_RM_BUG_1990048_WAR", "RMBug1990048War", KeyType::Unknown, true, 0x00000000, 545, 0, 0},
+    {"NV_REG_STR_RM_EXECUTE_FWSEC_ON_SEC2", "RMExecuteFwsecOnSec2", KeyType::Dword, false, 0x00000000, 545, 0, 0},
+    {"NV_REG_STR_RM_DEVINIT_BY_SECURE_BOOT", "RMDevinitBySecureBoot", KeyType::Dword, false, 0x00000000, 545, 0, 0},
+    {"NV_REG_STR_RM_ENABLE_PHY_REPEATER", "RMEnablePhyRepeater", KeyType::Dword, false, 0x00000000, 545, 2, 0},
+    {"NV_REG_STR_RM_BUG_200333878_WAR", "RMBug200333878War", KeyType::Dword, false, 0x00000000, 547, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_RC_ON_BAR_FAULT", "RMDisableRcOnBarFault", KeyType::Dword, false, 0x00000000, 547, 0, 3},
+    {"NV_REG_STR_RM_ZCULL_EQUAL_SCREEN_DIST_ON_FS", "RMZcullEqualScreenDistOnFS", KeyType::Dword, true, 0x00000000, 547, 0, 0},
+    {"NV_REG_STR_RM_PCIE_GEN_SWITCH_ON_PMU", "RMPcieGenSwitchOnPmu", KeyType::Dword, false, 0x00000000, 547, 0, 0},
+    {"NV_REG_STR_RM_SET_LINK_READY_TIMEOUT", "RMSetLinkReadyTimeout", KeyType::Dword, true, 0x00000000, 547, 0, 0},
+    {"NV_REG_STR_RM_PEX_POWER_SAVINGS", "RMPexPowerSavings", KeyType::Dword, false, 0x00000000, 547, 5, 0},
+    {"NV_REG_STR_RM_ENABLE_LANE_MARGINING", "RM200753824", KeyType::Dword, true, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_DEBUG_SET_SMC_MODE", "RMDebugSetSMCMode", KeyType::Dword, false, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_DEBUG_OVERRIDE_SMC_TPC_PER_GPC", "RMDebugOverrideSMCTpcPerGpc", KeyType::Dword, false, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_DEBUG_SMC_DYNAMIC_TPC_FS", "RMDebugSMCDynamicTpcFs", KeyType::Dword, false, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_DEBUG_SMC_SYS_PIPE_MASK_DISABLE", "RMDebugSyspipeMaskDisable", KeyType::Dword, false, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_DEBUG_SET_SMC_NVLINK_P2P_MODE", "RMDebugSetSMCNvLinkP2PMode", KeyType::Dword, false, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_DEBUG_OVERRIDE_SMC_SWIZZID_ALLOCATOR", "RMDebugOverrideSMCSwizzIdAllocator", KeyType::Dword, false, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_DEBUG_OVERRIDE_SMC_VGPU_POLICY", "RMDebugOverrideSMCVGPUPolicy", KeyType::Dword, false, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_DEBUG_OVERRIDE_SMC_HW_GPC_REORDER", "RMDebugOverrideSMCHwGpcReorder", KeyType::Dword, true, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_VGPC_SKYLINE", "RmVgpcSkyline", KeyType::Dword, false, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_VGPC_SKYLINE_HALF", "RmVgpcSkylineHalf", KeyType::Dword, false, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_VGPC_SKYLINE_QUARTER", "RmVgpcSkylineQuarter", KeyType::Dword, false, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_VGPC_SKYLINE_EIGHTH", "RmVgpcSkylineEighth", KeyType::Dword, false, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_VGPC_SINGLETON_MASK", "RmVgpcSingletonMask", KeyType::Dword, false, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_VGPC_SINGLETON_MASK_HALF", "RmVgpcSingletonMaskHalf", KeyType::Dword, false, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_VGPC_SINGLETON_MASK_QUARTER", "RmVgpcSingletonMaskQuarter", KeyType::Dword, false, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_VGPC_SINGLETON_MASK_EIGHTH", "RmVgpcSingletonMaskEighth", KeyType::Dword, false, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_SKYLINE_INSTANCE_COUNT_MASK", "RmSkylineInstCount", KeyType::Dword, false, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_DEBUG_OVERRIDE_PER_RUNLIST_CHANNEL_RAM", "RMDebugOverridePerRunlistChannelRam", KeyType::Dword, true, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_SKIP_TEGRA_CLK_INIT", "RMSkipTegraClkInit", KeyType::Dword, false, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_SKIP_TEGRA_RING_INIT", "RMSkipTegraRingInit", KeyType::Dword, false, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_POST_L2_COMPRESSION", "RMDisablePostL2Compression", KeyType::Dword, false, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_WAR_FOR_BUG_3046774", "RMDisableWarForBug3046774", KeyType::Dword, false, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_CTXSW_LOG", "RMCtxswLog", KeyType::Dword, true, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_CTXSW_LOG_RECORDS_PER_INTR", "RMCtxswLogMaxRecordsPerIntr", KeyType::Dword, true, 0x00000030, 552, 0, 0},
+    {"NV_REG_STR_RM_INTR_DETAILED_LOGS", "RMIntrDetailedLogs", KeyType::Dword, false, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_VESA_DISPLAYID_20", "RMDisableVESADisplayID20", KeyType::Dword, true, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_ALLOW_ECC_PAGE_RETIREMENT_WITH_SLI", "RMAllowECCPageRetirementSLI", KeyType::Dword, true, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_VGPU_ALLOW_PAGE_RETIREMENT", "RMvGpuAllowPageRetirement", KeyType::Dword, true, 0x00000001, 552, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_DYNAMIC_PAGE_OFFLINING", "RMDisableDynamicPageOfflining", KeyType::Dword, false, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_NVTELEMETRY_COLLECTION", "RMNvTelemetryCollection", KeyType::Dword, false, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_NVTELEMETRY_TEST", "RMNvTelemetryTest", KeyType::Dword, false, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_WAR_2061688", "RMDisableWAR2061688", KeyType::Dword, true, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_USBC_DEBUG_MODE", "RMUsbcDebugMode", KeyType::Dword, true, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_INCREASE_RSVD_MEMORY_SIZE_MB", "RMIncreaseRsvdMemorySizeMB", KeyType::Dword, true, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_CLFC_DISABLE", "RmCLFCDisable", KeyType::Dword, false, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_SM_OVERRIDE_SPEED_SELECT", "RMOverrideSmSpeedSelect", KeyType::Dword, false, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_SM_OVERRIDE_SPEED_SELECT_1", "RMOverrideSmSpeedSelect1", KeyType::Unknown, false, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_SCH_MICRO_SCHED", "RMSchMicroSched", KeyType::Dword, false, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_SKIP_HDCP22_INIT", "RMSkipHdcp22Init", KeyType::Unknown, false, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_FORCE_NVDEC_UCODE_ENCRYPTION", "RMForceNvdecUcodeEncryption", KeyType::Unknown, false, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_NVDEC_RISCV_UCODE_SELECT", "RMNvdecUcodeSelect", KeyType::Unknown, true, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_SCG_FAST_DRAIN", "RMDisableScgFastDrain", KeyType::Unknown, false, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_SLI_MCU_TEST_VALIDATE", "RMSliMcuTestValidate", KeyType::Unknown, false, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_ILLUM_FEATURE_DISABLE", "RMIllumFeatureDisable", KeyType::Unknown, false, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_SET_VGPU_VERSION_MIN", "RMSetVGPUVersionMin", KeyType::Dword, false, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_SET_VGPU_VERSION_MAX", "RMSetVGPUVersionMax", KeyType::Dword, false, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_OVERRIDE_SINT", "RmOverrideSint", KeyType::Dword, false, 0x00000000, 552, 0, 0},
+    {"NV_REG_STR_RM_PROFILING_CHECK_BYPASS", "RmProfilerFeature", KeyType::Dword, false, 0x00000000, 552, 2, 0},
+    {"NV_REG_STR_RM_VMMU", "RmVmmuSegmentSizeOverride", KeyType::Dword, false, 0x00000000, 554, 1, 0},
+    {"NV_REG_STR_RM_DISABLE_DISPLAY_MUX", "RmDisableDisplayMux", KeyType::Dword, false, 0x00000000, 555, 2, 0},
+    {"NV_REG_STR_RM_INTERNAL_DISP_MUX_OVERRIDES", "RmInternalDispMuxOverrides", KeyType::Unknown, false, 0x00000000, 557, 11, 0},
+    {"NV_REG_STR_RM_BUG_3079507_WAR", "RmBug3079507War", KeyType::Dword, false, 0x00000000, 568, 2, 0},
+    {"NV_REG_STR_RM_BUG_3477023_WAR_MS", "RmBug3477023WarMs", KeyType::Dword, false, 0x00000000, 570, 1, 0},
+    {"NV_REG_STR_RM_DISP_MUX_AUX_SETTLE_DELAY_OVERRIDE", "RmDispMuxAuxSettleDelayOverride", KeyType::Dword, false, 0x00000000, 571, 1, 0},
+    {"NV_REG_STR_RM_DISP_UPDATE_LINK_BW_SET_AFTER_LINK_RATE_SET", "RMDispUpdateLinkBwSetAfterLinkRateSet", KeyType::Dword, false, 0x00000000, 572, 0, 0},
+    {"NV_REG_STR_RM_OVERRIDE_ACPI_DDC_EDID_BLOCKS", "RmOverrideAcpiDDCEdidBlocks", KeyType::Dword, false, 0x00000000, 572, 0, 0},
+    {"NV_REG_STR_RM_ENABLE_KVM_VGPU_MIGRATION", "RmEnableKvmVgpuMigration", KeyType::Dword, true, 0x00000001, 572, 0, 0},
+    {"NV_REG_STR_RM_ENABLE_KVM_DOORBELL_EMULATION", "RmEnableKvmDoorbellEmulation", KeyType::Dword, true, 0x00000000, 572, 0, 0},
+    {"NV_REG_STR_RM_FORCE_TMDS_DETECTION", "RmForceTMDSDetection", KeyType::Dword, false, 0x00000000, 572, 0, 0},
+    {"NV_REG_STR_RM_SDC_OLED_PANEL_POWER_ON_TO_BLEN_ENABLE_BY_AUX_DELAY_TIME_MS", "RmPanelPwrOnToBlenEnByAuxMs", KeyType::Dword, false, 0x00000000, 572, 0, 0},
+    {"NV_REG_STR_RM_SDC_OLED_PANEL_BLEN_DISABLE_BY_AUX_TO_POWER_OFF_DELAY_TIME_MS", "RmPanelBlenDsByAuxToPwrOffMs", KeyType::Dword, false, 0x00000000, 572, 0, 0},
+    {"NV_REG_STR_RM_EDP_BLEN_BY_AUX_ENABLE", "RmEdpBlenByAuxEnable", KeyType::Dword, false, 0x00000000, 572, 2, 0},
+    {"NV_REG_STR_RM_DISABLE_HW_FAULT_BUFFER", "RmDisableHwFaultBuffer", KeyType::Dword, true, 0x00000000, 574, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_DISPMACRO", "RmDisableDispMacro", KeyType::Dword, true, 0x00000000, 574, 0, 0},
+    {"NV_REG_STR_RM_FEATURE_STRETCH_VBLANK", "Rm200692595", KeyType::Dword, true, 0x00000000, 574, 0, 0},
+    {"NV_REG_STR_RM_ENABLE_INFOROM", "RmEnableInforom", KeyType::Dword, false, 0x00000000, 574, 0, 0},
+    {"NV_REG_STR_RM_DISABLE_VBLANK_MSCG", "RmDisableVblankMscg", KeyType::Dword, true, 0x00000000, 574, 0, 0},
+    {"NV_REG_STR_RM_MSCG_LOW_FPS_WAR", "RmMscgLowFpsWarConfig", KeyType::Dword, false, 0x00000000, 574, 2, 0},
+    {"NV_REG_STR_RM_RISCV_CORE_DUMP_SIZE", "RmRiscvCoreSize", KeyType::Dword, true, 0x00002000, 576, 0, 0},
+    {"NV_REG_STR_RM_ENABLE_WDDM_INTERLEAVING_POLICY", "RmEnableWDDMInterleaving", KeyType::Dword, true, 0x00000000, 576, 0, 0},
+    {"NV_REG_STR_RM_ENABLE_WAR_2702359", "RmEnableWar2702359", KeyType::Dword, false, 0x00000000, 576, 0, 0},
+    {"NV_REG_STR_RM_WAR_2702359_PICK_UGPU", "RmWar2702359PickUgpu", KeyType::Dword, false, 0x00000000, 576, 0, 0},
+    {"NV_REG_STR_RM_FORCE_ENABLE_DISPLAY_MSCG", "RmForceEnableDisplayMscg", KeyType::Dword, false, 0x00000000, 576, 0, 0},
+    {"NV_REG_STR_RM_FORCE_ENABLE_DIFR", "RmForceEnableDIFR", KeyType::Dword, false, 0x00000000, 576, 0, 0},
+    {"NV_REG_STR_RM_ENABLE_EDID_READ_ON_EMU", "RmEnableEdidReadOnEmu", KeyType::Dword, false, 0x00000000, 576, 0, 0},
+    {"NV_REG_STR_RM_ROUTE_MODS_TO_VAB_V2", "RmEnableModsVABV2", KeyType::Dword, true, 0x00000000, 576, 0, 0},
+    {"NV_REG_STR_RM_SET_PCIE_TLP_RELAXED_ORDERING", "RmSetPCIERelaxedOrdering", KeyType::Dword, true, 0x00000000, 576, 0, 0},
+    {"NV_REG_STR_RM_VIDEO_EVENT_TRACE", "RmVideoEventTrace", KeyType::Dword, true, 0x00000000, 576, 2, 0},
+    {"NV_REG_STR_RM_BOOT_FROM_HS", "RmBootFromHs", KeyType::Unknown, false, 0x00000000, 578, 7, 0},
+    {"NV_REG_STR_RM_XV_TIMEOUT_OVERRIDE", "RmXvTimeoutOverride", KeyType::Unknown, true, 0x00000001, 585, 0, 0},
+    {"NV_REG_STR_RM_ENABLE_INTERMEDIATE_LINK_RATES", "RmEnableIntermediateLinkRates", KeyType::Dword, true, 0x00000000, 585, 0, 0},
+    {"NV_REG_STR_RM_TPCS_USEABLE_BY_GFX", "RmTpcsUseableByGfx", KeyType::Dword, false, 0x00000000, 585, 0, 0},
+    {"NV_REG_STR_RM_VOLT_DEV_POWER_UP_DELAY_US", "RmVoltPowerUpDelayUsOverride", KeyType::Dword, false, 0x00000000, 585, 3, 0},
+    {"NV_REG_STR_RM_VOLT_DEV_POWER_DOWN_DELAY_US", "RmVoltPowerDownDelayUsOverride", KeyType::Unknown, false, 0x00000000, 588, 3, 0},
+    {"NV_REG_STR_HDMI_FRL_TE_DEBOUNCE_TIME", "RMHdmiFrlTeDebounceTime", KeyType::Dword, false, 0x00000000, 591, 0, 0},
+    {"NV_REG_STR_RM_2779240", "RM2779240", KeyType::Unknown, false, 0x00000000, 591, 2, 0},
+    {"NV_REG_STR_RM_DISABLE_TITAN_CAPABILITY", "RmDisableTitanCapability", KeyType::Dword, true, 0x00000000, 593, 0, 0},
+    {"NV_REG_STR_RM_ENABLE_PLUGIN_IN_FTRACE_BUFFER", "RmEnablePluginFtrace", KeyType::Unknown, true, 0x00000000, 593, 0, 0},
+    {"NV_REG_STR_RM_64KB_BAR1_MAPPINGS", "RM64KBBAR1Mappings", KeyType::Unknown, false, 0x00000000, 593, 0, 0},
+    {"NV_REG_STR_RM_ENABLE_VGPU_SRIOV_SYSMEM_DIRTY_PAGE_TRACKING", "RmEnableVgpuSriovSysmemDirtyPageTracking", KeyType::Dword, true, 0x00000001, 593, 0, 0},
+    {"NV_REG_STR_RM_SMBPBI_EVENT_POSTING_OVERRIDE", "RmSmbpbiEventPostingOverride", KeyType::Unknown, false, 0x00000000, 593, 0, 0},
+    {"NV_REG_STR_RM_CONFIDENTIAL_COMPUTE", "RmConfidentialCompute", KeyType::Unknown, false, 0x00000000, 593, 3, 8},
+    {"NV_REG_STR_RM_CONF_COMPUTE_EARLY_INIT", "RmConfComputeEarlyInit", KeyType::Unknown, false, 0x00000000, 596, 0, 8},
+    {"NV_REG_STR_RM_CONF_COMPUTE_SPDM_POLICY", "RmConfComputeSpdmPolicy", KeyType::Unknown, false, 0x00000000, 596, 1, 8},
+    {"NV_REG_STR_RM_ENABLE_LOCAL_EGM_PEER_ID", "RMEnableLocalEgmPeerId", KeyType::Unknown, false, 0x00000000, 597, 0, 0},
+    {"NV_REG_STR_RM_ALLOW_SYSMEM_LARGE_PAGES", "RMAllowSysmemLargePages", KeyType::Unknown, false, 0x00000000, 597, 0, 0},
+    {"NV_REG_STR_RM_ENABLE_FLA_TRANSLATION_XID", "RmEnableFlaXid", KeyType::Unknown, true, 0x00000000, 597, 0, 0},
+    {"NV_REG_STR_RM_WAR_BUG_3275257_DISABLE", "DisableRmWar3275257", KeyType::Dword, true, 0x00000000, 597, 0, 0},
+    {"NV_REG_STR_RM_ENABLE_GA10X_ARCH_PERF_MODE", "RMEnableGA10XArchPerfMode", KeyType::Dword, true, 0x00000000, 597, 0, 0},
+    {"NV_REG_STR_RM_OVERRIDE_C2C_LINKS", "RmOverrideC2CLinks", KeyType::Dword, false, 0x00000000, 597, 0, 0},
+    {"NV_REG_STR_RM_ENABLE_HSHNVLMUX_SW_ALGORITHM", "RMEnableHshnvlmuxSwAlgorithm", KeyType::Unknown, true, 0x00000000, 597, 0, 0},
+    {"NV_REG_STR_RM_PROTECTED_MEMORY_SIZE_IN_MB", "RmProtectedMemorySizeInMB", KeyType::Unknown, false, 0x00000000, 597, 0, 0},
+    {"NV_REG_STR_BUG_3289265_WAR", "RMBug3289265War", KeyType::Dword, true, 0x00000000, 597, 0, 0},
+    {"NV_REG_STR_PWR_TRANSITION_THREAD_TIMEOUT_MS", "RMPwrTransThreadTimeoutMs", KeyType::Dword, false, 0x00000000, 597, 0, 0},
+    {"NV_REG_STR_RM_CPU_FIRMWARE_HANDLES_FBECC_INTR", "RmCpuFirmwareHandlesFbEccIntr", KeyType::Unknown, true, 0x00000000, 597, 0, 0},
+    {"NV_REG_STR_RM_FBHUB_RELAXED_ORDERING_MODE", "RmFbhubRelaxedOrderingOverride", KeyType::Dword, false, 0x00000000, 597, 5, 0},
+    {"NV_REG_STR_BUG_3007008_EMULATE_VF_MMU_TLB_INVALIDATE", "RMBug3007008EmulateVfMmuTlbInvalidate", KeyType::Dword, true, 0x00000001, 602, 0, 0},
+    {"NV_REG_STR_RM_ALLOC_CONTIGUOUS_RUNLISTS", "RMVerifAllocContiguousRunlists", KeyType::Dword, true, 0x00000000, 602, 0, 3},
+    {"NV_REG_STR_RM_NUMA_ALLOC_SKIP_RECLAIM_PERCENTAGE", "RmNumaAllocSkipReclaimPercent", KeyType::Dword, true, 0x00000004, 602, 0, 0},
+    {"NV_REG_STR_RM_SWAP_ACR_REGIONS", "RmSwapAcrRegions", KeyType::Dword, true, 0x00000000, 602, 0, 0},
+    {"NV_REG_STR_RM_ASSERT_ON_POSTED_REG_ACCESS_ERRORS", "RmAssertOnPostedRegAccessErrors", KeyType::Dword, false, 0x00000000, 602, 6, 0},
+    {"NV_REG_STR_RM_200753735", "Rm200753735", KeyType::Dword, true, 0x00000000, 608, 0, 0},
+    {"NV_REG_SUPPRESS_XID_DUMP", "RmSuppressXidDump", KeyType::Binary, false, 0x00000000, 608, 0, 0},
+};
+
+inline constexpr uint16_t kDisplace[309] = {
+    19, 3, 11, 9, 32, 5, 0, 2, 4, 66, 12, 0, 3, 7, 1, 1,
+    36, 0, 1, 6, 17, 12, 16, 5, 0, 5, 7, 1, 1, 0, 5, 1,
+    22, 9, 0, 8, 1, 3, 1, 5, 1, 1, 6, 1, 5, 4, 1, 1,
+    28, 1, 20, 8, 0, 0, 18, 1, 4, 20, 2, 3, 3, 1, 0, 9,
+    9, 1, 0, 1, 4, 12, 27, 2, 0, 13, 28, 2, 0, 16, 0, 5,
+    1, 5, 9, 3, 1, 69, 4, 7, 10, 1, 28, 10, 29, 2, 0, 10,
+    25, 0, 8, 53, 3, 5, 3, 5, 4, 3, 6, 4, 12, 2, 1, 0,
+    10, 12, 5, 23, 6, 13, 0, 18, 2, 10, 18, 4, 11, 50, 35, 17,
+    0, 1, 4, 5, 3, 14, 14, 1, 0, 0, 1, 44, 10, 3, 12, 0,
+    12, 1, 0, 38, 9, 13, 72, 23, 34, 9, 14, 18, 3, 28, 10, 24,
+    0, 3, 0, 7, 10, 3, 7, 0, 1, 0, 7, 16, 15, 3, 7, 17,
+    16, 1, 4, 15, 0, 1, 1, 53, 33, 19, 4, 11, 12, 86, 7, 4,
+    0, 1, 14, 14, 66, 25, 14, 13, 1, 2, 8, 15, 0, 1, 0, 0,
+    44, 16, 11, 2, 0, 26, 27, 4, 4, 45, 2, 18, 7, 27, 12, 32,
+    4, 0, 15, 22, 2, 7, 1, 39, 2, 46, 13, 8, 24, 0, 14, 3,
+    1, 0, 6, 11, 1, 13, 17, 2, 85, 3, 51, 21, 29, 4, 52, 7,
+    0, 8, 97, 19, 0, 10, 0, 8, 2, 0, 9, 11, 8, 26, 30, 10,
+    36, 5, 15, 50, 19, 45, 8, 62, 8, 125, 0, 2, 93, 29, 0, 29,
+    0, 5, 0, 7, 191, 22, 141, 100, 59, 1, 0, 104, 4, 90, 11, 121,
+    6, 145, 0, 46, 8,
+};
+
+inline constexpr uint16_t kSlots[1024] = {
+    724, 755, 26, 144, 708, 94, 852, 340, 820, 639, 65535, 473, 182, 655, 394, 443,
+    238, 592, 62, 703, 918, 872, 871, 223, 366, 718, 439, 101, 292, 107, 747, 808,
+    523, 416, 579, 792, 105, 65535, 449, 704, 387, 576, 398, 847, 556, 897, 310, 637,
+    863, 71, 397, 819, 330, 586, 65535, 463, 163, 65535, 78, 801, 65535, 65535, 877, 242,
+    666, 384, 372, 894, 44, 860, 65535, 432, 147, 323, 315, 190, 46, 129, 739, 696,
+    603, 31, 484, 382, 636, 823, 750, 906, 868, 917, 501, 861, 728, 65535, 402, 168,
+    596, 273, 0, 338, 65535, 910, 196, 217, 458, 149, 191, 876, 34, 467, 682, 886,
+    326, 304, 752, 425, 599, 710, 528, 334, 88, 786, 713, 224, 882, 252, 775, 549,
+    762, 879, 244, 450, 385, 732, 916, 65535, 345, 661, 65535, 500, 96, 672, 302, 529,
+    606, 265, 412, 583, 787, 890, 893, 594, 79, 857, 779, 225, 693, 278, 905, 616,
+    623, 707, 110, 414, 86, 65535, 65535, 864, 554, 220, 229, 65535, 510, 652, 774, 683,
+    867, 715, 520, 836, 621, 553, 923, 226, 29, 524, 437, 613, 337, 65535, 486, 634,
+    570, 373, 577, 768, 612, 177, 65535, 748, 65535, 742, 572, 803, 257, 65535, 417, 92,
+    65535, 578, 591, 547, 405, 186, 469, 660, 494, 139, 593, 185, 152, 142, 544, 65535,
+    65535, 153, 638, 471, 130, 359, 771, 772, 65535, 325, 317, 756, 172, 647, 21, 65535,
+    118, 271, 50, 65535, 608, 138, 678, 65535, 316, 499, 548, 830, 648, 259, 430, 174,
+    388, 436, 818, 814, 835, 327, 291, 65535, 4, 901, 83, 532, 169, 65535, 143, 702,
+    256, 873, 63, 619, 507, 862, 45, 700, 347, 65535, 65535, 250, 826, 533, 514, 815,
+    476, 241, 232, 601, 58, 679, 677, 451, 357, 43, 65535, 9, 782, 65535, 559, 68,
+    816, 434, 810, 239, 746, 505, 602, 717, 362, 246, 749, 899, 878, 77, 698, 65,
+    825, 356, 540, 788, 65535, 339, 120, 299, 573, 230, 24, 312, 646, 493, 870, 114,
+    465, 427, 65535, 456, 759, 67, 731, 40, 839, 423, 65535, 65535, 213, 856, 745, 535,
+    821, 737, 859, 811, 233, 54, 448, 888, 111, 671, 478, 674, 228, 588, 247, 444,
+    651, 798, 793, 506, 675, 328, 344, 176, 457, 55, 834, 65535, 119, 383, 720, 65535,
+    371, 65535, 263, 184, 100, 165, 764, 714, 65535, 261, 173, 258, 368, 676, 536, 605,
+    854, 858, 381, 743, 726, 321, 219, 919, 8, 722, 76, 301, 435, 881, 95, 459,
+    581, 569, 106, 197, 203, 380, 65535, 729, 358, 551, 280, 561, 584, 719, 611, 126,
+    150, 734, 761, 461, 560, 65535, 566, 93, 433, 515, 65535, 695, 926, 538, 365, 65535,
+    895, 526, 20, 644, 65535, 903, 690, 212, 89, 279, 489, 785, 541, 587, 531, 331,
+    921, 440, 681, 809, 760, 270, 351, 112, 65535, 51, 255, 537, 488, 288, 148, 215,
+    673, 618, 227, 424, 65535, 65535, 874, 885, 727, 685, 283, 175, 496, 65535, 617, 318,
+    65535, 307, 65535, 99, 64, 65535, 332, 806, 155, 306, 192, 407, 108, 69, 140, 626,
+    840, 222, 687, 900, 658, 922, 5, 65535, 654, 495, 849, 680, 286, 686, 97, 842,
+    604, 141, 670, 567, 711, 778, 65535, 87, 851, 503, 65535, 240, 23, 204, 65535, 395,
+    27, 841, 159, 361, 277, 625, 504, 313, 530, 25, 207, 65535, 610, 113, 664, 65535,
+    121, 789, 60, 920, 10, 65535, 2, 795, 585, 438, 794, 589, 846, 367, 260, 902,
+    91, 694, 109, 845, 565, 65535, 431, 645, 509, 776, 65535, 285, 598, 410, 122, 370,
+    913, 521, 915, 595, 597, 805, 354, 378, 262, 82, 341, 36, 607, 298, 127, 322,
+    914, 740, 490, 206, 564, 329, 630, 684, 346, 84, 65535, 485, 481, 466, 65535, 287,
+    61, 343, 245, 884, 183, 667, 421, 39, 103, 180, 665, 429, 568, 146, 81, 413,
+    305, 72, 817, 492, 300, 669, 236, 66, 352, 249, 662, 409, 804, 80, 557, 56,
+    539, 649, 418, 525, 264, 48, 7, 65535, 53, 460, 187, 582, 784, 235, 6, 17,
+    65535, 32, 275, 355, 777, 253, 243, 65535, 688, 468, 156, 399, 479, 12, 198, 767,
+    769, 758, 829, 800, 558, 124, 269, 550, 360, 641, 311, 516, 65535, 650, 281, 65535,
+    14, 390, 653, 234, 404, 324, 188, 158, 132, 200, 290, 790, 363, 780, 721, 657,
+    336, 831, 627, 736, 65535, 892, 763, 455, 705, 552, 251, 296, 209, 19, 513, 133,
+    709, 925, 267, 706, 195, 453, 757, 866, 474, 908, 896, 131, 28, 420, 848, 379,
+    22, 802, 74, 320, 216, 189, 289, 843, 199, 428, 741, 42, 37, 770, 376, 178,
+    248, 167, 511, 898, 889, 464, 624, 725, 3, 563, 65535, 65535, 406, 65535, 622, 828,
+    502, 41, 853, 294, 193, 231, 400, 411, 65535, 730, 543, 154, 303, 65535, 335, 85,
+    377, 272, 656, 65535, 375, 38, 374, 620, 65535, 470, 883, 701, 293, 102, 799, 145,
+    590, 65535, 855, 615, 519, 668, 282, 171, 837, 891, 205, 629, 628, 907, 65535, 16,
+    753, 30, 797, 545, 65535, 65535, 162, 518, 391, 392, 445, 348, 865, 491, 600, 512,
+    295, 353, 487, 827, 15, 70, 699, 571, 642, 18, 65535, 838, 480, 181, 65535, 441,
+    575, 210, 65535, 692, 517, 47, 659, 350, 65535, 452, 850, 59, 442, 415, 98, 783,
+    773, 161, 875, 11, 498, 697, 117, 744, 134, 386, 274, 632, 475, 522, 781, 65535,
+    483, 462, 844, 349, 157, 807, 284, 911, 482, 364, 738, 65535, 65535, 393, 208, 49,
+    733, 562, 927, 65535, 115, 422, 73, 237, 640, 401, 123, 832, 912, 633, 527, 319,
+    712, 164, 179, 136, 65535, 218, 254, 211, 631, 57, 869, 691, 116, 221, 35, 160,
+    751, 534, 791, 65535, 65535, 201, 924, 403, 887, 477, 408, 170, 833, 472, 497, 65535,
+    909, 276, 52, 574, 128, 396, 314, 135, 635, 151, 796, 447, 555, 508, 813, 904,
+    309, 765, 426, 754, 542, 266, 446, 308, 389, 297, 214, 735, 268, 90, 609, 812,
+    822, 643, 454, 65535, 333, 166, 202, 342, 137, 65535, 65535, 880, 614, 104, 194, 723,
+    33, 766, 546, 125, 369, 716, 65535, 75, 689, 419, 1, 580, 65535, 824, 13, 663,
+};
+
+inline constexpr PerfectHash kIndex{kDisplace, 309, kSlots, 1023};
+
+constexpr const Key* find(std::string_view name)
+{
+    return find_in(kKeys, kIndex, name);
+}
+
+constexpr FieldRange fields_of(const Key& key)
+{
+    return {kFields + key.field_begin, key.field_count};
+}
+
+constexpr const Condition& condition_of(const Key& key)
+{
+    return kConditions[key.condition];
+}
+
+constexpr Liveness live_in_release(const Key& key)
+{
+    return kConditions[key.condition].live(kRelease);
+}
+
+// False only for keys no retail driver reads, whatever its RMCFG features.
+constexpr bool is_live_in_release(const Key& key)
+{
+    return live_in_release(key) != Liveness::Never;
+}
+
+} // namespace rmreg
+
+#endif // NVTOOLS_RMREG_CATALOG_H
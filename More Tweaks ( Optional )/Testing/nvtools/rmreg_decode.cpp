@@ -0,0 +1,118 @@
+// rmreg_decode.cpp
+
+#include "rmreg_decode.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define RMREG_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(RMREG_X86) && (defined(__GNUC__) || defined(__clang__))
+#define RMREG_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define RMREG_TARGET_AVX2
+#endif
+
+namespace rmreg {
+
+namespace {
+
+// Fields are decoded in groups so the shift counts and masks of a group stay
+// in registers while a block of input streams through.
+constexpr size_t kGroup = 8;
+
+#if defined(RMREG_X86)
+RMREG_TARGET_AVX2
+void decode_avx2(const uint32_t* in, size_t n, const FieldDesc* fields,
+                 size_t field_count, uint32_t* const* out)
+{
+    const size_t vn = n & ~size_t(7);
+    for (size_t g = 0; g < field_count; g += kGroup) {
+        const size_t gn = field_count - g < kGroup ? field_count - g : kGroup;
+        __m128i shift[kGroup];
+        __m256i mask[kGroup];
+        for (size_t f = 0; f < gn; ++f) {
+            shift[f] = _mm_cvtsi32_si128(int(fields[g + f].lo));
+            mask[f] = _mm256_set1_epi32(int(fields[g + f].mask() >> fields[g + f].lo));
+        }
+        for (size_t i = 0; i < vn; i += 8) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+            for (size_t f = 0; f < gn; ++f) {
+                __m256i r = _mm256_and_si256(_mm256_srl_epi32(v, shift[f]), mask[f]);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out[g + f] + i), r);
+            }
+        }
+    }
+    if (vn < n) {
+        uint32_t* tail[256];
+        size_t fc = field_count < 256 ? field_count : 256;
+        for (size_t f = 0; f < fc; ++f)
+            tail[f] = out[f] + vn;
+        decode_columns_scalar(in + vn, n - vn, fields, fc, tail);
+    }
+}
+#endif
+
+} // namespace
+
+void decode_columns_scalar(const uint32_t* in, size_t n, const FieldDesc* fields,
+                           size_t field_count, uint32_t* const* out)
+{
+    // Walk the input in cache-sized blocks and run each field over the block;
+    // the inner loop is simple enough for the compiler to vectorize with
+    // whatever the target baseline allows.
+    constexpr size_t kBlock = 1024;
+    for (size_t b = 0; b < n; b += kBlock) {
+        const size_t bn = n - b < kBlock ? n - b : kBlock;
+        const uint32_t* src = in + b;
+        for (size_t f = 0; f < field_count; ++f) {
+            const unsigned shift = fields[f].lo;
+            const uint32_t mask = fields[f].mask() >> shift;
+            uint32_t* dst = out[f] + b;
+            for (size_t i = 0; i < bn; ++i)
+                dst[i] = (src[i] >> shift) & mask;
+        }
+    }
+}
+
+bool have_avx2()
+{
+#if defined(RMREG_X86) && defined(_MSC_VER)
+    static const bool avx2 = [] {
+        int r[4];
+        __cpuid(r, 0);
+        if (r[0] < 7)
+            return false;
+        __cpuid(r, 1);
+        // OSXSAVE and AVX, and the OS saves the YMM state.
+        if ((r[2] & (1 << 27)) == 0 || (r[2] & (1 << 28)) == 0
+            || (_xgetbv(0) & 6) != 6)
+            return false;
+        __cpuidex(r, 7, 0);
+        return (r[1] & (1 << 5)) != 0;
+    }();
+    return avx2;
+#elif defined(RMREG_X86)
+    static const bool avx2 = __builtin_cpu_supports("avx2");
+    return avx2;
+#else
+    return false;
+#endif
+}
+
+void decode_columns(const uint32_t* in, size_t n, const FieldDesc* fields,
+                    size_t field_count, uint32_t* const* out)
+{
+#if defined(RMREG_X86)
+    if (field_count <= 256 && have_avx2()) {
+        decode_avx2(in, n, fields, field_count, out);
+        return;
+    }
+#endif
+    decode_columns_scalar(in, n, fields, field_count, out);
+}
+
+} // namespace rmreg
@@ -0,0 +1,43 @@
+// rmreg_decode.h
+//
+// Batch decoder for columns of packed RM registry DWORDs, e.g. every
+// machine's RmOptp value from a fleet inventory. One pass over the input
+// writes one output column per DRF field:
+//
+//   const rmreg::Key* k = rmreg::find("RmOptp");
+//   std::vector<uint32_t> cols[5];  ...  uint32_t* out[5] = {...};
+//   rmreg::decode_columns(values.data(), values.size(), rmreg::fields_of(*k), out);
+//
+// Uses AVX2 when the CPU has it and falls back to scalar code otherwise.
+
+#ifndef NVTOOLS_RMREG_DECODE_H
+#define NVTOOLS_RMREG_DECODE_H
+
+#include "rmreg.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace rmreg {
+
+// out[f][i] = fields[f].get(in[i]) for every value and field. Each out[f]
+// must have room for n values.
+void decode_columns(const uint32_t* in, size_t n, const FieldDesc* fields,
+                    size_t field_count, uint32_t* const* out);
+
+inline void decode_columns(const uint32_t* in, size_t n, FieldRange fields,
+                           uint32_t* const* out)
+{
+    decode_columns(in, n, fields.begin(), fields.size(), out);
+}
+
+// The portable path, always available. decode_columns() picks between this
+// and the vector path; it is exposed for benchmarks and cross-checks.
+void decode_columns_scalar(const uint32_t* in, size_t n, const FieldDesc* fields,
+                           size_t field_count, uint32_t* const* out);
+
+bool have_avx2();
+
+} // namespace rmreg
+
+#endif // NVTOOLS_RMREG_DECODE_H
@@ -0,0 +1,207 @@
+// rmreg_diff.cpp
+
+#include "rmreg_diff.h"
+
+#include <cstdio>
+
+namespace rmreg {
+
+namespace {
+
+uint64_t hash_bytes(uint64_t h, std::string_view s)
+{
+    for (char c : s) {
+        h ^= uint8_t(c);
+        h *= 0x100000001b3ull;
+    }
+    // Keeps "ab" + "c" apart from "a" + "bc".
+    h ^= s.size();
+    h *= 0x100000001b3ull;
+    return h;
+}
+
+std::string hex(const std::optional<uint32_t>& v)
+{
+    if (!v)
+        return "none";
+    char buf[16];
+    std::snprintf(buf, sizeof buf, "0x%x", *v);
+    return buf;
+}
+
+std::string range(const FieldShape& f)
+{
+    return std::to_string(f.hi) + ":" + std::to_string(f.lo);
+}
+
+const char* type_text(KeyType t)
+{
+    switch (t) {
+    case KeyType::Dword:  return "DWORD";
+    case KeyType::Binary: return "BINARY";
+    case KeyType::String: return "STRING";
+    default:              return "unknown";
+    }
+}
+
+Liveness release_liveness(const Index& ix, uint16_t condition)
+{
+    const BuildCondition& c = ix.conditions[condition];
+    return Condition{c.expr, c.truth}.live(release_variant(ix));
+}
+
+KeySummary summarize(const Index& ix, const KeyBlock& key)
+{
+    KeySummary s;
+    std::string_view macro = ix.key_macro(key);
+    s.name = std::string(ix.key_name(key));
+    s.macro = std::string(macro);
+    s.type = declared_type(ix, key);
+    s.default_value = documented_default(ix, key);
+    s.condition = ix.key_condition(key).expr;
+    s.release = release_liveness(ix, ix.key_define(key).condition);
+
+    for (uint32_t c = 0; c < key.child_count; ++c) {
+        const Define& d = ix.defines[ix.children[key.child_begin + c]];
+        if (auto r = parse_range(d.value))
+            s.fields.push_back({std::string(d.name.substr(macro.size() + 1)), r->hi, r->lo, {}});
+    }
+    // <field>_DEFAULT, preferring the one a release driver sees.
+    for (FieldShape& f : s.fields) {
+        std::string name = s.macro + "_" + f.name + "_DEFAULT";
+        for (uint32_t c = 0; c < key.child_count; ++c) {
+            const Define& d = ix.defines[ix.children[key.child_begin + c]];
+            if (d.name != name)
+                continue;
+            bool live = release_liveness(ix, d.condition) != Liveness::Never;
+            if (!f.default_value || live)
+                f.default_value = evaluate(ix, d.value);
+            if (live)
+                break;
+        }
+    }
+    return s;
+}
+
+const FieldShape* find_field(const KeySummary& k, const std::string& name)
+{
+    for (const FieldShape& f : k.fields)
+        if (f.name == name)
+            return &f;
+    return nullptr;
+}
+
+void diff_key(const KeySummary& a, const KeySummary& b, std::vector<Change>& out)
+{
+    if (a.type != b.type)
+        out.push_back({ChangeKind::Type, b.name, {}, type_text(a.type), type_text(b.type)});
+    if (a.default_value != b.default_value)
+        out.push_back({ChangeKind::Default, b.name, {}, hex(a.default_value), hex(b.default_value)});
+
+    for (const FieldShape& f : a.fields)
+        if (!find_field(b, f.name))
+            out.push_back({ChangeKind::FieldRemoved, b.name, f.name, range(f), {}});
+    for (const FieldShape& f : b.fields) {
+        const FieldShape* old = find_field(a, f.name);
+        if (!old) {
+            out.push_back({ChangeKind::FieldAdded, b.name, f.name, {}, range(f)});
+            continue;
+        }
+        if (old->hi != f.hi || old->lo != f.lo)
+            out.push_back({ChangeKind::FieldWidth, b.name, f.name, range(*old), range(f)});
+        if (old->default_value != f.default_value)
+            out.push_back({ChangeKind::Default, b.name, f.name, hex(old->default_value),
+                           hex(f.default_value)});
+    }
+
+    if (a.condition != b.condition) {
+        bool hidden = a.release != Liveness::Never && b.release == Liveness::Never;
+        out.push_back({hidden ? ChangeKind::DebugOnly : ChangeKind::Condition, b.name, {},
+                       a.condition.empty() ? "always" : a.condition,
+                       b.condition.empty() ? "always" : b.condition});
+    }
+}
+
+} // namespace
+
+uint64_t block_hash(const Index& index, const KeyBlock& key)
+{
+    uint64_t h = 0xcbf29ce484222325ull;
+    for (uint32_t i = key.first_line; i < key.last_line; ++i)
+        h = hash_bytes(h, index.text(index.lines[i]));
+    h = hash_bytes(h, index.key_condition(key).expr);
+    for (uint32_t c = 0; c < key.child_count; ++c) {
+        const Define& d = index.defines[index.children[key.child_begin + c]];
+        h = hash_bytes(h, index.text(index.lines[d.line]));
+        h = hash_bytes(h, index.conditions[d.condition].expr);
+    }
+    return mix(h);
+}
+
+const KeySummary& SummaryCache::get(const Index& index, const KeyBlock& key, uint64_t hash)
+{
+    auto it = summaries_.find(hash);
+    if (it != summaries_.end()) {
+        ++hits_;
+        return it->second;
+    }
+    ++misses_;
+    return summaries_.emplace(hash, summarize(index, key)).first->second;
+}
+
+Snapshot snapshot(const Index& index, SummaryCache& cache)
+{
+    Snapshot s;
+    s.hashes.reserve(index.keys.size());
+    s.keys.reserve(index.keys.size());
+    for (const KeyBlock& k : index.keys) {
+        uint64_t h = block_hash(index, k);
+        const KeySummary& summary = cache.get(index, k, h);
+        // A name defined twice keeps its first block, like the registry
+        // lookups in the driver would.
+        if (!s.by_name.emplace(nvtools::folded(summary.name), uint32_t(s.keys.size())).second)
+            continue;
+        s.hashes.push_back(h);
+        s.keys.push_back(&summary);
+    }
+    return s;
+}
+
+std::vector<Change> diff(const Snapshot& before, const Snapshot& after)
+{
+    std::vector<Change> out;
+    for (const KeySummary* k : before.keys)
+        if (!after.by_name.count(nvtools::folded(k->name)))
+            out.push_back({ChangeKind::Removed, k->name, {}, k->macro, {}});
+    for (size_t i = 0; i < after.keys.size(); ++i) {
+        const KeySummary& k = *after.keys[i];
+        auto it = before.by_name.find(nvtools::folded(k.name));
+        if (it == before.by_name.end()) {
+            out.push_back({ChangeKind::Added, k.name, {}, {}, k.macro});
+            continue;
+        }
+        // Same block text, same summary: nothing to look at.
+        if (before.hashes[it->second] == after.hashes[i])
+            continue;
+        diff_key(*before.keys[it->second], k, out);
+    }
+    return out;
+}
+
+const char* change_name(ChangeKind kind)
+{
+    switch (kind) {
+    case ChangeKind::Added:        return "added";
+    case ChangeKind::Removed:      return "removed";
+    case ChangeKind::Type:         return "type";
+    case ChangeKind::Default:      return "default";
+    case ChangeKind::FieldAdded:   return "field added";
+    case ChangeKind::FieldRemoved: return "field removed";
+    case ChangeKind::FieldWidth:   return "field width";
+    case ChangeKind::DebugOnly:    return "debug only";
+    case ChangeKind::Condition:    return "condition";
+    }
+    return "?";
+}
+
+} // namespace rmreg
@@ -0,0 +1,104 @@
+// rmreg_diff.h
+//
+// Structural diff between two revisions of nvRmReg.h. Each key block (the
+// key, its doc comment and every child define such as
+// NV_REG_STR_RM_PERF_CF_OVERRIDE_LOAD, _TRRD_WAR and _RSVD) is hashed, and
+// only blocks whose hash is new get summarized. The SummaryCache is meant to
+// live across a whole series of archived headers:
+//
+//   rmreg::SummaryCache cache;
+//   rmreg::Snapshot a = rmreg::snapshot(old_index, cache);
+//   rmreg::Snapshot b = rmreg::snapshot(new_index, cache);
+//   for (const rmreg::Change& c : rmreg::diff(a, b)) ...
+//
+// Summaries own their text, so a Snapshot outlives the header it came from
+// as long as the cache does.
+
+#ifndef NVTOOLS_RMREG_DIFF_H
+#define NVTOOLS_RMREG_DIFF_H
+
+#include "rmreg_scan.h"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace rmreg {
+
+struct FieldShape {
+    std::string name;               // LOAD, the macro with the key's prefix removed
+    uint8_t hi;
+    uint8_t lo;
+    std::optional<uint32_t> default_value;     // from <field>_DEFAULT
+};
+
+// What the diff compares for one key.
+struct KeySummary {
+    std::string name;
+    std::string macro;
+    KeyType type;
+    std::optional<uint32_t> default_value;
+    std::vector<FieldShape> fields;
+    std::string condition;          // #if expression, empty when unconditional
+    Liveness release;
+};
+
+// Hash of everything a KeySummary is computed from: the block's lines, the
+// key's child defines wherever they sit, and their #if conditions. Defaults
+// that name a macro outside the block are not covered.
+uint64_t block_hash(const Index& index, const KeyBlock& key);
+
+class SummaryCache {
+public:
+    // The summary for a block, computed only if no earlier header had a block
+    // with the same hash. The reference stays valid for the cache's lifetime.
+    const KeySummary& get(const Index& index, const KeyBlock& key, uint64_t hash);
+
+    size_t hits() const { return hits_; }
+    size_t misses() const { return misses_; }
+
+private:
+    std::unordered_map<uint64_t, KeySummary> summaries_;
+    size_t hits_ = 0;
+    size_t misses_ = 0;
+};
+
+struct Snapshot {
+    std::vector<uint64_t> hashes;
+    std::vector<const KeySummary*> keys;
+    std::unordered_map<std::string, uint32_t> by_name;     // lower-cased name
+};
+
+Snapshot snapshot(const Index& index, SummaryCache& cache);
+
+enum class ChangeKind : uint8_t {
+    Added,
+    Removed,
+    Type,
+    Default,            // key default, or a field's _DEFAULT when field is set
+    FieldAdded,
+    FieldRemoved,
+    FieldWidth,         // same field name, different hi:lo
+    DebugOnly,          // was in release drivers, now only in debug/test ones
+    Condition,          // any other change of the #if around the key
+};
+
+struct Change {
+    ChangeKind kind;
+    std::string key;
+    std::string field;              // empty for key-level changes
+    std::string before;
+    std::string after;
+};
+
+// Changes in header order: removed keys in the old header's order, then the
+// rest in the new header's order.
+std::vector<Change> diff(const Snapshot& before, const Snapshot& after);
+
+const char* change_name(ChangeKind kind);
+
+} // namespace rmreg
+
+#endif // NVTOOLS_RMREG_DIFF_H
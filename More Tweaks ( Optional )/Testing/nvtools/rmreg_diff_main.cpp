@@ -0,0 +1,68 @@
+// rmreg_diff_main.cpp
+//
+// Structural diff of nvRmReg.h revisions. With more than two headers each one
+// is diffed against the one before it, sharing one summary cache, so a series
+// of archived drops costs little more than the blocks that actually changed:
+//
+//   rmreg_diff old/nvRmReg.h new/nvRmReg.h
+//   rmreg_diff r470/nvRmReg.h r510/nvRmReg.h r535/nvRmReg.h ...
+
+#include "mapped_file.h"
+#include "rmreg_diff.h"
+
+#include <cstdio>
+#include <string>
+
+namespace {
+
+void print(const rmreg::Change& c)
+{
+    std::string what = c.key + (c.field.empty() ? "" : "." + c.field);
+    switch (c.kind) {
+    case rmreg::ChangeKind::Added:
+    case rmreg::ChangeKind::FieldAdded:
+        std::printf("%-14s %-48s %s\n", rmreg::change_name(c.kind), what.c_str(), c.after.c_str());
+        break;
+    case rmreg::ChangeKind::Removed:
+    case rmreg::ChangeKind::FieldRemoved:
+        std::printf("%-14s %-48s %s\n", rmreg::change_name(c.kind), what.c_str(), c.before.c_str());
+        break;
+    default:
+        std::printf("%-14s %-48s %s -> %s\n", rmreg::change_name(c.kind), what.c_str(),
+                    c.before.c_str(), c.after.c_str());
+        break;
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 3) {
+        std::fprintf(stderr, "usage: rmreg_diff <old header> <new header> [newer headers...]\n");
+        return 2;
+    }
+    rmreg::SummaryCache cache;
+    rmreg::Snapshot prev;
+    size_t blocks = 0;
+    for (int i = 1; i < argc; ++i) {
+        nvtools::MappedFile f;
+        if (!f.open(argv[i])) {
+            std::fprintf(stderr, "error: cannot read %s\n", argv[i]);
+            return 1;
+        }
+        rmreg::Index ix = rmreg::index_header(f.view());
+        rmreg::Snapshot cur = rmreg::snapshot(ix, cache);
+        blocks += ix.keys.size();
+        if (i > 1) {
+            if (argc > 3)
+                std::printf("%s%s -> %s\n", i > 2 ? "\n" : "", argv[i - 1], argv[i]);
+            for (const rmreg::Change& c : rmreg::diff(prev, cur))
+                print(c);
+        }
+        prev = std::move(cur);
+    }
+    std::fprintf(stderr, "%zu key blocks, %zu summarized, %zu reused\n",
+                 blocks, cache.misses(), cache.hits());
+    return 0;
+}
@@ -0,0 +1,93 @@
+// rmreg_field.h
+//
+// Typed accessors for the DRF "hi:lo" field macros in nvRmReg.h.
+//
+//   using F = rmreg::Field<15, 8>;     // NV_REG_STR_RM_OPTP_DELAY_4MS
+//   F::get(word)                       // extract
+//   F::set(word, 50)                   // replace
+//   F::encode<50>()                    // 50 << 8, range-checked at compile time
+//
+// Layout<Fields...> collects the fields of one DWORD and refuses to compile
+// if any two of them share a bit. rmreg_fields.h, generated by rmreg_gen,
+// declares a Field and a Layout for every packed key in the header.
+
+#ifndef NVTOOLS_RMREG_FIELD_H
+#define NVTOOLS_RMREG_FIELD_H
+
+#include <cstdint>
+
+namespace rmreg {
+
+namespace detail {
+// Deliberately not constexpr: reaching it during constant evaluation turns an
+// out-of-range value into a compile error. At run time it does nothing and
+// the value is masked to the field width.
+inline void value_out_of_range() {}
+} // namespace detail
+
+template <unsigned Hi, unsigned Lo>
+struct Field {
+    static_assert(Lo <= Hi && Hi < 32, "DRF range must be hi:lo within a DWORD");
+
+    static constexpr unsigned hi = Hi;
+    static constexpr unsigned lo = Lo;
+    static constexpr unsigned width = Hi - Lo + 1;
+    static constexpr uint32_t max = width == 32 ? 0xffffffffu : (1u << width) - 1;
+    static constexpr uint32_t mask = max << Lo;
+
+    static constexpr bool fits(uint32_t v) { return v <= max; }
+
+    static constexpr uint32_t check(uint32_t v)
+    {
+        if (!fits(v))
+            detail::value_out_of_range();
+        return v & max;
+    }
+
+    static constexpr uint32_t get(uint32_t word) { return (word >> Lo) & max; }
+
+    static constexpr uint32_t set(uint32_t word, uint32_t v)
+    {
+        return (word & ~mask) | (check(v) << Lo);
+    }
+
+    static constexpr uint32_t encode(uint32_t v) { return check(v) << Lo; }
+
+    template <uint32_t V>
+    static constexpr uint32_t encode()
+    {
+        static_assert(V <= max, "value does not fit in the field");
+        return V << Lo;
+    }
+};
+
+template <class... Fields>
+struct Layout {
+private:
+    static constexpr bool disjoint()
+    {
+        uint32_t seen = 0;
+        bool ok = true;
+        ((ok = ok && (seen & Fields::mask) == 0, seen |= Fields::mask), ...);
+        return ok;
+    }
+
+public:
+    static_assert(disjoint(), "fields of a layout must not overlap");
+
+    static constexpr uint32_t mask = (0u | ... | Fields::mask);
+
+    // Bits set in word that no field of the layout covers.
+    static constexpr uint32_t unused_bits(uint32_t word) { return word & ~mask; }
+
+    // ORs pre-shifted field values together, e.g. from Field::encode<V>().
+    template <class... Encoded>
+    static constexpr uint32_t encode(Encoded... parts)
+    {
+        return (0u | ... | uint32_t(parts));
+    }
+};
+
+} // namespace rmreg
+
+#endif // NVTOOLS_RMREG_FIELD_H
@@ -0,0 +1,3892 @@
+// rmreg_fields.h
+//
+// Generated by rmreg_gen from nvRmReg.h - do not edit.
+//
+// rmreg::drf has one Field per "hi:lo" macro, named like the macro.
+// rmreg::fields has one struct per packed key, named like the registry
+// value, holding its fields, their named values and a Layout.
+
+#ifndef NVTOOLS_RMREG_FIELDS_H
+#define NVTOOLS_RMREG_FIELDS_H
+
+#include "rmreg_field.h"
+
+#include <string_view>
+
+namespace rmreg {
+
+namespace drf {
+using NV_REG_STR_RM_PMU_PERFMON_SAMPLING_ENABLE = Field<1, 0>;
+using NV_REG_STR_RM_PMU_PERFMON_SAMPLING_VBLANK_COUNT = Field<15, 8>;
+using NV_REG_STR_RM_PMU_PERFMON_SAMPLING_TODECREASE_COUNT = Field<23, 16>;
+using NV_REG_STR_RM_PMU_PERFMON_SAMPLING_INERTIA_COUNT = Field<31, 24>;
+using NV_REG_STR_RM_OPTP_ENABLE = Field<0, 0>;
+using NV_REG_STR_RM_OPTP_LOWER_MCLK = Field<1, 1>;
+using NV_REG_STR_RM_OPTP_DELAY_4MS = Field<15, 8>;
+using NV_REG_STR_RM_OPTP_TARGET_PERCENT_HIGH = Field<23, 16>;
+using NV_REG_STR_RM_OPTP_TARGET_PERCENT_LOW = Field<31, 24>;
+using NV_REG_STR_RM_OPTP2_LOWER_MCLK_DENOM = Field<7, 0>;
+using NV_REG_STR_RM_OPTP2_LOWER_MCLK_NUM = Field<15, 8>;
+using NV_REG_STR_RM_OPTP2_LOWER_MCLK_AC = Field<16, 16>;
+using NV_REG_STR_RM_PSTATE20_DECOUPLED_DOMAINS = Field<1, 1>;
+using NV_REG_STR_PSTATE_TIME_INTERVAL_MS = Field<15, 0>;
+using NV_REG_STR_PSTATE_TIME_LOWERING = Field<23, 16>;
+using NV_REG_STR_PSTATE_TIME_BOOST = Field<31, 24>;
+using NV_REG_STR_CL_ASLM_CFG_NV_LINK_UPGRADE = Field<1, 0>;
+using NV_REG_STR_CL_ASLM_CFG_HOT_RESET = Field<5, 4>;
+using NV_REG_STR_CL_ASLM_CFG_FAST_UPGRADE = Field<9, 8>;
+using NV_REG_STR_CL_ASLM_CFG_GEN2_LINK_UPGRADE = Field<11, 10>;
+using NV_REG_STR_CL_FORCE_P2P_READ = Field<1, 0>;
+using NV_REG_STR_CL_FORCE_P2P_WRITE = Field<5, 4>;
+using NV_REG_STR_OVERRIDE_IDLE_SLOWDOWN_GPC_FACTOR = Field<5, 0>;
+using NV_REG_STR_OVERRIDE_IDLE_SLOWDOWN_GPC_ACTIVE = Field<7, 7>;
+using NV_REG_STR_OVERRIDE_IDLE_SLOWDOWN_SYS_FACTOR = Field<13, 8>;
+using NV_REG_STR_OVERRIDE_IDLE_SLOWDOWN_SYS_ACTIVE = Field<15, 15>;
+using NV_REG_STR_OVERRIDE_IDLE_SLOWDOWN_DEPRECATED = Field<31, 16>;
+using NV_REG_STR_RM_PMGR_PWR_POLICY_OVERRIDE_DISABLE = Field<0, 0>;
+using NV_REG_STR_RM_PMGR_PWR_POLICY_OVERRIDE_LIMITS = Field<1, 1>;
+using NV_REG_STR_RM_PMGR_PWR_POLICY_OVERRIDE_RATED_LIMIT = Field<2, 2>;
+using NV_REG_STR_RM_PMGR_PWR_POLICY_OVERRIDE_INTEGRAL_CONTROL = Field<3, 3>;
+using NV_REG_STR_RM_PMGR_PWR_POLICY_OVERRIDE_MIN_CLIENT_SAMPLE_PERIOD = Field<19, 4>;
+using NV_REG_STR_RM_PMGR_PWR_DEVICE_BA00_OVERRIDE_HIGH_POWER_FIT_ONLY = Field<0, 0>;
+using NV_REG_STR_RM_PMGR_PMU_OVERRIDE_DISABLE = Field<0, 0>;
+using NV_REG_STR_RM_PMGR_ISENSE_VCM_OFFSET_OVERRIDE_VALUE = Field<6, 0>;
+using NV_REG_STR_RM_PMGR_ISENSE_VCM_OFFSET_OVERRIDE_RSVD = Field<31, 8>;
+using NV_REG_STR_RM_PMGR_ISENSE_DIFF_GAIN_OVERRIDE_VALUE = Field<4, 0>;
+using NV_REG_STR_RM_PMGR_ISENSE_DIFF_GAIN_OVERRIDE_RSVD = Field<31, 5>;
+using NV_REG_STR_RM_PMGR_ISENSE_DIFF_OFFSET_OVERRIDE_VALUE = Field<8, 0>;
+using NV_REG_STR_RM_PMGR_ISENSE_DIFF_OFFSET_OVERRIDE_RSVD = Field<31, 9>;
+using NV_REG_STR_RM_PMGR_ISENSE_VCM_COARSE_OFFSET_OVERRIDE_VALUE = Field<3, 0>;
+using NV_REG_STR_RM_PMGR_ISENSE_VCM_COARSE_OFFSET_OVERRIDE_RSVD = Field<31, 4>;
+using NV_REG_STR_RM_PMGR_ISENSE_DIFFERENTIAL_COARSE_GAIN_OVERRIDE_VALUE = Field<1, 0>;
+using NV_REG_STR_RM_PMGR_ISENSE_DIFFERENTIAL_COARSE_GAIN_OVERRIDE_RSVD = Field<31, 3>;
+using NV_REG_STR_RM_PERF_OVERRIDE_SKIP_RESTORE_BOOT_STATE_ON_UNLOAD = Field<0, 0>;
+using NV_REG_STR_RM_PERF_OVERRIDE_RSVD = Field<31, 1>;
+using NV_REG_STR_RM_PERF_CF_OVERRIDE_LOAD = Field<0, 0>;
+using NV_REG_STR_RM_PERF_CF_OVERRIDE_TRRD_WAR = Field<2, 1>;
+using NV_REG_STR_RM_PERF_CF_OVERRIDE_RSVD = Field<31, 3>;
+using NV_REG_STR_RM_PERF_CF_POLICY_OVERRIDES_DLPPC_1X = Field<0, 0>;
+using NV_REG_STR_RM_PERF_CF_POLICY_OVERRIDES_GSP_UTIL = Field<2, 1>;
+using NV_REG_STR_RM_CLK_CONTROLLERS_OVERRIDE_CLFC = Field<0, 0>;
+using NV_REG_STR_RM_CLK_CONTROLLERS_OVERRIDE_CLVC = Field<1, 1>;
+using NV_REG_STR_RM_CLK_CONTROLLERS_OVERRIDE_RSVD = Field<31, 2>;
+using NV_REG_STR_RM_PERF_CHANGE_SEQ_OVERRIDE_LOCK = Field<0, 0>;
+using NV_REG_STR_RM_PERF_CHANGE_SEQ_OVERRIDE_SKIP_VOLT_RANGE_TRIM = Field<1, 1>;
+using NV_REG_STR_RM_PERF_CHANGE_SEQ_OVERRIDE_RSVD = Field<31, 2>;
+using NV_REG_STR_RM_PERF_LIMITS_OVERRIDE_LOCK = Field<1, 0>;
+using NV_REG_STR_RM_PERF_LIMITS_OVERRIDE_CACHING_ENABLE = Field<3, 2>;
+using NV_REG_STR_RM_PERF_LIMITS_OVERRIDE_ARBITRATE_AND_APPLY_WORKITEM = Field<5, 4>;
+using NV_REG_STR_RM_PERF_LIMITS_OVERRIDE_RSVD = Field<31, 6>;
+using NV_REG_STR_CLK_SWITCH_WITHIN_MARGIN_MCLK = Field<4, 4>;
+using NV_REG_STR_BRIGHTNESS_CONTROL_FLAGS_UNUSED = Field<7, 0>;
+using NV_REG_STR_BRIGHTNESS_CONTROL_FLAGS_VBIOSRW = Field<9, 8>;
+using NV_REG_STR_BRIGHTNESS_CONTROL_FLAGS_DXGKIFACE = Field<11, 10>;
+using NV_REG_STR_BRIGHTNESS_CONTROL_FLAGS_LEVELS = Field<13, 12>;
+using NV_REG_STR_BRIGHTNESS_CONTROL_FLAGS_PBI = Field<15, 14>;
+using NV_REG_STR_BRIGHTNESS_CONTROL_FLAGS_FORCE = Field<17, 16>;
+using NV_REG_STR_RM_HEAD_DCLK_MODE_BASE = Field<0, 0>;
+using NV_REG_STR_RM_HEAD_DCLK_MODE_OVLY = Field<1, 1>;
+using NV_REG_STR_RM_HEAD_DCLK_MODE_CURS = Field<2, 2>;
+using NV_REG_STR_RM_HEAD_DCLK_MODE_PIPE = Field<3, 3>;
+using NV_REG_STR_RM_HEAD_DCLK_MODE_RG = Field<4, 4>;
+using NV_REG_STR_RM_EXTPERFCONTROL_LEVEL = Field<5, 0>;
+using NV_REG_STR_RM_EXTPERFCONTROL_CAP = Field<7, 6>;
+using NV_REG_STR_RM_EXTPERFCONTROL_POWER = Field<15, 8>;
+using NV_REG_STR_RM_EXTPERFCONTROL_DEBOUNCE_PERIOD_MS = Field<23, 16>;
+using NV_REG_STR_RM_EXTPERFCONTROL_SLI_LEVEL = Field<31, 24>;
+using NV_REG_STR_RM_BAR2_SYSMEM_ENABLE = Field<1, 0>;
+using NV_REG_STR_RM_INST_LOC_PTE = Field<1, 0>;
+using NV_REG_STR_RM_INST_LOC_BAR_PTE = Field<3, 2>;
+using NV_REG_STR_RM_INST_LOC_INSTBLK = Field<5, 4>;
+using NV_REG_STR_RM_INST_LOC_RAMFC = Field<7, 6>;
+using NV_REG_STR_RM_INST_LOC_CACHE1 = Field<9, 8>;
+using NV_REG_STR_RM_INST_LOC_GRCTX = Field<11, 10>;
+using NV_REG_STR_RM_INST_LOC_RUNLIST = Field<13, 12>;
+using NV_REG_STR_RM_INST_LOC_DISPLAY = Field<15, 14>;
+using NV_REG_STR_RM_INST_LOC_USERD = Field<17, 16>;
+using NV_REG_STR_RM_INST_LOC_EVENTBUFFER = Field<19, 18>;
+using NV_REG_STR_RM_INST_LOC_UNUSED = Field<21, 20>;
+using NV_REG_STR_RM_INST_LOC_CIPHER_XCHG = Field<23, 22>;
+using NV_REG_STR_RM_INST_LOC_PDE = Field<25, 24>;
+using NV_REG_STR_RM_INST_LOC_BAR_PDE = Field<27, 26>;
+using NV_REG_STR_RM_INST_LOC_PMUINST = Field<29, 28>;
+using NV_REG_STR_RM_INST_LOC_PMUUCODE = Field<31, 30>;
+using NV_REG_STR_RM_INST_LOC_2_COMPTAG_STORE = Field<1, 0>;
+using NV_REG_STR_RM_INST_LOC_2_ATTR_CB = Field<3, 2>;
+using NV_REG_STR_RM_INST_LOC_2_BUNDLE_CB = Field<5, 4>;
+using NV_REG_STR_RM_INST_LOC_2_PAGEPOOL = Field<7, 6>;
+using NV_REG_STR_RM_INST_LOC_2_GOLD_CTX = Field<9, 8>;
+using NV_REG_STR_RM_INST_LOC_2_BAR_CTX = Field<11, 10>;
+using NV_REG_STR_RM_INST_LOC_2_PMU_PWR_RAIL_VIDEO_PRED_BUFFER_SURFACE = Field<13, 12>;
+using NV_REG_STR_RM_INST_LOC_2_CTX_PATCH = Field<15, 14>;
+using NV_REG_STR_RM_INST_LOC_2_MMU_READ = Field<17, 16>;
+using NV_REG_STR_RM_INST_LOC_2_MMU_WRITE = Field<19, 18>;
+using NV_REG_STR_RM_INST_LOC_2_UNUSED = Field<21, 20>;
+using NV_REG_STR_RM_INST_LOC_2_ZCULLCTX = Field<23, 22>;
+using NV_REG_STR_RM_INST_LOC_2_PMCTX = Field<25, 24>;
+using NV_REG_STR_RM_INST_LOC_2_DPUDBG = Field<27, 26>;
+using NV_REG_STR_RM_INST_LOC_2_PMUPG = Field<29, 28>;
+using NV_REG_STR_RM_INST_LOC_2_PMU_LOGGER = Field<31, 30>;
+using NV_REG_STR_RM_INST_LOC_3_PG_LOG_SURFACE = Field<1, 0>;
+using NV_REG_STR_RM_INST_LOC_3_PREEMPT_BUFFER = Field<3, 2>;
+using NV_REG_STR_RM_INST_LOC_3_GFXP_BETACB_BUFFER = Field<5, 4>;
+using NV_REG_STR_RM_INST_LOC_3_GFXP_PAGEPOOL_BUFFER = Field<7, 6>;
+using NV_REG_STR_RM_INST_LOC_3_BSI_IMAGE = Field<9, 8>;
+using NV_REG_STR_RM_INST_LOC_3_PRIV_ACCESS_MAP = Field<11, 10>;
+using NV_REG_STR_RM_INST_LOC_3_SEC2DBG = Field<13, 12>;
+using NV_REG_STR_RM_INST_LOC_3_FECS_UCODE = Field<15, 14>;
+using NV_REG_STR_RM_INST_LOC_3_GFXP_SPILL_BUFFER = Field<17, 16>;
+using NV_REG_STR_RM_INST_LOC_3_UVM_FAULT_BUFFER_NONREPLAYABLE = Field<19, 18>;
+using NV_REG_STR_RM_INST_LOC_3_BAR_SCRATCH_PAGE = Field<21, 20>;
+using NV_REG_STR_RM_INST_LOC_3_FLCNINST = Field<23, 22>;
+using NV_REG_STR_RM_INST_LOC_3_RTVCB_BUFFER = Field<25, 24>;
+using NV_REG_STR_RM_INST_LOC_3_GFXP_RTVCB_BUFFER = Field<27, 26>;
+using NV_REG_STR_RM_INST_LOC_3_FAULT_METHOD_BUFFER = Field<29, 28>;
+using NV_REG_STR_RM_INST_LOC_3_PMU_DPU_DMA = Field<31, 30>;
+using NV_REG_STR_RM_INST_LOC_4_DISP_SC = Field<1, 0>;
+using NV_REG_STR_RM_INST_LOC_4_CHANNEL_PUSHBUFFER = Field<3, 2>;
+using NV_REG_STR_RM_INST_LOC_4_FW_SEC_LIC_COMMAND = Field<5, 4>;
+using NV_REG_STR_RM_INST_LOC_4_VRDS = Field<7, 6>;
+using NV_REG_STR_RM_INST_LOC_4_FLCN_UCODE_BUFFERS = Field<9, 8>;
+using NV_REG_STR_RM_INST_LOC_4_UVM_FAULT_BUFFER_REPLAYABLE = Field<11, 10>;
+using NV_REG_STR_RM_INST_LOC_4_BAR = Field<13, 12>;
+using NV_REG_STR_RM_INST_LOC_4_CE = Field<15, 14>;
+using NV_REG_STR_RM_INST_LOC_4_GR = Field<17, 16>;
+using NV_REG_STR_RM_INST_LOC_4_FALCON = Field<19, 18>;
+using NV_REG_STR_RM_INST_LOC_4_HWPM_PMA = Field<21, 20>;
+using NV_REG_STR_RM_INST_LOC_4_FECS_EVENT_BUF = Field<23, 22>;
+using NV_REG_STR_RM_INST_VPR_INSTBLK = Field<0, 0>;
+using NV_REG_STR_RM_INST_VPR_RAMFC = Field<1, 1>;
+using NV_REG_STR_RM_INST_VPR_RUNLIST = Field<2, 2>;
+using NV_REG_STR_RM_INST_VPR_MMU_READ = Field<3, 3>;
+using NV_REG_STR_RM_INST_VPR_MMU_WRITE = Field<4, 4>;
+using NV_REG_STR_RM_BANDWIDTH_FEATURES_DEPRECATED_0 = Field<1, 0>;
+using NV_REG_STR_RM_BANDWIDTH_FEATURES_ISO_CRIT_ALWAYS = Field<3, 2>;
+using NV_REG_STR_RM_BANDWIDTH_FEATURES_SCALER_AMORTIZATION = Field<5, 4>;
+using NV_REG_STR_RM_BANDWIDTH_FEATURES_DEPRECATED_2 = Field<7, 6>;
+using NV_REG_STR_RM_BANDWIDTH_FEATURES_DEPRECATED_3 = Field<9, 8>;
+using NV_REG_STR_RM_BANDWIDTH_FEATURES_ASR = Field<11, 10>;
+using NV_REG_STR_RM_BANDWIDTH_FEATURES_DEPRECATED_4 = Field<13, 12>;
+using NV_REG_STR_RM_BANDWIDTH_FEATURES_DYNAMIC_MEMPOOL = Field<15, 14>;
+using NV_REG_STR_RM_BANDWIDTH_FEATURES_DEPRECATED_5 = Field<17, 16>;
+using NV_REG_STR_RM_BANDWIDTH_FEATURES_IMP = Field<19, 18>;
+using NV_REG_STR_RM_BANDWIDTH_FEATURES_RESERVED = Field<21, 20>;
+using NV_REG_STR_RM_BANDWIDTH_FEATURES_DEPRECATED_6 = Field<23, 22>;
+using NV_REG_STR_RM_BANDWIDTH_FEATURES_DYNAMIC_DISP_CLK = Field<25, 24>;
+using NV_REG_STR_RM_BANDWIDTH_FEATURES_DEPRECATED_7 = Field<27, 26>;
+using NV_REG_STR_RM_BANDWIDTH_FEATURES_LINE_BUFFERING = Field<29, 28>;
+using NV_REG_STR_RM_BANDWIDTH_FEATURES_FORCE_MIN_MEMPOOL = Field<31, 30>;
+using NV_REG_STR_RM_BANDWIDTH_FEATURES_2_MEMPOOL_COMPRESSION = Field<1, 0>;
+using NV_REG_STR_RM_BANDWIDTH_FEATURES_2_ADVANCED_FETCH_METERING = Field<3, 2>;
+using NV_REG_STR_RM_POWER_FEATURES_SOFTWARE_SLOWDOWN = Field<1, 0>;
+using NV_REG_STR_RM_POWER_FEATURES_PEAK_POWER_SLOWDOWN = Field<3, 2>;
+using NV_REG_STR_RM_POWER_FEATURES_ELCG = Field<5, 4>;
+using NV_REG_STR_RM_POWER_FEATURES_ELPG = Field<7, 6>;
+using NV_REG_STR_RM_POWER_FEATURES_PCIE_DEEP_L1 = Field<9, 8>;
+using NV_REG_STR_RM_POWER_FEATURES_PCIE_CLKREQ = Field<11, 10>;
+using NV_REG_STR_RM_POWER_FEATURES_DEEP_IDLE = Field<13, 12>;
+using NV_REG_STR_RM_POWER_FEATURES_FB_ACPD = Field<15, 14>;
+using NV_REG_STR_RM_POWER_FEATURES_DUAL_PIXEL = Field<17, 16>;
+using NV_REG_STR_RM_POWER_FEATURES_BLCG2 = Field<21, 18>;
+using NV_REG_STR_RM_POWER_FEATURES_ADAPTIVE_POWER = Field<23, 22>;
+using NV_REG_STR_RM_POWER_FEATURES__DEPRECATED = Field<25, 24>;
+using NV_REG_STR_RM_POWER_FEATURES_PWR_RAIL_GATE = Field<27, 26>;
+using NV_REG_STR_RM_POWER_FEATURES_PWR_RAIL_GATE_PREDICTIVE = Field<29, 28>;
+using NV_REG_STR_RM_POWER_FEATURES_FSPG = Field<31, 30>;
+using NV_REG_STR_RM_POWER_FEATURES2_FLCG = Field<1, 0>;
+using NV_REG_STR_RM_POWER_FEATURES2_MSCG_SETTINGS_OWNER = Field<3, 2>;
+using NV_REG_STR_RM_POWER_FEATURES2_OPERATION_MODE = Field<5, 4>;
+using NV_REG_STR_RM_POWER_FEATURES2_SLCG = Field<7, 6>;
+using NV_REG_STR_RM_POWER_FEATURES2_CLK_NDIV_SLIDING = Field<9, 8>;
+using NV_REG_STR_RM_POWER_FEATURES2_NVVDD_PSI = Field<11, 10>;
+using NV_REG_STR_RM_POWER_FEATURES2_GC6_ROMLESS = Field<13, 12>;
+using NV_REG_STR_RM_POWER_FEATURES2_GC6_ROM = Field<15, 14>;
+using NV_REG_STR_RM_POWER_FEATURES2_DIDLE_SSC = Field<17, 16>;
+using NV_REG_STR_RM_POWER_FEATURES2_DIDLE_OS = Field<19, 18>;
+using NV_REG_STR_RM_POWER_FEATURES2_PCIE_L1_SUBSTATES = Field<21, 20>;
+using NV_REG_STR_RM_POWER_FEATURES2_LPWR_ONESHOT = Field<23, 22>;
+using NV_REG_STR_RM_POWER_FEATURES2_RPPG = Field<25, 24>;
+using NV_REG_STR_RM_POWER_FEATURES2_IST_CG = Field<27, 26>;
+using NV_REG_STR_RM_LPWR_ARCH_LPWR_ENG = Field<1, 0>;
+using NV_REG_STR_RM_LPWR_ARCH_IDLE_SNAP_DBG = Field<3, 2>;
+using NV_REG_STR_RM_LPWR_ARCH_PPU_THRESHOLD = Field<5, 4>;
+using NV_REG_STR_RM_LPWR_ARCH_LPWR_CTRL_HW_DISABLE = Field<7, 6>;
+using NV_REG_STR_RM_LPWR_ARCH_API_OPTIMIZATION = Field<9, 8>;
+using NV_REG_STR_RM_LPWR_ARCH_EXT_API_OPTIMIZATION = Field<11, 10>;
+using NV_REG_STR_RM_LPWR_ARCH_EI_COUPLED_GR_RG = Field<13, 12>;
+using NV_REG_STR_RM_LPWR_ARCH_REG_FILTER_PSTATE_CONTROL = Field<15, 14>;
+using NV_REG_STR_RM_LPWR_ARCH_GR_COUPLED_DFPR = Field<17, 16>;
+using NV_REG_STR_RM_LPWR_ARCH_DFPR_COUPLED_DIFR_SW_ASR = Field<19, 18>;
+using NV_REG_STR_RM_LPWR_EI_CLIENT_RM = Field<1, 0>;
+using NV_REG_STR_RM_LPWR_EI_CLIENT_PMU_LPWR = Field<3, 2>;
+using NV_REG_STR_RM_JT_POWER_CONTROL_PRGX = Field<9, 8>;
+using NV_REG_STR_RM_JT_POWER_CONTROL_PRGE = Field<11, 10>;
+using NV_REG_STR_RM_JT_VERIF_CAPS_JT_ENABLED = Field<0, 0>;
+using NV_REG_STR_RM_JT_VERIF_CAPS_NVSR_ENABLED = Field<2, 1>;
+using NV_REG_STR_RM_JT_VERIF_CAPS_REVISION_ID = Field<31, 20>;
+using NV_REG_STR_RM_COPROC_REFCOUNT_STYLE = Field<0, 0>;
+using NV_REG_STR_RM_GC6_STATS_ENABLED = Field<0, 0>;
+using NV_REG_STR_RM_GC6_FEATURE_FAKE_I2CS = Field<1, 0>;
+using NV_REG_STR_RM_GC6_FEATURE_PMU_CFG_SPACE_RESTORE = Field<3, 2>;
+using NV_REG_STR_RM_GC6_FEATURE_EXIT_BOOT_VOLTAGE = Field<5, 4>;
+using NV_REG_STR_RM_GC6_FEATURE_D3HOT_WAR = Field<7, 6>;
+using NV_REG_STR_RM_GC6_FEATURE_SKIP_COMPACTION_NORESET = Field<9, 8>;
+using NV_REG_STR_RM_GC6_FEATURE_FBSR_PMU_ENTRY = Field<11, 10>;
+using NV_REG_STR_RM_GC6_FEATURE_RTD3_SUPPORT = Field<13, 12>;
+using NV_REG_STR_RM_GC6_FEATURE_FAST_GC6_SUPPORT = Field<15, 14>;
+using NV_REG_STR_RM_GC6_FEATURE_SUPPORT_HDA_OSPM_D3 = Field<17, 16>;
+using NV_REG_STR_RM_GC6_FEATURE_IFR_DRIVEN_PATH = Field<19, 18>;
+using NV_REG_STR_RM_GC6_FEATURE_PCIE_LINK_STATE_CHECK = Field<21, 20>;
+using NV_REG_STR_RM_GCOFF_FEATURE_P0_BOOST = Field<1, 0>;
+using NV_REG_STR_RM_FORCE_RTD3_D3HOT_ENTRY = Field<1, 0>;
+using NV_REG_STR_RM_GC6_PARAMETERS_SLEEP_AWARE_CALLBACK = Field<1, 0>;
+using NV_REG_STR_RM_GC6_PARAMETERS_DEFERRED_PMU_CALLBACK = Field<3, 2>;
+using NV_REG_STR_RM_GC6_PARAMETERS_PMU_HANDLE_MODESET = Field<5, 4>;
+using NV_REG_STR_RM_GC6_PARAMETERS_BSOD_MODESET = Field<7, 6>;
+using NV_REG_STR_RM_DI_FEATURE_XTAL4XPLL = Field<1, 0>;
+using NV_REG_STR_RM_DI_FEATURE_THERM_SENSOR = Field<3, 2>;
+using NV_REG_STR_RM_DI_FEATURE_OSM_CLKS = Field<5, 4>;
+using NV_REG_STR_RM_DI_FEATURE_DISP_PLLS = Field<7, 6>;
+using NV_REG_STR_RM_DI_FEATURE_DFE_VAL = Field<9, 8>;
+using NV_REG_STR_RM_DI_FEATURE_GPU_READY = Field<11, 10>;
+using NV_REG_STR_RM_DI_FEATURE_RSVD = Field<13, 12>;
+using NV_REG_STR_RM_DI_FEATURE_RPPG = Field<15, 14>;
+using NV_REG_STR_RM_DI_FEATURE_NO_PSTATE_SUPPORT = Field<17, 16>;
+using NV_REG_STR_RM_DI_FEATURE_PLL_IDDQ = Field<19, 18>;
+using NV_REG_STR_RM_DI_FEATURE_VOLTAGE_UPDATE = Field<21, 20>;
+using NV_REG_STR_RM_DI_FEATURE_ALT_MUX_SEL = Field<23, 22>;
+using NV_REG_STR_RM_DI_FEATURE_XTAL_GATE = Field<25, 24>;
+using NV_REG_STR_RM_DI_WAKEUP_TIMER_TIME = Field<29, 0>;
+using NV_REG_STR_RM_DI_WAKEUP_TIMER_MODE = Field<31, 30>;
+using NV_REG_STR_RM_D3_FEATURE_DRIVER_CFG_SPACE_RESTORE = Field<1, 0>;
+using NV_REG_STR_RM_OPERATION_MODE_COMPUTE = Field<0, 0>;
+using NV_REG_STR_RM_OPERATION_MODE_TEX = Field<1, 1>;
+using NV_REG_STR_RM_OPERATION_MODE_DFMA = Field<2, 2>;
+using NV_REG_STR_RM_ELCG_GR = Field<1, 0>;
+using NV_REG_STR_RM_ELCG_PPP = Field<3, 2>;
+using NV_REG_STR_RM_ELCG_MPEG = Field<3, 2>;
+using NV_REG_STR_RM_ELCG_CE0 = Field<5, 4>;
+using NV_REG_STR_RM_ELCG_PDEC = Field<7, 6>;
+using NV_REG_STR_RM_ELCG_SEC = Field<9, 8>;
+using NV_REG_STR_RM_ELCG_VIC = Field<9, 8>;
+using NV_REG_STR_RM_ELCG_VLD = Field<11, 10>;
+using NV_REG_STR_RM_ELCG_CE1 = Field<13, 12>;
+using NV_REG_STR_RM_ELCG_DISP = Field<15, 14>;
+using NV_REG_STR_RM_ELCG_CE2 = Field<17, 16>;
+using NV_REG_STR_RM_ELCG_SEC2 = Field<19, 18>;
+using NV_REG_STR_RM_ELCG_MSENC = Field<21, 20>;
+using NV_REG_STR_RM_ELCG_MSENC1 = Field<23, 22>;
+using NV_REG_STR_RM_ELCG_CE3 = Field<25, 24>;
+using NV_REG_STR_RM_ELCG_CE4 = Field<27, 26>;
+using NV_REG_STR_RM_ELCG_CE5 = Field<29, 28>;
+using NV_REG_STR_RM_ELCG_MSENC2 = Field<31, 30>;
+using NV_REG_STR_RM_BLCG2_GR = Field<3, 0>;
+using NV_REG_STR_RM_BLCG2_PPP = Field<7, 4>;
+using NV_REG_STR_RM_BLCG2_FB = Field<11, 8>;
+using NV_REG_STR_RM_BLCG2_FBPA = Field<11, 8>;
+using NV_REG_STR_RM_BLCG2_LTCG = Field<11, 8>;
+using NV_REG_STR_RM_BLCG2_XBAR = Field<11, 8>;
+using NV_REG_STR_RM_BLCG2_PDEC = Field<15, 12>;
+using NV_REG_STR_RM_BLCG2_VLD = Field<19, 16>;
+using NV_REG_STR_RM_BLCG2_XVE = Field<23, 20>;
+using NV_REG_STR_RM_BLCG2_CE = Field<27, 24>;
+using NV_REG_STR_RM_BLCG2_MISC = Field<31, 28>;
+using NV_REG_STR_RM_ELPG_GR = Field<0, 0>;
+using NV_REG_STR_RM_ELPG_PDEC = Field<1, 1>;
+using NV_REG_STR_RM_ELPG_GR_RG = Field<2, 2>;
+using NV_REG_STR_RM_ELPG_DO_NOT_USE = Field<3, 3>;
+using NV_REG_STR_RM_ELPG_MS = Field<4, 4>;
+using NV_REG_STR_RM_ELPG_EI = Field<5, 5>;
+using NV_REG_STR_RM_ELPG_MS_LTC = Field<6, 6>;
+using NV_REG_STR_RM_ELPG_MS_PASSIVE = Field<7, 7>;
+using NV_REG_STR_RM_ELPG_EI_PASSIVE = Field<8, 8>;
+using NV_REG_STR_RM_ELPG_DFPR = Field<9, 9>;
+using NV_REG_STR_RM_ELPG_MS_DIFR_SW_ASR = Field<10, 10>;
+using NV_REG_STR_RM_ELPG_MS_DIFR_CG = Field<11, 11>;
+using NV_REG_STR_RM_ADAPTIVE_PWR_DEBUG_GR = Field<0, 0>;
+using NV_REG_STR_RM_ADAPTIVE_PWR_DEBUG_GC5 = Field<1, 1>;
+using NV_REG_STR_RM_SLCG_GR = Field<0, 0>;
+using NV_REG_STR_RM_SLCG_CE0 = Field<1, 1>;
+using NV_REG_STR_RM_SLCG_CE1 = Field<2, 2>;
+using NV_REG_STR_RM_SLCG_CE2 = Field<3, 3>;
+using NV_REG_STR_RM_SLCG_PMU = Field<4, 4>;
+using NV_REG_STR_RM_SLCG_FB = Field<5, 5>;
+using NV_REG_STR_RM_SLCG_FBPA = Field<5, 5>;
+using NV_REG_STR_RM_SLCG_LTCG = Field<5, 5>;
+using NV_REG_STR_RM_SLCG_XBAR = Field<5, 5>;
+using NV_REG_STR_RM_SLCG_ACB = Field<6, 6>;
+using NV_REG_STR_RM_SLCG_PERF = Field<7, 7>;
+using NV_REG_STR_RM_SLCG_FIFO = Field<8, 8>;
+using NV_REG_STR_RM_SLCG_CHIPLETS = Field<9, 9>;
+using NV_REG_STR_RM_SLCG_BUS = Field<10, 10>;
+using NV_REG_STR_RM_SLCG_THERM = Field<11, 11>;
+using NV_REG_STR_RM_SLCG_SEC2 = Field<12, 12>;
+using NV_REG_STR_RM_SLCG_NVDEC = Field<13, 13>;
+using NV_REG_STR_RM_SLCG_MSPDEC = Field<13, 13>;
+using NV_REG_STR_RM_SLCG_NVENC = Field<14, 14>;
+using NV_REG_STR_RM_SLCG_MSENC = Field<14, 14>;
+using NV_REG_STR_RM_SLCG_NVJPG = Field<15, 15>;
+using NV_REG_STR_RM_SLCG_GSP = Field<16, 16>;
+using NV_REG_STR_RM_SLCG_OFA = Field<17, 17>;
+using NV_REG_STR_RM_CLOCK_SLOWDOWN_THERMAL__RESERVED = Field<17, 0>;
+using NV_REG_STR_RM_CLOCK_SLOWDOWN__DEPRECATED = Field<19, 18>;
+using NV_REG_STR_RM_CLOCK_SLOWDOWN_NV = Field<23, 22>;
+using NV_REG_STR_RM_CLOCK_SLOWDOWN_HOST = Field<25, 24>;
+using NV_REG_STR_RM_CLOCK_SLOWDOWN_IDLE_PSTATE = Field<27, 26>;
+using NV_REG_STR_RM_FSPG_GRAPHICS = Field<0, 0>;
+using NV_REG_STR_RM_FSPG_VIDEO = Field<1, 1>;
+using NV_REG_STR_RM_FSPG_VIC = Field<2, 2>;
+using NV_REG_STR_RM_FSPG_FB = Field<3, 3>;
+using NV_REG_STR_RM_DISABLE_REGISTRY_CACHE_NVIF = Field<0, 0>;
+using NV_REG_STR_RM_DISABLE_REGISTRY_CACHE_EXTDEVICE = Field<1, 1>;
+using NV_REG_STR_RM_DISABLE_REGISTRY_CACHE_THERMAL = Field<2, 2>;
+using NV_REG_STR_RM_DISABLE_REGISTRY_CACHE_I2CPORTVALIDATE = Field<3, 3>;
+using NV_REG_RM_DISABLE_ACPI_NVIF = Field<0, 0>;
+using NV_REG_RM_DISABLE_ACPI_MXM = Field<1, 1>;
+using NV_REG_RM_DISABLE_ACPI_NVHG = Field<2, 2>;
+using NV_REG_RM_DISABLE_ACPI_NBCI = Field<3, 3>;
+using NV_REG_RM_DISABLE_ACPI_NBSI = Field<4, 4>;
+using NV_REG_RM_DISABLE_ACPI_SPB = Field<5, 5>;
+using NV_REG_RM_DISABLE_ACPI_NVOP = Field<6, 6>;
+using NV_REG_RM_DISABLE_ACPI_PCFG = Field<7, 7>;
+using NV_REG_RM_DISABLE_ACPI_GPS = Field<8, 8>;
+using NV_REG_RM_DISABLE_ACPI_GPS_2X = Field<9, 9>;
+using NV_REG_NATIVE_PCIE_L1_WAR_FLAGS_TARGET = Field<1, 0>;
+using NV_REG_NATIVE_PCIE_L1_WAR_FLAGS_POLICY = Field<5, 4>;
+using NV_REG_NATIVE_PCIE_L1_WAR_FLAGS_RESUME_CALLBACK = Field<8, 8>;
+using NV_REG_STR_RM_DISABLE_GPU_ASPM_FLAGS_L0S = Field<0, 0>;
+using NV_REG_STR_RM_DISABLE_GPU_ASPM_FLAGS_L1 = Field<1, 1>;
+using NV_REG_STR_RM_SBIOS_ENABLE_ASPM_DT_L0S = Field<0, 0>;
+using NV_REG_STR_RM_SBIOS_ENABLE_ASPM_DT_L1 = Field<1, 1>;
+using NV_REG_STR_RM_ENABLE_ASPM_DT_L0S = Field<0, 0>;
+using NV_REG_STR_RM_ENABLE_ASPM_DT_L1 = Field<1, 1>;
+using NV_REG_STR_RM_OVERRIDE_SUPPORT_CHIPSET_ASPM_L0S = Field<0, 0>;
+using NV_REG_STR_RM_OVERRIDE_SUPPORT_CHIPSET_ASPM_L1 = Field<1, 1>;
+using NV_REG_STR_RM_ENABLE_ASPM_AT_LOAD_L0S = Field<0, 0>;
+using NV_REG_STR_RM_ENABLE_ASPM_AT_LOAD_L1 = Field<1, 1>;
+using NV_REG_STR_RM_ENABLE_ASPM_PUBLIC_BITS_L0S = Field<0, 0>;
+using NV_REG_STR_RM_ENABLE_ASPM_PUBLIC_BITS_L1 = Field<1, 1>;
+using NV_REG_STR_RM_ENABLE_ASPM_PUBLIC_BITS_L1_CPM = Field<2, 2>;
+using NV_REG_STR_RM_DISABLE_COT_CMD_FRTS_SYSMEM = Field<1, 0>;
+using NV_REG_STR_RM_DISABLE_COT_CMD_FRTS_VIDMEM = Field<3, 2>;
+using NV_REG_STR_RM_DISABLE_COT_CMD_GSPFMC = Field<5, 4>;
+using NV_REG_STR_RM_GSP_RTOS_OVERRIDES_POLL_FOR_INIT_ACK = Field<1, 0>;
+using NV_REG_STR_RM_OVERRIDE_UPROC_ENGINE_ARCH_GSP = Field<3, 0>;
+using NV_REG_STR_RM_OVERRIDE_UPROC_ENGINE_ARCH_SEC2 = Field<7, 4>;
+using NV_REG_STR_RM_OVERRIDE_UPROC_ENGINE_ARCH_PMU = Field<11, 8>;
+using NV_REG_STR_RM_OVERRIDE_UPROC_ENGINE_ARCH_NVDEC = Field<15, 12>;
+using NV_REG_STR_RM_OVERRIDE_UPROC_ENGINE_ARCH_RSVD = Field<31, 16>;
+using NV_REG_STR_RM_DPU_FORCE_FRAME_RELEASE_ENABLE = Field<0, 0>;
+using NV_REG_STR_RM_DPU_FORCE_FRAME_RELEASE_THRESHOLD_US = Field<31, 16>;
+using NV_REG_STR_RM_SEC2_RTOS_OVERRIDES_USE_PWR_CLK_TICKS = Field<1, 0>;
+using NV_REG_STR_RM_SEC2_RTOS_OVERRIDES_FREQ_CHANGE = Field<3, 2>;
+using NV_REG_STR_RM_SEC2_RTOS_OVERRIDES_POLL_FOR_INIT_ACK = Field<5, 4>;
+using NV_REG_STR_RM_PG_LOG_PARAMS_EVENTS_PER_RECORD = Field<7, 0>;
+using NV_REG_STR_RM_PG_LOG_PARAMS_FLUSH_WATERMARKS = Field<15, 8>;
+using NV_REG_STR_RM_PG_LOG_PARAMS_EVENTS_PER_NSI = Field<19, 16>;
+using NV_REG_STR_RM_PG_LOG_PARAMS_LOG_EVENTS = Field<31, 30>;
+using NV_REG_STR_RM_FB_TRAINING_CMOS_ADR_TRAIN = Field<0, 0>;
+using NV_REG_STR_RM_FB_TRAINING_CMOS_WCK_TRAIN = Field<1, 1>;
+using NV_REG_STR_RM_FB_TRAINING_CMOS_RD_TRAIN = Field<2, 2>;
+using NV_REG_STR_RM_FB_TRAINING_CMOS_WR_TRAIN = Field<3, 3>;
+using NV_REG_STR_RM_FB_TRAINING_CMOS_PERIODIC = Field<8, 8>;
+using NV_REG_STR_RM_FB_TRAINING_CMOS_SDDR3_WR_TRAIN = Field<9, 9>;
+using NV_REG_STR_RM_FB_TRAINING_CMOS_SDDR3_WR_TRAIN_CTRL = Field<10, 10>;
+using NV_REG_STR_RM_FB_TRAINING_CMOS_SDDR3_QUSE_TRAIN = Field<11, 11>;
+using NV_REG_STR_RM_FB_TRAINING_CMOS_RESERVED = Field<31, 31>;
+using NV_REG_STR_RM_FB_TRAINING_CML_ADR_TRAIN = Field<0, 0>;
+using NV_REG_STR_RM_FB_TRAINING_CML_WCK_TRAIN = Field<1, 1>;
+using NV_REG_STR_RM_FB_TRAINING_CML_RD_TRAIN = Field<2, 2>;
+using NV_REG_STR_RM_FB_TRAINING_CML_WR_TRAIN = Field<3, 3>;
+using NV_REG_STR_RM_FB_TRAINING_CML_PERIODIC = Field<8, 8>;
+using NV_REG_STR_RM_FB_TRAINING_CML_RESERVED = Field<31, 31>;
+using NV_REG_STR_RM_OPSB_ASR = Field<1, 0>;
+using NV_REG_STR_RM_OPSB_RESERVED = Field<3, 2>;
+using NV_REG_STR_RM_OPSB_CLKREQ = Field<5, 4>;
+using NV_REG_STR_RM_OPSB_DEEP_L1 = Field<7, 6>;
+using NV_REG_STR_RM_OPSB_DEEP_IDLE = Field<9, 8>;
+using NV_REG_STR_RM_OPSB_AELPG = Field<11, 10>;
+using NV_REG_STR_RM_OPSB_VIDEO_ELPG = Field<13, 12>;
+using NV_REG_STR_RM_DUAL_HEAD_MCLK_SWITCH_ENABLE = Field<1, 0>;
+using NV_REG_STR_RM_CLK_VF_OVERRIDE_MONOTONICITY_ENABLE = Field<1, 0>;
+using NV_REG_STR_RM_CLK_VF_OVERRIDE_SMOOTHENING_ENABLE = Field<3, 2>;
+using NV_REG_STR_RM_ENABLE_FB_LINK_TRAINING_ENABLE = Field<0, 0>;
+using NV_REG_STR_RM_ENABLE_FB_LINK_TRAINING_ON = Field<4, 4>;
+using NV_REG_STR_RM_ENABLE_FB_LINK_TRAINING_PATTERN_VBIOS = Field<5, 5>;
+using NV_REG_STR_RM_ENABLE_FB_LINK_TRAINING_PATTERN_INTERNAL = Field<6, 6>;
+using NV_REG_STR_RM_QUADRO_TUNE_RASTER_BBOX_PAD = Field<7, 0>;
+using NV_REG_STR_RM_QUADRO_TUNE_RASTER_BBOX_PAD_LINE = Field<15, 8>;
+using NV_REG_STR_RM_QUADRO_TUNE_VPC_STIPPLED_LINE = Field<13, 6>;
+using NV_REG_STR_RM_QUADRO_TUNE_VPC_CULLED_SMALL_TRIANGLES_LINE = Field<21, 14>;
+using NV_REG_STR_RM_QUADRO_TUNE_VPC_NONCULLED_TRIANGLES_LINE = Field<29, 22>;
+using NV_REG_STR_RM_QUADRO_TUNE_ARCH_OVERRIDE = Field<30, 30>;
+using NV_REG_STR_RM_QUADRO_TUNE_GPU = Field<31, 31>;
+using NV_REG_STR_RM_QUADRO_TUNE_2_VPC_CULLED_SMALL_LINES = Field<7, 0>;
+using NV_REG_STR_RM_QUADRO_TUNE_2_VPC_CULLED_SMALL_TRIANGLES = Field<15, 8>;
+using NV_REG_STR_RM_QUADRO_TUNE_2_VPC_NONCULLED_LINES_AND_POINTS = Field<23, 16>;
+using NV_REG_STR_RM_QUADRO_TUNE_2_VPC_NONCULLED_TRIANGLES_LINE = Field<31, 24>;
+using NV_REG_STR_RM_FB_TRIMMER_VAL_CMD_TRIMMER_LSB = Field<0, 0>;
+using NV_REG_STR_RM_FB_TRIMMER_VAL_DATALO_TRIMMER_LSB = Field<1, 1>;
+using NV_REG_STR_RM_FB_TRIMMER_VAL_DATAHI_TIMMER_LSB = Field<3, 3>;
+using NV_REG_STR_RM_FB_TRIMMER_VAL_ALL_TRIMMER_MSB = Field<8, 8>;
+using NV_REG_STR_RM_FB_TRIMMER_VAL_RESERVED = Field<31, 31>;
+using NV_REG_STR_RM_ISOHUB_MCLK_SWITCH_MODE = Field<3, 0>;
+using NV_REG_STR_RM_ISOHUB_MCLK_SWITCH_MODE_VRR = Field<4, 4>;
+using NV_REG_STR_RM_ISOHUB_MCLK_SWITCH_MODE_OSM = Field<5, 5>;
+using NV_REG_STR_RM_ISOHUB_MCLK_SWITCH_ADDITIONAL_DELAY = Field<15, 8>;
+using NV_REG_STR_RM_ISOHUB_MCLK_SWITCH_REPLACEMENT_DELAY = Field<23, 16>;
+using NV_REG_STR_RM_LPWR_FSM_STATE_ON_INIT = Field<1, 0>;
+using NV_REG_STR_RM_PGCTRL_MS_PARAMETERS_SYSCLK_SLOWDOWN = Field<1, 0>;
+using NV_REG_STR_RM_PGCTRL_MS_PARAMETERS_CG = Field<3, 2>;
+using NV_REG_STR_RM_PGCTRL_MS_PARAMETERS_RPG = Field<5, 4>;
+using NV_REG_STR_RM_PGCTRL_MS_PARAMETERS_GSP = Field<7, 6>;
+using NV_REG_STR_RM_PGCTRL_MS_PARAMETERS_SWASR = Field<9, 8>;
+using NV_REG_STR_RM_PGCTRL_MS_PARAMETERS_ISO_STUTTER = Field<13, 12>;
+using NV_REG_STR_RM_PGCTRL_MS_PARAMETERS_DISPLAY = Field<15, 14>;
+using NV_REG_STR_RM_PGCTRL_MS_PARAMETERS_FB_TRAINING = Field<17, 16>;
+using NV_REG_STR_RM_PGCTRL_MS_PARAMETERS_PG_ENG_GR = Field<19, 18>;
+using NV_REG_STR_RM_PGCTRL_MS_PARAMETERS_RPPG = Field<21, 20>;
+using NV_REG_STR_RM_PGCTRL_MS_PARAMETERS_MSCG_WITH_IMMED_FLIP = Field<23, 22>;
+using NV_REG_STR_RM_PGCTRL_MS_PARAMETERS_NVDCLK_SLOWDOWN = Field<25, 24>;
+using NV_REG_STR_RM_PGCTRL_MS_PARAMETERS_SEC2_RTOS = Field<27, 26>;
+using NV_REG_STR_RM_PGCTRL_MS_PARAMETERS_PERF = Field<29, 28>;
+using NV_REG_STR_RM_PGCTRL_MS_PARAMETERS_UNUSED_1 = Field<31, 30>;
+using NV_REG_STR_RM_DWB_MSCG_DISABLE = Field<0, 0>;
+using NV_REG_STR_RM_ENABLE_MSCG_CONFIG_WITH_VSYNC = Field<0, 0>;
+using NV_REG_STR_RM_ENABLE_MSCG_CONFIG_WITH_FRL = Field<1, 1>;
+using NV_REG_STR_RM_LPWR_CTRL_MS_LTC_PARAMETERS_GSP = Field<1, 0>;
+using NV_REG_STR_RM_LPWR_CTRL_MS_LTC_PARAMETERS_PERF = Field<3, 2>;
+using NV_REG_STR_RM_LPWR_CTRL_MS_DIFR_SW_ASR_PARAMETERS_SWASR = Field<1, 0>;
+using NV_REG_STR_RM_LPWR_CTRL_MS_DIFR_SW_ASR_PARAMETERS_FB_TRAINING = Field<3, 2>;
+using NV_REG_STR_RM_LPWR_CTRL_MS_DIFR_SW_ASR_PARAMETERS_DISPLAY = Field<5, 4>;
+using NV_REG_STR_RM_LPWR_CTRL_MS_DIFR_SW_ASR_PARAMETERS_ISO_STUTTER = Field<7, 6>;
+using NV_REG_STR_RM_LPWR_CTRL_MS_DIFR_SW_ASR_PARAMETERS_SEC2 = Field<9, 8>;
+using NV_REG_STR_RM_LPWR_CTRL_MS_DIFR_SW_ASR_PARAMETERS_GSP = Field<11, 10>;
+using NV_REG_STR_RM_LPWR_CTRL_MS_DIFR_SW_ASR_PARAMETERS_HSHUB = Field<13, 12>;
+using NV_REG_STR_RM_LPWR_CTRL_MS_DIFR_CG_PARAMETERS_CG = Field<1, 0>;
+using NV_REG_STR_RM_LPWR_CTRL_MS_DIFR_CG_PARAMETERS_ISO_STUTTER = Field<3, 2>;
+using NV_REG_STR_RM_LPWR_CTRL_MS_DIFR_CG_PARAMETERS_RPPG = Field<5, 4>;
+using NV_REG_STR_RM_LPWR_CTRL_MS_DIFR_CG_PARAMETERS_PSI = Field<7, 6>;
+using NV_REG_STR_RM_LPWR_CTRL_MS_DIFR_CG_PARAMETERS_SYSCLK_SLOWDOWN = Field<9, 8>;
+using NV_REG_STR_RM_LPWR_CTRL_MS_DIFR_CG_PARAMETERS_NVDCLK_SLOWDOWN = Field<11, 10>;
+using NV_REG_STR_RM_PGCTRL_DI_PARAMETERS_PGENG_FEATURE_STATE = Field<1, 0>;
+using NV_REG_STR_RM_PGCTRL_DI_PARAMETERS_DEEP_L1 = Field<3, 2>;
+using NV_REG_STR_RM_PGCTRL_DI_PARAMETERS_L1SS = Field<5, 4>;
+using NV_REG_STR_RM_PGCTRL_GR_PARAMETERS_UNUSED = Field<1, 0>;
+using NV_REG_STR_RM_PGCTRL_GR_PARAMETERS_NEW_HOST_SEQ = Field<3, 2>;
+using NV_REG_STR_RM_PGCTRL_GR_PARAMETERS_ELPG = Field<5, 4>;
+using NV_REG_STR_RM_PGCTRL_GR_PARAMETERS_RPPG = Field<7, 6>;
+using NV_REG_STR_RM_PGCTRL_GR_PARAMETERS_PSI = Field<9, 8>;
+using NV_REG_STR_RM_PGCTRL_GR_PARAMETERS_PRIV_RING = Field<11, 10>;
+using NV_REG_STR_RM_PGCTRL_GR_PARAMETERS_UNBIND = Field<13, 12>;
+using NV_REG_STR_RM_PGCTRL_GR_PARAMETERS_SAVE_GLOBAL_STATE = Field<15, 14>;
+using NV_REG_STR_RM_PGCTRL_GR_PARAMETERS_RESET = Field<17, 16>;
+using NV_REG_STR_RM_PGCTRL_GR_PARAMETERS_HW_SEQUENCE = Field<19, 18>;
+using NV_REG_STR_RM_PGCTRL_GR_PARAMETERS_ELPG_SRAM = Field<21, 20>;
+using NV_REG_STR_RM_PGCTRL_GR_PARAMETERS_ELPG_LOGIC = Field<23, 22>;
+using NV_REG_STR_RM_PGCTRL_GR_PARAMETERS_ELPG_L2RPPG = Field<25, 24>;
+using NV_REG_STR_RM_PGCTRL_GR_PARAMETERS_FG_RPPG_EXCLUSION = Field<27, 26>;
+using NV_REG_STR_RM_PGCTRL_GR_PARAMETERS_SEC2 = Field<29, 28>;
+using NV_REG_STR_RM_PGCTRL_GR_PARAMETERS_GSP = Field<31, 30>;
+using NV_REG_STR_RM_LPWR_CTRL_GR_RG_PARAMETERS_PRIV_RING = Field<1, 0>;
+using NV_REG_STR_RM_LPWR_CTRL_GR_RG_PARAMETERS_UNBIND = Field<3, 2>;
+using NV_REG_STR_RM_LPWR_CTRL_GR_RG_PARAMETERS_SAVE_GLOBAL_STATE = Field<5, 4>;
+using NV_REG_STR_RM_LPWR_CTRL_GR_RG_PARAMETERS_RESET = Field<7, 6>;
+using NV_REG_STR_RM_LPWR_CTRL_GR_RG_PARAMETERS_HW_SEQUENCE = Field<9, 8>;
+using NV_REG_STR_RM_LPWR_CTRL_GR_RG_PARAMETERS_GSP = Field<11, 10>;
+using NV_REG_STR_RM_LPWR_CTRL_GR_RG_PARAMETERS_SEC2 = Field<13, 12>;
+using NV_REG_STR_RM_LPWR_CTRL_GR_RG_PARAMETERS_RG_GPCCS_BS = Field<15, 14>;
+using NV_REG_STR_RM_LPWR_CTRL_GR_RG_PARAMETERS_RG_PERF_CHANGE_SEQ = Field<17, 16>;
+using NV_REG_STR_RM_LPWR_CTRL_GR_RG_PARAMETERS_XVE = Field<19, 18>;
+using NV_REG_STR_RM_LPWR_CTRL_GR_RG_PARAMETERS_UNUSED = Field<21, 20>;
+using NV_REG_STR_RM_LPWR_CTRL_GR_RG_PARAMETERS_RG_GPCCS_BS_PMU = Field<23, 22>;
+using NV_REG_STR_RM_LPWR_CTRL_GR_RG_PARAMETERS_RG_TS_PD = Field<25, 24>;
+using NV_REG_STR_RM_LPWR_CTRL_GR_RG_PARAMETERS_NEW_HOST_SEQ = Field<27, 26>;
+using NV_REG_STR_RM_NVLOG_BUFFER_FLAGS = Field<7, 0>;
+using NV_REG_STR_RM_NVLOG_BUFFER_SIZE = Field<23, 8>;
+using NV_REG_STR_RM_NVLOG_RUNTIME_LEVEL = Field<28, 25>;
+using NV_REG_STR_RM_NVLOG_TIMESTAMP = Field<30, 29>;
+using NV_REG_STR_RM_NVLOG_INITED = Field<31, 31>;
+using NV_REG_STR_RM_HDCP_OFFLOAD_INIT = Field<1, 0>;
+using NV_REG_STR_RM_FORCE_DP_DONGLE_HDMI_TYPE_1 = Field<0, 0>;
+using NV_REG_STR_RM_FORCE_DP_DONGLE_HDMI_TYPE_2 = Field<1, 1>;
+using NV_REG_STR_RM_FORCE_DP_DONGLE_HDMI_LINK_MASK = Field<15, 8>;
+using NV_REG_STR_RM_SMMU_CONFIG_ALL = Field<31, 0>;
+using NV_REG_STR_RM_SMMU_CONFIG_DISPLAY = Field<1, 0>;
+using NV_REG_STR_RM_SMMU_CONFIG_AVP = Field<3, 2>;
+using NV_REG_STR_RM_SMMU_CONFIG_GPU = Field<5, 4>;
+using NV_REG_STR_RM_THERM_POLICY_OVERRIDE_DISABLE = Field<0, 0>;
+using NV_REG_STR_RM_THERM_POLICY_SW_SLOWDOWN_OVERRIDE_DISABLE = Field<0, 0>;
+using NV_REG_STR_RM_PCIE_LINK_SPEED_ALLOW_GEN2 = Field<1, 0>;
+using NV_REG_STR_RM_PCIE_LINK_SPEED_ALLOW_GEN3 = Field<3, 2>;
+using NV_REG_STR_RM_PCIE_LINK_SPEED_ALLOW_GEN4 = Field<5, 4>;
+using NV_REG_STR_RM_PCIE_LINK_SPEED_ALLOW_GEN5 = Field<7, 6>;
+using NV_REG_STR_RM_PCIE_LINK_SPEED_LOCK_AT_LOAD = Field<31, 31>;
+using NV_REG_STR_RM_LTR_L1_2_THRESHOLD_OVERRIDE = Field<1, 0>;
+using NV_REG_STR_RM_LTR_L1_2_THRESHOLD_VALUE = Field<11, 2>;
+using NV_REG_STR_RM_LTR_L1_2_THRESHOLD_SCALE = Field<14, 12>;
+using NV_REG_STR_RM_PCIE_LTR_OVERRIDE_ALLOW_LTR = Field<1, 0>;
+using NV_REG_STR_RM_PCIE_LTR_OVERRIDE_SNOOP_LAT_VALUE = Field<11, 2>;
+using NV_REG_STR_RM_PCIE_LTR_OVERRIDE_SNOOP_LAT_SCALE = Field<14, 12>;
+using NV_REG_STR_RM_PCIE_LTR_OVERRIDE_NO_SNOOP_LAT_VALUE = Field<24, 15>;
+using NV_REG_STR_RM_PCIE_LTR_OVERRIDE_NO_SNOOP_LAT_SCALE = Field<27, 25>;
+using NV_REG_STR_RM_THERM_PROVIDER_AUTODETECT_SKIP_NVINT = Field<0, 0>;
+using NV_REG_STR_RM_THERM_PROVIDER_AUTODETECT_SKIP_AD1032_COMPAT = Field<1, 1>;
+using NV_REG_STR_RM_THERM_PROVIDER_AUTODETECT_SKIP_ADT7473 = Field<2, 2>;
+using NV_REG_STR_RM_THERM_PROVIDER_AUTODETECT_SKIP_NVSYSCON = Field<3, 3>;
+using NV_REG_STR_RM_GR_BALANCING_MODE_SKIP_TABLE = Field<1, 0>;
+using NV_REG_STR_RM_GR_BALANCING_MODE_PD_WORKLOAD = Field<3, 2>;
+using NV_REG_STR_RM_GR_BALANCING_MODE_SKIP_MASK = Field<15, 8>;
+using NV_REG_STR_RM_1165534_PPBDMA_TIMEOUT_PERIOD = Field<31, 0>;
+using NV_REG_STR_RM_1295474_CHECK_FAKE_LVDS_ENTRY_DISABLE = Field<0, 0>;
+using NV_REG_STR_RM_FAN_2X_OVERRIDE_POR = Field<1, 0>;
+using NV_REG_STR_RM_INFOROM_DISABLE_BBX_COMPLETELY = Field<0, 0>;
+using NV_REG_STR_RM_INFOROM_DISABLE_BBX_WRITE_BY_RM = Field<1, 1>;
+using NV_REG_STR_RM_INFOROM_DISABLE_BBX_WRITE_BY_CLIENT = Field<2, 2>;
+using NV_REG_STR_RM_INFOROM_DISABLE_BBX_PERIODIC_FLUSH = Field<3, 3>;
+using NV_REG_STR_RM_INFOROM_DISABLE_NVLINK_FATAL_ERROR_LOGGING = Field<0, 0>;
+using NV_REG_STR_RM_INFOROM_DISABLE_NVLINK_CORRECTABLE_ERROR_LOGGING = Field<1, 1>;
+using NV_REG_STR_RM_ROP_L2_FUSE_MASK_FOR_FMODEL_MASK = Field<31, 0>;
+using NV_REG_STR_RM_CREATE_ACR_REGION_SIZE = Field<15, 0>;
+using NV_REG_STR_RM_CREATE_ACR_REGION_READMASK = Field<18, 16>;
+using NV_REG_STR_RM_CREATE_ACR_REGION_WRITEMASK = Field<21, 19>;
+using NV_REG_STR_RM_CREATE_ACR_REGION_MEMALIGN = Field<31, 22>;
+using NV_REG_STR_RM_SLI_GPU_BOOST_SYNC_OVERRIDE_POR = Field<1, 0>;
+using NV_REG_STR_RM_ACR_USE_CE_FOR_SHADOW_COPY_STATE = Field<0, 0>;
+using NV_REG_STR_RM_LSFM_FEATURE_WPR_BLOB_VERSION = Field<0, 0>;
+using NV_REG_STR_RM_ENABLE_SINGLE_HEAD_MULTI_DISPLAY_SST = Field<0, 0>;
+using NV_REG_STR_RM_ENABLE_SINGLE_HEAD_MULTI_DISPLAY_MST = Field<1, 1>;
+using NV_REG_STR_RM_HULK_DISABLE_FEATURES_VPR = Field<0, 0>;
+using NV_REG_STR_RM_HULK_DISABLE_FEATURES_WPR = Field<1, 1>;
+using NV_REG_STR_RM_HULK_DISABLE_FEATURES_HDCP = Field<2, 2>;
+using NV_REG_STR_RM_HDA_UCODE_ADDRMODE = Field<0, 0>;
+using NV_REG_STR_RM_PRIV_SECURITY_REGISTERS = Field<0, 0>;
+using NV_REG_STR_RM_PRIV_SECURITY_DISABLE = Field<2, 1>;
+using NV_REG_STR_RM_PRIV_SECURITY_MODE = Field<4, 3>;
+using NV_REG_STR_RM_NVLINK_CONTROL_FORCE_DISABLE = Field<0, 0>;
+using NV_REG_STR_RM_NVLINK_CONTROL_TRAIN_AT_LOAD = Field<1, 1>;
+using NV_REG_STR_RM_NVLINK_CONTROL_SKIP_TRAIN = Field<2, 2>;
+using NV_REG_STR_RM_NVLINK_CONTROL_RESERVED_0 = Field<7, 3>;
+using NV_REG_STR_RM_NVLINK_CONTROL_FORCE_AUTOCONFIG = Field<8, 8>;
+using NV_REG_STR_RM_NVLINK_CONTROL_FORCE_ENABLE = Field<31, 31>;
+using NV_REG_STR_RM_NVLINK_FORCE_CORE_LIB_RTL_ENABLE = Field<0, 0>;
+using NV_REG_STR_RM_NVLINK_NISOHUB_ENABLE = Field<0, 0>;
+using NV_REG_STR_RM_NVLINK_UPHY_INIT_CONTROL_LANE_INIT = Field<0, 0>;
+using NV_REG_STR_RM_NVLINK_UPHY_INIT_CONTROL_TX_EQ = Field<1, 1>;
+using NV_REG_STR_RM_NVLINK_UPHY_INIT_CONTROL_LINK_TRAIN = Field<2, 2>;
+using NV_REG_STR_RM_NVLINK_UPHY_INIT_CONTROL_POWER_DOWN = Field<3, 3>;
+using NV_REG_STR_RM_NVLINK_UPHY_INIT_CONTROL_UPHY_VER = Field<4, 4>;
+using NV_REG_STR_RM_NVLINK_SELECT_REFCLK_TYPE = Field<1, 0>;
+using NV_REG_STR_RM_NVLINK_REFCLK_RATE_VAL = Field<1, 0>;
+using NV_REG_STR_RM_NVLINK_SPEED_CONTROL_SPEED = Field<4, 0>;
+using NV_REG_STR_RM_NVLINK_TXTRAIN_CONTROL_FOM_FORMAT = Field<2, 0>;
+using NV_REG_STR_RM_NVLINK_TXTRAIN_CONTROL_OPTIMIZATION_ALGORITHM = Field<10, 3>;
+using NV_REG_STR_RM_NVLINK_TXTRAIN_CONTROL_ADJUSTMENT_ALGORITHM = Field<15, 11>;
+using NV_REG_STR_RM_NVLINK_TXTRAIN_CONTROL_MINIMUM_TRAIN_TIME_MANTISSA = Field<19, 16>;
+using NV_REG_STR_RM_NVLINK_TXTRAIN_CONTROL_MINIMUM_TRAIN_TIME_EXPONENT = Field<23, 20>;
+using NV_REG_STR_RM_NVLINK_MINION_CONTROL_ENABLE = Field<3, 0>;
+using NV_REG_STR_RM_NVLINK_MINION_CONTROL_PHY_CONFIG = Field<7, 4>;
+using NV_REG_STR_RM_NVLINK_MINION_CONTROL_DL_STATUS = Field<11, 8>;
+using NV_REG_STR_RM_NVLINK_MINION_CONTROL_INITNEGOTIATE = Field<15, 12>;
+using NV_REG_STR_RM_NVLINK_MINION_CONTROL_INITOPTIMIZE = Field<19, 16>;
+using NV_REG_STR_RM_NVLINK_MINION_CONTROL_CACHE_SEEDS = Field<23, 20>;
+using NV_REG_STR_RM_NVLINK_MINION_CONTROL_BOOT_CORE = Field<27, 24>;
+using NV_REG_STR_RM_NVLINK_MINION_CONTROL_ALI_TRAINING = Field<30, 28>;
+using NV_REG_STR_RM_NVLINK_MINION_CONTROL_GFW_BOOT = Field<31, 31>;
+using NV_REG_STR_RM_NVLINK_MINION_SIMMODE_CONTROL_MODE = Field<3, 0>;
+using NV_REG_STR_RM_NVLINK_MINION_SIMMODE_CONTROL_SHORT_ALARMS = Field<6, 4>;
+using NV_REG_STR_RM_NVLINK_MINION_SIMMODE_CONTROL_SHORT_ALARMS_RESERVED = Field<7, 7>;
+using NV_REG_STR_RM_NVLINK_MINION_SMF_SETTINGS_MODE = Field<3, 0>;
+using NV_REG_STR_RM_NVLINK_MINION_UPHY_TABLES_MODE = Field<1, 0>;
+using NV_REG_STR_RM_NVLINK_VERBOSE_MASK_CONTROL_REGINIT = Field<0, 0>;
+using NV_REG_STR_RM_NVLINK_SKIP_BUFFER_READY_TLC = Field<0, 0>;
+using NV_REG_STR_RM_NVLINK_SKIP_BUFFER_READY_MIF = Field<1, 1>;
+using NV_REG_STR_RM_NVLINK_SKIP_BUFFER_READY_RESERVED_0 = Field<31, 2>;
+using NV_REG_STR_RM_NVLINK_COUNTER_CONTROL_ENABLE = Field<0, 0>;
+using NV_REG_STR_RM_NVLINK_COUNTER_CONTROL_DUMP = Field<1, 1>;
+using NV_REG_STR_RM_NVLINK_COUNTER_CONTROL_RESERVED_0 = Field<3, 2>;
+using NV_REG_STR_RM_NVLINK_COUNTER_CONTROL_UNIT = Field<5, 4>;
+using NV_REG_STR_RM_NVLINK_COUNTER_CONTROL_RESERVED_1 = Field<7, 6>;
+using NV_REG_STR_RM_NVLINK_COUNTER_CONTROL_FLITFILTER = Field<15, 8>;
+using NV_REG_STR_RM_NVLINK_COUNTER_CONTROL_L1_FILTER_ENABLE = Field<16, 16>;
+using NV_REG_STR_RM_NVLINK_COUNTER_CONTROL_L1_FILTER = Field<19, 17>;
+using NV_REG_STR_RM_NVLINK_COUNTER_CONTROL_RESERVED_2 = Field<31, 20>;
+using NV_REG_STR_RM_NVLINK_LINK_PM_CONTROL_SINGLE_LANE_MODE = Field<1, 0>;
+using NV_REG_STR_RM_NVLINK_LINK_PM_CONTROL_PROD_WRITES = Field<3, 2>;
+using NV_REG_STR_RM_NVLINK_LINK_PM_CONTROL_L1_MODE = Field<5, 4>;
+using NV_REG_STR_RM_NVLINK_LINK_PM_CONTROL_L2_MODE = Field<7, 6>;
+using NV_REG_STR_RM_NVLINK_LINK_PM_CONTROL_RESERVED = Field<31, 8>;
+using NV_REG_STR_RM_NVLINK_SSG_CONTROL_BREAK_AFTER_UPHY_INIT = Field<0, 0>;
+using NV_REG_STR_RM_NVLINK_SSG_CONTROL_BREAK_AFTER_DLPL_INIT = Field<1, 1>;
+using NV_REG_STR_RM_PREEMPTION_TEST_OPTIONS_CONTROL = Field<1, 0>;
+using NV_REG_STR_RM_DP_AUXLOGGER_CONFIG_REDACTION = Field<0, 0>;
+using NV_REG_STR_RM_DP_AUXLOGGER_CONFIG_BUFFERSIZE = Field<31, 16>;
+using NV_REG_STR_RM_NVSR_FLICKER_CONTROL_PRE_FRAME_WEIGHT = Field<3, 0>;
+using NV_REG_STR_RM_NVSR_FLICKER_CONTROL_CUR_FRAME_WEIGHT = Field<7, 4>;
+using NV_REG_STR_RM_NVSR_FLICKER_CONTROL_THRESHOLD = Field<15, 8>;
+using NV_REG_STR_RM_NVSR_FLICKER_CONTROL_MAX_DELAY_TIME = Field<19, 16>;
+using NV_REG_STR_RM_NVSR_FLICKER_CONTROL_MIN_MARGIN_TIME = Field<23, 20>;
+using NV_REG_STR_ACPI_DSM_SHIM_REV_ID = Field<15, 0>;
+using NV_REG_STR_ACPI_DSM_SHIM_SUB_FUNC = Field<27, 16>;
+using NV_REG_STR_ACPI_DSM_SHIM_ENABLE = Field<28, 28>;
+using NV_REG_STR_RM_NONCONTIG_ALLOC_CONFIG_SET_DEFAULT = Field<1, 0>;
+using NV_REG_STR_RM_NONCONTIG_ALLOC_CONFIG_PAGE_SHUFFLE = Field<3, 2>;
+using NV_REG_STR_RM_GRID_LICENSED_FEATURES_QUADRO = Field<0, 0>;
+using NV_REG_STR_RM_GRID_LICENSED_FEATURES_VGPU = Field<1, 1>;
+using NV_REG_STR_RM_GRID_LICENSED_FEATURES_GEFORCE = Field<2, 2>;
+using NV_REG_STR_RM_GRID_LICENSED_FEATURES_COMPUTE = Field<3, 3>;
+using NV_REG_STR_RM_GRID_LICENSED_FEATURES_VGPU_BLOCKED = Field<4, 4>;
+using NV_REG_STR_RM_DISPLAY_OVERRIDE_ELV_START_VALUE = Field<31, 0>;
+using NV_REG_STR_RM_PVMRL_ENABLE = Field<0, 0>;
+using NV_REG_STR_RM_PVMRL_ARR_ENABLE = Field<1, 1>;
+using NV_REG_STR_RM_PVMRL_SCHED_POLICY = Field<7, 4>;
+using NV_REG_STR_RM_PVMRL_USE_SUBMIT_OFFSET = Field<8, 8>;
+using NV_REG_STR_RM_PVMRL_PREVENT_EXTRA_CONTEXT_SWITCH = Field<9, 9>;
+using NV_REG_STR_RM_PVMRL_FREQUENCY = Field<21, 12>;
+using NV_REG_STR_RM_PVMRL_TIMESLICE = Field<23, 16>;
+using NV_REG_STR_RM_PVMRL_AVERAGE_FACTOR = Field<31, 24>;
+using NV_REG_STR_RM_ENABLE_PHY_REPEATER_TRAIN = Field<0, 0>;
+using NV_REG_STR_RM_ENABLE_PHY_REPEATER_NO_CAP_PROBE = Field<1, 1>;
+using NV_REG_STR_RM_PEX_POWER_SAVINGS_ENGAGE = Field<0, 0>;
+using NV_REG_STR_RM_PEX_POWER_SAVINGS_LOWER_LIMIT_DIFF_PERCENTAGE = Field<7, 1>;
+using NV_REG_STR_RM_PEX_POWER_SAVINGS_UPPER_LIMIT_DIFF_PERCENTAGE = Field<14, 8>;
+using NV_REG_STR_RM_PEX_POWER_SAVINGS_LOWER_LIMIT_NEW_L1_RESIDENCY = Field<21, 15>;
+using NV_REG_STR_RM_PEX_POWER_SAVINGS_UPPER_LIMIT_NEW_L1_RESIDENCY = Field<28, 22>;
+using NV_REG_STR_RM_PROFILING_CHECK_BYPASS_ALLOWLIST = Field<0, 0>;
+using NV_REG_STR_RM_PROFILING_CHECK_BYPASS_RESERVATION = Field<1, 1>;
+using NV_REG_STR_RM_VMMU_SEGMENT_SIZE = Field<2, 0>;
+using NV_REG_STR_RM_DISABLE_DISPLAY_MUX_INTERNAL = Field<3, 0>;
+using NV_REG_STR_RM_DISABLE_DISPLAY_MUX_EXTERNAL = Field<7, 4>;
+using NV_REG_STR_RM_INTERNAL_DISP_MUX_OVERRIDES_TRIGGER_TCON_D0_VIA_I2C = Field<0, 0>;
+using NV_REG_STR_RM_INTERNAL_DISP_MUX_OVERRIDES_FORCE_DYNAMIC_MODE = Field<1, 1>;
+using NV_REG_STR_RM_INTERNAL_DISP_MUX_OVERRIDES_DISABLE_IGPU_PSR_SB = Field<2, 2>;
+using NV_REG_STR_RM_INTERNAL_DISP_MUX_OVERRIDES_ENABLE_FSM_UPDATE_ONLY_FOR_SWITCH = Field<3, 3>;
+using NV_REG_STR_RM_INTERNAL_DISP_MUX_OVERRIDES_ALWAYS_SKIP_EDP_POWERDOWN = Field<4, 4>;
+using NV_REG_STR_RM_INTERNAL_DISP_MUX_OVERRIDES_SKIP_SR_EXIT_RECOVERY = Field<5, 5>;
+using NV_REG_STR_RM_INTERNAL_DISP_MUX_OVERRIDES_EMULATE_TCON_IDX_VAL = Field<15, 8>;
+using NV_REG_STR_RM_INTERNAL_DISP_MUX_OVERRIDES_EMULATE_TCON_IDX_VALID = Field<16, 16>;
+using NV_REG_STR_RM_INTERNAL_DISP_MUX_OVERRIDES_FORCE_MUX_COMPLIANCE = Field<17, 17>;
+using NV_REG_STR_RM_INTERNAL_DISP_MUX_OVERRIDES_EMULATE_MUX_IDX_VALID = Field<18, 18>;
+using NV_REG_STR_RM_INTERNAL_DISP_MUX_OVERRIDES_EMULATE_MUX_IDX_VAL = Field<27, 20>;
+using NV_REG_STR_RM_BUG_3079507_WAR_ENABLE = Field<0, 0>;
+using NV_REG_STR_RM_BUG_3079507_WAR_DELAY_MS_VAL = Field<8, 1>;
+using NV_REG_STR_RM_BUG_3477023_WAR_MS_DELAY_VAL = Field<15, 0>;
+using NV_REG_STR_RM_DISP_MUX_AUX_SETTLE_DELAY_OVERRIDE_MS_VAL = Field<8, 0>;
+using NV_REG_STR_RM_EDP_BLEN_BY_AUX_ENABLE_USING_CALLBACK = Field<0, 0>;
+using NV_REG_STR_RM_EDP_BLEN_BY_AUX_ENABLE_USING_SOR_SEQ = Field<1, 1>;
+using NV_REG_STR_RM_MSCG_LOW_FPS_WAR_DISABLE = Field<0, 0>;
+using NV_REG_STR_RM_MSCG_LOW_FPS_WAR_DISABLE_INTR_ROUTING = Field<1, 1>;
+using NV_REG_STR_RM_VIDEO_EVENT_TRACE_STAGING_BUFFER_SIZE_IN_4k = Field<15, 0>;
+using NV_REG_STR_RM_VIDEO_EVENT_TRACE_EVENT_BUFFER_SIZE_IN_4k = Field<31, 16>;
+using NV_REG_STR_RM_BOOT_FROM_HS_ACR_AHESASC = Field<1, 0>;
+using NV_REG_STR_RM_BOOT_FROM_HS_ACR_ASB = Field<3, 2>;
+using NV_REG_STR_RM_BOOT_FROM_HS_ACR_UNLOAD = Field<5, 4>;
+using NV_REG_STR_RM_BOOT_FROM_HS_NVDEC_SCRUBBER = Field<7, 6>;
+using NV_REG_STR_RM_BOOT_FROM_HS_NVDEC = Field<9, 8>;
+using NV_REG_STR_RM_BOOT_FROM_HS_SEC2 = Field<11, 10>;
+using NV_REG_STR_RM_BOOT_FROM_HS_GSP = Field<13, 12>;
+using NV_REG_STR_RM_VOLT_DEV_POWER_UP_DELAY_US_VAL = Field<15, 0>;
+using NV_REG_STR_RM_VOLT_DEV_POWER_UP_DELAY_US_IDX = Field<23, 16>;
+using NV_REG_STR_RM_VOLT_DEV_POWER_UP_DELAY_US_RSVD = Field<31, 24>;
+using NV_REG_STR_RM_VOLT_DEV_POWER_DOWN_DELAY_US_VAL = Field<15, 0>;
+using NV_REG_STR_RM_VOLT_DEV_POWER_DOWN_DELAY_US_IDX = Field<23, 16>;
+using NV_REG_STR_RM_VOLT_DEV_POWER_DOWN_DELAY_US_RSVD = Field<31, 24>;
+using NV_REG_STR_RM_2779240_CLKREQ = Field<1, 0>;
+using NV_REG_STR_RM_2779240_DEEP_L1 = Field<3, 2>;
+using NV_REG_STR_RM_CONFIDENTIAL_COMPUTE_ENABLED = Field<0, 0>;
+using NV_REG_STR_RM_CONFIDENTIAL_COMPUTE_DEV_MODE_ENABLED = Field<1, 1>;
+using NV_REG_STR_RM_CONFIDENTIAL_COMPUTE_GPUS_READY_CHECK = Field<2, 2>;
+using NV_REG_STR_RM_CONF_COMPUTE_SPDM_POLICY_ENABLED = Field<0, 0>;
+using NV_REG_STR_RM_FBHUB_RELAXED_ORDERING_MODE_WRITES = Field<1, 0>;
+using NV_REG_STR_RM_FBHUB_RELAXED_ORDERING_MODE_READS = Field<3, 2>;
+using NV_REG_STR_RM_FBHUB_RELAXED_ORDERING_MODE_ATOMICS = Field<5, 4>;
+using NV_REG_STR_RM_FBHUB_RELAXED_ORDERING_MODE_DOWNSTREAM_WRITES = Field<7, 6>;
+using NV_REG_STR_RM_FBHUB_RELAXED_ORDERING_MODE_DOWNSTREAM_CPLS = Field<10, 8>;
+using NV_REG_STR_RM_ASSERT_ON_POSTED_REG_ACCESS_ERRORS_PMU = Field<0, 0>;
+using NV_REG_STR_RM_ASSERT_ON_POSTED_REG_ACCESS_ERRORS_I2C = Field<1, 1>;
+using NV_REG_STR_RM_ASSERT_ON_POSTED_REG_ACCESS_ERRORS_FBFALCON = Field<2, 2>;
+using NV_REG_STR_RM_ASSERT_ON_POSTED_REG_ACCESS_ERRORS_SEC2 = Field<3, 3>;
+using NV_REG_STR_RM_ASSERT_ON_POSTED_REG_ACCESS_ERRORS_GSP = Field<4, 4>;
+using NV_REG_STR_RM_ASSERT_ON_POSTED_REG_ACCESS_ERRORS_NVDEC = Field<5, 5>;
+} // namespace drf
+
+namespace fields {
+
+struct RmPmuPerfmonSampling {
+    static constexpr std::string_view name = "RmPmuPerfmonSampling";
+    struct ENABLE : Field<1, 0> {
+        static constexpr uint32_t DIS = 0x0;
+        static constexpr uint32_t EN = 0x1;
+        static constexpr uint32_t DEFAULT = 0x2;
+    };
+    struct VBLANK_COUNT : Field<15, 8> {
+        static constexpr uint32_t DEFAULT = 0x0;
+    };
+    struct TODECREASE_COUNT : Field<23, 16> {
+        static constexpr uint32_t DEFAULT = 0x0;
+    };
+    struct INERTIA_COUNT : Field<31, 24> {
+        static constexpr uint32_t DEFAULT = 0x0;
+    };
+    using layout = Layout<ENABLE, VBLANK_COUNT, TODECREASE_COUNT, INERTIA_COUNT>;
+};
+
+struct RmOptp {
+    static constexpr std::string_view name = "RmOptp";
+    struct ENABLE : Field<0, 0> {
+        static constexpr uint32_t DIS = 0x0;
+        static constexpr uint32_t EN = 0x1;
+    };
+    struct LOWER_MCLK : Field<1, 1> {
+        static constexpr uint32_t DIS = 0x0;
+        static constexpr uint32_t EN = 0x1;
+    };
+    struct DELAY_4MS : Field<15, 8> {
+        static constexpr uint32_t MIN = 0x9;
+        static constexpr uint32_t DEFAULT = 0x32;
+    };
+    struct TARGET_PERCENT_HIGH : Field<23, 16> {
+        static constexpr uint32_t MIN = 0xa;
+        static constexpr uint32_t DEFAULT = 0x64;
+    };
+    struct TARGET_PERCENT_LOW : Field<31, 24> {
+        static constexpr uint32_t DEFAULT = 0x5f;
+    };
+    using layout = Layout<ENABLE, LOWER_MCLK, DELAY_4MS, TARGET_PERCENT_HIGH, TARGET_PERCENT_LOW>;
+};
+
+struct RmOptp2LowerMclk {
+    static constexpr std::string_view name = "RmOptp2LowerMclk";
+    struct DENOM : Field<7, 0> {
+        static constexpr uint32_t DIS = 0x0;
+    };
+    struct NUM : Field<15, 8> {};
+    struct AC : Field<16, 16> {
+        static constexpr uint32_t DISABLE = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+    };
+    using layout = Layout<DENOM, NUM, AC>;
+};
+
+struct RmPstate20 {
+    static constexpr std::string_view name = "RmPstate20";
+    struct DECOUPLED_DOMAINS : Field<1, 1> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+    };
+    using layout = Layout<DECOUPLED_DOMAINS>;
+};
+
+struct PStateTime {
+    static constexpr std::string_view name = "PStateTime";
+    struct INTERVAL_MS : Field<15, 0> {
+        static constexpr uint32_t DEFAULT = 0x3e8;
+    };
+    struct LOWERING : Field<23, 16> {
+        static constexpr uint32_t DEFAULT = 0xf;
+    };
+    struct BOOST : Field<31, 24> {
+        static constexpr uint32_t DEFAULT = 0x1e;
+    };
+    using layout = Layout<INTERVAL_MS, LOWERING, BOOST>;
+};
+
+struct AslmCfg {
+    static constexpr std::string_view name = "AslmCfg";
+    struct NV_LINK_UPGRADE : Field<1, 0> {
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t YES = 0x1;
+        static constexpr uint32_t DEFAULT = 0x2;
+    };
+    struct HOT_RESET : Field<5, 4> {
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t YES = 0x1;
+        static constexpr uint32_t DEFAULT = 0x2;
+    };
+    struct FAST_UPGRADE : Field<9, 8> {
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t YES = 0x1;
+        static constexpr uint32_t DEFAULT = 0x2;
+    };
+    struct GEN2_LINK_UPGRADE : Field<11, 10> {
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t YES = 0x1;
+        static constexpr uint32_t DEFAULT = 0x2;
+    };
+    using layout = Layout<NV_LINK_UPGRADE, HOT_RESET, FAST_UPGRADE, GEN2_LINK_UPGRADE>;
+};
+
+struct ForceP2P {
+    static constexpr std::string_view name = "ForceP2P";
+    struct READ : Field<1, 0> {
+        static constexpr uint32_t DISABLE = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DEFAULT = 0x2;
+    };
+    struct WRITE : Field<5, 4> {
+        static constexpr uint32_t DISABLE = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DEFAULT = 0x2;
+    };
+    using layout = Layout<READ, WRITE>;
+};
+
+struct RmPmgrPwrPolicyOverride {
+    static constexpr std::string_view name = "RmPmgrPwrPolicyOverride";
+    struct DISABLE : Field<0, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLED = 0x1;
+    };
+    struct LIMITS : Field<1, 1> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t UNLIMITED = 0x1;
+    };
+    struct RATED_LIMIT : Field<2, 2> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t MAXIMUM = 0x1;
+    };
+    struct INTEGRAL_CONTROL : Field<3, 3> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+    };
+    struct MIN_CLIENT_SAMPLE_PERIOD : Field<19, 4> {};
+    using layout = Layout<DISABLE, LIMITS, RATED_LIMIT, INTEGRAL_CONTROL, MIN_CLIENT_SAMPLE_PERIOD>;
+};
+
+struct RmPmgrPwrDeviceBa00Override {
+    static constexpr std::string_view name = "RmPmgrPwrDeviceBa00Override";
+    struct HIGH_POWER_FIT_ONLY : Field<0, 0> {
+        static constexpr uint32_t DISABLE = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+    };
+    using layout = Layout<HIGH_POWER_FIT_ONLY>;
+};
+
+struct RmPmgrPmuOverride {
+    static constexpr std::string_view name = "RmPmgrPmuOverride";
+    struct DISABLE : Field<0, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLED = 0x1;
+    };
+    using layout = Layout<DISABLE>;
+};
+
+struct RmPmgrIsenseVcmOffsetOverride {
+    static constexpr std::string_view name = "RmPmgrIsenseVcmOffsetOverride";
+    struct VALUE : Field<6, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+    };
+    struct RSVD : Field<31, 8> {};
+    using layout = Layout<VALUE, RSVD>;
+};
+
+struct RmPmgrIsenseDiffGainOverride {
+    static constexpr std::string_view name = "RmPmgrIsenseDiffGainOverride";
+    struct VALUE : Field<4, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+    };
+    struct RSVD : Field<31, 5> {};
+    using layout = Layout<VALUE, RSVD>;
+};
+
+struct RmPmgrIsenseDiffOffsetOverride {
+    static constexpr std::string_view name = "RmPmgrIsenseDiffOffsetOverride";
+    struct VALUE : Field<8, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+    };
+    struct RSVD : Field<31, 9> {};
+    using layout = Layout<VALUE, RSVD>;
+};
+
+struct RmPmgrIsenseVcmCoarseOffsetOverride {
+    static constexpr std::string_view name = "RmPmgrIsenseVcmCoarseOffsetOverride";
+    struct VALUE : Field<3, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+    };
+    struct RSVD : Field<31, 4> {};
+    using layout = Layout<VALUE, RSVD>;
+};
+
+struct RmPmgrIsenseDiffCoarseGainOverride {
+    static constexpr std::string_view name = "RmPmgrIsenseDiffCoarseGainOverride";
+    struct VALUE : Field<1, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+    };
+    struct RSVD : Field<31, 3> {};
+    using layout = Layout<VALUE, RSVD>;
+};
+
+struct RmPerfOverride {
+    static constexpr std::string_view name = "RmPerfOverride";
+    struct SKIP_RESTORE_BOOT_STATE_ON_UNLOAD : Field<0, 0> {
+        static constexpr uint32_t DISABLE = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+    };
+    struct RSVD : Field<31, 1> {};
+    using layout = Layout<SKIP_RESTORE_BOOT_STATE_ON_UNLOAD, RSVD>;
+};
+
+struct RmPerfCfOverride {
+    static constexpr std::string_view name = "RmPerfCfOverride";
+    struct LOAD : Field<0, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+    };
+    struct TRRD_WAR : Field<2, 1> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DISABLE = 0x2;
+    };
+    struct RSVD : Field<31, 3> {};
+    using layout = Layout<LOAD, TRRD_WAR, RSVD>;
+};
+
+struct RmPerfCfPolicyOverrides {
+    static constexpr std::string_view name = "RmPerfCfPolicyOverrides";
+    struct DLPPC_1X : Field<0, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+    };
+    struct GSP_UTIL : Field<2, 1> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x2;
+    };
+    using layout = Layout<DLPPC_1X, GSP_UTIL>;
+};
+
+struct RmClkControllersOverride {
+    static constexpr std::string_view name = "RmClkControllersOverride";
+    struct CLFC : Field<0, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+    };
+    struct CLVC : Field<1, 1> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+    };
+    struct RSVD : Field<31, 2> {};
+    using layout = Layout<CLFC, CLVC, RSVD>;
+};
+
+struct RmPerfChangeSeqOverride {
+    static constexpr std::string_view name = "RmPerfChangeSeqOverride";
+    struct LOCK : Field<0, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t SET = 0x1;
+    };
+    struct SKIP_VOLT_RANGE_TRIM : Field<1, 1> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t SET = 0x1;
+    };
+    struct RSVD : Field<31, 2> {};
+    using layout = Layout<LOCK, SKIP_VOLT_RANGE_TRIM, RSVD>;
+};
+
+struct RmPerfLimitsOverride {
+    static constexpr std::string_view name = "RmPerfLimitsOverride";
+    struct LOCK : Field<1, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t FALSE = 0x1;
+        static constexpr uint32_t TRUE = 0x2;
+    };
+    struct CACHING_ENABLE : Field<3, 2> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLED = 0x1;
+        static constexpr uint32_t ENABLED = 0x2;
+    };
+    struct ARBITRATE_AND_APPLY_WORKITEM : Field<5, 4> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLED = 0x1;
+        static constexpr uint32_t ENABLED = 0x2;
+    };
+    struct RSVD : Field<31, 6> {};
+    using layout = Layout<LOCK, CACHING_ENABLE, ARBITRATE_AND_APPLY_WORKITEM, RSVD>;
+};
+
+struct RMClkSwitchWithinMargin {
+    static constexpr std::string_view name = "RMClkSwitchWithinMargin";
+    struct MCLK : Field<4, 4> {
+        static constexpr uint32_t SKIP = 0x0;
+        static constexpr uint32_t FORCE = 0x1;
+        static constexpr uint32_t DEFAULT = 0x0;
+    };
+    using layout = Layout<MCLK>;
+};
+
+struct RMBrightnessControlFlags {
+    static constexpr std::string_view name = "RMBrightnessControlFlags";
+    struct UNUSED : Field<7, 0> {};
+    struct VBIOSRW : Field<9, 8> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DISABLE = 0x2;
+    };
+    struct DXGKIFACE : Field<11, 10> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DISABLE = 0x2;
+    };
+    struct LEVELS : Field<13, 12> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t NVIF = 0x1;
+        static constexpr uint32_t BCL = 0x2;
+    };
+    struct PBI : Field<15, 14> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DISABLE = 0x2;
+    };
+    struct FORCE : Field<17, 16> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t RM = 0x1;
+        static constexpr uint32_t PMU = 0x2;
+    };
+    using layout = Layout<UNUSED, VBIOSRW, DXGKIFACE, LEVELS, PBI, FORCE>;
+};
+
+struct RMExtPerfControl {
+    static constexpr std::string_view name = "RMExtPerfControl";
+    struct LEVEL : Field<5, 0> {};
+    struct CAP : Field<7, 6> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t FORCE_SMOOTH = 0x1;
+        static constexpr uint32_t FORCE_MAY_GLITCH = 0x2;
+        static constexpr uint32_t DEF_2 = 0x3;
+    };
+    struct POWER : Field<15, 8> {};
+    struct DEBOUNCE_PERIOD_MS : Field<23, 16> {};
+    struct SLI_LEVEL : Field<31, 24> {};
+    using layout = Layout<LEVEL, CAP, POWER, DEBOUNCE_PERIOD_MS, SLI_LEVEL>;
+};
+
+struct RMBar2SysmemEnable {
+    static constexpr std::string_view name = "RMBar2SysmemEnable";
+    struct ENABLE : Field<1, 0> {
+        static constexpr uint32_t FALSE = 0x0;
+        static constexpr uint32_t TRUE = 0x1;
+    };
+    using layout = Layout<ENABLE>;
+};
+
+struct RMInstVPR {
+    static constexpr std::string_view name = "RMInstVPR";
+    struct INSTBLK : Field<0, 0> {
+        static constexpr uint32_t FALSE = 0x0;
+        static constexpr uint32_t TRUE = 0x1;
+    };
+    struct RAMFC : Field<1, 1> {
+        static constexpr uint32_t FALSE = 0x0;
+        static constexpr uint32_t TRUE = 0x1;
+    };
+    struct RUNLIST : Field<2, 2> {
+        static constexpr uint32_t FALSE = 0x0;
+        static constexpr uint32_t TRUE = 0x1;
+    };
+    struct MMU_READ : Field<3, 3> {
+        static constexpr uint32_t FALSE = 0x0;
+        static constexpr uint32_t TRUE = 0x1;
+    };
+    struct MMU_WRITE : Field<4, 4> {
+        static constexpr uint32_t FALSE = 0x0;
+        static constexpr uint32_t TRUE = 0x1;
+    };
+    using layout = Layout<INSTBLK, RAMFC, RUNLIST, MMU_READ, MMU_WRITE>;
+};
+
+struct RMBandwidthFeature {
+    static constexpr std::string_view name = "RMBandwidthFeature";
+    struct DEPRECATED_0 : Field<1, 0> {};
+    struct ISO_CRIT_ALWAYS : Field<3, 2> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct SCALER_AMORTIZATION : Field<5, 4> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct DEPRECATED_2 : Field<7, 6> {};
+    struct DEPRECATED_3 : Field<9, 8> {};
+    struct ASR : Field<11, 10> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct DEPRECATED_4 : Field<13, 12> {};
+    struct DYNAMIC_MEMPOOL : Field<15, 14> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct DEPRECATED_5 : Field<17, 16> {};
+    struct IMP : Field<19, 18> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct RESERVED : Field<21, 20> {};
+    struct DEPRECATED_6 : Field<23, 22> {};
+    struct DYNAMIC_DISP_CLK : Field<25, 24> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct DEPRECATED_7 : Field<27, 26> {};
+    struct LINE_BUFFERING : Field<29, 28> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct FORCE_MIN_MEMPOOL : Field<31, 30> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    using layout = Layout<DEPRECATED_0, ISO_CRIT_ALWAYS, SCALER_AMORTIZATION, DEPRECATED_2, DEPRECATED_3, ASR, DEPRECATED_4, DYNAMIC_MEMPOOL, DEPRECATED_5, IMP, RESERVED, DEPRECATED_6, DYNAMIC_DISP_CLK, DEPRECATED_7, LINE_BUFFERING, FORCE_MIN_MEMPOOL>;
+};
+
+struct RMBandwidthFeature2 {
+    static constexpr std::string_view name = "RMBandwidthFeature2";
+    struct MEMPOOL_COMPRESSION : Field<1, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct ADVANCED_FETCH_METERING : Field<3, 2> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    using layout = Layout<MEMPOOL_COMPRESSION, ADVANCED_FETCH_METERING>;
+};
+
+struct RMPowerFeature {
+    static constexpr std::string_view name = "RMPowerFeature";
+    struct SOFTWARE_SLOWDOWN : Field<1, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+    };
+    struct PEAK_POWER_SLOWDOWN : Field<3, 2> {};
+    struct ELCG : Field<5, 4> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t PER_ENG = 0x2;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct ELPG : Field<7, 6> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t PER_ENG = 0x2;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct PCIE_DEEP_L1 : Field<9, 8> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct PCIE_CLKREQ : Field<11, 10> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct DEEP_IDLE : Field<13, 12> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct FB_ACPD : Field<15, 14> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct DUAL_PIXEL : Field<17, 16> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct BLCG2 : Field<21, 18> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t PER_ENG = 0x2;
+        static constexpr uint32_t ENABLE = 0x3;
+        static constexpr uint32_t IDLE = 0x4;
+        static constexpr uint32_t STALL = 0x8;
+        static constexpr uint32_t QUIESCENT = 0xc;
+    };
+    struct ADAPTIVE_POWER : Field<23, 22> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t MONITOR = 0x2;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct _DEPRECATED : Field<25, 24> {};
+    struct PWR_RAIL_GATE : Field<27, 26> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct PWR_RAIL_GATE_PREDICTIVE : Field<29, 28> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct FSPG : Field<31, 30> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t PER_ENG = 0x2;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    using layout = Layout<SOFTWARE_SLOWDOWN, PEAK_POWER_SLOWDOWN, ELCG, ELPG, PCIE_DEEP_L1, PCIE_CLKREQ, DEEP_IDLE, FB_ACPD, DUAL_PIXEL, BLCG2, ADAPTIVE_POWER, _DEPRECATED, PWR_RAIL_GATE, PWR_RAIL_GATE_PREDICTIVE, FSPG>;
+};
+
+struct RMPowerFeature2 {
+    static constexpr std::string_view name = "RMPowerFeature2";
+    struct FLCG : Field<1, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t PER_ENG = 0x2;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct MSCG_SETTINGS_OWNER : Field<3, 2> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t RM = 0x1;
+        static constexpr uint32_t PMU = 0x2;
+    };
+    struct OPERATION_MODE : Field<5, 4> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t PER_MODE = 0x2;
+    };
+    struct SLCG : Field<7, 6> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t PER_ENG = 0x2;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct CLK_NDIV_SLIDING : Field<9, 8> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t PER_DOMAIN = 0x2;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct NVVDD_PSI : Field<11, 10> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct GC6_ROMLESS : Field<13, 12> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct GC6_ROM : Field<15, 14> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct DIDLE_SSC : Field<17, 16> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct DIDLE_OS : Field<19, 18> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct PCIE_L1_SUBSTATES : Field<21, 20> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct LPWR_ONESHOT : Field<23, 22> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct RPPG : Field<25, 24> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct IST_CG : Field<27, 26> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    using layout = Layout<FLCG, MSCG_SETTINGS_OWNER, OPERATION_MODE, SLCG, CLK_NDIV_SLIDING, NVVDD_PSI, GC6_ROMLESS, GC6_ROM, DIDLE_SSC, DIDLE_OS, PCIE_L1_SUBSTATES, LPWR_ONESHOT, RPPG, IST_CG>;
+};
+
+struct RMLpwrArch {
+    static constexpr std::string_view name = "RMLpwrArch";
+    struct LPWR_ENG : Field<1, 0> {
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t RESERVED = 0x3;
+    };
+    struct IDLE_SNAP_DBG : Field<3, 2> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t RESERVED = 0x3;
+    };
+    struct PPU_THRESHOLD : Field<5, 4> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t NEVER = 0x1;
+        static constexpr uint32_t ALWAYS = 0x3;
+    };
+    struct LPWR_CTRL_HW_DISABLE : Field<7, 6> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct API_OPTIMIZATION : Field<9, 8> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct EXT_API_OPTIMIZATION : Field<11, 10> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct EI_COUPLED_GR_RG : Field<13, 12> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct REG_FILTER_PSTATE_CONTROL : Field<15, 14> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct GR_COUPLED_DFPR : Field<17, 16> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct DFPR_COUPLED_DIFR_SW_ASR : Field<19, 18> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    using layout = Layout<LPWR_ENG, IDLE_SNAP_DBG, PPU_THRESHOLD, LPWR_CTRL_HW_DISABLE, API_OPTIMIZATION, EXT_API_OPTIMIZATION, EI_COUPLED_GR_RG, REG_FILTER_PSTATE_CONTROL, GR_COUPLED_DFPR, DFPR_COUPLED_DIFR_SW_ASR>;
+};
+
+struct RMLpwrEiClient {
+    static constexpr std::string_view name = "RMLpwrEiClient";
+    struct RM : Field<1, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct PMU_LPWR : Field<3, 2> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    using layout = Layout<RM, PMU_LPWR>;
+};
+
+struct RMJTPowerControl {
+    static constexpr std::string_view name = "RMJTPowerControl";
+    struct PRGX : Field<9, 8> {
+        static constexpr uint32_t EBPG = 0x0;
+        static constexpr uint32_t EBPC = 0x1;
+        static constexpr uint32_t EAGP = 0x2;
+        static constexpr uint32_t EAPG = 0x3;
+    };
+    struct PRGE : Field<11, 10> {
+        static constexpr uint32_t DAGC = 0x0;
+        static constexpr uint32_t DBGC = 0x1;
+        static constexpr uint32_t DAGP = 0x2;
+        static constexpr uint32_t DBGS = 0x3;
+    };
+    using layout = Layout<PRGX, PRGE>;
+};
+
+struct RMJTVerifCaps {
+    static constexpr std::string_view name = "RMJTVerifCaps";
+    struct JT_ENABLED : Field<0, 0> {
+        static constexpr uint32_t FALSE = 0x0;
+        static constexpr uint32_t TRUE = 0x1;
+    };
+    struct NVSR_ENABLED : Field<2, 1> {
+        static constexpr uint32_t TRUE = 0x0;
+        static constexpr uint32_t FALSE = 0x1;
+    };
+    struct REVISION_ID : Field<31, 20> {};
+    using layout = Layout<JT_ENABLED, NVSR_ENABLED, REVISION_ID>;
+};
+
+struct RMCoprocrefCount {
+    static constexpr std::string_view name = "RMCoprocrefCount";
+    struct STYLE : Field<0, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DIRECT = 0x0;
+        static constexpr uint32_t WORKERTHREAD = 0x1;
+    };
+    using layout = Layout<STYLE>;
+};
+
+struct RMGC6Stats {
+    static constexpr std::string_view name = "RMGC6Stats";
+    struct ENABLED : Field<0, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t YES = 0x1;
+    };
+    using layout = Layout<ENABLED>;
+};
+
+struct RMGC6Feature {
+    static constexpr std::string_view name = "RMGC6Feature";
+    struct FAKE_I2CS : Field<1, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLED = 0x1;
+        static constexpr uint32_t DISABLED = 0x2;
+        static constexpr uint32_t UNUSED = 0x3;
+    };
+    struct PMU_CFG_SPACE_RESTORE : Field<3, 2> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLED = 0x1;
+        static constexpr uint32_t DISABLED = 0x2;
+        static constexpr uint32_t UNUSED = 0x3;
+    };
+    struct EXIT_BOOT_VOLTAGE : Field<5, 4> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLED = 0x1;
+        static constexpr uint32_t DISABLED = 0x2;
+        static constexpr uint32_t UNUSED = 0x3;
+    };
+    struct D3HOT_WAR : Field<7, 6> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLED = 0x1;
+        static constexpr uint32_t DISABLED = 0x2;
+        static constexpr uint32_t AND_SKIP_POWER_CHECK = 0x3;
+    };
+    struct SKIP_COMPACTION_NORESET : Field<9, 8> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLED = 0x1;
+        static constexpr uint32_t DISABLED = 0x2;
+        static constexpr uint32_t UNUSED = 0x3;
+    };
+    struct FBSR_PMU_ENTRY : Field<11, 10> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLED = 0x2;
+        static constexpr uint32_t UNUSED = 0x3;
+    };
+    struct RTD3_SUPPORT : Field<13, 12> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLED = 0x1;
+        static constexpr uint32_t DISABLED = 0x2;
+        static constexpr uint32_t UNUSED = 0x3;
+    };
+    struct FAST_GC6_SUPPORT : Field<15, 14> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLED = 0x2;
+        static constexpr uint32_t UNUSED = 0x3;
+    };
+    struct SUPPORT_HDA_OSPM_D3 : Field<17, 16> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLED = 0x1;
+        static constexpr uint32_t DISABLED = 0x2;
+        static constexpr uint32_t UNUSED = 0x3;
+    };
+    struct IFR_DRIVEN_PATH : Field<19, 18> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLED = 0x1;
+        static constexpr uint32_t DISABLED = 0x2;
+        static constexpr uint32_t UNUSED = 0x3;
+    };
+    struct PCIE_LINK_STATE_CHECK : Field<21, 20> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t LINKL2 = 0x1;
+        static constexpr uint32_t LINKDISABLE = 0x2;
+        static constexpr uint32_t UNUSED = 0x3;
+    };
+    using layout = Layout<FAKE_I2CS, PMU_CFG_SPACE_RESTORE, EXIT_BOOT_VOLTAGE, D3HOT_WAR, SKIP_COMPACTION_NORESET, FBSR_PMU_ENTRY, RTD3_SUPPORT, FAST_GC6_SUPPORT, SUPPORT_HDA_OSPM_D3, IFR_DRIVEN_PATH, PCIE_LINK_STATE_CHECK>;
+};
+
+struct RMGCOffFeature {
+    static constexpr std::string_view name = "RMGCOffFeature";
+    struct P0_BOOST : Field<1, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLED = 0x1;
+        static constexpr uint32_t ENABLED = 0x2;
+        static constexpr uint32_t UNUSED = 0x3;
+    };
+    using layout = Layout<P0_BOOST>;
+};
+
+struct RMForceRtd3D3Hot {
+    static constexpr std::string_view name = "RMForceRtd3D3Hot";
+    struct ENTRY : Field<1, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLED = 0x1;
+        static constexpr uint32_t DISABLED = 0x2;
+        static constexpr uint32_t UNUSED = 0x3;
+    };
+    using layout = Layout<ENTRY>;
+};
+
+struct RMGC6Parameters {
+    static constexpr std::string_view name = "RMGC6Parameters";
+    struct SLEEP_AWARE_CALLBACK : Field<1, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLED = 0x1;
+        static constexpr uint32_t ENABLED = 0x3;
+    };
+    struct DEFERRED_PMU_CALLBACK : Field<3, 2> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLED = 0x1;
+        static constexpr uint32_t ENABLED = 0x3;
+    };
+    struct PMU_HANDLE_MODESET : Field<5, 4> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLED = 0x1;
+        static constexpr uint32_t ENABLED = 0x3;
+    };
+    struct BSOD_MODESET : Field<7, 6> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLED = 0x1;
+        static constexpr uint32_t ENABLED = 0x3;
+    };
+    using layout = Layout<SLEEP_AWARE_CALLBACK, DEFERRED_PMU_CALLBACK, PMU_HANDLE_MODESET, BSOD_MODESET>;
+};
+
+struct RMDidleFeatureGC5 {
+    static constexpr std::string_view name = "RMDidleFeatureGC5";
+    struct XTAL4XPLL : Field<1, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DISABLE = 0x2;
+        static constexpr uint32_t UNUSED = 0x3;
+    };
+    struct THERM_SENSOR : Field<3, 2> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DISABLE = 0x2;
+        static constexpr uint32_t UNUSED = 0x3;
+    };
+    struct OSM_CLKS : Field<5, 4> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DISABLE = 0x2;
+        static constexpr uint32_t UNUSED = 0x3;
+    };
+    struct DISP_PLLS : Field<7, 6> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DISABLE = 0x2;
+        static constexpr uint32_t UNUSED = 0x3;
+    };
+    struct DFE_VAL : Field<9, 8> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DISABLE = 0x2;
+        static constexpr uint32_t UNUSED = 0x3;
+    };
+    struct GPU_READY : Field<11, 10> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DISABLE = 0x2;
+        static constexpr uint32_t UNUSED = 0x3;
+    };
+    struct RSVD : Field<13, 12> {};
+    struct RPPG : Field<15, 14> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DISABLE = 0x2;
+        static constexpr uint32_t UNUSED = 0x3;
+    };
+    struct NO_PSTATE_SUPPORT : Field<17, 16> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DISABLE = 0x2;
+        static constexpr uint32_t UNUSED = 0x3;
+    };
+    struct PLL_IDDQ : Field<19, 18> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DISABLE = 0x2;
+        static constexpr uint32_t UNUSED = 0x3;
+    };
+    struct VOLTAGE_UPDATE : Field<21, 20> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DISABLE = 0x2;
+        static constexpr uint32_t UNUSED = 0x3;
+    };
+    struct ALT_MUX_SEL : Field<23, 22> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DISABLE = 0x2;
+        static constexpr uint32_t UNUSED = 0x3;
+    };
+    struct XTAL_GATE : Field<25, 24> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DISABLE = 0x2;
+        static constexpr uint32_t UNUSED = 0x3;
+    };
+    using layout = Layout<XTAL4XPLL, THERM_SENSOR, OSM_CLKS, DISP_PLLS, DFE_VAL, GPU_READY, RSVD, RPPG, NO_PSTATE_SUPPORT, PLL_IDDQ, VOLTAGE_UPDATE, ALT_MUX_SEL, XTAL_GATE>;
+};
+
+struct RMDiWakeupTimer {
+    static constexpr std::string_view name = "RMDiWakeupTimer";
+    struct TIME : Field<29, 0> {};
+    struct MODE : Field<31, 30> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t AUTO = 0x0;
+        static constexpr uint32_t FORCE = 0x1;
+        static constexpr uint32_t DISABLED = 0x2;
+    };
+    using layout = Layout<TIME, MODE>;
+};
+
+struct RMD3Feature {
+    static constexpr std::string_view name = "RMD3Feature";
+    struct DRIVER_CFG_SPACE_RESTORE : Field<1, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLED = 0x1;
+        static constexpr uint32_t DISABLED = 0x2;
+        static constexpr uint32_t UNUSED = 0x3;
+    };
+    using layout = Layout<DRIVER_CFG_SPACE_RESTORE>;
+};
+
+struct RMGpuOperationMode {
+    static constexpr std::string_view name = "RMGpuOperationMode";
+    struct COMPUTE : Field<0, 0> {
+        static constexpr uint32_t DISABLE = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+    };
+    struct TEX : Field<1, 1> {
+        static constexpr uint32_t DISABLE = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+    };
+    struct DFMA : Field<2, 2> {
+        static constexpr uint32_t DISABLE = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+    };
+    using layout = Layout<COMPUTE, TEX, DFMA>;
+};
+
+struct RMElcg {
+    static constexpr std::string_view name = "RMElcg";
+    struct GR : Field<1, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLED = 0x1;
+    };
+    struct PPP : Field<3, 2> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLED = 0x1;
+    };
+    struct MPEG : Field<3, 2> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLED = 0x1;
+    };
+    struct CE0 : Field<5, 4> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLED = 0x1;
+    };
+    struct PDEC : Field<7, 6> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLED = 0x1;
+    };
+    struct SEC : Field<9, 8> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLED = 0x1;
+    };
+    struct VIC : Field<9, 8> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLED = 0x1;
+    };
+    struct VLD : Field<11, 10> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLED = 0x1;
+    };
+    struct CE1 : Field<13, 12> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLED = 0x1;
+    };
+    struct DISP : Field<15, 14> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLED = 0x1;
+    };
+    struct CE2 : Field<17, 16> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLED = 0x1;
+    };
+    struct SEC2 : Field<19, 18> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLED = 0x1;
+    };
+    struct MSENC : Field<21, 20> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLED = 0x1;
+    };
+    struct MSENC1 : Field<23, 22> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLED = 0x1;
+    };
+    struct CE3 : Field<25, 24> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLED = 0x1;
+    };
+    struct CE4 : Field<27, 26> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLED = 0x1;
+    };
+    struct CE5 : Field<29, 28> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLED = 0x1;
+    };
+    struct MSENC2 : Field<31, 30> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLED = 0x1;
+    };
+    // MPEG overlaps PPP, not in layout
+    // VIC overlaps SEC, not in layout
+    using layout = Layout<GR, PPP, CE0, PDEC, SEC, VLD, CE1, DISP, CE2, SEC2, MSENC, MSENC1, CE3, CE4, CE5, MSENC2>;
+};
+
+struct RMBlcg {
+    static constexpr std::string_view name = "RMBlcg";
+    struct GR : Field<3, 0> {};
+    struct PPP : Field<7, 4> {};
+    struct FB : Field<11, 8> {};
+    struct FBPA : Field<11, 8> {};
+    struct LTCG : Field<11, 8> {};
+    struct XBAR : Field<11, 8> {};
+    struct PDEC : Field<15, 12> {};
+    struct VLD : Field<19, 16> {};
+    struct XVE : Field<23, 20> {};
+    struct CE : Field<27, 24> {};
+    struct MISC : Field<31, 28> {};
+    // FBPA overlaps FB, not in layout
+    // LTCG overlaps FB, not in layout
+    // XBAR overlaps FB, not in layout
+    using layout = Layout<GR, PPP, FB, PDEC, VLD, XVE, CE, MISC>;
+};
+
+struct RMElpg {
+    static constexpr std::string_view name = "RMElpg";
+    struct GR : Field<0, 0> {};
+    struct PDEC : Field<1, 1> {};
+    struct GR_RG : Field<2, 2> {};
+    struct DO_NOT_USE : Field<3, 3> {};
+    struct MS : Field<4, 4> {};
+    struct EI : Field<5, 5> {};
+    struct MS_LTC : Field<6, 6> {};
+    struct MS_PASSIVE : Field<7, 7> {};
+    struct EI_PASSIVE : Field<8, 8> {};
+    struct DFPR : Field<9, 9> {};
+    struct MS_DIFR_SW_ASR : Field<10, 10> {};
+    struct MS_DIFR_CG : Field<11, 11> {};
+    using layout = Layout<GR, PDEC, GR_RG, DO_NOT_USE, MS, EI, MS_LTC, MS_PASSIVE, EI_PASSIVE, DFPR, MS_DIFR_SW_ASR, MS_DIFR_CG>;
+};
+
+struct RMAdaptivePwrDebug {
+    static constexpr std::string_view name = "RMAdaptivePwrDebug";
+    struct GR : Field<0, 0> {};
+    struct GC5 : Field<1, 1> {};
+    using layout = Layout<GR, GC5>;
+};
+
+struct RMSlcg {
+    static constexpr std::string_view name = "RMSlcg";
+    struct GR : Field<0, 0> {};
+    struct CE0 : Field<1, 1> {};
+    struct CE1 : Field<2, 2> {};
+    struct CE2 : Field<3, 3> {};
+    struct PMU : Field<4, 4> {};
+    struct FB : Field<5, 5> {};
+    struct FBPA : Field<5, 5> {};
+    struct LTCG : Field<5, 5> {};
+    struct XBAR : Field<5, 5> {};
+    struct ACB : Field<6, 6> {};
+    struct PERF : Field<7, 7> {};
+    struct FIFO : Field<8, 8> {};
+    struct CHIPLETS : Field<9, 9> {};
+    struct BUS : Field<10, 10> {};
+    struct THERM : Field<11, 11> {};
+    struct SEC2 : Field<12, 12> {};
+    struct NVDEC : Field<13, 13> {};
+    struct MSPDEC : Field<13, 13> {};
+    struct NVENC : Field<14, 14> {};
+    struct MSENC : Field<14, 14> {};
+    struct NVJPG : Field<15, 15> {};
+    struct GSP : Field<16, 16> {};
+    struct OFA : Field<17, 17> {};
+    // FBPA overlaps FB, not in layout
+    // LTCG overlaps FB, not in layout
+    // XBAR overlaps FB, not in layout
+    // MSPDEC overlaps NVDEC, not in layout
+    // MSENC overlaps NVENC, not in layout
+    using layout = Layout<GR, CE0, CE1, CE2, PMU, FB, ACB, PERF, FIFO, CHIPLETS, BUS, THERM, SEC2, NVDEC, NVENC, NVJPG, GSP, OFA>;
+};
+
+struct RMClkSlowDown {
+    static constexpr std::string_view name = "RMClkSlowDown";
+    struct THERMAL__RESERVED : Field<17, 0> {};
+    struct _DEPRECATED : Field<19, 18> {};
+    struct NV : Field<23, 22> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct HOST : Field<25, 24> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct IDLE_PSTATE : Field<27, 26> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    using layout = Layout<THERMAL__RESERVED, _DEPRECATED, NV, HOST, IDLE_PSTATE>;
+};
+
+struct RMFspg {
+    static constexpr std::string_view name = "RMFspg";
+    struct GRAPHICS : Field<0, 0> {
+        static constexpr uint32_t ENABLE = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+    };
+    struct VIDEO : Field<1, 1> {
+        static constexpr uint32_t ENABLE = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+    };
+    struct VIC : Field<2, 2> {
+        static constexpr uint32_t ENABLE = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+    };
+    struct FB : Field<3, 3> {
+        static constexpr uint32_t ENABLE = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+    };
+    using layout = Layout<GRAPHICS, VIDEO, VIC, FB>;
+};
+
+struct RmDisableRegistryCaching {
+    static constexpr std::string_view name = "RmDisableRegistryCaching";
+    struct NVIF : Field<0, 0> {
+        static constexpr uint32_t ENABLE = 0x1;
+    };
+    struct EXTDEVICE : Field<1, 1> {
+        static constexpr uint32_t ENABLE = 0x1;
+    };
+    struct THERMAL : Field<2, 2> {
+        static constexpr uint32_t ENABLE = 0x1;
+    };
+    struct I2CPORTVALIDATE : Field<3, 3> {
+        static constexpr uint32_t ENABLE = 0x1;
+    };
+    using layout = Layout<NVIF, EXTDEVICE, THERMAL, I2CPORTVALIDATE>;
+};
+
+struct RMNativePcieL1WarFlags {
+    static constexpr std::string_view name = "RMNativePcieL1WarFlags";
+    struct TARGET : Field<1, 0> {
+        static constexpr uint32_t NONE = 0x0;
+        static constexpr uint32_t ENDPOINT = 0x1;
+        static constexpr uint32_t ROOT = 0x2;
+        static constexpr uint32_t BOTH = 0x3;
+    };
+    struct POLICY : Field<5, 4> {
+        static constexpr uint32_t ALWAYS = 0x0;
+        static constexpr uint32_t NEVER = 0x1;
+        static constexpr uint32_t RESTORE = 0x2;
+    };
+    struct RESUME_CALLBACK : Field<8, 8> {
+        static constexpr uint32_t OFF = 0x0;
+        static constexpr uint32_t ON = 0x1;
+    };
+    using layout = Layout<TARGET, POLICY, RESUME_CALLBACK>;
+};
+
+struct RMDisableGpuASPMFlags {
+    static constexpr std::string_view name = "RMDisableGpuASPMFlags";
+    struct L0S : Field<0, 0> {};
+    struct L1 : Field<1, 1> {};
+    using layout = Layout<L0S, L1>;
+};
+
+struct RMSbiosEnableASPMDT {
+    static constexpr std::string_view name = "RMSbiosEnableASPMDT";
+    struct L0S : Field<0, 0> {};
+    struct L1 : Field<1, 1> {};
+    using layout = Layout<L0S, L1>;
+};
+
+struct RMEnableASPMDT {
+    static constexpr std::string_view name = "RMEnableASPMDT";
+    struct L0S : Field<0, 0> {};
+    struct L1 : Field<1, 1> {};
+    using layout = Layout<L0S, L1>;
+};
+
+struct RmOverrideSupportChipsetAspm {
+    static constexpr std::string_view name = "RmOverrideSupportChipsetAspm";
+    struct L0S : Field<0, 0> {};
+    struct L1 : Field<1, 1> {};
+    using layout = Layout<L0S, L1>;
+};
+
+struct RMEnableASPMAtLoad {
+    static constexpr std::string_view name = "RMEnableASPMAtLoad";
+    struct L0S : Field<0, 0> {};
+    struct L1 : Field<1, 1> {};
+    using layout = Layout<L0S, L1>;
+};
+
+struct RMEnableASPMPublicBits {
+    static constexpr std::string_view name = "RMEnableASPMPublicBits";
+    struct L0S : Field<0, 0> {};
+    struct L1 : Field<1, 1> {};
+    struct L1_CPM : Field<2, 2> {};
+    using layout = Layout<L0S, L1, L1_CPM>;
+};
+
+struct RmDisableCotCmd {
+    static constexpr std::string_view name = "RmDisableCotCmd";
+    struct FRTS_SYSMEM : Field<1, 0> {};
+    struct FRTS_VIDMEM : Field<3, 2> {};
+    struct GSPFMC : Field<5, 4> {};
+    using layout = Layout<FRTS_SYSMEM, FRTS_VIDMEM, GSPFMC>;
+};
+
+struct RmGspRtosOverrides {
+    static constexpr std::string_view name = "RmGspRtosOverrides";
+    struct POLL_FOR_INIT_ACK : Field<1, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t FALSE = 0x1;
+        static constexpr uint32_t TRUE = 0x2;
+    };
+    using layout = Layout<POLL_FOR_INIT_ACK>;
+};
+
+struct RmOverrideUprocEngineArch {
+    static constexpr std::string_view name = "RmOverrideUprocEngineArch";
+    struct GSP : Field<3, 0> {};
+    struct SEC2 : Field<7, 4> {};
+    struct PMU : Field<11, 8> {};
+    struct NVDEC : Field<15, 12> {};
+    struct RSVD : Field<31, 16> {};
+    using layout = Layout<GSP, SEC2, PMU, NVDEC, RSVD>;
+};
+
+struct RmDpuForceFrameRelease {
+    static constexpr std::string_view name = "RmDpuForceFrameRelease";
+    struct ENABLE : Field<0, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t YES = 0x1;
+    };
+    struct THRESHOLD_US : Field<31, 16> {
+        static constexpr uint32_t DEFAULT = 0x3e8;
+    };
+    using layout = Layout<ENABLE, THRESHOLD_US>;
+};
+
+struct RmSec2RtosOverrides {
+    static constexpr std::string_view name = "RmSec2RtosOverrides";
+    struct USE_PWR_CLK_TICKS : Field<1, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t FALSE = 0x1;
+        static constexpr uint32_t TRUE = 0x2;
+    };
+    struct FREQ_CHANGE : Field<3, 2> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x2;
+    };
+    struct POLL_FOR_INIT_ACK : Field<5, 4> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t FALSE = 0x1;
+        static constexpr uint32_t TRUE = 0x2;
+    };
+    using layout = Layout<USE_PWR_CLK_TICKS, FREQ_CHANGE, POLL_FOR_INIT_ACK>;
+};
+
+struct RmPmuPgLogParams {
+    static constexpr std::string_view name = "RmPmuPgLogParams";
+    struct EVENTS_PER_RECORD : Field<7, 0> {
+        static constexpr uint32_t DEFAULT = 0x1f;
+    };
+    struct FLUSH_WATERMARKS : Field<15, 8> {
+        static constexpr uint32_t DEFAULT = 0x1b;
+    };
+    struct EVENTS_PER_NSI : Field<19, 16> {
+        static constexpr uint32_t DEFAULT = 0x8;
+    };
+    struct LOG_EVENTS : Field<31, 30> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DISABLE = 0x3;
+    };
+    using layout = Layout<EVENTS_PER_RECORD, FLUSH_WATERMARKS, EVENTS_PER_NSI, LOG_EVENTS>;
+};
+
+struct RMFBTrainingCMOS {
+    static constexpr std::string_view name = "RMFBTrainingCMOS";
+    struct ADR_TRAIN : Field<0, 0> {
+        static constexpr uint32_t DISABLE = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+    };
+    struct WCK_TRAIN : Field<1, 1> {
+        static constexpr uint32_t DISABLE = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+    };
+    struct RD_TRAIN : Field<2, 2> {
+        static constexpr uint32_t DISABLE = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+    };
+    struct WR_TRAIN : Field<3, 3> {
+        static constexpr uint32_t DISABLE = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+    };
+    struct PERIODIC : Field<8, 8> {
+        static constexpr uint32_t DISABLE = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+    };
+    struct SDDR3_WR_TRAIN : Field<9, 9> {
+        static constexpr uint32_t DISABLE = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+    };
+    struct SDDR3_WR_TRAIN_CTRL : Field<10, 10> {
+        static constexpr uint32_t TRIMMER = 0x0;
+        static constexpr uint32_t DLL = 0x1;
+    };
+    struct SDDR3_QUSE_TRAIN : Field<11, 11> {
+        static constexpr uint32_t DISABLE = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+    };
+    struct RESERVED : Field<31, 31> {};
+    using layout = Layout<ADR_TRAIN, WCK_TRAIN, RD_TRAIN, WR_TRAIN, PERIODIC, SDDR3_WR_TRAIN, SDDR3_WR_TRAIN_CTRL, SDDR3_QUSE_TRAIN, RESERVED>;
+};
+
+struct RMFBTrainingCML {
+    static constexpr std::string_view name = "RMFBTrainingCML";
+    struct ADR_TRAIN : Field<0, 0> {
+        static constexpr uint32_t DISABLE = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+    };
+    struct WCK_TRAIN : Field<1, 1> {
+        static constexpr uint32_t DISABLE = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+    };
+    struct RD_TRAIN : Field<2, 2> {
+        static constexpr uint32_t DISABLE = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+    };
+    struct WR_TRAIN : Field<3, 3> {
+        static constexpr uint32_t DISABLE = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+    };
+    struct PERIODIC : Field<8, 8> {
+        static constexpr uint32_t DISABLE = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+    };
+    struct RESERVED : Field<31, 31> {};
+    using layout = Layout<ADR_TRAIN, WCK_TRAIN, RD_TRAIN, WR_TRAIN, PERIODIC, RESERVED>;
+};
+
+struct RMOPSB {
+    static constexpr std::string_view name = "RMOPSB";
+    struct ASR : Field<1, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DISABLE = 0x2;
+    };
+    struct RESERVED : Field<3, 2> {};
+    struct CLKREQ : Field<5, 4> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DISABLE = 0x2;
+    };
+    struct DEEP_L1 : Field<7, 6> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DISABLE = 0x2;
+    };
+    struct DEEP_IDLE : Field<9, 8> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DISABLE = 0x2;
+    };
+    struct AELPG : Field<11, 10> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DISABLE = 0x2;
+        static constexpr uint32_t MONITOR = 0x3;
+    };
+    struct VIDEO_ELPG : Field<13, 12> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DISABLE = 0x2;
+    };
+    using layout = Layout<ASR, RESERVED, CLKREQ, DEEP_L1, DEEP_IDLE, AELPG, VIDEO_ELPG>;
+};
+
+struct RM592311 {
+    static constexpr std::string_view name = "RM592311";
+    struct ENABLE : Field<1, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t TRUE = 0x1;
+        static constexpr uint32_t FALSE = 0x2;
+    };
+    using layout = Layout<ENABLE>;
+};
+
+struct RMClkVfOverride {
+    static constexpr std::string_view name = "RMClkVfOverride";
+    struct MONOTONICITY_ENABLE : Field<1, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t TRUE = 0x1;
+        static constexpr uint32_t FALSE = 0x3;
+    };
+    struct SMOOTHENING_ENABLE : Field<3, 2> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t TRUE = 0x1;
+        static constexpr uint32_t FALSE = 0x3;
+    };
+    using layout = Layout<MONOTONICITY_ENABLE, SMOOTHENING_ENABLE>;
+};
+
+struct RMFbLinkTraining {
+    static constexpr std::string_view name = "RMFbLinkTraining";
+    struct ENABLE : Field<0, 0> {
+        static constexpr uint32_t TRUE = 0x0;
+        static constexpr uint32_t FALSE = 0x1;
+    };
+    struct ON : Field<4, 4> {
+        static constexpr uint32_t CPU = 0x0;
+        static constexpr uint32_t PMU = 0x1;
+    };
+    struct PATTERN_VBIOS : Field<5, 5> {
+        static constexpr uint32_t ENABLE = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+    };
+    struct PATTERN_INTERNAL : Field<6, 6> {
+        static constexpr uint32_t ENABLE = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+    };
+    using layout = Layout<ENABLE, ON, PATTERN_VBIOS, PATTERN_INTERNAL>;
+};
+
+struct QTNE {
+    static constexpr std::string_view name = "QTNE";
+    struct RASTER_BBOX_PAD : Field<7, 0> {
+        static constexpr uint32_t QUADRO = 0x0;
+        static constexpr uint32_t GEFORCE = 0x6;
+    };
+    struct RASTER_BBOX_PAD_LINE : Field<15, 8> {
+        static constexpr uint32_t QUADRO = 0x0;
+        static constexpr uint32_t GEFORCE = 0x20;
+    };
+    struct VPC_STIPPLED_LINE : Field<13, 6> {
+        static constexpr uint32_t QUADRO = 0x0;
+        static constexpr uint32_t TITAN = 0x0;
+        static constexpr uint32_t GEFORCE = 0x78;
+    };
+    struct VPC_CULLED_SMALL_TRIANGLES_LINE : Field<21, 14> {
+        static constexpr uint32_t QUADRO = 0x0;
+        static constexpr uint32_t TITAN = 0x0;
+        static constexpr uint32_t GEFORCE = 0x78;
+    };
+    struct VPC_NONCULLED_TRIANGLES_LINE : Field<29, 22> {
+        static constexpr uint32_t QUADRO = 0x0;
+        static constexpr uint32_t TITAN = 0x0;
+        static constexpr uint32_t GEFORCE = 0x78;
+    };
+    struct ARCH_OVERRIDE : Field<30, 30> {
+        static constexpr uint32_t DISABLED = 0x0;
+        static constexpr uint32_t ENABLED = 0x1;
+    };
+    struct GPU : Field<31, 31> {
+        static constexpr uint32_t QUADRO = 0x0;
+        static constexpr uint32_t GEFORCE = 0x1;
+    };
+    // VPC_STIPPLED_LINE overlaps RASTER_BBOX_PAD, not in layout
+    // VPC_CULLED_SMALL_TRIANGLES_LINE overlaps RASTER_BBOX_PAD_LINE, not in layout
+    using layout = Layout<RASTER_BBOX_PAD, RASTER_BBOX_PAD_LINE, VPC_NONCULLED_TRIANGLES_LINE, ARCH_OVERRIDE, GPU>;
+};
+
+struct QTNE2 {
+    static constexpr std::string_view name = "QTNE2";
+    struct VPC_CULLED_SMALL_LINES : Field<7, 0> {
+        static constexpr uint32_t QUADRO = 0x0;
+        static constexpr uint32_t TITAN = 0x0;
+        static constexpr uint32_t GEFORCE = 0x38;
+    };
+    struct VPC_CULLED_SMALL_TRIANGLES : Field<15, 8> {
+        static constexpr uint32_t QUADRO = 0x0;
+        static constexpr uint32_t TITAN = 0x0;
+        static constexpr uint32_t GEFORCE = 0x18;
+    };
+    struct VPC_NONCULLED_LINES_AND_POINTS : Field<23, 16> {
+        static constexpr uint32_t QUADRO = 0x0;
+        static constexpr uint32_t TITAN = 0x0;
+        static constexpr uint32_t GEFORCE = 0xc;
+    };
+    struct VPC_NONCULLED_TRIANGLES_LINE : Field<31, 24> {
+        static constexpr uint32_t QUADRO = 0x0;
+        static constexpr uint32_t TITAN = 0x0;
+        static constexpr uint32_t GEFORCE = 0xc;
+    };
+    using layout = Layout<VPC_CULLED_SMALL_LINES, VPC_CULLED_SMALL_TRIANGLES, VPC_NONCULLED_LINES_AND_POINTS, VPC_NONCULLED_TRIANGLES_LINE>;
+};
+
+struct RMFBTrimmerVal {
+    static constexpr std::string_view name = "RMFBTrimmerVal";
+    struct CMD_TRIMMER_LSB : Field<0, 0> {
+        static constexpr uint32_t DISABLE = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+    };
+    struct DATALO_TRIMMER_LSB : Field<1, 1> {
+        static constexpr uint32_t DISABLE = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+    };
+    struct DATAHI_TIMMER_LSB : Field<3, 3> {
+        static constexpr uint32_t DISABLE = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+    };
+    struct ALL_TRIMMER_MSB : Field<8, 8> {
+        static constexpr uint32_t DISABLE = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+    };
+    struct RESERVED : Field<31, 31> {};
+    using layout = Layout<CMD_TRIMMER_LSB, DATALO_TRIMMER_LSB, DATAHI_TIMMER_LSB, ALL_TRIMMER_MSB, RESERVED>;
+};
+
+struct RmIsoHubMCLKSwitch {
+    static constexpr std::string_view name = "RmIsoHubMCLKSwitch";
+    struct MODE : Field<3, 0> {
+        static constexpr uint32_t NONE = 0x0;
+        static constexpr uint32_t MID_FRAME_ENABLE = 0x1;
+        static constexpr uint32_t DWCF_ENABLE = 0x2;
+        static constexpr uint32_t MID_AND_DWCF_ENABLE = 0x3;
+        static constexpr uint32_t DMI_ENABLE = 0x4;
+        static constexpr uint32_t MID_AND_DMI_ENABLE = 0x5;
+        static constexpr uint32_t DWCF_AND_DMI_ENABLE = 0x6;
+        static constexpr uint32_t MID_DWCF_AND_DMI_ENABLE = 0x7;
+        static constexpr uint32_t LEGACY_VBLANK_ENABLE = 0x8;
+    };
+    struct MODE_VRR : Field<4, 4> {
+        static constexpr uint32_t DISABLE = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+    };
+    struct MODE_OSM : Field<5, 5> {
+        static constexpr uint32_t DISABLE = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+    };
+    struct ADDITIONAL_DELAY : Field<15, 8> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ZERO = 0x0;
+        static constexpr uint32_t MAX = 0xff;
+    };
+    struct REPLACEMENT_DELAY : Field<23, 16> {
+        static constexpr uint32_t DEFAULT = 0x0;
+    };
+    using layout = Layout<MODE, MODE_VRR, MODE_OSM, ADDITIONAL_DELAY, REPLACEMENT_DELAY>;
+};
+
+struct RMElpgStateOnInit {
+    static constexpr std::string_view name = "RMElpgStateOnInit";
+    struct ON_INIT : Field<1, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DISABLE = 0x3;
+    };
+    using layout = Layout<ON_INIT>;
+};
+
+struct RmPgCtrlParameters {
+    static constexpr std::string_view name = "RmPgCtrlParameters";
+    struct SYSCLK_SLOWDOWN : Field<1, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct CG : Field<3, 2> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct RPG : Field<5, 4> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct GSP : Field<7, 6> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct SWASR : Field<9, 8> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct ISO_STUTTER : Field<13, 12> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct DISPLAY : Field<15, 14> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct FB_TRAINING : Field<17, 16> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct PG_ENG_GR : Field<19, 18> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct RPPG : Field<21, 20> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct MSCG_WITH_IMMED_FLIP : Field<23, 22> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct NVDCLK_SLOWDOWN : Field<25, 24> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct SEC2_RTOS : Field<27, 26> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct PERF : Field<29, 28> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct UNUSED_1 : Field<31, 30> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    using layout = Layout<SYSCLK_SLOWDOWN, CG, RPG, GSP, SWASR, ISO_STUTTER, DISPLAY, FB_TRAINING, PG_ENG_GR, RPPG, MSCG_WITH_IMMED_FLIP, NVDCLK_SLOWDOWN, SEC2_RTOS, PERF, UNUSED_1>;
+};
+
+struct RmDwbMscg {
+    static constexpr std::string_view name = "RmDwbMscg";
+    struct DISABLE : Field<0, 0> {
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t YES = 0x1;
+    };
+    using layout = Layout<DISABLE>;
+};
+
+struct RMEnableMSCGConfig {
+    static constexpr std::string_view name = "RMEnableMSCGConfig";
+    struct WITH_VSYNC : Field<0, 0> {
+        static constexpr uint32_t TRUE = 0x1;
+        static constexpr uint32_t FALSE = 0x0;
+    };
+    struct WITH_FRL : Field<1, 1> {
+        static constexpr uint32_t TRUE = 0x1;
+        static constexpr uint32_t FALSE = 0x0;
+    };
+    using layout = Layout<WITH_VSYNC, WITH_FRL>;
+};
+
+struct RmLpwrCtrlMsLtcParameters {
+    static constexpr std::string_view name = "RmLpwrCtrlMsLtcParameters";
+    struct GSP : Field<1, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct PERF : Field<3, 2> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    using layout = Layout<GSP, PERF>;
+};
+
+struct RmLpwrCtrlMsDifrSwAsrParameters {
+    static constexpr std::string_view name = "RmLpwrCtrlMsDifrSwAsrParameters";
+    struct SWASR : Field<1, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct FB_TRAINING : Field<3, 2> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct DISPLAY : Field<5, 4> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct ISO_STUTTER : Field<7, 6> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct SEC2 : Field<9, 8> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct GSP : Field<11, 10> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct HSHUB : Field<13, 12> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    using layout = Layout<SWASR, FB_TRAINING, DISPLAY, ISO_STUTTER, SEC2, GSP, HSHUB>;
+};
+
+struct RmLpwrCtrlMsDifrCgParameters {
+    static constexpr std::string_view name = "RmLpwrCtrlMsDifrCgParameters";
+    struct CG : Field<1, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct ISO_STUTTER : Field<3, 2> {
+        static constexpr uint32_t DEFAULT = 0x1;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct RPPG : Field<5, 4> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct PSI : Field<7, 6> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct SYSCLK_SLOWDOWN : Field<9, 8> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct NVDCLK_SLOWDOWN : Field<11, 10> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    using layout = Layout<CG, ISO_STUTTER, RPPG, PSI, SYSCLK_SLOWDOWN, NVDCLK_SLOWDOWN>;
+};
+
+struct RmPgCtrlDiParameters {
+    static constexpr std::string_view name = "RmPgCtrlDiParameters";
+    struct PGENG_FEATURE_STATE : Field<1, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct DEEP_L1 : Field<3, 2> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct L1SS : Field<5, 4> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    using layout = Layout<PGENG_FEATURE_STATE, DEEP_L1, L1SS>;
+};
+
+struct RmPgCtrlGrParameters {
+    static constexpr std::string_view name = "RmPgCtrlGrParameters";
+    struct UNUSED : Field<1, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct NEW_HOST_SEQ : Field<3, 2> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct ELPG : Field<5, 4> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct RPPG : Field<7, 6> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct PSI : Field<9, 8> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct PRIV_RING : Field<11, 10> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct UNBIND : Field<13, 12> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct SAVE_GLOBAL_STATE : Field<15, 14> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct RESET : Field<17, 16> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct HW_SEQUENCE : Field<19, 18> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct ELPG_SRAM : Field<21, 20> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct ELPG_LOGIC : Field<23, 22> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct ELPG_L2RPPG : Field<25, 24> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct FG_RPPG_EXCLUSION : Field<27, 26> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct SEC2 : Field<29, 28> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct GSP : Field<31, 30> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    using layout = Layout<UNUSED, NEW_HOST_SEQ, ELPG, RPPG, PSI, PRIV_RING, UNBIND, SAVE_GLOBAL_STATE, RESET, HW_SEQUENCE, ELPG_SRAM, ELPG_LOGIC, ELPG_L2RPPG, FG_RPPG_EXCLUSION, SEC2, GSP>;
+};
+
+struct RmLpwrCtrlGrRgParameters {
+    static constexpr std::string_view name = "RmLpwrCtrlGrRgParameters";
+    struct PRIV_RING : Field<1, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct UNBIND : Field<3, 2> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct SAVE_GLOBAL_STATE : Field<5, 4> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct RESET : Field<7, 6> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct HW_SEQUENCE : Field<9, 8> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct GSP : Field<11, 10> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct SEC2 : Field<13, 12> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct RG_GPCCS_BS : Field<15, 14> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct RG_PERF_CHANGE_SEQ : Field<17, 16> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct XVE : Field<19, 18> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct UNUSED : Field<21, 20> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct RG_GPCCS_BS_PMU : Field<23, 22> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct RG_TS_PD : Field<25, 24> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    struct NEW_HOST_SEQ : Field<27, 26> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x3;
+    };
+    using layout = Layout<PRIV_RING, UNBIND, SAVE_GLOBAL_STATE, RESET, HW_SEQUENCE, GSP, SEC2, RG_GPCCS_BS, RG_PERF_CHANGE_SEQ, XVE, UNUSED, RG_GPCCS_BS_PMU, RG_TS_PD, NEW_HOST_SEQ>;
+};
+
+struct RMNvLog {
+    static constexpr std::string_view name = "RMNvLog";
+    struct BUFFER_FLAGS : Field<7, 0> {};
+    struct BUFFER_SIZE : Field<23, 8> {
+        static constexpr uint32_t DISABLE = 0x0;
+    };
+    struct RUNTIME_LEVEL : Field<28, 25> {};
+    struct TIMESTAMP : Field<30, 29> {
+        static constexpr uint32_t NONE = 0x0;
+        static constexpr uint32_t _32 = 0x1;
+        static constexpr uint32_t _64 = 0x2;
+        static constexpr uint32_t _32_DIFF = 0x3;
+    };
+    struct INITED : Field<31, 31> {
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t YES = 0x1;
+    };
+    using layout = Layout<BUFFER_FLAGS, BUFFER_SIZE, RUNTIME_LEVEL, TIMESTAMP, INITED>;
+};
+
+struct RMHdcpOffload {
+    static constexpr std::string_view name = "RMHdcpOffload";
+    struct INIT : Field<1, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DISABLE = 0x3;
+    };
+    using layout = Layout<INIT>;
+};
+
+struct RM776993 {
+    static constexpr std::string_view name = "RM776993";
+    struct TYPE_1 : Field<0, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t FALSE = 0x0;
+        static constexpr uint32_t TRUE = 0x1;
+    };
+    struct TYPE_2 : Field<1, 1> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t FALSE = 0x0;
+        static constexpr uint32_t TRUE = 0x1;
+    };
+    struct LINK_MASK : Field<15, 8> {};
+    using layout = Layout<TYPE_1, TYPE_2, LINK_MASK>;
+};
+
+struct RMSmmuConfig {
+    static constexpr std::string_view name = "RMSmmuConfig";
+    struct ALL : Field<31, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x55555555;
+        static constexpr uint32_t ENABLE = 0xaaaaaaaa;
+    };
+    struct DISPLAY : Field<1, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x2;
+    };
+    struct AVP : Field<3, 2> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x2;
+    };
+    struct GPU : Field<5, 4> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x2;
+    };
+    // DISPLAY overlaps ALL, not in layout
+    // AVP overlaps ALL, not in layout
+    // GPU overlaps ALL, not in layout
+    using layout = Layout<ALL>;
+};
+
+struct RmThermPolicyOverride {
+    static constexpr std::string_view name = "RmThermPolicyOverride";
+    struct DISABLE : Field<0, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLED = 0x1;
+    };
+    using layout = Layout<DISABLE>;
+};
+
+struct RmThermPolicySwSlowdownOverride {
+    static constexpr std::string_view name = "RmThermPolicySwSlowdownOverride";
+    struct DISABLE : Field<0, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLED = 0x1;
+    };
+    using layout = Layout<DISABLE>;
+};
+
+struct RMPcieLinkSpeed {
+    static constexpr std::string_view name = "RMPcieLinkSpeed";
+    struct ALLOW_GEN2 : Field<1, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DISABLE = 0x2;
+    };
+    struct ALLOW_GEN3 : Field<3, 2> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DISABLE = 0x2;
+    };
+    struct ALLOW_GEN4 : Field<5, 4> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DISABLE = 0x2;
+    };
+    struct ALLOW_GEN5 : Field<7, 6> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DISABLE = 0x2;
+    };
+    struct LOCK_AT_LOAD : Field<31, 31> {
+        static constexpr uint32_t DISABLE = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+    };
+    using layout = Layout<ALLOW_GEN2, ALLOW_GEN3, ALLOW_GEN4, ALLOW_GEN5, LOCK_AT_LOAD>;
+};
+
+struct RMPcieLtrL12ThresholdOverride {
+    static constexpr std::string_view name = "RMPcieLtrL12ThresholdOverride";
+    struct OVERRIDE : Field<1, 0> {
+        static constexpr uint32_t ENABLED = 0x0;
+        static constexpr uint32_t DISABLED = 0x1;
+    };
+    struct VALUE : Field<11, 2> {};
+    struct SCALE : Field<14, 12> {};
+    using layout = Layout<OVERRIDE, VALUE, SCALE>;
+};
+
+struct RMPcieLtrOverride {
+    static constexpr std::string_view name = "RMPcieLtrOverride";
+    struct ALLOW_LTR : Field<1, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DISABLE = 0x2;
+    };
+    struct SNOOP_LAT_VALUE : Field<11, 2> {};
+    struct SNOOP_LAT_SCALE : Field<14, 12> {};
+    struct NO_SNOOP_LAT_VALUE : Field<24, 15> {};
+    struct NO_SNOOP_LAT_SCALE : Field<27, 25> {};
+    using layout = Layout<ALLOW_LTR, SNOOP_LAT_VALUE, SNOOP_LAT_SCALE, NO_SNOOP_LAT_VALUE, NO_SNOOP_LAT_SCALE>;
+};
+
+struct RmThermProviderAutoDetectSkip {
+    static constexpr std::string_view name = "RmThermProviderAutoDetectSkip";
+    struct NVINT : Field<0, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t SKIP = 0x1;
+    };
+    struct AD1032_COMPAT : Field<1, 1> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t SKIP = 0x1;
+    };
+    struct ADT7473 : Field<2, 2> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t SKIP = 0x1;
+    };
+    struct NVSYSCON : Field<3, 3> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t SKIP = 0x1;
+    };
+    using layout = Layout<NVINT, AD1032_COMPAT, ADT7473, NVSYSCON>;
+};
+
+struct RmGrBalancingMode {
+    static constexpr std::string_view name = "RmGrBalancingMode";
+    struct SKIP_TABLE : Field<1, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t FORCED = 0x2;
+    };
+    struct PD_WORKLOAD : Field<3, 2> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t FORCED = 0x2;
+    };
+    struct SKIP_MASK : Field<15, 8> {
+        static constexpr uint32_t DEFAULT = 0x0;
+    };
+    using layout = Layout<SKIP_TABLE, PD_WORKLOAD, SKIP_MASK>;
+};
+
+struct RmPbdmaTimeout {
+    static constexpr std::string_view name = "RmPbdmaTimeout";
+    struct PERIOD : Field<31, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t MAX = 0xffffffff;
+    };
+    using layout = Layout<PERIOD>;
+};
+
+struct RmDisableFakeEntryCheck {
+    static constexpr std::string_view name = "RmDisableFakeEntryCheck";
+    struct DISABLE : Field<0, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t YES = 0x1;
+    };
+    using layout = Layout<DISABLE>;
+};
+
+struct RmFan2XOverride {
+    static constexpr std::string_view name = "RmFan2XOverride";
+    struct POR : Field<1, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x2;
+    };
+    using layout = Layout<POR>;
+};
+
+struct RmDisableInforomBBX {
+    static constexpr std::string_view name = "RmDisableInforomBBX";
+    struct COMPLETELY : Field<0, 0> {
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t YES = 0x1;
+    };
+    struct WRITE_BY_RM : Field<1, 1> {
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t YES = 0x1;
+    };
+    struct WRITE_BY_CLIENT : Field<2, 2> {
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t YES = 0x1;
+    };
+    struct PERIODIC_FLUSH : Field<3, 3> {
+        static constexpr uint32_t YES = 0x0;
+        static constexpr uint32_t NO = 0x1;
+    };
+    using layout = Layout<COMPLETELY, WRITE_BY_RM, WRITE_BY_CLIENT, PERIODIC_FLUSH>;
+};
+
+struct RmDisableInforomNvlink {
+    static constexpr std::string_view name = "RmDisableInforomNvlink";
+    struct FATAL_ERROR_LOGGING : Field<0, 0> {
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t YES = 0x1;
+    };
+    struct CORRECTABLE_ERROR_LOGGING : Field<1, 1> {
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t YES = 0x1;
+    };
+    using layout = Layout<FATAL_ERROR_LOGGING, CORRECTABLE_ERROR_LOGGING>;
+};
+
+struct RMROPL2FuseMaskForFModel {
+    static constexpr std::string_view name = "RMROPL2FuseMaskForFModel";
+    struct MASK : Field<31, 0> {};
+    using layout = Layout<MASK>;
+};
+
+struct RmSliGpuBoostSyncOverride {
+    static constexpr std::string_view name = "RmSliGpuBoostSyncOverride";
+    struct POR : Field<1, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+        static constexpr uint32_t ENABLE = 0x2;
+    };
+    using layout = Layout<POR>;
+};
+
+struct RMAcrUseCeForShadowCopy {
+    static constexpr std::string_view name = "RMAcrUseCeForShadowCopy";
+    struct STATE : Field<0, 0> {
+        static constexpr uint32_t DISABLE = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+    };
+    using layout = Layout<STATE>;
+};
+
+struct RmLSFMFeature {
+    static constexpr std::string_view name = "RmLSFMFeature";
+    struct WPR_BLOB_VERSION : Field<0, 0> {
+        static constexpr uint32_t UNSUPPORT = 0x0;
+        static constexpr uint32_t SUPPORT = 0x1;
+    };
+    using layout = Layout<WPR_BLOB_VERSION>;
+};
+
+struct RMEnableSingleHeadMultiDisplay {
+    static constexpr std::string_view name = "RMEnableSingleHeadMultiDisplay";
+    struct SST : Field<0, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t YES = 0x1;
+    };
+    struct MST : Field<1, 1> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t YES = 0x1;
+    };
+    using layout = Layout<SST, MST>;
+};
+
+struct RmHulkDisableFeatures {
+    static constexpr std::string_view name = "RmHulkDisableFeatures";
+    struct VPR : Field<0, 0> {
+        static constexpr uint32_t FALSE = 0x0;
+        static constexpr uint32_t TRUE = 0x1;
+    };
+    struct WPR : Field<1, 1> {
+        static constexpr uint32_t FALSE = 0x0;
+        static constexpr uint32_t TRUE = 0x1;
+    };
+    struct HDCP : Field<2, 2> {
+        static constexpr uint32_t FALSE = 0x0;
+        static constexpr uint32_t TRUE = 0x1;
+    };
+    using layout = Layout<VPR, WPR, HDCP>;
+};
+
+struct RmHdaOverride {
+    static constexpr std::string_view name = "RmHdaOverride";
+    struct UCODE_ADDRMODE : Field<0, 0> {
+        static constexpr uint32_t VIRT = 0x0;
+        static constexpr uint32_t PHYS = 0x1;
+    };
+    using layout = Layout<UCODE_ADDRMODE>;
+};
+
+struct RMPrivSecurity {
+    static constexpr std::string_view name = "RMPrivSecurity";
+    struct REGISTERS : Field<0, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLED = 0x0;
+        static constexpr uint32_t ENABLED = 0x1;
+    };
+    struct DISABLE : Field<2, 1> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t FALSE = 0x1;
+        static constexpr uint32_t TRUE = 0x2;
+    };
+    struct MODE : Field<4, 3> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t PROD = 0x1;
+        static constexpr uint32_t DEBUG = 0x2;
+    };
+    using layout = Layout<REGISTERS, DISABLE, MODE>;
+};
+
+struct RMNvLinkControl {
+    static constexpr std::string_view name = "RMNvLinkControl";
+    struct FORCE_DISABLE : Field<0, 0> {
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t YES = 0x1;
+        static constexpr uint32_t DEFAULT = 0x0;
+    };
+    struct TRAIN_AT_LOAD : Field<1, 1> {
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t YES = 0x1;
+        static constexpr uint32_t DEFAULT = 0x0;
+    };
+    struct SKIP_TRAIN : Field<2, 2> {
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t YES = 0x1;
+        static constexpr uint32_t DEFAULT = 0x0;
+    };
+    struct RESERVED_0 : Field<7, 3> {};
+    struct FORCE_AUTOCONFIG : Field<8, 8> {
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t YES = 0x1;
+        static constexpr uint32_t DEFAULT = 0x0;
+    };
+    struct FORCE_ENABLE : Field<31, 31> {
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t YES = 0x1;
+        static constexpr uint32_t DEFAULT = 0x0;
+    };
+    using layout = Layout<FORCE_DISABLE, TRAIN_AT_LOAD, SKIP_TRAIN, RESERVED_0, FORCE_AUTOCONFIG, FORCE_ENABLE>;
+};
+
+struct RMNvlinkForceCoreLibRtlsim {
+    static constexpr std::string_view name = "RMNvlinkForceCoreLibRtlsim";
+    struct ENABLE : Field<0, 0> {
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t YES = 0x1;
+    };
+    using layout = Layout<ENABLE>;
+};
+
+struct RMNvLinkNisohub {
+    static constexpr std::string_view name = "RMNvLinkNisohub";
+    struct ENABLE : Field<0, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t YES = 0x1;
+    };
+    using layout = Layout<ENABLE>;
+};
+
+struct RMNvlinkUPHYInitControl {
+    static constexpr std::string_view name = "RMNvlinkUPHYInitControl";
+    struct LANE_INIT : Field<0, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLED = 0x1;
+        static constexpr uint32_t DISABLED = 0x0;
+    };
+    struct TX_EQ : Field<1, 1> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLED = 0x1;
+        static constexpr uint32_t DISABLED = 0x0;
+    };
+    struct LINK_TRAIN : Field<2, 2> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLED = 0x1;
+        static constexpr uint32_t DISABLED = 0x0;
+    };
+    struct POWER_DOWN : Field<3, 3> {
+        static constexpr uint32_t DEFAULT = 0x1;
+        static constexpr uint32_t ENABLED = 0x1;
+        static constexpr uint32_t DISABLED = 0x0;
+    };
+    struct UPHY_VER : Field<4, 4> {
+        static constexpr uint32_t DEFAULT = 0x1;
+        static constexpr uint32_t _041 = 0x0;
+        static constexpr uint32_t _060 = 0x1;
+    };
+    using layout = Layout<LANE_INIT, TX_EQ, LINK_TRAIN, POWER_DOWN, UPHY_VER>;
+};
+
+struct RMNvLinkSelectRefclk {
+    static constexpr std::string_view name = "RMNvLinkSelectRefclk";
+    struct TYPE : Field<1, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t PEX = 0x1;
+        static constexpr uint32_t NVHS = 0x2;
+        static constexpr uint32_t RESERVED = 0x3;
+    };
+    using layout = Layout<TYPE>;
+};
+
+struct RMNvLinkRefclkRate {
+    static constexpr std::string_view name = "RMNvLinkRefclkRate";
+    struct VAL : Field<1, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t _100 = 0x1;
+        static constexpr uint32_t _133 = 0x2;
+        static constexpr uint32_t RESERVED = 0x3;
+    };
+    using layout = Layout<VAL>;
+};
+
+struct RMNvLinkSpeedControl {
+    static constexpr std::string_view name = "RMNvLinkSpeedControl";
+    struct SPEED : Field<4, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t _16G = 0x1;
+        static constexpr uint32_t _19_2G = 0x2;
+        static constexpr uint32_t _20G = 0x3;
+        static constexpr uint32_t _21G = 0x4;
+        static constexpr uint32_t _22G = 0x5;
+        static constexpr uint32_t _23G = 0x6;
+        static constexpr uint32_t _24G = 0x7;
+        static constexpr uint32_t _25G = 0x8;
+        static constexpr uint32_t _25_78125G = 0x8;
+        static constexpr uint32_t _25_00000G = 0x9;
+        static constexpr uint32_t _16_14583G = 0xa;
+        static constexpr uint32_t _26_56250G = 0xb;
+        static constexpr uint32_t _27_34375G = 0xc;
+        static constexpr uint32_t _28_12500G = 0xd;
+        static constexpr uint32_t _32G = 0xe;
+        static constexpr uint32_t _40G = 0xf;
+        static constexpr uint32_t _50_00000G = 0x10;
+        static constexpr uint32_t _53_12500G = 0x11;
+        static constexpr uint32_t _100_00000G = 0x12;
+        static constexpr uint32_t _106_25000G = 0x13;
+        static constexpr uint32_t FAULT = 0x14;
+        static constexpr uint32_t _LAST = 0x14;
+    };
+    using layout = Layout<SPEED>;
+};
+
+struct RMNvLinkTxTrainControl {
+    static constexpr std::string_view name = "RMNvLinkTxTrainControl";
+    struct FOM_FORMAT : Field<2, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t FOMA = 0x1;
+        static constexpr uint32_t FOMB = 0x2;
+        static constexpr uint32_t FOMC = 0x4;
+    };
+    struct OPTIMIZATION_ALGORITHM : Field<10, 3> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t A0 = 0x1;
+        static constexpr uint32_t A1 = 0x2;
+        static constexpr uint32_t A2 = 0x4;
+        static constexpr uint32_t A3 = 0x8;
+        static constexpr uint32_t A4 = 0x10;
+        static constexpr uint32_t A5 = 0x20;
+        static constexpr uint32_t A6 = 0x40;
+        static constexpr uint32_t A7 = 0x80;
+    };
+    struct ADJUSTMENT_ALGORITHM : Field<15, 11> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t B0 = 0x1;
+        static constexpr uint32_t B1 = 0x2;
+        static constexpr uint32_t B2 = 0x4;
+        static constexpr uint32_t B3 = 0x8;
+    };
+    struct MINIMUM_TRAIN_TIME_MANTISSA : Field<19, 16> {
+        static constexpr uint32_t DEFAULT = 0x0;
+    };
+    struct MINIMUM_TRAIN_TIME_EXPONENT : Field<23, 20> {
+        static constexpr uint32_t DEFAULT = 0x0;
+    };
+    using layout = Layout<FOM_FORMAT, OPTIMIZATION_ALGORITHM, ADJUSTMENT_ALGORITHM, MINIMUM_TRAIN_TIME_MANTISSA, MINIMUM_TRAIN_TIME_EXPONENT>;
+};
+
+struct RMNvLinkMinionControl {
+    static constexpr std::string_view name = "RMNvLinkMinionControl";
+    struct ENABLE : Field<3, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t FORCE_ON = 0x1;
+        static constexpr uint32_t FORCE_OFF = 0x2;
+    };
+    struct PHY_CONFIG : Field<7, 4> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DISABLE = 0x2;
+    };
+    struct DL_STATUS : Field<11, 8> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DISABLE = 0x2;
+    };
+    struct INITNEGOTIATE : Field<15, 12> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DISABLE = 0x2;
+    };
+    struct INITOPTIMIZE : Field<19, 16> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DISABLE = 0x2;
+    };
+    struct CACHE_SEEDS : Field<23, 20> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DISABLE = 0x2;
+    };
+    struct BOOT_CORE : Field<27, 24> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t RISCV = 0x1;
+        static constexpr uint32_t FALCON = 0x2;
+        static constexpr uint32_t RISCV_MANIFEST = 0x3;
+        static constexpr uint32_t NO_MANIFEST = 0x4;
+    };
+    struct ALI_TRAINING : Field<30, 28> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DISABLE = 0x2;
+    };
+    struct GFW_BOOT : Field<31, 31> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+    };
+    using layout = Layout<ENABLE, PHY_CONFIG, DL_STATUS, INITNEGOTIATE, INITOPTIMIZE, CACHE_SEEDS, BOOT_CORE, ALI_TRAINING, GFW_BOOT>;
+};
+
+struct RMNvLinkMinionSimModeControl {
+    static constexpr std::string_view name = "RMNvLinkMinionSimModeControl";
+    struct MODE : Field<3, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t FAST = 0x1;
+        static constexpr uint32_t MEDIUM = 0x2;
+        static constexpr uint32_t SLOW = 0x3;
+    };
+    struct SHORT_ALARMS : Field<6, 4> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLED = 0x1;
+        static constexpr uint32_t DISABLED = 0x2;
+    };
+    struct SHORT_ALARMS_RESERVED : Field<7, 7> {};
+    using layout = Layout<MODE, SHORT_ALARMS, SHORT_ALARMS_RESERVED>;
+};
+
+struct RMNvLinkMinionSmfSettings {
+    static constexpr std::string_view name = "RMNvLinkMinionSmfSettings";
+    struct MODE : Field<3, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t FAST = 0x1;
+        static constexpr uint32_t MEDIUM = 0x2;
+        static constexpr uint32_t SLOW = 0x3;
+        static constexpr uint32_t MEDIUM_SERIAL = 0x4;
+    };
+    using layout = Layout<MODE>;
+};
+
+struct RMNvLinkMinionUphyTables {
+    static constexpr std::string_view name = "RMNvLinkMinionUphyTables";
+    struct MODE : Field<1, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t SHORT = 0x1;
+        static constexpr uint32_t FAST = 0x2;
+    };
+    using layout = Layout<MODE>;
+};
+
+struct RMNvLinkverboseControlMask {
+    static constexpr std::string_view name = "RMNvLinkverboseControlMask";
+    struct REGINIT : Field<0, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ON = 0x1;
+        static constexpr uint32_t OFF = 0x0;
+    };
+    using layout = Layout<REGINIT>;
+};
+
+struct RMNvLinkSkipBufferReady {
+    static constexpr std::string_view name = "RMNvLinkSkipBufferReady";
+    struct TLC : Field<0, 0> {
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t YES = 0x1;
+        static constexpr uint32_t DEFAULT = 0x0;
+    };
+    struct MIF : Field<1, 1> {
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t YES = 0x1;
+        static constexpr uint32_t DEFAULT = 0x0;
+    };
+    struct RESERVED_0 : Field<31, 2> {};
+    using layout = Layout<TLC, MIF, RESERVED_0>;
+};
+
+struct RMNvLinkCounterControl {
+    static constexpr std::string_view name = "RMNvLinkCounterControl";
+    struct ENABLE : Field<0, 0> {
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t YES = 0x1;
+        static constexpr uint32_t DEFAULT = 0x0;
+    };
+    struct DUMP : Field<1, 1> {
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t YES = 0x1;
+        static constexpr uint32_t DEFAULT = 0x0;
+    };
+    struct RESERVED_0 : Field<3, 2> {};
+    struct UNIT : Field<5, 4> {
+        static constexpr uint32_t CYCLES = 0x0;
+        static constexpr uint32_t PACKETS = 0x1;
+        static constexpr uint32_t FLITS = 0x2;
+        static constexpr uint32_t BYTES = 0x3;
+        static constexpr uint32_t DEFAULT = 0x0;
+    };
+    struct RESERVED_1 : Field<7, 6> {};
+    struct FLITFILTER : Field<15, 8> {
+        static constexpr uint32_t NONE = 0x0;
+        static constexpr uint32_t HEAD = 0x1;
+        static constexpr uint32_t AE = 0x2;
+        static constexpr uint32_t BE = 0x4;
+        static constexpr uint32_t DATA = 0x8;
+        static constexpr uint32_t IDLE = 0x10;
+        static constexpr uint32_t DEFAULT = 0x0;
+    };
+    struct L1_FILTER_ENABLE : Field<16, 16> {
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t YES = 0x1;
+        static constexpr uint32_t DEFAULT = 0x0;
+    };
+    struct L1_FILTER : Field<19, 17> {
+        static constexpr uint32_t CYCLES_IN_L1 = 0x0;
+        static constexpr uint32_t CYCLES_IN_L1_WITH_LOCAL_ACTIVE_DESIRED = 0x1;
+        static constexpr uint32_t CYCLES_IN_ACTIVE_WITH_LOCAL_L1_DESIRED_ONLY = 0x2;
+        static constexpr uint32_t CYCLES_IN_ACTIVE_WITH_REMOTE_L1_DESIRED_ONLY = 0x3;
+        static constexpr uint32_t CYCLES_IN_ACTIVE_WITH_BOTH_LOCAL_AND_REMOTE_L1_DESIRED = 0x4;
+        static constexpr uint32_t ENTRIES_INTO_L1 = 0x7;
+        static constexpr uint32_t DEFAULT = 0x0;
+    };
+    struct RESERVED_2 : Field<31, 20> {};
+    using layout = Layout<ENABLE, DUMP, RESERVED_0, UNIT, RESERVED_1, FLITFILTER, L1_FILTER_ENABLE, L1_FILTER, RESERVED_2>;
+};
+
+struct RMNvLinkControlLinkPM {
+    static constexpr std::string_view name = "RMNvLinkControlLinkPM";
+    struct SINGLE_LANE_MODE : Field<1, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DISABLE = 0x2;
+    };
+    struct PROD_WRITES : Field<3, 2> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DISABLE = 0x2;
+    };
+    struct L1_MODE : Field<5, 4> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DISABLE = 0x2;
+    };
+    struct L2_MODE : Field<7, 6> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+        static constexpr uint32_t DISABLE = 0x2;
+    };
+    struct RESERVED : Field<31, 8> {};
+    using layout = Layout<SINGLE_LANE_MODE, PROD_WRITES, L1_MODE, L2_MODE, RESERVED>;
+};
+
+struct RMNvlinkSSGControl {
+    static constexpr std::string_view name = "RMNvlinkSSGControl";
+    struct BREAK_AFTER_UPHY_INIT : Field<0, 0> {
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t YES = 0x1;
+    };
+    struct BREAK_AFTER_DLPL_INIT : Field<1, 1> {
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t YES = 0x1;
+    };
+    using layout = Layout<BREAK_AFTER_UPHY_INIT, BREAK_AFTER_DLPL_INIT>;
+};
+
+struct RMPreemptionTestOptions {
+    static constexpr std::string_view name = "RMPreemptionTestOptions";
+    struct CONTROL : Field<1, 0> {
+        static constexpr uint32_t NONE = 0x0;
+        static constexpr uint32_t SKIP_SAVE_RESET_RESTORE = 0x1;
+    };
+    using layout = Layout<CONTROL>;
+};
+
+struct RmDpAuxloggerConfig {
+    static constexpr std::string_view name = "RmDpAuxloggerConfig";
+    struct REDACTION : Field<0, 0> {
+        static constexpr uint32_t SKIP = 0x1;
+        static constexpr uint32_t ENFORCE = 0x0;
+        static constexpr uint32_t DEFAULT = 0x1;
+    };
+    struct BUFFERSIZE : Field<31, 16> {
+        static constexpr uint32_t DEFAULT = 0x400;
+        static constexpr uint32_t MAXIMUM = 0x1000;
+    };
+    using layout = Layout<REDACTION, BUFFERSIZE>;
+};
+
+struct RmNvsrFlickerControl {
+    static constexpr std::string_view name = "RmNvsrFlickerControl";
+    struct PRE_FRAME_WEIGHT : Field<3, 0> {
+        static constexpr uint32_t DEFAULT = 0x2;
+    };
+    struct CUR_FRAME_WEIGHT : Field<7, 4> {
+        static constexpr uint32_t DEFAULT = 0x1;
+    };
+    struct THRESHOLD : Field<15, 8> {
+        static constexpr uint32_t DEFAULT = 0xe6;
+    };
+    struct MAX_DELAY_TIME : Field<19, 16> {};
+    struct MIN_MARGIN_TIME : Field<23, 20> {
+        static constexpr uint32_t DEFAULT = 0x2;
+    };
+    using layout = Layout<PRE_FRAME_WEIGHT, CUR_FRAME_WEIGHT, THRESHOLD, MAX_DELAY_TIME, MIN_MARGIN_TIME>;
+};
+
+struct AcpiDsmShim {
+    static constexpr std::string_view name = "AcpiDsmShim";
+    struct REV_ID : Field<15, 0> {};
+    struct SUB_FUNC : Field<27, 16> {};
+    struct ENABLE : Field<28, 28> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t YES = 0x1;
+    };
+    using layout = Layout<REV_ID, SUB_FUNC, ENABLE>;
+};
+
+struct RmNonContigAllocConfig {
+    static constexpr std::string_view name = "RmNonContigAllocConfig";
+    struct SET_DEFAULT : Field<1, 0> {
+        static constexpr uint32_t FALSE = 0x0;
+        static constexpr uint32_t TRUE = 0x1;
+    };
+    struct PAGE_SHUFFLE : Field<3, 2> {
+        static constexpr uint32_t DISABLE = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+    };
+    using layout = Layout<SET_DEFAULT, PAGE_SHUFFLE>;
+};
+
+struct GridLicensedFeatures {
+    static constexpr std::string_view name = "GridLicensedFeatures";
+    struct QUADRO : Field<0, 0> {
+        static constexpr uint32_t DISABLED = 0x0;
+        static constexpr uint32_t ENABLED = 0x1;
+    };
+    struct VGPU : Field<1, 1> {
+        static constexpr uint32_t DISABLED = 0x0;
+        static constexpr uint32_t ENABLED = 0x1;
+    };
+    struct GEFORCE : Field<2, 2> {
+        static constexpr uint32_t DISABLED = 0x0;
+        static constexpr uint32_t ENABLED = 0x1;
+    };
+    struct COMPUTE : Field<3, 3> {
+        static constexpr uint32_t DISABLED = 0x0;
+        static constexpr uint32_t ENABLED = 0x1;
+    };
+    struct VGPU_BLOCKED : Field<4, 4> {
+        static constexpr uint32_t DISABLED = 0x0;
+        static constexpr uint32_t ENABLED = 0x1;
+    };
+    using layout = Layout<QUADRO, VGPU, GEFORCE, COMPUTE, VGPU_BLOCKED>;
+};
+
+struct RMDisplayOverrideElvStart {
+    static constexpr std::string_view name = "RMDisplayOverrideElvStart";
+    struct VALUE : Field<31, 0> {
+        static constexpr uint32_t RM_PROGRAMMED = 0x0;
+    };
+    using layout = Layout<VALUE>;
+};
+
+struct RmPVMRL {
+    static constexpr std::string_view name = "RmPVMRL";
+    struct ENABLE : Field<0, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t YES = 0x1;
+    };
+    struct ARR_ENABLE : Field<1, 1> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t YES = 0x1;
+    };
+    struct SCHED_POLICY : Field<7, 4> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t VGPU_RELATIVE = 0x0;
+        static constexpr uint32_t PGPU_SHARE = 0x1;
+    };
+    struct USE_SUBMIT_OFFSET : Field<8, 8> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLED = 0x0;
+        static constexpr uint32_t ENABLED = 0x1;
+    };
+    struct PREVENT_EXTRA_CONTEXT_SWITCH : Field<9, 9> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLED = 0x0;
+        static constexpr uint32_t DISABLED = 0x1;
+    };
+    struct FREQUENCY : Field<21, 12> {};
+    struct TIMESLICE : Field<23, 16> {};
+    struct AVERAGE_FACTOR : Field<31, 24> {};
+    // TIMESLICE overlaps FREQUENCY, not in layout
+    using layout = Layout<ENABLE, ARR_ENABLE, SCHED_POLICY, USE_SUBMIT_OFFSET, PREVENT_EXTRA_CONTEXT_SWITCH, FREQUENCY, AVERAGE_FACTOR>;
+};
+
+struct RMEnablePhyRepeater {
+    static constexpr std::string_view name = "RMEnablePhyRepeater";
+    struct TRAIN : Field<0, 0> {
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t YES = 0x1;
+    };
+    struct NO_CAP_PROBE : Field<1, 1> {
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t YES = 0x1;
+    };
+    using layout = Layout<TRAIN, NO_CAP_PROBE>;
+};
+
+struct RMPexPowerSavings {
+    static constexpr std::string_view name = "RMPexPowerSavings";
+    struct ENGAGE : Field<0, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+    };
+    struct LOWER_LIMIT_DIFF_PERCENTAGE : Field<7, 1> {
+        static constexpr uint32_t INIT = 0x5;
+    };
+    struct UPPER_LIMIT_DIFF_PERCENTAGE : Field<14, 8> {
+        static constexpr uint32_t INIT = 0xa;
+    };
+    struct LOWER_LIMIT_NEW_L1_RESIDENCY : Field<21, 15> {
+        static constexpr uint32_t INIT = 0xf;
+    };
+    struct UPPER_LIMIT_NEW_L1_RESIDENCY : Field<28, 22> {
+        static constexpr uint32_t INIT = 0x1e;
+    };
+    using layout = Layout<ENGAGE, LOWER_LIMIT_DIFF_PERCENTAGE, UPPER_LIMIT_DIFF_PERCENTAGE, LOWER_LIMIT_NEW_L1_RESIDENCY, UPPER_LIMIT_NEW_L1_RESIDENCY>;
+};
+
+struct RmProfilerFeature {
+    static constexpr std::string_view name = "RmProfilerFeature";
+    struct ALLOWLIST : Field<0, 0> {
+        static constexpr uint32_t FALSE = 0x0;
+        static constexpr uint32_t TRUE = 0x1;
+        static constexpr uint32_t DEFAULT = 0x0;
+    };
+    struct RESERVATION : Field<1, 1> {
+        static constexpr uint32_t FALSE = 0x0;
+        static constexpr uint32_t TRUE = 0x1;
+        static constexpr uint32_t DEFAULT = 0x0;
+    };
+    using layout = Layout<ALLOWLIST, RESERVATION>;
+};
+
+struct RmVmmuSegmentSizeOverride {
+    static constexpr std::string_view name = "RmVmmuSegmentSizeOverride";
+    struct SEGMENT_SIZE : Field<2, 0> {
+        static constexpr uint32_t _32MB = 0x0;
+        static constexpr uint32_t _64MB = 0x1;
+        static constexpr uint32_t _128MB = 0x2;
+        static constexpr uint32_t _256MB = 0x3;
+        static constexpr uint32_t _512MB = 0x4;
+    };
+    using layout = Layout<SEGMENT_SIZE>;
+};
+
+struct RmDisableDisplayMux {
+    static constexpr std::string_view name = "RmDisableDisplayMux";
+    struct INTERNAL : Field<3, 0> {
+        static constexpr uint32_t YES = 0x1;
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t DEFAULT = 0x0;
+    };
+    struct EXTERNAL : Field<7, 4> {
+        static constexpr uint32_t YES = 0x1;
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t DEFAULT = 0x0;
+    };
+    using layout = Layout<INTERNAL, EXTERNAL>;
+};
+
+struct RmInternalDispMuxOverrides {
+    static constexpr std::string_view name = "RmInternalDispMuxOverrides";
+    struct TRIGGER_TCON_D0_VIA_I2C : Field<0, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t YES = 0x1;
+    };
+    struct FORCE_DYNAMIC_MODE : Field<1, 1> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t YES = 0x1;
+    };
+    struct DISABLE_IGPU_PSR_SB : Field<2, 2> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t YES = 0x1;
+    };
+    struct ENABLE_FSM_UPDATE_ONLY_FOR_SWITCH : Field<3, 3> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t YES = 0x1;
+    };
+    struct ALWAYS_SKIP_EDP_POWERDOWN : Field<4, 4> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t YES = 0x1;
+    };
+    struct SKIP_SR_EXIT_RECOVERY : Field<5, 5> {
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t YES = 0x1;
+        static constexpr uint32_t DEFAULT = 0x0;
+    };
+    struct EMULATE_TCON_IDX_VAL : Field<15, 8> {
+        static constexpr uint32_t SKIP_SB_SR = 0x0;
+    };
+    struct EMULATE_TCON_IDX_VALID : Field<16, 16> {
+        static constexpr uint32_t YES = 0x1;
+        static constexpr uint32_t NO = 0x0;
+    };
+    struct FORCE_MUX_COMPLIANCE : Field<17, 17> {
+        static constexpr uint32_t YES = 0x1;
+        static constexpr uint32_t NO = 0x0;
+    };
+    struct EMULATE_MUX_IDX_VALID : Field<18, 18> {
+        static constexpr uint32_t YES = 0x1;
+        static constexpr uint32_t NO = 0x0;
+    };
+    struct EMULATE_MUX_IDX_VAL : Field<27, 20> {};
+    using layout = Layout<TRIGGER_TCON_D0_VIA_I2C, FORCE_DYNAMIC_MODE, DISABLE_IGPU_PSR_SB, ENABLE_FSM_UPDATE_ONLY_FOR_SWITCH, ALWAYS_SKIP_EDP_POWERDOWN, SKIP_SR_EXIT_RECOVERY, EMULATE_TCON_IDX_VAL, EMULATE_TCON_IDX_VALID, FORCE_MUX_COMPLIANCE, EMULATE_MUX_IDX_VALID, EMULATE_MUX_IDX_VAL>;
+};
+
+struct RmBug3079507War {
+    static constexpr std::string_view name = "RmBug3079507War";
+    struct ENABLE : Field<0, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t YES = 0x1;
+        static constexpr uint32_t NO = 0x0;
+    };
+    struct DELAY_MS_VAL : Field<8, 1> {
+        static constexpr uint32_t DEFAULT = 0x0;
+    };
+    using layout = Layout<ENABLE, DELAY_MS_VAL>;
+};
+
+struct RmBug3477023WarMs {
+    static constexpr std::string_view name = "RmBug3477023WarMs";
+    struct DELAY_VAL : Field<15, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+    };
+    using layout = Layout<DELAY_VAL>;
+};
+
+struct RmDispMuxAuxSettleDelayOverride {
+    static constexpr std::string_view name = "RmDispMuxAuxSettleDelayOverride";
+    struct MS_VAL : Field<8, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+    };
+    using layout = Layout<MS_VAL>;
+};
+
+struct RmEdpBlenByAuxEnable {
+    static constexpr std::string_view name = "RmEdpBlenByAuxEnable";
+    struct USING_CALLBACK : Field<0, 0> {
+        static constexpr uint32_t TRUE = 0x1;
+        static constexpr uint32_t FALSE = 0x0;
+        static constexpr uint32_t DEFAULT = 0x0;
+    };
+    struct USING_SOR_SEQ : Field<1, 1> {
+        static constexpr uint32_t TRUE = 0x1;
+        static constexpr uint32_t FALSE = 0x0;
+        static constexpr uint32_t DEFAULT = 0x0;
+    };
+    using layout = Layout<USING_CALLBACK, USING_SOR_SEQ>;
+};
+
+struct RmMscgLowFpsWarConfig {
+    static constexpr std::string_view name = "RmMscgLowFpsWarConfig";
+    struct DISABLE : Field<0, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t FALSE = 0x0;
+        static constexpr uint32_t TRUE = 0x1;
+    };
+    struct DISABLE_INTR_ROUTING : Field<1, 1> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t FALSE = 0x0;
+        static constexpr uint32_t TRUE = 0x1;
+    };
+    using layout = Layout<DISABLE, DISABLE_INTR_ROUTING>;
+};
+
+struct RmVideoEventTrace {
+    static constexpr std::string_view name = "RmVideoEventTrace";
+    struct STAGING_BUFFER_SIZE_IN_4k : Field<15, 0> {};
+    struct EVENT_BUFFER_SIZE_IN_4k : Field<31, 16> {};
+    using layout = Layout<STAGING_BUFFER_SIZE_IN_4k, EVENT_BUFFER_SIZE_IN_4k>;
+};
+
+struct RmBootFromHs {
+    static constexpr std::string_view name = "RmBootFromHs";
+    struct ACR_AHESASC : Field<1, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLED = 0x1;
+        static constexpr uint32_t DISABLED = 0x3;
+    };
+    struct ACR_ASB : Field<3, 2> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLED = 0x1;
+        static constexpr uint32_t DISABLED = 0x3;
+    };
+    struct ACR_UNLOAD : Field<5, 4> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLED = 0x1;
+        static constexpr uint32_t DISABLED = 0x3;
+    };
+    struct NVDEC_SCRUBBER : Field<7, 6> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLED = 0x1;
+        static constexpr uint32_t DISABLED = 0x3;
+    };
+    struct NVDEC : Field<9, 8> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLED = 0x1;
+        static constexpr uint32_t DISABLED = 0x3;
+    };
+    struct SEC2 : Field<11, 10> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLED = 0x1;
+        static constexpr uint32_t DISABLED = 0x3;
+    };
+    struct GSP : Field<13, 12> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t ENABLED = 0x1;
+        static constexpr uint32_t DISABLED = 0x3;
+    };
+    using layout = Layout<ACR_AHESASC, ACR_ASB, ACR_UNLOAD, NVDEC_SCRUBBER, NVDEC, SEC2, GSP>;
+};
+
+struct RmVoltPowerUpDelayUsOverride {
+    static constexpr std::string_view name = "RmVoltPowerUpDelayUsOverride";
+    struct VAL : Field<15, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+    };
+    struct IDX : Field<23, 16> {
+        static constexpr uint32_t DEFAULT = 0x0;
+    };
+    struct RSVD : Field<31, 24> {};
+    using layout = Layout<VAL, IDX, RSVD>;
+};
+
+struct RmVoltPowerDownDelayUsOverride {
+    static constexpr std::string_view name = "RmVoltPowerDownDelayUsOverride";
+    struct VAL : Field<15, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+    };
+    struct IDX : Field<23, 16> {
+        static constexpr uint32_t DEFAULT = 0x0;
+    };
+    struct RSVD : Field<31, 24> {};
+    using layout = Layout<VAL, IDX, RSVD>;
+};
+
+struct RM2779240 {
+    static constexpr std::string_view name = "RM2779240";
+    struct CLKREQ : Field<1, 0> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+    };
+    struct DEEP_L1 : Field<3, 2> {
+        static constexpr uint32_t DEFAULT = 0x0;
+        static constexpr uint32_t DISABLE = 0x1;
+    };
+    using layout = Layout<CLKREQ, DEEP_L1>;
+};
+
+struct RmConfidentialCompute {
+    static constexpr std::string_view name = "RmConfidentialCompute";
+    struct ENABLED : Field<0, 0> {
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t YES = 0x1;
+    };
+    struct DEV_MODE_ENABLED : Field<1, 1> {
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t YES = 0x1;
+    };
+    struct GPUS_READY_CHECK : Field<2, 2> {
+        static constexpr uint32_t DISABLED = 0x0;
+        static constexpr uint32_t ENABLED = 0x1;
+    };
+    using layout = Layout<ENABLED, DEV_MODE_ENABLED, GPUS_READY_CHECK>;
+};
+
+struct RmConfComputeSpdmPolicy {
+    static constexpr std::string_view name = "RmConfComputeSpdmPolicy";
+    struct ENABLED : Field<0, 0> {
+        static constexpr uint32_t NO = 0x0;
+        static constexpr uint32_t YES = 0x1;
+    };
+    using layout = Layout<ENABLED>;
+};
+
+struct RmFbhubRelaxedOrderingOverride {
+    static constexpr std::string_view name = "RmFbhubRelaxedOrderingOverride";
+    struct WRITES : Field<1, 0> {
+        static constexpr uint32_t FORCE_RO_0 = 0x0;
+        static constexpr uint32_t FORCE_RO_1 = 0x1;
+        static constexpr uint32_t SET_RO_FROM_STRONG = 0x2;
+        static constexpr uint32_t DEFAULT = 0x3;
+    };
+    struct READS : Field<3, 2> {
+        static constexpr uint32_t FORCE_RO_0 = 0x0;
+        static constexpr uint32_t FORCE_RO_1 = 0x1;
+        static constexpr uint32_t SET_RO_FROM_STRONG = 0x2;
+        static constexpr uint32_t DEFAULT = 0x3;
+    };
+    struct ATOMICS : Field<5, 4> {
+        static constexpr uint32_t FORCE_RO_0 = 0x0;
+        static constexpr uint32_t FORCE_RO_1 = 0x1;
+        static constexpr uint32_t SET_RO_FROM_STRONG = 0x2;
+        static constexpr uint32_t DEFAULT = 0x3;
+    };
+    struct DOWNSTREAM_WRITES : Field<7, 6> {
+        static constexpr uint32_t SRC = 0x0;
+        static constexpr uint32_t ALL = 0x1;
+        static constexpr uint32_t NONE = 0x2;
+        static constexpr uint32_t DEFAULT = 0x3;
+    };
+    struct DOWNSTREAM_CPLS : Field<10, 8> {
+        static constexpr uint32_t ALLOWS_SRC = 0x0;
+        static constexpr uint32_t ALLOWS_SRC_L2B_ONLY = 0x1;
+        static constexpr uint32_t ALLOWS_SRC_L2R_ONLY = 0x2;
+        static constexpr uint32_t ALLOWS_NONE = 0x3;
+        static constexpr uint32_t DEFAULT = 0x4;
+    };
+    using layout = Layout<WRITES, READS, ATOMICS, DOWNSTREAM_WRITES, DOWNSTREAM_CPLS>;
+};
+
+struct RmAssertOnPostedRegAccessErrors {
+    static constexpr std::string_view name = "RmAssertOnPostedRegAccessErrors";
+    struct PMU : Field<0, 0> {
+        static constexpr uint32_t DISABLE = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+    };
+    struct I2C : Field<1, 1> {
+        static constexpr uint32_t DISABLE = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+    };
+    struct FBFALCON : Field<2, 2> {
+        static constexpr uint32_t DISABLE = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+    };
+    struct SEC2 : Field<3, 3> {
+        static constexpr uint32_t DISABLE = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+    };
+    struct GSP : Field<4, 4> {
+        static constexpr uint32_t DISABLE = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+    };
+    struct NVDEC : Field<5, 5> {
+        static constexpr uint32_t DISABLE = 0x0;
+        static constexpr uint32_t ENABLE = 0x1;
+    };
+    using layout = Layout<PMU, I2C, FBFALCON, SEC2, GSP, NVDEC>;
+};
+
+} // namespace fields
+
+} // namespace rmreg
+
+#endif // NVTOOLS_RMREG_FIELDS_H
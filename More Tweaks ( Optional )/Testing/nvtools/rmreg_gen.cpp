@@ -0,0 +1,397 @@
+// rmreg_gen.cpp
+//
+// Generates rmreg_catalog.h and rmreg_fields.h from nvRmReg.h.
+//
+//   rmreg_gen "../nvRmReg.h" .
+
+#include "mapped_file.h"
+#include "rmreg_scan.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace {
+
+const char* type_name(rmreg::KeyType t)
+{
+    switch (t) {
+    case rmreg::KeyType::Dword:  return "KeyType::Dword";
+    case rmreg::KeyType::Binary: return "KeyType::Binary";
+    case rmreg::KeyType::String: return "KeyType::String";
+    default:                     return "KeyType::Unknown";
+    }
+}
+
+struct HashTables {
+    std::vector<uint16_t> displace;
+    std::vector<uint16_t> slots;
+};
+
+// Hash-and-displace: place the biggest buckets first, and for each bucket try
+// displacements until all of its keys land in free, distinct slots.
+bool build_perfect_hash(const std::vector<std::string_view>& names, HashTables& t)
+{
+    uint32_t slot_count = 1;
+    while (slot_count < names.size())
+        slot_count <<= 1;
+    uint32_t bucket_count = std::max<uint32_t>(1, uint32_t(names.size() / 3));
+
+    std::vector<std::vector<uint32_t>> buckets(bucket_count);
+    std::vector<uint64_t> hashes(names.size());
+    for (uint32_t i = 0; i < names.size(); ++i) {
+        hashes[i] = rmreg::hash_name(names[i]);
+        buckets[hashes[i] % bucket_count].push_back(i);
+    }
+    std::vector<uint32_t> order(bucket_count);
+    for (uint32_t b = 0; b < bucket_count; ++b)
+        order[b] = b;
+    std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+        return buckets[a].size() > buckets[b].size();
+    });
+
+    t.displace.assign(bucket_count, 0);
+    t.slots.assign(slot_count, rmreg::PerfectHash::kEmpty);
+    std::vector<uint32_t> taken;
+    for (uint32_t b : order) {
+        if (buckets[b].empty())
+            break;
+        bool placed = false;
+        for (uint32_t d = 0; d < 0xffff && !placed; ++d) {
+            taken.clear();
+            placed = true;
+            for (uint32_t k : buckets[b]) {
+                uint32_t s = rmreg::PerfectHash::slot_of(hashes[k], uint16_t(d), slot_count - 1);
+                if (t.slots[s] != rmreg::PerfectHash::kEmpty
+                    || std::find(taken.begin(), taken.end(), s) != taken.end()) {
+                    placed = false;
+                    break;
+                }
+                taken.push_back(s);
+            }
+            if (placed) {
+                t.displace[b] = uint16_t(d);
+                for (size_t i = 0; i < taken.size(); ++i)
+                    t.slots[taken[i]] = uint16_t(buckets[b][i]);
+            }
+        }
+        if (!placed)
+            return false;
+    }
+    return true;
+}
+
+struct FieldValue {
+    std::string name;
+    uint32_t value;
+};
+
+struct KeyField {
+    std::string_view macro;
+    std::string name;
+    rmreg::BitRange range;
+    uint16_t condition;
+    bool in_layout;
+    std::string overlaps;           // first layout field it collides with
+    std::vector<FieldValue> values;
+};
+
+// Turns a macro suffix into something usable as a C++ identifier.
+std::string identifier(std::string_view s)
+{
+    std::string out;
+    if (s.empty() || std::isdigit(uint8_t(s[0])))
+        out += '_';
+    for (char c : s)
+        out += (std::isalnum(uint8_t(c)) || c == '_') ? c : '_';
+    return out;
+}
+
+// Fields of a key in header order, each with its named values. A field goes
+// into the key's Layout unless it shares bits with one that is already in it
+// (the header has aliases like ELCG_PPP / ELCG_MPEG, and a few real clashes).
+std::vector<KeyField> key_fields(const rmreg::Index& ix, const rmreg::KeyBlock& k)
+{
+    std::vector<KeyField> fields;
+    std::string_view macro = ix.key_macro(k);
+    for (uint32_t c = 0; c < k.child_count; ++c) {
+        const rmreg::Define& d = ix.defines[ix.children[k.child_begin + c]];
+        if (auto r = rmreg::parse_range(d.value))
+            fields.push_back(KeyField{d.name, identifier(d.name.substr(macro.size() + 1)),
+                                      *r, d.condition, true, {}, {}});
+    }
+
+    uint32_t seen = 0;
+    for (KeyField& f : fields) {
+        uint32_t mask = rmreg::FieldDesc{{}, f.range.hi, f.range.lo, 0}.mask();
+        if (seen & mask) {
+            f.in_layout = false;
+            for (const KeyField& g : fields)
+                if (g.in_layout && &g != &f
+                    && (rmreg::FieldDesc{{}, g.range.hi, g.range.lo, 0}.mask() & mask)) {
+                    f.overlaps = g.name;
+                    break;
+                }
+        }
+        seen |= f.in_layout ? mask : 0;
+    }
+
+    for (uint32_t c = 0; c < k.child_count; ++c) {
+        const rmreg::Define& d = ix.defines[ix.children[k.child_begin + c]];
+        if (rmreg::parse_range(d.value))
+            continue;
+        KeyField* owner = nullptr;
+        for (KeyField& f : fields)
+            if (d.name.size() > f.macro.size() + 1
+                && d.name.substr(0, f.macro.size()) == f.macro && d.name[f.macro.size()] == '_'
+                && (!owner || f.macro.size() > owner->macro.size()))
+                owner = &f;
+        if (!owner)
+            continue;
+        auto v = rmreg::evaluate(ix, d.value);
+        if (!v)
+            continue;
+        uint32_t max = rmreg::FieldDesc{{}, owner->range.hi, owner->range.lo, 0}.mask() >> owner->range.lo;
+        if (*v > max) {
+            std::fprintf(stderr, "note: %.*s = 0x%x does not fit %u:%u, skipped\n",
+                         int(d.name.size()), d.name.data(), *v, owner->range.hi, owner->range.lo);
+            continue;
+        }
+        owner->values.push_back({identifier(d.name.substr(owner->macro.size() + 1)), *v});
+    }
+    return fields;
+}
+
+void write_table(FILE* f, const char* name, const std::vector<uint16_t>& v)
+{
+    std::fprintf(f, "inline constexpr uint16_t %s[%zu] = {", name, v.size());
+    for (size_t i = 0; i < v.size(); ++i)
+        std::fprintf(f, "%s%u,", i % 16 ? " " : "\n    ", v[i]);
+    std::fprintf(f, "\n};\n\n");
+}
+
+bool write_catalog(const std::string& path, const rmreg::Index& ix,
+                   const std::vector<std::vector<KeyField>>& fields, const HashTables& tables)
+{
+    FILE* f = std::fopen(path.c_str(), "wb");
+    if (!f)
+        return false;
+    std::fprintf(f,
+        "// rmreg_catalog.h\n"
+        "//\n"
+        "// Generated by rmreg_gen from nvRmReg.h - do not edit.\n"
+        "\n"
+        "#ifndef NVTOOLS_RMREG_CATALOG_H\n"
+        "#define NVTOOLS_RMREG_CATALOG_H\n"
+        "\n"
+        "#include \"rmreg.h\"\n"
+        "\n"
+        "namespace rmreg {\n"
+        "\n");
+
+    std::fprintf(f, "// Config symbols the header's #if lines test; bit i of a TruthTable\n"
+                    "// assignment is kSymbols[i].\n");
+    std::fprintf(f, "inline constexpr std::string_view kSymbols[%zu] = {\n",
+                 std::max<size_t>(ix.symbols.size(), 1));
+    for (const std::string& s : ix.symbols)
+        std::fprintf(f, "    \"%s\",\n", s.c_str());
+    if (ix.symbols.empty())
+        std::fprintf(f, "    \"\",\n");
+    std::fprintf(f, "};\n\n");
+
+    std::fprintf(f, "inline constexpr Condition kConditions[%zu] = {\n", ix.conditions.size());
+    for (const rmreg::BuildCondition& c : ix.conditions)
+        std::fprintf(f, "    {\"%s\", {{0x%016llx, 0x%016llx, 0x%016llx, 0x%016llx}}},\n",
+                     c.expr.c_str(), (unsigned long long)c.truth.w[0], (unsigned long long)c.truth.w[1],
+                     (unsigned long long)c.truth.w[2], (unsigned long long)c.truth.w[3]);
+    rmreg::Variant release = rmreg::release_variant(ix);
+    std::fprintf(f, "};\n\n"
+                    "// Retail driver: DEBUG, DEVELOP, QA_BUILD, NV_MODS and NV_VERIF_FEATURES\n"
+                    "// off, RMCFG_* features either way.\n"
+                    "inline constexpr Variant kRelease{0x%02x, 0x%02x};\n\n",
+                 release.on, release.off);
+
+    size_t field_count = 0;
+    for (const auto& kf : fields)
+        field_count += kf.size();
+    std::fprintf(f, "inline constexpr FieldDesc kFields[%zu] = {\n", std::max<size_t>(field_count, 1));
+    for (const auto& kf : fields)
+        for (const KeyField& fd : kf)
+            std::fprintf(f, "    {\"%s\", %u, %u, %u},\n", fd.name.c_str(), fd.range.hi,
+                         fd.range.lo, fd.condition);
+    if (field_count == 0)
+        std::fprintf(f, "    {\"\", 0, 0, 0},\n");
+    std::fprintf(f, "};\n\n");
+
+    std::fprintf(f, "inline constexpr Key kKeys[%zu] = {\n", ix.keys.size());
+    size_t field_begin = 0;
+    for (size_t i = 0; i < ix.keys.size(); ++i) {
+        const rmreg::KeyBlock& k = ix.keys[i];
+        auto def = rmreg::documented_default(ix, k);
+        std::fprintf(f, "    {\"%.*s\", \"%.*s\", %s, %s, 0x%08x, %zu, %zu, %u},\n",
+                     int(ix.key_macro(k).size()), ix.key_macro(k).data(),
+                     int(ix.key_name(k).size()), ix.key_name(k).data(),
+                     type_name(rmreg::declared_type(ix, k)),
+                     def ? "true" : "false", def ? *def : 0u,
+                     field_begin, fields[i].size(), ix.key_define(k).condition);
+        field_begin += fields[i].size();
+    }
+    std::fprintf(f, "};\n\n");
+    write_table(f, "kDisplace", tables.displace);
+    write_table(f, "kSlots", tables.slots);
+    std::fprintf(f,
+        "inline constexpr PerfectHash kIndex{kDisplace, %zu, kSlots, %zu};\n"
+        "\n"
+        "constexpr const Key* find(std::string_view name)\n"
+        "{\n"
+        "    return find_in(kKeys, kIndex, name);\n"
+        "}\n"
+        "\n"
+        "constexpr FieldRange fields_of(const Key& key)\n"
+        "{\n"
+        "    return {kFields + key.field_begin, key.field_count};\n"
+        "}\n"
+        "\n"
+        "constexpr const Condition& condition_of(const Key& key)\n"
+        "{\n"
+        "    return kConditions[key.condition];\n"
+        "}\n"
+        "\n"
+        "constexpr Liveness live_in_release(const Key& key)\n"
+        "{\n"
+        "    return kConditions[key.condition].live(kRelease);\n"
+        "}\n"
+        "\n"
+        "// False only for keys no retail driver reads, whatever its RMCFG features.\n"
+        "constexpr bool is_live_in_release(const Key& key)\n"
+        "{\n"
+        "    return live_in_release(key) != Liveness::Never;\n"
+        "}\n"
+        "\n"
+        "} // namespace rmreg\n"
+        "\n"
+        "#endif // NVTOOLS_RMREG_CATALOG_H\n",
+        tables.displace.size(), tables.slots.size() - 1);
+    return std::fclose(f) == 0;
+}
+
+bool write_fields(const std::string& path, const rmreg::Index& ix,
+                  const std::vector<std::vector<KeyField>>& fields)
+{
+    FILE* f = std::fopen(path.c_str(), "wb");
+    if (!f)
+        return false;
+    std::fprintf(f,
+        "// rmreg_fields.h\n"
+        "//\n"
+        "// Generated by rmreg_gen from nvRmReg.h - do not edit.\n"
+        "//\n"
+        "// rmreg::drf has one Field per \"hi:lo\" macro, named like the macro.\n"
+        "// rmreg::fields has one struct per packed key, named like the registry\n"
+        "// value, holding its fields, their named values and a Layout.\n"
+        "\n"
+        "#ifndef NVTOOLS_RMREG_FIELDS_H\n"
+        "#define NVTOOLS_RMREG_FIELDS_H\n"
+        "\n"
+        "#include \"rmreg_field.h\"\n"
+        "\n"
+        "#include <string_view>\n"
+        "\n"
+        "namespace rmreg {\n"
+        "\n"
+        "namespace drf {\n");
+    for (const rmreg::Define& d : ix.defines)
+        if (auto r = rmreg::parse_range(d.value))
+            std::fprintf(f, "using %.*s = Field<%u, %u>;\n",
+                         int(d.name.size()), d.name.data(), r->hi, r->lo);
+    std::fprintf(f, "} // namespace drf\n\nnamespace fields {\n");
+
+    for (size_t i = 0; i < ix.keys.size(); ++i) {
+        if (fields[i].empty())
+            continue;
+        std::string_view name = ix.key_name(ix.keys[i]);
+        std::fprintf(f, "\nstruct %s {\n", identifier(name).c_str());
+        std::fprintf(f, "    static constexpr std::string_view name = \"%.*s\";\n",
+                     int(name.size()), name.data());
+        for (const KeyField& fd : fields[i]) {
+            std::fprintf(f, "    struct %s : Field<%u, %u> {", fd.name.c_str(), fd.range.hi, fd.range.lo);
+            if (fd.values.empty()) {
+                std::fprintf(f, "};\n");
+                continue;
+            }
+            std::fprintf(f, "\n");
+            for (const FieldValue& v : fd.values)
+                std::fprintf(f, "        static constexpr uint32_t %s = 0x%x;\n", v.name.c_str(), v.value);
+            std::fprintf(f, "    };\n");
+        }
+        std::string members;
+        for (const KeyField& fd : fields[i]) {
+            if (!fd.in_layout) {
+                std::fprintf(f, "    // %s overlaps %s, not in layout\n", fd.name.c_str(),
+                             fd.overlaps.c_str());
+                continue;
+            }
+            members += (members.empty() ? "" : ", ") + fd.name;
+        }
+        std::fprintf(f, "    using layout = Layout<%s>;\n};\n", members.c_str());
+    }
+    std::fprintf(f,
+        "\n"
+        "} // namespace fields\n"
+        "\n"
+        "} // namespace rmreg\n"
+        "\n"
+        "#endif // NVTOOLS_RMREG_FIELDS_H\n");
+    return std::fclose(f) == 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc != 3) {
+        std::fprintf(stderr, "usage: rmreg_gen <nvRmReg.h> <output dir>\n");
+        return 2;
+    }
+    nvtools::MappedFile file;
+    if (!file.open(argv[1])) {
+        std::fprintf(stderr, "error: cannot read %s\n", argv[1]);
+        return 1;
+    }
+    rmreg::Index ix = rmreg::index_header(file.view());
+    if (ix.keys.size() >= rmreg::PerfectHash::kEmpty) {
+        std::fprintf(stderr, "error: too many keys (%zu)\n", ix.keys.size());
+        return 1;
+    }
+    if (ix.symbols.size() > rmreg::kMaxSymbols) {
+        std::fprintf(stderr, "error: #if lines test %zu symbols, at most %zu are supported\n",
+                     ix.symbols.size(), rmreg::kMaxSymbols);
+        return 1;
+    }
+
+    std::vector<std::string_view> names;
+    std::vector<std::vector<KeyField>> fields;
+    for (const rmreg::KeyBlock& k : ix.keys) {
+        names.push_back(ix.key_name(k));
+        fields.push_back(key_fields(ix, k));
+    }
+    HashTables tables;
+    if (!build_perfect_hash(names, tables)) {
+        std::fprintf(stderr, "error: no perfect hash found\n");
+        return 1;
+    }
+
+    std::string dir = argv[2];
+    if (!dir.empty() && dir.back() != '/' && dir.back() != '\\')
+        dir += '/';
+    if (!write_catalog(dir + "rmreg_catalog.h", ix, fields, tables)
+        || !write_fields(dir + "rmreg_fields.h", ix, fields)) {
+        std::fprintf(stderr, "error: cannot write to %s\n", argv[2]);
+        return 1;
+    }
+    std::fprintf(stderr, "%zu keys, %zu buckets, %zu slots\n",
+                 ix.keys.size(), tables.displace.size(), tables.slots.size());
+    return 0;
+}
@@ -0,0 +1,470 @@
+// rmreg_lint.cpp
+
+#include "rmreg_lint.h"
+
+#include "byte_scan.h"
+#include "rmreg_blob.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+
+namespace rmreg {
+
+namespace {
+
+using nvtools::edit_distance;
+using nvtools::ends_with_nocase;
+using nvtools::find_nocase;
+using nvtools::folded;
+using nvtools::starts_with_nocase;
+using nvtools::trim;
+
+// before ends with word, in any case, as a word of its own.
+bool ends_with_word(std::string_view before, std::string_view word)
+{
+    size_t n = word.size();
+    return ends_with_nocase(before, word)
+        && (before.size() == n || std::isspace(uint8_t(before[before.size() - n - 1])));
+}
+
+// Where a reg add or reg delete command starts on the line, npos if
+// nowhere. reg is matched in any case, as reg or reg.exe, with or without a
+// path ("Reg.exe add", "(reg add", "do "%WINDIR%\System32\reg.exe" delete"),
+// and has to start a command: "echo reg add" and "regedit" do not.
+size_t find_reg_command(std::string_view line, bool& remove)
+{
+    size_t at = find_nocase(line, "reg");
+    while (at != std::string_view::npos) {
+        size_t start = at;
+        if (start && (line[start - 1] == '\\' || line[start - 1] == '/'))
+            while (start && !std::isspace(uint8_t(line[start - 1])) && line[start - 1] != '"')
+                --start;
+        if (start && line[start - 1] == '"')
+            --start;
+        // Less any @ and redirections: ">nul 2>&1 reg add".
+        std::string_view before = trim(line.substr(0, start));
+        while (!before.empty()) {
+            size_t space = before.find_last_of(" \t");
+            std::string_view last = before.substr(space == std::string_view::npos ? 0 : space + 1);
+            if (last.find_first_of("<>") == std::string_view::npos && before.back() != '@')
+                break;
+            before = trim(before.substr(0, before.back() == '@' ? before.size() - 1 : before.size() - last.size()));
+        }
+        bool command = before.empty() || before.back() == '(' || before.back() == '&' || before.back() == '|'
+            || ends_with_word(before, "do") || ends_with_word(before, "else");
+
+        size_t end = at + 3;
+        if (iequals(line.substr(end, 4), ".exe"))
+            end += 4;
+        if (end < line.size() && line[end] == '"' && line[start] == '"')
+            ++end;
+        size_t verb = end;
+        while (verb < line.size() && std::isspace(uint8_t(line[verb])))
+            ++verb;
+        std::string_view rest = line.substr(verb);
+        size_t word = 0;
+        while (word < rest.size() && !std::isspace(uint8_t(rest[word])))
+            ++word;
+        rest = rest.substr(0, word);
+        if (command && verb > end && (iequals(rest, "add") || iequals(rest, "delete"))) {
+            remove = iequals(rest, "delete");
+            return start;
+        }
+        size_t next = find_nocase(line.substr(at + 1), "reg");
+        at = next == std::string_view::npos ? next : at + 1 + next;
+    }
+    return std::string_view::npos;
+}
+
+template <class Fn>
+void for_each_line(std::string_view text, Fn&& fn)
+{
+    uint32_t number = 1;
+    size_t pos = 0;
+    while (pos < text.size()) {
+        size_t end = text.find_first_of("\r\n", pos);
+        if (end == std::string_view::npos)
+            end = text.size();
+        fn(text.substr(pos, end - pos), number++);
+        bool crlf = end + 1 < text.size() && text[end] == '\r' && text[end + 1] == '\n';
+        pos = end + (crlf ? 2 : 1);
+    }
+}
+
+// Lower-cased camel-case words: "RMLpwrGrIdleThresholdUs" -> rm lpwr gr idle
+// threshold us.
+std::vector<std::string> words(std::string_view name)
+{
+    std::vector<std::string> out;
+    std::string cur;
+    for (size_t i = 0; i < name.size(); ++i) {
+        char c = name[i];
+        bool upper = std::isupper(uint8_t(c));
+        bool split = !cur.empty()
+            && ((upper && std::islower(uint8_t(name[i - 1])))
+                || (upper && i + 1 < name.size() && std::islower(uint8_t(name[i + 1]))
+                    && std::isupper(uint8_t(name[i - 1])))
+                || (std::isdigit(uint8_t(c)) != std::isdigit(uint8_t(name[i - 1]))));
+        if (split || !std::isalnum(uint8_t(c))) {
+            if (!cur.empty())
+                out.push_back(cur);
+            cur.clear();
+        }
+        if (std::isalnum(uint8_t(c)))
+            cur += fold(c);
+    }
+    if (!cur.empty())
+        out.push_back(cur);
+    return out;
+}
+
+// reg add /d as reg.exe reads it for a REG_DWORD: hex after 0x, decimal
+// otherwise, so /d 010 is ten, not octal eight.
+std::optional<uint32_t> parse_data(std::string_view s)
+{
+    if (s.empty() || s.find('%') != std::string_view::npos || s.find('!') != std::string_view::npos)
+        return std::nullopt;
+    bool hex = starts_with_nocase(s, "0x");
+    std::string t(hex ? s.substr(2) : s);
+    if (t.empty() || !std::isxdigit(uint8_t(t[0])))
+        return std::nullopt;
+    char* end = nullptr;
+    unsigned long long v = std::strtoull(t.c_str(), &end, hex ? 16 : 10);
+    if (*end != '\0' || v > 0xffffffffull)
+        return std::nullopt;
+    return uint32_t(v);
+}
+
+// Splits a command line into arguments, honouring double quotes.
+std::vector<std::string_view> arguments(std::string_view s)
+{
+    std::vector<std::string_view> out;
+    size_t i = 0;
+    while (i < s.size()) {
+        while (i < s.size() && std::isspace(uint8_t(s[i])))
+            ++i;
+        if (i >= s.size())
+            break;
+        if (s[i] == '"') {
+            size_t e = s.find('"', i + 1);
+            if (e == std::string_view::npos)
+                e = s.size();
+            out.push_back(s.substr(i + 1, e - i - 1));
+            i = e + 1;
+        } else {
+            size_t e = i;
+            while (e < s.size() && !std::isspace(uint8_t(s[e])))
+                ++e;
+            out.push_back(s.substr(i, e - i));
+            i = e;
+        }
+    }
+    return out;
+}
+
+RegType bat_type(std::string_view t)
+{
+    if (iequals(t, "REG_DWORD"))
+        return RegType::Dword;
+    if (iequals(t, "REG_QWORD"))
+        return RegType::Qword;
+    if (iequals(t, "REG_SZ") || iequals(t, "REG_EXPAND_SZ") || iequals(t, "REG_MULTI_SZ"))
+        return RegType::String;
+    if (iequals(t, "REG_BINARY"))
+        return RegType::Binary;
+    return RegType::Other;
+}
+
+void append_utf8(std::string& out, uint32_t cp)
+{
+    if (cp < 0x80) {
+        out += char(cp);
+    } else if (cp < 0x800) {
+        out += char(0xc0 | (cp >> 6));
+        out += char(0x80 | (cp & 0x3f));
+    } else if (cp < 0x10000) {
+        out += char(0xe0 | (cp >> 12));
+        out += char(0x80 | ((cp >> 6) & 0x3f));
+        out += char(0x80 | (cp & 0x3f));
+    } else {
+        out += char(0xf0 | (cp >> 18));
+        out += char(0x80 | ((cp >> 12) & 0x3f));
+        out += char(0x80 | ((cp >> 6) & 0x3f));
+        out += char(0x80 | (cp & 0x3f));
+    }
+}
+
+const char* type_text(KeyType t)
+{
+    switch (t) {
+    case KeyType::Dword:  return "DWORD";
+    case KeyType::Binary: return "BINARY";
+    case KeyType::String: return "STRING";
+    default:              return "untyped";
+    }
+}
+
+std::string hex(uint32_t v)
+{
+    char buf[16];
+    std::snprintf(buf, sizeof buf, "0x%x", v);
+    return buf;
+}
+
+} // namespace
+
+std::string decode_text(std::string_view raw)
+{
+    auto byte = [&](size_t i) { return uint8_t(raw[i]); };
+    if (raw.size() >= 3 && byte(0) == 0xef && byte(1) == 0xbb && byte(2) == 0xbf)
+        return std::string(raw.substr(3));
+    bool le = raw.size() >= 2 && byte(0) == 0xff && byte(1) == 0xfe;
+    bool be = raw.size() >= 2 && byte(0) == 0xfe && byte(1) == 0xff;
+    if (!le && !be)
+        return std::string(raw);
+
+    std::string out;
+    out.reserve(raw.size() / 2);
+    for (size_t i = 2; i + 1 < raw.size(); i += 2) {
+        uint32_t u = le ? byte(i) | byte(i + 1) << 8 : byte(i) << 8 | byte(i + 1);
+        if (u >= 0xd800 && u < 0xdc00 && i + 3 < raw.size()) {
+            uint32_t lo = le ? byte(i + 2) | byte(i + 3) << 8 : byte(i + 2) << 8 | byte(i + 3);
+            if (lo >= 0xdc00 && lo < 0xe000) {
+                u = 0x10000 + ((u - 0xd800) << 10) + (lo - 0xdc00);
+                i += 2;
+            }
+        }
+        append_utf8(out, u);
+    }
+    return out;
+}
+
+std::vector<RegWrite> parse_reg_file(std::string_view text)
+{
+    std::vector<RegWrite> out;
+    bool continued = false;
+    for_each_line(text, [&](std::string_view line, uint32_t number) {
+        line = trim(line);
+        if (continued) {
+            // hex:01,02,\ goes on in the next line; the lines are views into
+            // text, so the data just grows.
+            std::string_view& data = out.back().data;
+            if (!line.empty())
+                data = std::string_view(data.data(), size_t(line.data() + line.size() - data.data()));
+            continued = !line.empty() && line.back() == '\\';
+            return;
+        }
+        if (line.empty() || line[0] != '"')
+            return;
+        size_t q = 1;
+        while (q < line.size() && line[q] != '"')
+            q += line[q] == '\\' ? 2 : 1;
+        if (q >= line.size())
+            return;
+        RegWrite w{line.substr(1, q - 1), RegType::Other, std::nullopt, number, {}};
+        std::string_view data = trim(line.substr(q + 1));
+        if (data.empty() || data[0] != '=')
+            return;
+        data = trim(data.substr(1));
+        w.data = data;
+        continued = !data.empty() && data.back() == '\\';
+        if (data.empty()) {
+            w.type = RegType::Empty;
+        } else if (data == "-") {
+            w.type = RegType::Delete;
+        } else if (starts_with_nocase(data, "dword:")) {
+            w.type = RegType::Dword;
+            std::string_view digits = trim(data.substr(6));
+            if (!digits.empty() && digits.size() <= 8) {
+                char* end = nullptr;
+                std::string d(digits);
+                unsigned long v = std::strtoul(d.c_str(), &end, 16);
+                if (*end == '\0')
+                    w.dword = uint32_t(v);
+            }
+        } else if (starts_with_nocase(data, "hex(b):")) {
+            w.type = RegType::Qword;
+        } else if (starts_with_nocase(data, "hex(2):") || starts_with_nocase(data, "hex(7):")
+                   || data[0] == '"') {
+            w.type = RegType::String;
+        } else if (starts_with_nocase(data, "hex:")) {
+            w.type = RegType::Binary;
+        }
+        out.push_back(w);
+    });
+    return out;
+}
+
+std::vector<RegWrite> parse_bat_file(std::string_view text)
+{
+    std::vector<RegWrite> out;
+    for_each_line(text, [&](std::string_view line, uint32_t number) {
+        bool remove = false;
+        size_t at = find_reg_command(line, remove);
+        if (at == std::string_view::npos)
+            return;
+        std::vector<std::string_view> args = arguments(line.substr(at));
+        RegWrite w{{}, remove ? RegType::Delete : RegType::Other, std::nullopt, number, {}};
+        std::string_view data;
+        bool has_name = false;
+        for (size_t i = 2; i + 1 < args.size(); ++i) {
+            if (iequals(args[i], "/v")) {
+                w.name = args[++i];
+                has_name = true;
+            } else if (iequals(args[i], "/t") && !remove) {
+                w.type = bat_type(args[++i]);
+            } else if (iequals(args[i], "/d")) {
+                data = args[++i];
+            }
+        }
+        if (!has_name)
+            return;
+        if (w.type == RegType::Other && !remove)
+            w.type = RegType::String;       // reg add's default is REG_SZ
+        if (w.type == RegType::Dword)
+            w.dword = parse_data(data);
+        w.data = data;
+        out.push_back(w);
+    });
+    return out;
+}
+
+KeyIndex::KeyIndex(const Index& ix)
+{
+    const Variant release = release_variant(ix);
+    keys_.reserve(ix.keys.size());
+    for (const KeyBlock& k : ix.keys) {
+        LintKey lk{extract_meta(ix, k), {}, 0, Liveness::Always, ix.key_condition(k).expr};
+        std::string_view macro = ix.key_macro(k);
+        for (uint32_t c = 0; c < k.child_count; ++c) {
+            const Define& d = ix.defines[ix.children[k.child_begin + c]];
+            if (auto r = parse_range(d.value)) {
+                FieldDesc f{{}, r->hi, r->lo, 0};
+                lk.field_mask |= f.mask();
+                lk.fields.push_back({std::string(d.name.substr(macro.size() + 1)), f, {}, {}});
+            }
+        }
+        for (FieldLimit& f : lk.fields) {
+            std::string prefix = std::string(macro) + "_" + f.name + "_";
+            if (const Define* d = ix.find_define(prefix + "MIN"))
+                f.min = evaluate(ix, d->value);
+            if (const Define* d = ix.find_define(prefix + "MAX"))
+                f.max = evaluate(ix, d->value);
+        }
+        const BuildCondition& bc = ix.key_condition(k);
+        lk.release = Condition{bc.expr, bc.truth}.live(release);
+
+        uint32_t i = uint32_t(keys_.size());
+        if (!by_name_.emplace(folded(lk.meta.name), i).second)
+            continue;
+        for (std::string& w : words(lk.meta.name)) {
+            std::vector<uint32_t>& posting = by_word_[w];
+            if (posting.empty() || posting.back() != i)
+                posting.push_back(i);
+        }
+        keys_.push_back(std::move(lk));
+    }
+}
+
+const LintKey* KeyIndex::find(std::string_view name) const
+{
+    auto it = by_name_.find(folded(name));
+    return it == by_name_.end() ? nullptr : &keys_[it->second];
+}
+
+const LintKey* KeyIndex::suggest(std::string_view name) const
+{
+    std::unordered_map<uint32_t, uint32_t> score;
+    std::vector<std::string> ws = words(name);
+    for (const std::string& w : ws) {
+        // Every key starts with "rm", it says nothing.
+        if (w == "rm")
+            continue;
+        auto it = by_word_.find(w);
+        if (it != by_word_.end())
+            for (uint32_t k : it->second)
+                ++score[k];
+    }
+    // Of the keys sharing a word, the nearest in spelling, if it is near
+    // enough to be a typo: an eighth of the name's letters at most.
+    std::string folded_name = folded(name);
+    size_t limit = std::max<size_t>(1, name.size() / 8);
+    size_t best_distance = limit + 1;
+    uint32_t best = 0, best_score = 0;
+    for (const auto& [k, s] : score) {
+        size_t d = edit_distance(folded_name, folded(keys_[k].meta.name), limit);
+        if (d < best_distance || (d == best_distance && (s > best_score || (s == best_score && k < best)))) {
+            best = k;
+            best_score = s;
+            best_distance = d;
+        }
+    }
+    return best_distance <= limit ? &keys_[best] : nullptr;
+}
+
+void lint_writes(const KeyIndex& keys, const std::vector<RegWrite>& writes,
+                 std::vector<Finding>& out)
+{
+    for (const RegWrite& w : writes) {
+        if (w.type == RegType::Delete)
+            continue;
+        std::string name(w.name);
+        if (w.type == RegType::Empty) {
+            // regedit refuses the whole file over it.
+            out.push_back({w.line, Severity::Error, name + " has no data after the ="});
+            continue;
+        }
+        if (const BlobSchema* s = w.type == RegType::Binary ? find_blob_schema(w.name) : nullptr) {
+            auto bytes = parse_hex(w.data);
+            std::string why = "data is not hex";
+            if (!bytes || !BlobView(*s, bytes->data(), bytes->size()).check(&why))
+                out.push_back({w.line, Severity::Error, name + ": " + why});
+        }
+        const LintKey* k = keys.find(w.name);
+        if (!k) {
+            if (starts_with_nocase(w.name, "rm") && w.name.size() > 2 && std::isupper(uint8_t(w.name[2]))) {
+                std::string msg = name + " is not a key in nvRmReg.h";
+                if (const LintKey* s = keys.suggest(w.name))
+                    msg += ", did you mean " + s->meta.name + "?";
+                out.push_back({w.line, Severity::Error, msg});
+            }
+            continue;
+        }
+        const KeyMeta& m = k->meta;
+        bool numeric = w.type == RegType::Dword || w.type == RegType::Qword;
+        if ((m.type == KeyType::String || m.type == KeyType::Binary) && numeric)
+            out.push_back({w.line, Severity::Error,
+                           name + " is a " + type_text(m.type) + " key, written as a number"});
+        if (m.type == KeyType::Dword && !m.type_inferred
+            && (w.type == RegType::String || w.type == RegType::Binary))
+            out.push_back({w.line, Severity::Error, name + " is a DWORD key, written as "
+                           + (w.type == RegType::String ? "a string" : "binary")});
+        if (k->release == Liveness::Never)
+            out.push_back({w.line, Severity::Warning,
+                           name + " is only read by debug/test drivers (#if " + k->condition + ")"});
+        if (!w.dword)
+            continue;
+        uint32_t v = *w.dword;
+        if ((m.min && v < *m.min) || (m.max && v > *m.max))
+            out.push_back({w.line, Severity::Error,
+                           name + " = " + std::to_string(v) + " is outside "
+                           + (m.min ? std::to_string(*m.min) : std::string("0")) + ".."
+                           + (m.max ? std::to_string(*m.max) : std::string("0xffffffff"))});
+        if (k->field_mask && (v & ~k->field_mask))
+            out.push_back({w.line, Severity::Error,
+                           name + " = " + hex(v) + " sets bits " + hex(v & ~k->field_mask)
+                           + " outside every field"});
+        for (const FieldLimit& f : k->fields) {
+            uint32_t fv = f.field.get(v);
+            if ((f.min && fv < *f.min) || (f.max && fv > *f.max))
+                out.push_back({w.line, Severity::Error,
+                               name + " = " + hex(v) + ": " + f.name + " is " + std::to_string(fv)
+                               + ", outside " + (f.min ? std::to_string(*f.min) : std::string("0"))
+                               + ".." + (f.max ? std::to_string(*f.max) : std::string("max"))});
+        }
+    }
+}
+
+} // namespace rmreg
@@ -0,0 +1,107 @@
+// rmreg_lint.h
+//
+// Checks the registry writes in .reg and .bat files against nvRmReg.h:
+//
+//   - an Rm*/RM* value name the header does not define
+//   - a value outside the key's range, or over 1 for a boolean
+//   - bits set outside every DRF field of a packed key, or a field value
+//     below its _MIN / above its _MAX
+//   - a DWORD written to a STRING/BINARY key or the other way round
+//   - a key only debug/test drivers read (warning)
+//   - a BINARY value that does not fit its layout in rmreg_blob.h
+//   - a .reg value with no data ("Name"=), which regedit will not import
+//
+// Names are matched case-insensitively through KeyIndex, an inverted index
+// from the folded name, and from every camel-case word of it, to the keys.
+// The words give "did you mean" hints for names that are off by a word.
+
+#ifndef NVTOOLS_RMREG_LINT_H
+#define NVTOOLS_RMREG_LINT_H
+
+#include "rmreg_meta.h"
+#include "rmreg_scan.h"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace rmreg {
+
+enum class RegType : uint8_t {
+    Dword,
+    Qword,
+    String,             // REG_SZ, REG_EXPAND_SZ, REG_MULTI_SZ
+    Binary,
+    Delete,             // "Name"=- and reg delete /v
+    Empty,              // "Name"= with nothing after it
+    Other,
+};
+
+// One value written by a script. Text is a view into the decoded file.
+struct RegWrite {
+    std::string_view name;
+    RegType type;
+    std::optional<uint32_t> dword;  // unset when the data is not a literal
+    uint32_t line;                  // 1-based
+    std::string_view data;          // as written, .reg continuation lines included
+};
+
+// .reg files are UTF-16LE more often than not; returns UTF-8 with any BOM
+// removed.
+std::string decode_text(std::string_view raw);
+
+// Both take decoded text. Lines end in \n, \r\n or a lone \r.
+std::vector<RegWrite> parse_reg_file(std::string_view text);
+std::vector<RegWrite> parse_bat_file(std::string_view text);     // [Reg.exe] add ... /v
+
+// A DRF field with its _MIN/_MAX, e.g. RmOptp DELAY_4MS 15:8, at least 9.
+struct FieldLimit {
+    std::string name;
+    FieldDesc field;
+    std::optional<uint32_t> min;
+    std::optional<uint32_t> max;
+};
+
+struct LintKey {
+    KeyMeta meta;
+    std::vector<FieldLimit> fields;
+    uint32_t field_mask;            // union of the DRF fields, 0 if none
+    Liveness release;
+    std::string condition;          // #if around the key, empty if none
+};
+
+class KeyIndex {
+public:
+    explicit KeyIndex(const Index& index);
+
+    const LintKey* find(std::string_view name) const;
+
+    // Of the keys sharing a camel-case word with name, the one nearest in
+    // spelling, if no more than an eighth of name's letters differ.
+    const LintKey* suggest(std::string_view name) const;
+
+    size_t size() const { return keys_.size(); }
+
+private:
+    std::vector<LintKey> keys_;
+    std::unordered_map<std::string, uint32_t> by_name_;             // folded
+    std::unordered_map<std::string, std::vector<uint32_t>> by_word_;
+};
+
+enum class Severity : uint8_t { Warning, Error };
+
+struct Finding {
+    uint32_t line;
+    Severity severity;
+    std::string message;
+};
+
+void lint_writes(const KeyIndex& keys, const std::vector<RegWrite>& writes,
+                 std::vector<Finding>& out);
+
+} // namespace rmreg
+
+#endif // NVTOOLS_RMREG_LINT_H
@@ -0,0 +1,107 @@
+// rmreg_lint_main.cpp
+//
+// Lints every .reg and .bat file under the given paths (default: the current
+// directory) against nvRmReg.h:
+//
+//   rmreg_lint ../nvRmReg.h ../../..
+//
+// Prints "file:line: error: ..." and exits with 1 if there were errors.
+
+#include "mapped_file.h"
+#include "rmreg_lint.h"
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <system_error>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+struct Totals {
+    size_t files = 0;
+    size_t writes = 0;
+    size_t errors = 0;
+    size_t warnings = 0;
+};
+
+bool has_extension(const fs::path& p, std::string_view ext)
+{
+    return rmreg::iequals(p.extension().string(), ext);
+}
+
+void lint_file(const rmreg::KeyIndex& keys, const fs::path& path, Totals& totals)
+{
+    bool reg = has_extension(path, ".reg");
+    if (!reg && !has_extension(path, ".bat") && !has_extension(path, ".cmd"))
+        return;
+    nvtools::MappedFile f;
+    if (!f.open(path.string().c_str())) {
+        std::fprintf(stderr, "%s: error: cannot read\n", path.string().c_str());
+        ++totals.errors;
+        return;
+    }
+    std::string text = rmreg::decode_text(f.view());
+    std::vector<rmreg::RegWrite> writes = reg ? rmreg::parse_reg_file(text)
+                                              : rmreg::parse_bat_file(text);
+    std::vector<rmreg::Finding> findings;
+    rmreg::lint_writes(keys, writes, findings);
+    ++totals.files;
+    totals.writes += writes.size();
+    for (const rmreg::Finding& x : findings) {
+        bool error = x.severity == rmreg::Severity::Error;
+        std::printf("%s:%u: %s: %s\n", path.string().c_str(), x.line,
+                    error ? "error" : "warning", x.message.c_str());
+        ++(error ? totals.errors : totals.warnings);
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        std::fprintf(stderr, "usage: rmreg_lint <nvRmReg.h> [file or directory...]\n");
+        return 2;
+    }
+    auto t0 = std::chrono::steady_clock::now();
+    nvtools::MappedFile header;
+    if (!header.open(argv[1])) {
+        std::fprintf(stderr, "error: cannot read %s\n", argv[1]);
+        return 1;
+    }
+    rmreg::Index ix = rmreg::index_header(header.view());
+    rmreg::KeyIndex keys(ix);
+
+    Totals totals;
+    std::vector<fs::path> roots;
+    for (int i = 2; i < argc; ++i)
+        roots.emplace_back(argv[i]);
+    if (roots.empty())
+        roots.emplace_back(".");
+    for (const fs::path& root : roots) {
+        std::error_code ec;
+        if (!fs::is_directory(root, ec)) {
+            lint_file(keys, root, totals);
+            continue;
+        }
+        fs::recursive_directory_iterator it(root, fs::directory_options::skip_permission_denied, ec), end;
+        for (; !ec && it != end; it.increment(ec)) {
+            if (it->is_directory(ec) && it->path().filename() == ".git") {
+                it.disable_recursion_pending();
+                continue;
+            }
+            if (it->is_regular_file(ec))
+                lint_file(keys, it->path(), totals);
+        }
+        if (ec)
+            std::fprintf(stderr, "%s: error: %s\n", root.string().c_str(), ec.message().c_str());
+    }
+
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    std::fprintf(stderr, "%zu keys, %zu files, %zu values, %zu errors, %zu warnings in %.1f ms\n",
+                 keys.size(), totals.files, totals.writes, totals.errors, totals.warnings, ms);
+    return totals.errors ? 1 : 0;
+}
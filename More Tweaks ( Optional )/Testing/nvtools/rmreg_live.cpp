@@ -0,0 +1,52 @@
+// rmreg_live.cpp
+//
+// Tells which registry values a retail driver actually reads. Looks every
+// name up in the catalog, so it costs nothing compared to preprocessing the
+// header once per build variant:
+//
+//   rmreg_live RMDisablePostL2Compression RmVerifBackToBackInt
+//
+// Exits with 1 if any name is unknown or compiled out of every release build.
+
+#include "rmreg_catalog.h"
+
+#include <cstdio>
+
+namespace {
+
+const char* describe(rmreg::Liveness l)
+{
+    switch (l) {
+    case rmreg::Liveness::Always:  return "live";
+    case rmreg::Liveness::Depends: return "depends";
+    default:                       return "dead";
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        std::fprintf(stderr, "usage: rmreg_live <value name>...\n");
+        return 2;
+    }
+    int status = 0;
+    for (int i = 1; i < argc; ++i) {
+        const rmreg::Key* k = rmreg::find(argv[i]);
+        if (!k) {
+            std::fprintf(stderr, "error: %s is not in nvRmReg.h\n", argv[i]);
+            status = 1;
+            continue;
+        }
+        rmreg::Liveness l = rmreg::live_in_release(*k);
+        const rmreg::Condition& c = rmreg::condition_of(*k);
+        std::printf("%-40.*s %s", int(k->name.size()), k->name.data(), describe(l));
+        if (!c.expr.empty())
+            std::printf("  (#if %.*s)", int(c.expr.size()), c.expr.data());
+        std::printf("\n");
+        if (l == rmreg::Liveness::Never)
+            status = 1;
+    }
+    return status;
+}
@@ -0,0 +1,432 @@
+// rmreg_meta.cpp
+
+#include "rmreg_meta.h"
+
+#include "byte_scan.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace rmreg {
+
+namespace {
+
+using nvtools::ends_with;
+using nvtools::starts_with_nocase;
+using nvtools::trim;
+
+// Word after a "Type"/"Encoding"/"Range" label, past any ":", "--" or spaces.
+std::optional<std::string_view> after_label(std::string_view body, std::string_view label)
+{
+    if (!starts_with_nocase(body, label)
+        || (body.size() > label.size() && std::isalnum(uint8_t(body[label.size()]))))
+        return std::nullopt;
+    body.remove_prefix(label.size());
+    while (!body.empty() && (std::isspace(uint8_t(body[0])) || body[0] == ':' || body[0] == '-'))
+        body.remove_prefix(1);
+    return body;
+}
+
+// Standalone numbers in free text, "0 - 5" and "[0,100]" give two.
+std::vector<uint32_t> numbers(std::string_view s)
+{
+    std::vector<uint32_t> out;
+    for (size_t i = 0; i < s.size(); ++i) {
+        if (!std::isdigit(uint8_t(s[i])) || (i > 0 && (std::isalnum(uint8_t(s[i - 1])) || s[i - 1] == '_')))
+            continue;
+        size_t e = i;
+        while (e < s.size() && std::isalnum(uint8_t(s[e])))
+            ++e;
+        std::string token(s.substr(i, e - i));
+        char* end = nullptr;
+        unsigned long v = std::strtoul(token.c_str(), &end, 0);
+        while (*end == 'u' || *end == 'U' || *end == 'l' || *end == 'L')
+            ++end;
+        if (*end == '\0' && v <= 0xffffffffu)
+            out.push_back(uint32_t(v));
+        i = e;
+    }
+    return out;
+}
+
+bool is_bool_name(std::string_view n)
+{
+    for (std::string_view b : {"YES", "NO", "TRUE", "FALSE", "ON", "OFF",
+                               "ENABLE", "ENABLED", "DISABLE", "DISABLED"})
+        if (n == b)
+            return true;
+    return false;
+}
+
+enum Column {
+    kNameOffset,        // uint32_t per key, into kStrings
+    kNameLength,        // uint16_t
+    kType,              // uint8_t KeyType
+    kFlags,             // uint8_t kFlag*
+    kUnit,              // uint8_t Unit
+    kMin,               // uint32_t
+    kMax,
+    kDefault,
+    kValueBegin,        // uint32_t per key, into the value columns
+    kValueCount,        // uint16_t
+    kValueNameOffset,   // uint32_t per value
+    kValueNameLength,   // uint16_t
+    kValue,             // uint32_t
+    kStrings,           // char, not terminated
+    kColumns,
+};
+
+enum Flag : uint8_t {
+    kFlagBoolean = 1,
+    kFlagMin = 2,
+    kFlagMax = 4,
+    kFlagDefault = 8,
+    kFlagInferred = 16,
+};
+
+constexpr char kMagic[8] = {'R', 'M', 'M', 'E', 'T', 'A', '\0', '\0'};
+constexpr uint32_t kVersion = 1;
+
+struct FileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t key_count;
+    uint32_t value_count;
+    uint32_t column_count;
+    uint64_t offsets[16];
+    uint64_t sizes[16];         // bytes
+};
+static_assert(sizeof(FileHeader) == 280, "FileHeader layout is part of the format");
+
+class ColumnWriter {
+public:
+    ColumnWriter() : buf_(sizeof(FileHeader), '\0') {}
+
+    template <class T>
+    void put(Column c, const std::vector<T>& v)
+    {
+        while (buf_.size() % 8)
+            buf_ += '\0';
+        header_.offsets[c] = buf_.size();
+        header_.sizes[c] = v.size() * sizeof(T);
+        if (!v.empty())
+            buf_.append(reinterpret_cast<const char*>(v.data()), v.size() * sizeof(T));
+    }
+
+    bool save(const char* path, uint32_t keys, uint32_t values)
+    {
+        std::memcpy(header_.magic, kMagic, sizeof kMagic);
+        header_.version = kVersion;
+        header_.key_count = keys;
+        header_.value_count = values;
+        header_.column_count = kColumns;
+        std::memcpy(&buf_[0], &header_, sizeof header_);
+        FILE* f = std::fopen(path, "wb");
+        if (!f)
+            return false;
+        bool ok = std::fwrite(buf_.data(), 1, buf_.size(), f) == buf_.size();
+        return std::fclose(f) == 0 && ok;
+    }
+
+private:
+    std::string buf_;
+    FileHeader header_ = {};
+};
+
+} // namespace
+
+Unit unit_from_name(std::string_view name)
+{
+    struct Suffix {
+        std::string_view text;
+        Unit unit;
+    };
+    // Longest first. The header glues lower-case units on as well
+    // ("Timeoutus", "PerioduS", "WinmS", "LimitmW").
+    static constexpr Suffix kSuffixes[] = {
+        {"Percent", Unit::Percent}, {"Timeoutus", Unit::Microseconds},
+        {"Usec", Unit::Microseconds}, {"MHz", Unit::Megahertz}, {"Mhz", Unit::Megahertz},
+        {"KHz", Unit::Kilohertz}, {"Khz", Unit::Kilohertz},
+        {"Us", Unit::Microseconds}, {"uS", Unit::Microseconds},
+        {"Ms", Unit::Milliseconds}, {"mS", Unit::Milliseconds}, {"Ns", Unit::Nanoseconds},
+        {"KB", Unit::Kilobytes}, {"MB", Unit::Megabytes}, {"GB", Unit::Gigabytes},
+        {"mW", Unit::Milliwatts},
+    };
+    for (const Suffix& s : kSuffixes)
+        if (ends_with(name, s.text))
+            return s.unit;
+    return Unit::None;
+}
+
+const char* unit_name(Unit unit)
+{
+    switch (unit) {
+    case Unit::Nanoseconds:  return "ns";
+    case Unit::Microseconds: return "us";
+    case Unit::Milliseconds: return "ms";
+    case Unit::Kilobytes:    return "KB";
+    case Unit::Megabytes:    return "MB";
+    case Unit::Gigabytes:    return "GB";
+    case Unit::Milliwatts:   return "mW";
+    case Unit::Kilohertz:    return "kHz";
+    case Unit::Megahertz:    return "MHz";
+    case Unit::Percent:      return "%";
+    default:                 return "";
+    }
+}
+
+KeyMeta extract_meta(const Index& ix, const KeyBlock& key)
+{
+    KeyMeta m;
+    std::string_view macro = ix.key_macro(key);
+    m.name = std::string(ix.key_name(key));
+    m.type = declared_type(ix, key);
+    m.type_inferred = false;
+    m.boolean = false;
+    m.default_value = documented_default(ix, key);
+    m.unit = unit_from_name(m.name);
+
+    for (uint32_t i = key.first_line; i < key.last_line; ++i) {
+        if (ix.lines[i].kind != LineKind::Comment)
+            continue;
+        std::string_view b = comment_body(ix.text(ix.lines[i]));
+        if (auto t = after_label(b, "type")) {
+            m.boolean = m.boolean || nvtools::find_nocase(*t, "bool") != std::string_view::npos;
+        } else if (auto e = after_label(b, "encoding")) {
+            m.boolean = m.boolean || starts_with_nocase(trim(*e), "bool");
+        } else if (auto r = after_label(b, "range")) {
+            std::vector<uint32_t> n = numbers(*r);
+            if (!n.empty() && !m.min)
+                m.min = n[0];
+            if (n.size() > 1 && !m.max && n[1] >= n[0])
+                m.max = n[1];
+        }
+    }
+
+    // Children: fields and their values, _DEFAULT/_MIN/_MAX, named values.
+    std::vector<std::string_view> fields;
+    for (uint32_t c = 0; c < key.child_count; ++c) {
+        const Define& d = ix.defines[ix.children[key.child_begin + c]];
+        if (parse_range(d.value))
+            fields.push_back(d.name);
+    }
+    for (uint32_t c = 0; c < key.child_count; ++c) {
+        const Define& d = ix.defines[ix.children[key.child_begin + c]];
+        std::string_view suffix = d.name.substr(macro.size() + 1);
+        bool in_field = false;
+        for (std::string_view f : fields)
+            in_field = in_field || d.name == f
+                || (d.name.size() > f.size() && d.name.substr(0, f.size()) == f && d.name[f.size()] == '_');
+        if (in_field)
+            continue;
+        auto v = evaluate(ix, d.value);
+        if (!v)
+            continue;
+        if (suffix == "MIN")
+            m.min = *v;
+        else if (suffix == "MAX")
+            m.max = *v;
+        else if (suffix != "DEFAULT")
+            m.values.push_back({std::string(suffix), *v});
+    }
+
+    // Only YES/NO-style values, at least the "on" one, and no declared range.
+    if (!m.boolean && fields.empty() && !m.values.empty() && !m.min && !m.max) {
+        bool all = true, on = false;
+        for (const EnumValue& v : m.values) {
+            all = all && v.value <= 1 && is_bool_name(v.name);
+            on = on || v.value == 1;
+        }
+        m.boolean = all && on;
+    }
+    if (m.boolean) {
+        m.min = m.min.value_or(0);
+        m.max = m.max.value_or(1);
+    }
+    if (m.type == KeyType::Unknown
+        && (!fields.empty() || !m.values.empty() || m.default_value || m.min || m.max)) {
+        m.type = KeyType::Dword;
+        m.type_inferred = true;
+    }
+    return m;
+}
+
+bool write_meta_store(const char* path, std::vector<KeyMeta> keys)
+{
+    std::stable_sort(keys.begin(), keys.end(), [](const KeyMeta& a, const KeyMeta& b) {
+        return nvtools::folded(a.name) < nvtools::folded(b.name);
+    });
+    keys.erase(std::unique(keys.begin(), keys.end(), [](const KeyMeta& a, const KeyMeta& b) {
+        return iequals(a.name, b.name);
+    }), keys.end());
+
+    std::vector<uint32_t> name_off, min, max, def, value_begin, value_name_off, value;
+    std::vector<uint16_t> name_len, value_count, value_name_len;
+    std::vector<uint8_t> type, flags, unit;
+    std::vector<char> strings;
+    auto add_string = [&](const std::string& s, std::vector<uint32_t>& off, std::vector<uint16_t>& len) {
+        off.push_back(uint32_t(strings.size()));
+        len.push_back(uint16_t(std::min<size_t>(s.size(), 0xffff)));
+        strings.insert(strings.end(), s.begin(), s.begin() + len.back());
+    };
+    for (const KeyMeta& k : keys) {
+        add_string(k.name, name_off, name_len);
+        type.push_back(uint8_t(k.type));
+        flags.push_back(uint8_t((k.boolean ? kFlagBoolean : 0) | (k.min ? kFlagMin : 0)
+                                | (k.max ? kFlagMax : 0) | (k.default_value ? kFlagDefault : 0)
+                                | (k.type_inferred ? kFlagInferred : 0)));
+        unit.push_back(uint8_t(k.unit));
+        min.push_back(k.min.value_or(0));
+        max.push_back(k.max.value_or(0));
+        def.push_back(k.default_value.value_or(0));
+        value_begin.push_back(uint32_t(value.size()));
+        value_count.push_back(uint16_t(std::min<size_t>(k.values.size(), 0xffff)));
+        for (size_t i = 0; i < value_count.back(); ++i) {
+            add_string(k.values[i].name, value_name_off, value_name_len);
+            value.push_back(k.values[i].value);
+        }
+    }
+
+    ColumnWriter w;
+    w.put(kNameOffset, name_off);
+    w.put(kNameLength, name_len);
+    w.put(kType, type);
+    w.put(kFlags, flags);
+    w.put(kUnit, unit);
+    w.put(kMin, min);
+    w.put(kMax, max);
+    w.put(kDefault, def);
+    w.put(kValueBegin, value_begin);
+    w.put(kValueCount, value_count);
+    w.put(kValueNameOffset, value_name_off);
+    w.put(kValueNameLength, value_name_len);
+    w.put(kValue, value);
+    w.put(kStrings, strings);
+    return w.save(path, uint32_t(keys.size()), uint32_t(value.size()));
+}
+
+bool MetaStore::open(const char* path)
+{
+    key_count_ = value_count_ = 0;
+    if (!file_.open(path) || file_.size() < sizeof(FileHeader))
+        return false;
+    FileHeader h;
+    std::memcpy(&h, file_.data(), sizeof h);
+    if (std::memcmp(h.magic, kMagic, sizeof kMagic) != 0 || h.version != kVersion
+        || h.column_count != kColumns)
+        return false;
+
+    static constexpr uint8_t kWidth[kColumns] = {4, 2, 1, 1, 1, 4, 4, 4, 4, 2, 4, 2, 4, 1};
+    for (int c = 0; c < kColumns; ++c) {
+        uint64_t count = c == kStrings ? h.sizes[c]
+                       : c >= kValueNameOffset ? h.value_count : h.key_count;
+        if (h.offsets[c] % 8 || h.sizes[c] != count * kWidth[c]
+            || h.offsets[c] > file_.size() || h.sizes[c] > file_.size() - h.offsets[c])
+            return false;
+        offsets_[c] = h.offsets[c];
+    }
+    // Every string and value range must stay inside its column, so Key never
+    // has to check.
+    const uint64_t strings = h.sizes[kStrings];
+    for (uint32_t i = 0; i < h.key_count; ++i)
+        if (uint64_t(column<uint32_t>(kNameOffset)[i]) + column<uint16_t>(kNameLength)[i] > strings
+            || uint64_t(column<uint32_t>(kValueBegin)[i]) + column<uint16_t>(kValueCount)[i] > h.value_count)
+            return false;
+    for (uint32_t i = 0; i < h.value_count; ++i)
+        if (uint64_t(column<uint32_t>(kValueNameOffset)[i]) + column<uint16_t>(kValueNameLength)[i] > strings)
+            return false;
+    key_count_ = h.key_count;
+    value_count_ = h.value_count;
+    return true;
+}
+
+std::string_view MetaStore::string(uint32_t offset, uint16_t length) const
+{
+    return {column<char>(kStrings) + offset, length};
+}
+
+std::optional<MetaStore::Key> MetaStore::find(std::string_view name) const
+{
+    auto less = [](std::string_view a, std::string_view b) {
+        for (size_t i = 0; i < a.size() && i < b.size(); ++i)
+            if (fold(a[i]) != fold(b[i]))
+                return fold(a[i]) < fold(b[i]);
+        return a.size() < b.size();
+    };
+    size_t lo = 0, hi = key_count_;
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (less(at(mid).name(), name))
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    if (lo < key_count_ && iequals(at(lo).name(), name))
+        return at(lo);
+    return std::nullopt;
+}
+
+std::string_view MetaStore::Key::name() const
+{
+    return store_->string(store_->column<uint32_t>(kNameOffset)[i_],
+                          store_->column<uint16_t>(kNameLength)[i_]);
+}
+
+KeyType MetaStore::Key::type() const
+{
+    return KeyType(store_->column<uint8_t>(kType)[i_]);
+}
+
+bool MetaStore::Key::type_inferred() const
+{
+    return store_->column<uint8_t>(kFlags)[i_] & kFlagInferred;
+}
+
+bool MetaStore::Key::boolean() const
+{
+    return store_->column<uint8_t>(kFlags)[i_] & kFlagBoolean;
+}
+
+std::optional<uint32_t> MetaStore::Key::min() const
+{
+    if (!(store_->column<uint8_t>(kFlags)[i_] & kFlagMin))
+        return std::nullopt;
+    return store_->column<uint32_t>(kMin)[i_];
+}
+
+std::optional<uint32_t> MetaStore::Key::max() const
+{
+    if (!(store_->column<uint8_t>(kFlags)[i_] & kFlagMax))
+        return std::nullopt;
+    return store_->column<uint32_t>(kMax)[i_];
+}
+
+std::optional<uint32_t> MetaStore::Key::default_value() const
+{
+    if (!(store_->column<uint8_t>(kFlags)[i_] & kFlagDefault))
+        return std::nullopt;
+    return store_->column<uint32_t>(kDefault)[i_];
+}
+
+Unit MetaStore::Key::unit() const
+{
+    return Unit(store_->column<uint8_t>(kUnit)[i_]);
+}
+
+size_t MetaStore::Key::value_count() const
+{
+    return store_->column<uint16_t>(kValueCount)[i_];
+}
+
+MetaStore::Value MetaStore::Key::value(size_t i) const
+{
+    size_t v = store_->column<uint32_t>(kValueBegin)[i_] + i;
+    return {store_->string(store_->column<uint32_t>(kValueNameOffset)[v],
+                           store_->column<uint16_t>(kValueNameLength)[v]),
+            store_->column<uint32_t>(kValue)[v]};
+}
+
+} // namespace rmreg
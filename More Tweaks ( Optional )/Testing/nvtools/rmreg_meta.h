@@ -0,0 +1,128 @@
+// rmreg_meta.h
+//
+// Normalized key metadata from nvRmReg.h's comments and child defines, and a
+// columnar file to ship it in. The comments spell the same thing many ways
+// ("// Type DWORD", "* Type: Dword", "Type DWORD (Boolean)", "Encoding --
+// Boolean"); KeyMeta is what they mean:
+//
+//   type      declared "Type", or Dword when the key has numeric children
+//   boolean   "(Boolean)" / "Encoding boolean", or only _YES/_NO-style 0/1 values
+//   min, max  key _MIN/_MAX defines, "Range: a - b", 0..1 for booleans
+//   unit      from the name: ...Ms, ...Us, ...MB, ...mW, ...MHz, ...Percent
+//   values    named values (NV_REG_STR_RM_X_ENABLE -> ENABLE) outside fields
+//
+// A validator that runs at every logon should not parse comments, so
+// rmreg_meta writes the records to a file that MetaStore maps and reads in
+// place: a fixed header, then one array per column, names sorted for binary
+// search. The file is little-endian, like every machine the tweaks run on.
+
+#ifndef NVTOOLS_RMREG_META_H
+#define NVTOOLS_RMREG_META_H
+
+#include "mapped_file.h"
+#include "rmreg_scan.h"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace rmreg {
+
+enum class Unit : uint8_t {
+    None,
+    Nanoseconds,
+    Microseconds,
+    Milliseconds,
+    Kilobytes,
+    Megabytes,
+    Gigabytes,
+    Milliwatts,
+    Kilohertz,
+    Megahertz,
+    Percent,
+};
+
+struct EnumValue {
+    std::string name;           // ENABLE, the macro with the key's prefix removed
+    uint32_t value;
+};
+
+struct KeyMeta {
+    std::string name;
+    KeyType type;
+    bool type_inferred;         // no "Type" comment, type guessed from the defines
+    bool boolean;
+    std::optional<uint32_t> min;
+    std::optional<uint32_t> max;
+    std::optional<uint32_t> default_value;
+    Unit unit;
+    std::vector<EnumValue> values;
+};
+
+KeyMeta extract_meta(const Index& index, const KeyBlock& key);
+
+// Unit suffix of a registry value name. Case matters: "DPMS" is not
+// milliseconds and "Status" is not microseconds.
+Unit unit_from_name(std::string_view name);
+
+const char* unit_name(Unit unit);
+
+// Writes the store. Keys are sorted by case-folded name; duplicates keep the
+// first record.
+bool write_meta_store(const char* path, std::vector<KeyMeta> keys);
+
+class MetaStore {
+public:
+    struct Value {
+        std::string_view name;
+        uint32_t value;
+    };
+
+    // A key record read straight out of the mapping.
+    class Key {
+    public:
+        std::string_view name() const;
+        KeyType type() const;
+        bool type_inferred() const;
+        bool boolean() const;
+        std::optional<uint32_t> min() const;
+        std::optional<uint32_t> max() const;
+        std::optional<uint32_t> default_value() const;
+        Unit unit() const;
+        size_t value_count() const;
+        Value value(size_t i) const;
+
+    private:
+        friend class MetaStore;
+        Key(const MetaStore* store, uint32_t i) : store_(store), i_(i) {}
+
+        const MetaStore* store_;
+        uint32_t i_;
+    };
+
+    // Maps the file and checks its header and column bounds; no parsing.
+    bool open(const char* path);
+
+    size_t size() const { return key_count_; }
+    Key at(size_t i) const { return Key(this, uint32_t(i)); }
+    std::optional<Key> find(std::string_view name) const;
+
+private:
+    template <class T>
+    const T* column(int c) const
+    {
+        return reinterpret_cast<const T*>(file_.data() + offsets_[c]);
+    }
+    std::string_view string(uint32_t offset, uint16_t length) const;
+
+    nvtools::MappedFile file_;
+    uint32_t key_count_ = 0;
+    uint32_t value_count_ = 0;
+    uint64_t offsets_[16] = {};
+};
+
+} // namespace rmreg
+
+#endif // NVTOOLS_RMREG_META_H
@@ -0,0 +1,104 @@
+// rmreg_meta_main.cpp
+//
+//   rmreg_meta build ../nvRmReg.h rmreg_meta.bin
+//   rmreg_meta show rmreg_meta.bin [value name...]
+//
+// build extracts the metadata and writes the store; show prints records from
+// a store, all of them when no names are given.
+
+#include "rmreg_meta.h"
+
+#include <cstdio>
+#include <cstring>
+
+namespace {
+
+const char* type_text(rmreg::KeyType t)
+{
+    switch (t) {
+    case rmreg::KeyType::Dword:  return "DWORD";
+    case rmreg::KeyType::Binary: return "BINARY";
+    case rmreg::KeyType::String: return "STRING";
+    default:                     return "?";
+    }
+}
+
+void print(const rmreg::MetaStore::Key& k)
+{
+    std::printf("%.*s  %s%s", int(k.name().size()), k.name().data(), type_text(k.type()),
+                k.type_inferred() ? " (inferred)" : "");
+    if (k.boolean())
+        std::printf("  boolean");
+    if (k.min() || k.max()) {
+        std::printf("  range ");
+        k.min() ? std::printf("%u", *k.min()) : std::printf("?");
+        k.max() ? std::printf("..%u", *k.max()) : std::printf("..?");
+    }
+    if (k.unit() != rmreg::Unit::None)
+        std::printf("  unit %s", rmreg::unit_name(k.unit()));
+    if (k.default_value())
+        std::printf("  default 0x%x", *k.default_value());
+    std::printf("\n");
+    for (size_t i = 0; i < k.value_count(); ++i) {
+        rmreg::MetaStore::Value v = k.value(i);
+        std::printf("    %-40.*s 0x%x\n", int(v.name.size()), v.name.data(), v.value);
+    }
+}
+
+int build(const char* header, const char* out)
+{
+    nvtools::MappedFile f;
+    if (!f.open(header)) {
+        std::fprintf(stderr, "error: cannot read %s\n", header);
+        return 1;
+    }
+    rmreg::Index ix = rmreg::index_header(f.view());
+    std::vector<rmreg::KeyMeta> keys;
+    keys.reserve(ix.keys.size());
+    for (const rmreg::KeyBlock& k : ix.keys)
+        keys.push_back(rmreg::extract_meta(ix, k));
+    if (!rmreg::write_meta_store(out, keys)) {
+        std::fprintf(stderr, "error: cannot write %s\n", out);
+        return 1;
+    }
+    std::fprintf(stderr, "%zu keys\n", keys.size());
+    return 0;
+}
+
+int show(const char* path, int count, char** names)
+{
+    rmreg::MetaStore store;
+    if (!store.open(path)) {
+        std::fprintf(stderr, "error: %s is not a metadata store\n", path);
+        return 1;
+    }
+    if (count == 0) {
+        for (size_t i = 0; i < store.size(); ++i)
+            print(store.at(i));
+        return 0;
+    }
+    int status = 0;
+    for (int i = 0; i < count; ++i) {
+        if (auto k = store.find(names[i])) {
+            print(*k);
+        } else {
+            std::fprintf(stderr, "error: %s is not in the store\n", names[i]);
+            status = 1;
+        }
+    }
+    return status;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc == 4 && std::strcmp(argv[1], "build") == 0)
+        return build(argv[2], argv[3]);
+    if (argc >= 3 && std::strcmp(argv[1], "show") == 0)
+        return show(argv[2], argc - 3, argv + 3);
+    std::fprintf(stderr,
+                 "usage: rmreg_meta build <nvRmReg.h> <store>\n"
+                 "       rmreg_meta show <store> [value name...]\n");
+    return 2;
+}
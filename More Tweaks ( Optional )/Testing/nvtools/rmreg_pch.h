@@ -0,0 +1,23 @@
+// rmreg_pch.h
+//
+// The catalog headers in one header to precompile. Every tool that uses
+// rmreg_catalog.h and rmreg_fields.h spends most of its compile time on
+// their constexpr tables, and nearly all of it goes away with a PCH:
+//
+//   g++ -std=c++17 -O2 -x c++-header rmreg_pch.h        # writes rmreg_pch.h.gch
+//   g++ -std=c++17 -O2 -include rmreg_pch.h -c tool.cpp
+//
+// GCC only uses the .gch when the language standard, optimization and -D
+// flags match the ones it was built with. Otherwise it quietly parses the
+// header again; -Winvalid-pch says when that happens.
+//
+// nvRmReg.h stays out on purpose: its NV_REG_STR_* macros would rewrite the
+// rmreg::drf names of the same spelling.
+
+#ifndef NVTOOLS_RMREG_PCH_H
+#define NVTOOLS_RMREG_PCH_H
+
+#include "rmreg_catalog.h"
+#include "rmreg_fields.h"
+
+#endif // NVTOOLS_RMREG_PCH_H
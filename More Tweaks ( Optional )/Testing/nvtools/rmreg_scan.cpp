@@ -0,0 +1,776 @@
+// rmreg_scan.cpp
+
+#include "rmreg_scan.h"
+
+#include "byte_scan.h"
+
+#include <cctype>
+
+namespace rmreg {
+
+namespace {
+
+bool is_ident(char c)
+{
+    return std::isalnum(uint8_t(c)) || c == '_';
+}
+
+using nvtools::find_nocase;
+using nvtools::starts_with_nocase;
+using nvtools::trim;
+
+// Splits "VALUE   // comment" at the first comment marker outside a string
+// literal. Returns the offset of the marker, or npos.
+size_t comment_start(std::string_view s)
+{
+    bool quoted = false;
+    for (size_t i = nvtools::find_either(s, '"', '/'); i != std::string_view::npos;
+         i = nvtools::find_either(s, '"', '/', i + 1)) {
+        if (s[i] == '"')
+            quoted = !quoted;
+        else if (!quoted && i + 1 < s.size() && (s[i + 1] == '/' || s[i + 1] == '*'))
+            return i;
+    }
+    return std::string_view::npos;
+}
+
+// Parses a decimal or 0x literal at the start of s, with optional U/L suffix.
+std::optional<uint32_t> parse_number(std::string_view s, size_t* used)
+{
+    size_t i = 0;
+    uint64_t v = 0;
+    if (s.size() > 2 && s[0] == '0' && (s[1] == 'x' || s[1] == 'X')) {
+        i = 2;
+        size_t digits = 0;
+        for (; i < s.size() && std::isxdigit(uint8_t(s[i])); ++i, ++digits) {
+            char c = fold(s[i]);
+            v = v * 16 + uint64_t(c <= '9' ? c - '0' : c - 'a' + 10);
+        }
+        if (digits == 0)
+            return std::nullopt;
+    } else {
+        if (s.empty() || !std::isdigit(uint8_t(s[0])))
+            return std::nullopt;
+        for (; i < s.size() && std::isdigit(uint8_t(s[i])); ++i)
+            v = v * 10 + uint64_t(s[i] - '0');
+    }
+    while (i < s.size() && (fold(s[i]) == 'u' || fold(s[i]) == 'l'))
+        ++i;
+    if (v > 0xffffffffull)
+        return std::nullopt;
+    *used = i;
+    return uint32_t(v);
+}
+
+// First standalone number in free text: "0x0(default)" and "Value = 0 ->"
+// match, "4MS" and "L2" do not.
+std::optional<uint32_t> first_number(std::string_view s)
+{
+    for (size_t i = 0; i < s.size(); ++i) {
+        if (!std::isdigit(uint8_t(s[i])) || (i > 0 && is_ident(s[i - 1])))
+            continue;
+        size_t used = 0;
+        auto v = parse_number(s.substr(i), &used);
+        if (v && (i + used == s.size() || !is_ident(s[i + used])))
+            return v;
+        while (i < s.size() && is_ident(s[i]))
+            ++i;
+    }
+    return std::nullopt;
+}
+
+class Evaluator {
+public:
+    Evaluator(const Index& index, std::string_view expr, int depth)
+        : index_(index), s_(expr), depth_(depth) {}
+
+    std::optional<uint32_t> run()
+    {
+        auto v = parse_or();
+        skip_space();
+        if (!v || pos_ != s_.size())
+            return std::nullopt;
+        return v;
+    }
+
+private:
+    void skip_space()
+    {
+        while (pos_ < s_.size() && std::isspace(uint8_t(s_[pos_])))
+            ++pos_;
+    }
+
+    bool accept(std::string_view op)
+    {
+        skip_space();
+        if (s_.substr(pos_, op.size()) != op)
+            return false;
+        // Keep "|" from eating the first half of "||" and friends.
+        if (op.size() == 1 && pos_ + 1 < s_.size() && s_[pos_ + 1] == op[0])
+            return false;
+        pos_ += op.size();
+        return true;
+    }
+
+    std::optional<uint32_t> parse_or()
+    {
+        auto v = parse_and();
+        while (v && accept("|")) {
+            auto r = parse_and();
+            v = r ? std::optional<uint32_t>(*v | *r) : std::nullopt;
+        }
+        return v;
+    }
+
+    std::optional<uint32_t> parse_and()
+    {
+        auto v = parse_shift();
+        while (v && accept("&")) {
+            auto r = parse_shift();
+            v = r ? std::optional<uint32_t>(*v & *r) : std::nullopt;
+        }
+        return v;
+    }
+
+    std::optional<uint32_t> parse_shift()
+    {
+        auto v = parse_add();
+        while (v && accept("<<")) {
+            auto r = parse_add();
+            v = (r && *r < 32) ? std::optional<uint32_t>(*v << *r) : std::nullopt;
+        }
+        return v;
+    }
+
+    std::optional<uint32_t> parse_add()
+    {
+        auto v = parse_mul();
+        while (v) {
+            if (accept("+")) {
+                auto r = parse_mul();
+                v = r ? std::optional<uint32_t>(*v + *r) : std::nullopt;
+            } else if (accept("-")) {
+                auto r = parse_mul();
+                v = r ? std::optional<uint32_t>(*v - *r) : std::nullopt;
+            } else {
+                break;
+            }
+        }
+        return v;
+    }
+
+    std::optional<uint32_t> parse_mul()
+    {
+        auto v = parse_unary();
+        while (v && accept("*")) {
+            auto r = parse_unary();
+            v = r ? std::optional<uint32_t>(*v * *r) : std::nullopt;
+        }
+        return v;
+    }
+
+    std::optional<uint32_t> parse_unary()
+    {
+        if (accept("~")) {
+            auto v = parse_unary();
+            return v ? std::optional<uint32_t>(~*v) : std::nullopt;
+        }
+        return parse_primary();
+    }
+
+    std::optional<uint32_t> parse_primary()
+    {
+        skip_space();
+        if (pos_ >= s_.size())
+            return std::nullopt;
+        if (accept("(")) {
+            auto v = parse_or();
+            return (v && accept(")")) ? v : std::nullopt;
+        }
+        if (std::isdigit(uint8_t(s_[pos_]))) {
+            size_t used = 0;
+            auto v = parse_number(s_.substr(pos_), &used);
+            pos_ += used;
+            return v;
+        }
+        size_t b = pos_;
+        while (pos_ < s_.size() && is_ident(s_[pos_]))
+            ++pos_;
+        std::string_view ident = s_.substr(b, pos_ - b);
+        if (ident.empty())
+            return std::nullopt;
+        if (ident == "NVBIT" || ident == "BIT") {
+            if (!accept("("))
+                return std::nullopt;
+            auto n = parse_or();
+            if (!n || *n >= 32 || !accept(")"))
+                return std::nullopt;
+            return uint32_t(1) << *n;
+        }
+        const Define* d = index_.find_define(ident);
+        if (!d || depth_ >= 16)
+            return std::nullopt;
+        return Evaluator(index_, d->value, depth_ + 1).run();
+    }
+
+    const Index& index_;
+    std::string_view s_;
+    size_t pos_ = 0;
+    int depth_;
+};
+
+
+// Symbols the header only tests to build debug, test and MODS drivers.
+constexpr std::string_view kDebugOnlySymbols[] = {
+    "DEBUG", "DEVELOP", "QA_BUILD", "NV_MODS", "NV_VERIF_FEATURES",
+};
+
+// Collapses whitespace and "\" line joins into single spaces.
+std::string normalize(std::string_view s)
+{
+    std::string out;
+    for (char c : s) {
+        bool space = std::isspace(uint8_t(c)) || c == '\\';
+        if (space && (out.empty() || out.back() == ' '))
+            continue;
+        out += space ? ' ' : c;
+    }
+    while (!out.empty() && out.back() == ' ')
+        out.pop_back();
+    return out;
+}
+
+TruthTable symbol_truth(Index& ix, std::string_view name)
+{
+    size_t i = 0;
+    while (i < ix.symbols.size() && ix.symbols[i] != name)
+        ++i;
+    if (i == ix.symbols.size())
+        ix.symbols.emplace_back(name);
+    // Past kMaxSymbols the table cannot say anything; rmreg_gen refuses to
+    // emit a catalog in that case.
+    return i < kMaxSymbols ? TruthTable::symbol(i) : TruthTable::all();
+}
+
+// Parses an #if expression into a truth table. defined(X) and X both mean
+// "X is on"; the header only ever uses them together ("defined(X) && X").
+class ConditionParser {
+public:
+    ConditionParser(Index& index, std::string_view expr) : index_(index), s_(expr) {}
+
+    std::optional<TruthTable> run()
+    {
+        auto v = parse_or();
+        skip_space();
+        if (!v || pos_ != s_.size())
+            return std::nullopt;
+        return v;
+    }
+
+private:
+    void skip_space()
+    {
+        while (pos_ < s_.size() && (std::isspace(uint8_t(s_[pos_])) || s_[pos_] == '\\'))
+            ++pos_;
+    }
+
+    bool accept(std::string_view op)
+    {
+        skip_space();
+        if (s_.substr(pos_, op.size()) != op)
+            return false;
+        if (op == "!" && s_.substr(pos_, 2) == "!=")
+            return false;
+        pos_ += op.size();
+        return true;
+    }
+
+    std::string_view ident()
+    {
+        skip_space();
+        size_t b = pos_;
+        while (pos_ < s_.size() && is_ident(s_[pos_]))
+            ++pos_;
+        return s_.substr(b, pos_ - b);
+    }
+
+    std::optional<TruthTable> parse_or()
+    {
+        auto v = parse_and();
+        while (v && accept("||")) {
+            auto r = parse_and();
+            v = r ? std::optional<TruthTable>(*v | *r) : std::nullopt;
+        }
+        return v;
+    }
+
+    std::optional<TruthTable> parse_and()
+    {
+        auto v = parse_unary();
+        while (v && accept("&&")) {
+            auto r = parse_unary();
+            v = r ? std::optional<TruthTable>(*v & *r) : std::nullopt;
+        }
+        return v;
+    }
+
+    std::optional<TruthTable> parse_unary()
+    {
+        if (accept("!")) {
+            auto v = parse_unary();
+            return v ? std::optional<TruthTable>(~*v) : std::nullopt;
+        }
+        return parse_primary();
+    }
+
+    std::optional<TruthTable> parse_primary()
+    {
+        if (accept("(")) {
+            auto v = parse_or();
+            return (v && accept(")")) ? v : std::nullopt;
+        }
+        skip_space();
+        if (pos_ < s_.size() && std::isdigit(uint8_t(s_[pos_]))) {
+            size_t used = 0;
+            auto v = parse_number(s_.substr(pos_), &used);
+            pos_ += used;
+            if (!v)
+                return std::nullopt;
+            return *v ? TruthTable::all() : TruthTable::none();
+        }
+        std::string_view name = ident();
+        if (name.empty())
+            return std::nullopt;
+        if (name == "defined") {
+            bool paren = accept("(");
+            name = ident();
+            if (name.empty() || (paren && !accept(")")))
+                return std::nullopt;
+        }
+        return symbol_truth(index_, name);
+    }
+
+    Index& index_;
+    std::string_view s_;
+    size_t pos_ = 0;
+};
+
+// Anything the parser does not follow (comparisons, arithmetic) becomes one
+// opaque symbol named by the whole expression.
+TruthTable condition_truth(Index& ix, std::string_view expr)
+{
+    if (auto t = ConditionParser(ix, expr).run())
+        return *t;
+    return symbol_truth(ix, normalize(expr));
+}
+
+std::string negated(const std::string& expr)
+{
+    bool simple = !expr.empty();
+    for (char c : expr)
+        simple = simple && is_ident(c);
+    return simple ? "!" + expr : "!(" + expr + ")";
+}
+
+// One level of #if nesting.
+struct Branch {
+    TruthTable taken;           // union of the earlier branches
+    TruthTable truth;           // the current branch
+    std::string taken_expr;     // "!(A) && !(B)" for the earlier branches
+    std::string expr;
+};
+
+std::string join_and(const std::string& a, const std::string& b)
+{
+    return a.empty() ? b : b.empty() ? a : a + " && " + b;
+}
+
+uint16_t intern_condition(Index& ix, const std::vector<Branch>& stack)
+{
+    TruthTable truth = TruthTable::all();
+    size_t parts = 0;
+    for (const Branch& b : stack) {
+        truth = truth & b.truth;
+        parts += !b.expr.empty();
+    }
+    std::string expr;
+    for (const Branch& b : stack) {
+        if (b.expr.empty())
+            continue;
+        bool group = parts > 1 && b.expr.find("||") != std::string::npos;
+        expr = join_and(expr, group ? "(" + b.expr + ")" : b.expr);
+    }
+    for (size_t i = 0; i < ix.conditions.size(); ++i)
+        if (ix.conditions[i].truth == truth)
+            return uint16_t(i);
+    ix.conditions.push_back(BuildCondition{expr, truth});
+    return uint16_t(ix.conditions.size() - 1);
+}
+
+// Applies one #if/#ifdef/#ifndef/#elif/#else/#endif to the stack. d is the
+// directive without its "#", after is the source following the line.
+void apply_directive(Index& ix, std::vector<Branch>& stack, std::string_view d,
+                     std::string_view after)
+{
+    size_t n = 0;
+    while (n < d.size() && is_ident(d[n]))
+        ++n;
+    std::string_view word = d.substr(0, n);
+    std::string_view rest = d.substr(n);
+    size_t c = comment_start(rest);
+    if (c != std::string_view::npos)
+        rest = rest.substr(0, c);
+    rest = trim(rest);
+
+    if (word == "if" || word == "ifdef" || word == "ifndef") {
+        Branch b{TruthTable::none(), TruthTable::all(), {}, {}};
+        if (word == "if") {
+            b.truth = condition_truth(ix, rest);
+            b.expr = normalize(rest);
+        } else {
+            std::string_view name = rest.substr(0, rest.find_first_of(" \t"));
+            // "#ifndef X" right before "#define X" is an include guard.
+            std::string_view next = trim(after.substr(0, after.find('\n')));
+            bool guard = false;
+            if (word == "ifndef" && !next.empty() && next[0] == '#') {
+                std::string_view nd = trim(next.substr(1));
+                guard = nd.size() > 6 && nd.substr(0, 6) == "define" && trim(nd.substr(6)) == name;
+            }
+            if (!guard) {
+                b.truth = symbol_truth(ix, name);
+                b.expr = std::string(name);
+                if (word == "ifndef") {
+                    b.truth = ~b.truth;
+                    b.expr = "!" + b.expr;
+                }
+            }
+        }
+        stack.push_back(std::move(b));
+    } else if ((word == "elif" || word == "else") && !stack.empty()) {
+        Branch& b = stack.back();
+        b.taken = b.taken | b.truth;
+        b.taken_expr = join_and(b.taken_expr, negated(b.expr));
+        b.truth = ~b.taken;
+        b.expr = b.taken_expr;
+        if (word == "elif") {
+            b.truth = b.truth & condition_truth(ix, rest);
+            b.expr = join_and(b.expr, normalize(rest));
+        }
+    } else if (word == "endif" && !stack.empty()) {
+        stack.pop_back();
+    }
+}
+
+
+void parse_define(Index& ix, std::string_view body, uint32_t line, uint16_t condition)
+{
+    size_t i = 0;
+    while (i < body.size() && is_ident(body[i]))
+        ++i;
+    if (i == 0)
+        return;
+    Define d;
+    d.name = body.substr(0, i);
+    std::string_view rest = body.substr(i);
+    if (!rest.empty() && rest[0] == '(') {
+        size_t close = rest.find(')');
+        rest = close == std::string_view::npos ? std::string_view() : rest.substr(close + 1);
+    }
+    size_t c = comment_start(rest);
+    if (c != std::string_view::npos) {
+        d.comment = trim(rest.substr(c + 2));
+        rest = rest.substr(0, c);
+    }
+    d.value = trim(rest);
+    d.line = line;
+    d.condition = condition;
+    ix.by_macro.emplace(d.name, uint32_t(ix.defines.size()));
+    ix.defines.push_back(d);
+}
+
+bool is_key_value(std::string_view v)
+{
+    return v.size() >= 2 && v.front() == '"' && v.back() == '"';
+}
+
+void build_blocks(Index& ix)
+{
+    std::unordered_map<std::string_view, uint32_t> key_by_macro;
+    for (uint32_t i = 0; i < ix.defines.size(); ++i) {
+        if (!is_key_value(ix.defines[i].value))
+            continue;
+        key_by_macro.emplace(ix.defines[i].name, uint32_t(ix.keys.size()));
+        ix.keys.push_back(KeyBlock{i, 0, 0, 0, 0});
+    }
+
+    // Each define belongs to the key with the longest macro name that is an
+    // "_"-separated prefix of its own name.
+    constexpr uint32_t kNone = 0xffffffff;
+    std::vector<uint32_t> owner(ix.defines.size(), kNone);
+    for (uint32_t i = 0; i < ix.defines.size(); ++i) {
+        if (is_key_value(ix.defines[i].value))
+            continue;
+        std::string_view n = ix.defines[i].name;
+        for (size_t p = n.rfind('_'); p != std::string_view::npos && p > 0; p = n.rfind('_')) {
+            n = n.substr(0, p);
+            auto it = key_by_macro.find(n);
+            if (it != key_by_macro.end()) {
+                owner[i] = it->second;
+                ++ix.keys[it->second].child_count;
+                break;
+            }
+        }
+    }
+    uint32_t next = 0;
+    for (KeyBlock& k : ix.keys) {
+        k.child_begin = next;
+        next += k.child_count;
+        k.child_count = 0;
+    }
+    ix.children.resize(next);
+    for (uint32_t i = 0; i < ix.defines.size(); ++i) {
+        if (owner[i] == kNone)
+            continue;
+        KeyBlock& k = ix.keys[owner[i]];
+        ix.children[k.child_begin + k.child_count++] = i;
+    }
+
+    // A comment run directly above a key documents that key, unless it hangs
+    // off the previous define with no blank line in between - then it is the
+    // "// Type DWORD" trailer of whatever came before. An #if opened right
+    // above the key belongs to the key too.
+    for (KeyBlock& k : ix.keys) {
+        uint32_t l = ix.defines[k.define].line;
+        while (l > 0 && ix.lines[l - 1].kind == LineKind::Directive
+               && trim(ix.text(ix.lines[l - 1])).substr(0, 3) == "#if")
+            --l;
+        uint32_t s = l;
+        while (s > 0 && ix.lines[s - 1].kind == LineKind::Comment)
+            --s;
+        if (s > 0 && s < l && ix.lines[s - 1].kind == LineKind::Define)
+            s = l;
+        k.first_line = s;
+    }
+    for (size_t i = 0; i < ix.keys.size(); ++i)
+        ix.keys[i].last_line = i + 1 < ix.keys.size() ? ix.keys[i + 1].first_line
+                                                       : uint32_t(ix.lines.size());
+}
+
+} // namespace
+
+std::string_view Index::key_name(const KeyBlock& k) const
+{
+    // A few names carry padding ("romOverride\0\0\0"); the registry value
+    // name ends at the first NUL.
+    std::string_view v = defines[k.define].value;
+    v = v.substr(1, v.size() - 2);
+    return v.substr(0, v.find("\\0"));
+}
+
+const Define* Index::find_define(std::string_view macro) const
+{
+    auto it = by_macro.find(macro);
+    return it == by_macro.end() ? nullptr : &defines[it->second];
+}
+
+Index index_header(std::string_view source)
+{
+    Index ix;
+    ix.source = source;
+    // nvRmReg.h averages ~50 bytes a line and one define per two lines.
+    ix.lines.reserve(source.size() / 40 + 1);
+    ix.defines.reserve(source.size() / 80 + 1);
+    ix.by_macro.reserve(source.size() / 80 + 1);
+    ix.conditions.push_back(BuildCondition{{}, TruthTable::all()});
+
+    std::vector<Branch> stack;
+    uint16_t condition = 0;
+    bool in_block = false;
+    size_t pos = 0;
+    uint32_t number = 1;
+    while (pos < source.size()) {
+        size_t nl = nvtools::find_byte(source, '\n', pos);
+        size_t end = nl == std::string_view::npos ? source.size() : nl;
+        size_t next = nl == std::string_view::npos ? source.size() : nl + 1;
+
+        Line line{uint32_t(pos), 0, number++, LineKind::Other};
+        std::string_view t = trim(source.substr(pos, end - pos));
+
+        // Preprocessor lines continue across "\" line ends.
+        if (!in_block && !t.empty() && t[0] == '#') {
+            while (!t.empty() && t.back() == '\\' && next < source.size()) {
+                nl = nvtools::find_byte(source, '\n', next);
+                end = nl == std::string_view::npos ? source.size() : nl;
+                next = nl == std::string_view::npos ? source.size() : nl + 1;
+                t = trim(source.substr(pos, end - pos));
+                ++number;
+            }
+        }
+        if (end > pos && source[end - 1] == '\r')
+            --end;
+        line.end = uint32_t(end);
+
+        uint32_t index = uint32_t(ix.lines.size());
+        if (in_block) {
+            line.kind = LineKind::Comment;
+            in_block = t.find("*/") == std::string_view::npos;
+        } else if (t.empty()) {
+            line.kind = LineKind::Blank;
+        } else if (t.substr(0, 2) == "//") {
+            line.kind = LineKind::Comment;
+        } else if (t.substr(0, 2) == "/*") {
+            line.kind = LineKind::Comment;
+            in_block = t.find("*/", 2) == std::string_view::npos;
+        } else if (t[0] == '#') {
+            std::string_view d = trim(t.substr(1));
+            if (d.substr(0, 6) == "define" && d.size() > 6 && std::isspace(uint8_t(d[6]))) {
+                line.kind = LineKind::Define;
+                parse_define(ix, trim(d.substr(6)), index, condition);
+            } else {
+                line.kind = LineKind::Directive;
+                size_t depth = stack.size();
+                apply_directive(ix, stack, d, source.substr(next));
+                if (stack.size() != depth || d.substr(0, 2) == "el")
+                    condition = intern_condition(ix, stack);
+            }
+        }
+        ix.lines.push_back(line);
+        pos = next;
+    }
+
+    build_blocks(ix);
+    return ix;
+}
+
+std::optional<uint32_t> evaluate(const Index& index, std::string_view expr)
+{
+    return Evaluator(index, expr, 0).run();
+}
+
+std::optional<BitRange> parse_range(std::string_view value)
+{
+    value = trim(value);
+    if (value.size() > 2 && value.front() == '(' && value.back() == ')')
+        value = trim(value.substr(1, value.size() - 2));
+    size_t colon = value.find(':');
+    if (colon == std::string_view::npos)
+        return std::nullopt;
+    std::string_view hs = trim(value.substr(0, colon));
+    std::string_view ls = trim(value.substr(colon + 1));
+    size_t hu = 0, lu = 0;
+    auto hi = parse_number(hs, &hu);
+    auto lo = parse_number(ls, &lu);
+    if (!hi || !lo || hu != hs.size() || lu != ls.size() || *hi < *lo || *hi > 31)
+        return std::nullopt;
+    return BitRange{uint8_t(*hi), uint8_t(*lo)};
+}
+
+std::string_view comment_body(std::string_view line)
+{
+    std::string_view t = trim(line);
+    if (t.substr(0, 2) == "//")
+        t = t.substr(2);
+    else if (t.substr(0, 3) == "/*!")
+        t = t.substr(3);
+    else if (t.substr(0, 2) == "/*")
+        t = t.substr(2);
+    else if (!t.empty() && t[0] == '*' && t.substr(0, 2) != "*/")
+        t = t.substr(1);
+    if (t.size() >= 2 && t.substr(t.size() - 2) == "*/")
+        t = t.substr(0, t.size() - 2);
+    return trim(t);
+}
+
+Variant release_variant(const Index& index)
+{
+    Variant v{0, 0};
+    for (size_t i = 0; i < index.symbols.size() && i < kMaxSymbols; ++i)
+        for (std::string_view s : kDebugOnlySymbols)
+            if (index.symbols[i] == s)
+                v.off |= uint8_t(1u << i);
+    return v;
+}
+
+KeyType declared_type(const Index& index, const KeyBlock& key)
+{
+    for (uint32_t i = key.first_line; i < key.last_line; ++i) {
+        if (index.lines[i].kind != LineKind::Comment)
+            continue;
+        std::string_view b = comment_body(index.text(index.lines[i]));
+        if (!starts_with_nocase(b, "type") || (b.size() > 4 && is_ident(b[4])))
+            continue;
+        b = b.substr(4);
+        while (!b.empty() && (b[0] == ' ' || b[0] == '\t' || b[0] == ':'))
+            b.remove_prefix(1);
+        size_t n = 0;
+        while (n < b.size() && is_ident(b[n]))
+            ++n;
+        std::string_view word = b.substr(0, n);
+        // "DWROD" is a typo the header has three times.
+        if (iequals(word, "dword") || iequals(word, "reg_dword") || iequals(word, "nvbool")
+            || iequals(word, "dwrod"))
+            return KeyType::Dword;
+        if (iequals(word, "binary") || iequals(word, "reg_binary"))
+            return KeyType::Binary;
+        if (iequals(word, "string") || iequals(word, "reg_sz"))
+            return KeyType::String;
+    }
+    return KeyType::Unknown;
+}
+
+std::optional<uint32_t> documented_default(const Index& index, const KeyBlock& key)
+{
+    std::string_view macro = index.key_macro(key);
+    const Define* def = nullptr;
+    const Variant release = release_variant(index);
+    for (uint32_t c = 0; c < key.child_count; ++c) {
+        const Define& d = index.defines[index.children[key.child_begin + c]];
+        if (d.name.size() != macro.size() + 8 || d.name.substr(macro.size()) != "_DEFAULT")
+            continue;
+        const BuildCondition& bc = index.conditions[d.condition];
+        bool live = Condition{bc.expr, bc.truth}.live(release) != Liveness::Never;
+        if (!def || live)
+            def = &d;
+        if (live)
+            break;
+    }
+    if (def)
+        return evaluate(index, def->value);
+
+    for (uint32_t i = key.first_line; i < key.last_line; ++i) {
+        if (index.lines[i].kind != LineKind::Comment)
+            continue;
+        std::string_view b = comment_body(index.text(index.lines[i]));
+        size_t p = find_nocase(b, "(default)");
+        if (p != std::string_view::npos) {
+            if (auto v = first_number(b.substr(0, p)))
+                return v;
+            continue;
+        }
+        p = find_nocase(b, "default");
+        if (p == std::string_view::npos)
+            continue;
+        // "Default is 3", "default value: 0x10", "defaults to 1"
+        std::string_view rest = b.substr(p + 7);
+        for (;;) {
+            rest = trim(rest);
+            if (!rest.empty() && (rest[0] == ':' || rest[0] == '='))
+                rest.remove_prefix(1);
+            else if (starts_with_nocase(rest, "s "))
+                rest.remove_prefix(2);
+            else if (starts_with_nocase(rest, "is ") || starts_with_nocase(rest, "to "))
+                rest.remove_prefix(3);
+            else if (starts_with_nocase(rest, "value "))
+                rest.remove_prefix(6);
+            else
+                break;
+        }
+        size_t used = 0;
+        auto v = parse_number(rest, &used);
+        if (v && (used == rest.size() || !is_ident(rest[used])))
+            return v;
+    }
+    return std::nullopt;
+}
+
+} // namespace rmreg
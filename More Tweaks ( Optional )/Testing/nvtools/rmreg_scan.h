@@ -0,0 +1,127 @@
+// rmreg_scan.h
+//
+// Indexer for nvRmReg.h-style headers. Splits the text into lines, picks out
+// every #define and groups the defines under the registry key they extend:
+//
+//   #define NV_REG_STR_RM_OPTP              "RmOptp"     <- key
+//   #define NV_REG_STR_RM_OPTP_DELAY_4MS    15:8         <- child (field)
+//   #define NV_REG_STR_RM_OPTP_DELAY_4MS_MIN (9)         <- child (field value)
+//
+// It also follows the #if/#ifdef/#else nesting, so every define knows the
+// build variants it exists in.
+//
+// All text in the index is a view into the source buffer, which must outlive
+// the index.
+
+#ifndef NVTOOLS_RMREG_SCAN_H
+#define NVTOOLS_RMREG_SCAN_H
+
+#include "rmreg.h"
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace rmreg {
+
+enum class LineKind : uint8_t {
+    Blank,
+    Comment,        // "//" line, or any line of a /* */ block
+    Define,
+    Directive,      // any other preprocessor line
+    Other,
+};
+
+struct Line {
+    uint32_t begin;             // byte offsets into the source,
+    uint32_t end;               // end excludes the line terminator
+    uint32_t number;            // 1-based line in the file; a "\"-continued
+    LineKind kind;              // directive is one Line starting there
+};
+
+struct Define {
+    std::string_view name;
+    std::string_view value;     // replacement text, trailing comment removed
+    std::string_view comment;   // trailing "//" comment, if any
+    uint32_t line;              // index into Index::lines
+    uint16_t condition;         // index into Index::conditions
+};
+
+// A registry key and its block of the header. The block starts at the key's
+// leading doc comment and runs up to where the next key's block starts.
+struct KeyBlock {
+    uint32_t define;            // index into Index::defines
+    uint32_t child_begin;       // range into Index::children
+    uint32_t child_count;
+    uint32_t first_line;        // [first_line, last_line) into Index::lines
+    uint32_t last_line;
+};
+
+struct BitRange {
+    uint8_t hi;
+    uint8_t lo;
+};
+
+// Every distinct #if nesting in the header, e.g. "NV_VERIF_FEATURES" or
+// "!(defined(DEBUG) || defined(DEVELOP)) && NV_MODS". Two nestings with the
+// same truth table share one entry.
+struct BuildCondition {
+    std::string expr;           // empty for the unconditional entry 0
+    TruthTable truth;
+};
+
+struct Index {
+    std::string_view source;
+    std::vector<Line> lines;
+    std::vector<Define> defines;
+    std::vector<KeyBlock> keys;
+    std::vector<uint32_t> children;     // define indices, grouped by key
+    std::unordered_map<std::string_view, uint32_t> by_macro;   // first define wins
+    std::vector<std::string> symbols;   // config symbols, bit i of a TruthTable
+    std::vector<BuildCondition> conditions;
+
+    std::string_view text(const Line& l) const
+    {
+        return source.substr(l.begin, l.end - l.begin);
+    }
+    const Define& key_define(const KeyBlock& k) const { return defines[k.define]; }
+    std::string_view key_macro(const KeyBlock& k) const { return defines[k.define].name; }
+    std::string_view key_name(const KeyBlock& k) const;
+    const Define* find_define(std::string_view macro) const;
+    const BuildCondition& key_condition(const KeyBlock& k) const
+    {
+        return conditions[defines[k.define].condition];
+    }
+};
+
+// One pass over the text. Apart from growing the result vectors (sized up
+// front from the text length) nothing is allocated per line.
+Index index_header(std::string_view source);
+
+// Evaluates a define's replacement text as a 32-bit constant. Understands
+// integer literals, other defines, NVBIT(n), parentheses, ~, |, &, *, +, -
+// and <<, which covers everything the header uses for values.
+std::optional<uint32_t> evaluate(const Index& index, std::string_view expr);
+
+// Parses a DRF "hi:lo" field range.
+std::optional<BitRange> parse_range(std::string_view value);
+
+// Text of a comment line with the comment markers and leading "*" removed.
+std::string_view comment_body(std::string_view line);
+
+// A retail driver: DEBUG, DEVELOP, QA_BUILD, NV_MODS and NV_VERIF_FEATURES
+// off, RMCFG_* feature switches free.
+Variant release_variant(const Index& index);
+
+KeyType declared_type(const Index& index, const KeyBlock& key);
+
+// When the header defines the default under #if/#else, the one a release
+// driver sees wins.
+std::optional<uint32_t> documented_default(const Index& index, const KeyBlock& key);
+
+} // namespace rmreg
+
+#endif // NVTOOLS_RMREG_SCAN_H
@@ -0,0 +1,31 @@
+/*
+ * nvrm_registry.h (stub)
+ *
+ * The published registry keys live in nvrm_registry.h, which is not in this
+ * repo. nvRmReg.h refers to a few of its values by name. The stub defines
+ * those values so that the macros that use them expand to numbers.
+ */
+
+#ifndef NVRM_REGISTRY_H
+#define NVRM_REGISTRY_H
+
+/*
+ * The per-structure NV_REG_STR_RM_INST_LOC_* fields are 2 bits each. The
+ * values follow from NV_REG_STR_RM_INST_LOC_ALL_COH (0x55555555),
+ * _ALL_NCOH (0xAAAAAAAA) and _ALL_VID (0xFFFFFFFF).
+ */
+#define NV_REG_STR_RM_INST_LOC_DEFAULT      (0x00000000)
+#define NV_REG_STR_RM_INST_LOC_COH          (0x00000001)
+#define NV_REG_STR_RM_INST_LOC_NCOH         (0x00000002)
+#define NV_REG_STR_RM_INST_LOC_VID          (0x00000003)
+
+/*
+ * Used by the RmOverrideUprocEngineArch fields. Only _DEFAULT = 0 is
+ * certain, because an all-zero DWORD means no override. The others only need
+ * to be distinct.
+ */
+#define NV_UPROC_ENGINE_ARCH_DEFAULT        (0x00000000)
+#define NV_UPROC_ENGINE_ARCH_FALCON         (0x00000001)
+#define NV_UPROC_ENGINE_ARCH_FALCON_RISCV   (0x00000002)
+
+#endif /* NVRM_REGISTRY_H */
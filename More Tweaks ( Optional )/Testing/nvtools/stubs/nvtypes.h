@@ -0,0 +1,47 @@
+/*
+ * nvtypes.h (stub)
+ *
+ * nvRmReg.h includes nvtypes.h from the driver tree, which is not in this
+ * repo. The macros in nvRmReg.h only use NVBIT and the NVOS_IS_* flags from
+ * it, so this stub is enough to include the header as it is:
+ *
+ *   g++ -I"../nvtools/stubs" ...
+ *
+ * The guard is the real header's, so a real nvtypes.h earlier on the include
+ * path wins.
+ */
+
+#ifndef NVTYPES_INCLUDED
+#define NVTYPES_INCLUDED
+
+#include <stdint.h>
+
+typedef uint8_t  NvU8;
+typedef uint16_t NvU16;
+typedef uint32_t NvU32;
+typedef uint64_t NvU64;
+typedef int8_t   NvS8;
+typedef int16_t  NvS16;
+typedef int32_t  NvS32;
+typedef int64_t  NvS64;
+typedef uint8_t  NvBool;
+
+#define NV_TRUE   ((NvBool)(0 == 0))
+#define NV_FALSE  ((NvBool)(0 != 0))
+
+#define NVBIT(b)    (1U << (b))
+#define NVBIT64(b)  (1ULL << (b))
+
+/* The real tree gets these from cpuopsys.h. */
+#if defined(_WIN32)
+#define NVOS_IS_WINDOWS    1
+#else
+#define NVOS_IS_WINDOWS    0
+#endif
+#if defined(__APPLE__)
+#define NVOS_IS_MACINTOSH  1
+#else
+#define NVOS_IS_MACINTOSH  0
+#endif
+
+#endif /* NVTYPES_INCLUDED */
@@ -0,0 +1,156 @@
+// text_util.h
+//
+// The ASCII text helpers every tool uses: case folding, trimming, hex
+// digits, an edit distance for "did you mean" hints, and fail() for the
+// std::string* why out-parameters. Case folds to lower case, as registry
+// names always have in rmreg.h; the nvapi join index and snapshot hash names
+// folded the same way.
+
+#ifndef NVTOOLS_TEXT_UTIL_H
+#define NVTOOLS_TEXT_UTIL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace nvtools {
+
+constexpr char fold(char c)
+{
+    return (c >= 'A' && c <= 'Z') ? char(c - 'A' + 'a') : c;
+}
+
+constexpr bool iequals(std::string_view a, std::string_view b)
+{
+    if (a.size() != b.size())
+        return false;
+    for (size_t i = 0; i < a.size(); ++i)
+        if (fold(a[i]) != fold(b[i]))
+            return false;
+    return true;
+}
+
+inline std::string folded(std::string_view s)
+{
+    std::string out(s);
+    for (char& c : out)
+        c = fold(c);
+    return out;
+}
+
+constexpr bool starts_with(std::string_view s, std::string_view prefix)
+{
+    return s.substr(0, prefix.size()) == prefix;
+}
+
+constexpr bool ends_with(std::string_view s, std::string_view suffix)
+{
+    return s.size() >= suffix.size() && s.substr(s.size() - suffix.size()) == suffix;
+}
+
+constexpr bool starts_with_nocase(std::string_view s, std::string_view prefix)
+{
+    return s.size() >= prefix.size() && iequals(s.substr(0, prefix.size()), prefix);
+}
+
+constexpr bool ends_with_nocase(std::string_view s, std::string_view suffix)
+{
+    return s.size() >= suffix.size() && iequals(s.substr(s.size() - suffix.size()), suffix);
+}
+
+// Spaces, tabs and line ends; not the locale's idea of space.
+constexpr bool is_space(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\v' || c == '\f';
+}
+
+constexpr std::string_view trim(std::string_view s)
+{
+    while (!s.empty() && is_space(s.front()))
+        s.remove_prefix(1);
+    while (!s.empty() && is_space(s.back()))
+        s.remove_suffix(1);
+    return s;
+}
+
+constexpr int hex_digit(char c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    return -1;
+}
+
+// "0x" and one to sixteen hex digits, nothing around them.
+constexpr bool parse_hex(std::string_view s, uint64_t& out)
+{
+    if (s.size() < 3 || s.size() > 18 || s[0] != '0' || (s[1] != 'x' && s[1] != 'X'))
+        return false;
+    uint64_t v = 0;
+    for (char c : s.substr(2)) {
+        int d = hex_digit(c);
+        if (d < 0)
+            return false;
+        v = v << 4 | uint64_t(d);
+    }
+    out = v;
+    return true;
+}
+
+// Levenshtein distance with a transposition counted as one edit, or
+// limit + 1 once it is sure to be over limit. Allocates only for b longer
+// than 64 characters.
+inline size_t edit_distance(std::string_view a, std::string_view b, size_t limit)
+{
+    if ((a.size() > b.size() ? a.size() - b.size() : b.size() - a.size()) > limit)
+        return limit + 1;
+    constexpr size_t kShort = 64;
+    size_t stack[3][kShort + 1];
+    std::vector<size_t> heap;
+    size_t* prev2 = stack[0];
+    size_t* prev = stack[1];
+    size_t* cur = stack[2];
+    if (b.size() > kShort) {
+        heap.resize(3 * (b.size() + 1));
+        prev2 = heap.data();
+        prev = prev2 + b.size() + 1;
+        cur = prev + b.size() + 1;
+    }
+    for (size_t j = 0; j <= b.size(); ++j)
+        prev[j] = j;
+    for (size_t i = 1; i <= a.size(); ++i) {
+        cur[0] = i;
+        size_t row_min = cur[0];
+        for (size_t j = 1; j <= b.size(); ++j) {
+            size_t d = std::min({prev[j] + 1, cur[j - 1] + 1, prev[j - 1] + (a[i - 1] != b[j - 1])});
+            if (i > 1 && j > 1 && a[i - 1] == b[j - 2] && a[i - 2] == b[j - 1])
+                d = std::min(d, prev2[j - 2] + 1);
+            cur[j] = d;
+            row_min = std::min(row_min, d);
+        }
+        if (row_min > limit)
+            return limit + 1;
+        std::swap(prev2, prev);
+        std::swap(prev, cur);
+    }
+    return std::min(prev[b.size()], limit + 1);
+}
+
+// Sets *why, if there is one, and returns false.
+inline bool fail(std::string* why, std::string reason)
+{
+    if (why)
+        *why = std::move(reason);
+    return false;
+}
+
+} // namespace nvtools
+
+#endif // NVTOOLS_TEXT_UTIL_H
@@ -0,0 +1,124 @@
+// utf16.cpp
+
+#include "utf16.h"
+
+#include "byte_scan.h"
+
+#include <cstdint>
+
+namespace nvtools {
+
+bool utf16le_to_utf8(std::string_view in, std::string& out)
+{
+    const unsigned char* p = reinterpret_cast<const unsigned char*>(in.data());
+    size_t n = in.size() / 2;
+    // Three bytes per unit at most (a pair is two units and four bytes), so
+    // write through a pointer and trim afterwards.
+    size_t base = out.size();
+    out.resize(base + 3 * n);
+    char* o = &out[0] + base;
+    auto unit = [&](size_t i) { return uint32_t(p[2 * i]) | uint32_t(p[2 * i + 1]) << 8; };
+
+    size_t i = 0;
+    while (i < n) {
+#if defined(NVTOOLS_SSE2)
+        const __m128i high = _mm_set1_epi16(short(0xff80));
+        const __m128i zero = _mm_setzero_si128();
+        for (; i + 8 <= n; i += 8) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 2 * i));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(v, high), zero)) != 0xffff)
+                break;
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(o), _mm_packus_epi16(v, v));
+            o += 8;
+        }
+        if (i >= n)
+            break;
+#endif
+        uint32_t c = unit(i++);
+        if (c < 0x80) {
+            *o++ = char(c);
+            continue;
+        }
+        if (c >= 0xd800 && c < 0xdc00 && i < n && unit(i) >= 0xdc00 && unit(i) < 0xe000)
+            c = 0x10000 + ((c - 0xd800) << 10) + (unit(i++) - 0xdc00);
+        if (c < 0x800) {
+            *o++ = char(0xc0 | c >> 6);
+        } else if (c < 0x10000) {
+            *o++ = char(0xe0 | c >> 12);
+            *o++ = char(0x80 | (c >> 6 & 0x3f));
+        } else {
+            *o++ = char(0xf0 | c >> 18);
+            *o++ = char(0x80 | (c >> 12 & 0x3f));
+            *o++ = char(0x80 | (c >> 6 & 0x3f));
+        }
+        *o++ = char(0x80 | (c & 0x3f));
+    }
+    out.resize(size_t(o - out.data()));
+    return in.size() % 2 == 0;
+}
+
+bool utf8_to_utf16le(std::string_view in, std::string& out)
+{
+    const unsigned char* p = reinterpret_cast<const unsigned char*>(in.data());
+    size_t n = in.size();
+    size_t base = out.size();
+    out.resize(base + 2 * n);   // a unit per byte at most
+    char* o = &out[0] + base;
+    auto put = [&](uint32_t u) {
+        *o++ = char(u & 0xff);
+        *o++ = char(u >> 8);
+    };
+    auto tail = [&](size_t i) { return i < n && (p[i] & 0xc0) == 0x80; };
+
+    size_t i = 0;
+    bool ok = true;
+    while (i < n) {
+#if defined(NVTOOLS_SSE2)
+        const __m128i zero = _mm_setzero_si128();
+        for (; i + 16 <= n; i += 16) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+            if (_mm_movemask_epi8(v))
+                break;
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(o), _mm_unpacklo_epi8(v, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(o + 16), _mm_unpackhi_epi8(v, zero));
+            o += 32;
+        }
+        if (i >= n)
+            break;
+#endif
+        uint32_t c = p[i];
+        if (c < 0x80) {
+            put(c);
+            ++i;
+        } else if (c >= 0xc2 && c < 0xe0 && tail(i + 1)) {
+            put((c & 0x1f) << 6 | (p[i + 1] & 0x3f));
+            i += 2;
+        } else if (c >= 0xe0 && c < 0xf0 && tail(i + 1) && tail(i + 2)) {
+            uint32_t u = (c & 0x0f) << 12 | uint32_t(p[i + 1] & 0x3f) << 6 | (p[i + 2] & 0x3f);
+            if (u < 0x800) {
+                ok = false;
+                break;
+            }
+            put(u);             // surrogates included, see utf16.h
+            i += 3;
+        } else if (c >= 0xf0 && c < 0xf5 && tail(i + 1) && tail(i + 2) && tail(i + 3)) {
+            uint32_t u = (c & 0x07) << 18 | uint32_t(p[i + 1] & 0x3f) << 12 | uint32_t(p[i + 2] & 0x3f) << 6
+                | (p[i + 3] & 0x3f);
+            if (u < 0x10000 || u > 0x10ffff) {
+                ok = false;
+                break;
+            }
+            u -= 0x10000;
+            put(0xd800 + (u >> 10));
+            put(0xdc00 + (u & 0x3ff));
+            i += 4;
+        } else {
+            ok = false;
+            break;
+        }
+    }
+    out.resize(size_t(o - out.data()));
+    return ok;
+}
+
+} // namespace nvtools
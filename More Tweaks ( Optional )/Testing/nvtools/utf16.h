@@ -0,0 +1,31 @@
+// utf16.h
+//
+// UTF-16LE <-> UTF-8 for the files Windows tools save as "Unicode", such as
+// nvidiaProfileInspector's .nip exports. Those are nearly all ASCII, so both
+// directions take runs of ASCII 8 or 16 units at a time with SSE2
+// (byte_scan.h's rule: every x86-64 target has it, no runtime dispatch) and
+// only drop to one code point at a time for the rest.
+//
+// A lone surrogate, which UTF-16 files do contain now and then, becomes its
+// own 3-byte sequence (WTF-8) instead of an error, so converting back gives
+// the same bytes.
+
+#ifndef NVTOOLS_UTF16_H
+#define NVTOOLS_UTF16_H
+
+#include <string>
+#include <string_view>
+
+namespace nvtools {
+
+// Appends in, little-endian UTF-16 without a BOM, to out as UTF-8. False if
+// in has an odd number of bytes; out then has the whole units before it.
+bool utf16le_to_utf8(std::string_view in, std::string& out);
+
+// Appends in to out as little-endian UTF-16. False at the first byte that
+// is not (WTF-)UTF-8; out then has everything before it.
+bool utf8_to_utf16le(std::string_view in, std::string& out);
+
+} // namespace nvtools
+
+#endif // NVTOOLS_UTF16_H
@@ -0,0 +1,115 @@
+// work_steal.h
+//
+// A small work-stealing loop for splitting one job into independent pieces:
+//
+//   nvtools::parallel_for(chunks.size(), threads, [&](size_t i) { parse(chunks[i]); });
+//
+// Each thread starts with an equal share of the indices and takes them from
+// the front. A thread that runs out steals the back half of the fullest
+// share it can find, so a few slow pieces don't leave the other threads
+// idle. The calling thread is one of the workers; threads <= 1 runs
+// everything on it, in order.
+
+#ifndef NVTOOLS_WORK_STEAL_H
+#define NVTOOLS_WORK_STEAL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace nvtools {
+
+// Threads to use when the caller says 0: one per core.
+inline unsigned default_threads()
+{
+    unsigned n = std::thread::hardware_concurrency();
+    return n ? n : 1;
+}
+
+template <class Fn>
+void parallel_for(size_t count, unsigned threads, Fn&& fn)
+{
+    if (threads == 0)
+        threads = default_threads();
+    threads = unsigned(std::min<size_t>(threads, count));
+    if (threads <= 1) {
+        for (size_t i = 0; i < count; ++i)
+            fn(i);
+        return;
+    }
+
+    struct Share {
+        std::mutex lock;
+        size_t next;
+        size_t end;
+    };
+    std::unique_ptr<Share[]> shares(new Share[threads]);
+    for (unsigned t = 0; t < threads; ++t) {
+        shares[t].next = count * t / threads;
+        shares[t].end = count * (t + 1) / threads;
+    }
+
+    auto work = [&](unsigned self) {
+        Share& mine = shares[self];
+        for (;;) {
+            // Whether i is ours is settled under the lock: a thief moves
+            // mine.end down under it, and i past the new end is the thief's.
+            size_t i;
+            bool have;
+            {
+                std::lock_guard<std::mutex> g(mine.lock);
+                have = mine.next < mine.end;
+                i = mine.next;
+                if (have)
+                    ++mine.next;
+            }
+            if (have) {
+                fn(i);
+                continue;
+            }
+            // Out of work: take the back half of the largest other share.
+            unsigned victim = self;
+            size_t most = 0;
+            for (unsigned t = 0; t < threads; ++t) {
+                if (t == self)
+                    continue;
+                std::lock_guard<std::mutex> g(shares[t].lock);
+                size_t left = shares[t].end - shares[t].next;
+                if (left > most) {
+                    most = left;
+                    victim = t;
+                }
+            }
+            if (victim == self)
+                return;
+            size_t begin, end;
+            {
+                std::lock_guard<std::mutex> g(shares[victim].lock);
+                size_t left = shares[victim].end - shares[victim].next;
+                if (left == 0)
+                    continue;
+                end = shares[victim].end;
+                begin = end - (left + 1) / 2;
+                shares[victim].end = begin;
+            }
+            std::lock_guard<std::mutex> g(mine.lock);
+            mine.next = begin;
+            mine.end = end;
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(threads - 1);
+    for (unsigned t = 1; t < threads; ++t)
+        pool.emplace_back(work, t);
+    work(0);
+    for (std::thread& th : pool)
+        th.join();
+}
+
+} // namespace nvtools
+
+#endif // NVTOOLS_WORK_STEAL_H